@@ -207,11 +207,13 @@ rst_files = [
     "geopm_prof.3",
     "geopmpy.7",
     "geopmread.1",
+    "geopmreport.1",
     "geopm_report.7",
     "geopm_sched.3",
     "geopmsession.1",
     "geopm_time.3",
     "geopm_topo.3",
+    "geopmtrace.1",
     "geopm_version.3",
     "geopmwrite.1",
 ]
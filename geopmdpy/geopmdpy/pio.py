@@ -43,6 +43,10 @@ int geopm_pio_read_signal(const char *signal_name,
                           int domain_idx,
                           double *result);
 
+int geopm_pio_read_signals(int num_request,
+                           const struct geopm_request_s *requests,
+                           double *result);
+
 int geopm_pio_write_control(const char *control_name,
                             int domain_type,
                             int domain_idx,
@@ -59,6 +63,10 @@ int geopm_pio_push_control(const char *control_name,
 int geopm_pio_sample(int signal_idx,
                      double *result);
 
+int geopm_pio_sample_array(int signal_idx_begin,
+                           int num_signal,
+                           double *result);
+
 int geopm_pio_adjust(int control_idx,
                      double setting);
 
@@ -96,6 +104,16 @@ int geopm_pio_start_batch_server(int client_pid,
                                  int key_size,
                                  char *server_key);
 
+int geopm_pio_start_batch_server_sampling(int client_pid,
+                                          int num_signal,
+                                          const struct geopm_request_s *signal_config,
+                                          int num_control,
+                                          const struct geopm_request_s *control_config,
+                                          double sample_period,
+                                          int *server_pid,
+                                          int key_size,
+                                          char *server_key);
+
 int geopm_pio_stop_batch_server(int server_pid);
 
 int geopm_pio_format_signal(double signal,
@@ -238,6 +256,38 @@ def read_signal(signal_name, domain_type, domain_idx):
         raise RuntimeError('geopm_pio_read_signal() failed: {}'.format(error.message(err)))
     return result_cdbl[0]
 
+def read_signals(requests):
+    """Read a list of signal values from the platform.
+
+    Equivalent to calling read_signal() for each request, but
+    requests for signals in their native domain that are provided by
+    the same IOGroup are read together in one operation.
+
+    Args:
+        requests (list((str, int or str, int))): List of (signal_name,
+            domain_type, domain_idx) tuples in the form of the
+            arguments to read_signal().
+
+    Returns:
+        list(float): The value of each signal in SI units in request
+            order.
+
+    """
+    global _dl
+    num_request = len(requests)
+    if num_request == 0:
+        return []
+    requests_carr = gffi.gffi.new(f'struct geopm_request_s[{num_request}]')
+    for idx, req in enumerate(requests):
+        requests_carr[idx].name = req[0].encode()
+        requests_carr[idx].domain = topo.domain_type(req[1])
+        requests_carr[idx].domain_idx = req[2]
+    result_carr = gffi.gffi.new(f'double[{num_request}]')
+    err = _dl.geopm_pio_read_signals(num_request, requests_carr, result_carr)
+    if err < 0:
+        raise RuntimeError('geopm_pio_read_signals() failed: {}'.format(error.message(err)))
+    return list(result_carr)
+
 def write_control(control_name, domain_type, domain_idx, setting):
     """Write a control value to the platform.
 
@@ -363,6 +413,32 @@ def sample(signal_idx):
         raise RuntimeError('geopm_pio_sample() failed: {}'.format(error.message(err)))
     return result_cdbl[0]
 
+def sample_array(signal_idx_begin, num_signal):
+    """Sample a contiguous range of pushed signals.
+
+    Equivalent to calling sample() for each signal index from
+    signal_idx_begin up to signal_idx_begin + num_signal, but the
+    values are copied with a single call into the library.
+
+    Args:
+        signal_idx_begin (int): Index returned by push_signal() for
+            the first signal in the range.
+        num_signal (int): Number of signals in the range.
+
+    Returns:
+        list(float): Values of the signals read when read_batch()
+            function was last called in push order.
+
+    """
+    global _dl
+    if num_signal == 0:
+        return []
+    result_carr = gffi.gffi.new(f'double[{num_signal}]')
+    err = _dl.geopm_pio_sample_array(signal_idx_begin, num_signal, result_carr)
+    if err < 0:
+        raise RuntimeError('geopm_pio_sample_array() failed: {}'.format(error.message(err)))
+    return list(result_carr)
+
 def adjust(control_idx, setting):
     """Updates the cached value of a single control.
 
@@ -566,7 +642,7 @@ def signal_info(signal_name):
         raise RuntimeError('geopm_pio_signal_info() failed: {}'.format(error.message(err)))
     return (aggregation_type[0], format_type[0], behavior_type[0])
 
-def start_batch_server(client_pid, signal_config, control_config):
+def start_batch_server(client_pid, signal_config, control_config, sample_period=0.0):
     """Start a batch server to interface with a client thread
 
     Create a new process to interact with the client thread using the
@@ -591,6 +667,11 @@ def start_batch_server(client_pid, signal_config, control_config):
             controls where each tuple represents
             (domain_type, domain_idx, control_name).
 
+        sample_period (float): If non-zero, the server reads all of
+            the signals at this interval in seconds and publishes
+            them to shared memory, and clients read the latest
+            values without making a request of the server.
+
     Returns:
         tuple(int, str): The server PID and the string key used by the
                          client thread to initiate the GEOPM batch
@@ -624,16 +705,17 @@ def start_batch_server(client_pid, signal_config, control_config):
 
     server_pid_c = gffi.gffi.new('int *')
     server_key_cstr = gffi.gffi.new('char [255]')
-    err = _dl.geopm_pio_start_batch_server(client_pid,
-                                           num_signal,
-                                           signal_config_carr,
-                                           num_control,
-                                           control_config_carr,
-                                           server_pid_c,
-                                           255,
-                                           server_key_cstr)
+    err = _dl.geopm_pio_start_batch_server_sampling(client_pid,
+                                                    num_signal,
+                                                    signal_config_carr,
+                                                    num_control,
+                                                    control_config_carr,
+                                                    sample_period,
+                                                    server_pid_c,
+                                                    255,
+                                                    server_key_cstr)
     if err < 0:
-        raise RuntimeError('geopm_pio_start_batch_server() failed: {}'.format(error.message(err)))
+        raise RuntimeError('geopm_pio_start_batch_server_sampling() failed: {}'.format(error.message(err)))
     server_pid = server_pid_c[0]
     server_key = gffi.gffi.string(server_key_cstr).decode()
     return server_pid, server_key
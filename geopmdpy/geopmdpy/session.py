@@ -309,7 +309,7 @@ class Session:
     def run(self, run_time, period, pid, print_header,
             request_stream=sys.stdin, out_stream=sys.stdout,
             report_path=None, session_io=None, delimiter=',', report_format='yaml',
-            report_samples=None):
+            report_samples=None, report_quantiles=False):
         """"Create a GEOPM session with values parsed from the command line
 
         The implementation for the geopmsession command line tool.
@@ -351,6 +351,10 @@ class Session:
             report_samples (int): If not None, enable periodic reporting after
                                   this many samples.
 
+            report_quantiles (bool): If True, reports include estimates of the
+                                     median, 90th and 99th percentiles of each
+                                     signal.
+
         """
         global g_session_handler
         if session_io is not None:
@@ -368,7 +372,8 @@ class Session:
         if out_stream is not None and print_header:
             header_names = self.header_names(signal_config)
             print(self._delimiter.join(header_names), file=out_stream)
-        with stats.Collector(signal_config) if do_stats else nullcontext() as stats_collector:
+        quantile_config = range(len(signal_config)) if report_quantiles else None
+        with stats.Collector(signal_config, quantile_config) if do_stats else nullcontext() as stats_collector:
             report_stream = None
             if do_stats:
                 report_stream = _ReportStream(stats_collector, session_io, print_header, delimiter, report_format)
@@ -596,6 +601,8 @@ def get_parser():
                         help='Format for report: "csv" or "yaml".  Default: %(default)s.')
     parser.add_argument('-s', '--report-samples', dest='report_samples', type=int, default=None,
                         help='Create reports each time the specified number of periods have elapsed')
+    parser.add_argument('-q', '--report-quantiles', dest='report_quantiles', action='store_true',
+                        help='Include estimates of the median, 90th and 99th percentiles of each signal in reports.')
     return parser
 
 def main():
@@ -628,7 +635,8 @@ def main():
         sess = Session(args.delimiter)
         sess.run(run_time=args.time, period=args.period, pid=args.pid, print_header=not args.no_header,
                  request_stream=None, out_stream=trace_out, report_path=None, session_io=session_io,
-                 report_format=args.report_format, delimiter=args.delimiter, report_samples=args.report_samples)
+                 report_format=args.report_format, delimiter=args.delimiter, report_samples=args.report_samples,
+                 report_quantiles=args.report_quantiles)
     except RuntimeError as ee:
         if 'GEOPM_DEBUG' in os.environ:
             # Do not handle exception if GEOPM_DEBUG is set
@@ -36,6 +36,13 @@ enum geopm_metric_stats_e {
     GEOPM_NUM_METRIC_STATS
 };
 
+enum geopm_metric_quantile_e {
+    GEOPM_METRIC_QUANTILE_P50,
+    GEOPM_METRIC_QUANTILE_P90,
+    GEOPM_METRIC_QUANTILE_P99,
+    GEOPM_NUM_METRIC_QUANTILE
+};
+
 struct geopm_metric_stats_s {
     char name[255];
     double stats[7];
@@ -49,9 +56,16 @@ struct geopm_report_s {
     struct geopm_metric_stats_s *metric_stats;
 };
 
+struct geopm_metric_quantile_s {
+    double quantile[3];
+};
+
 int geopm_stats_collector_create(size_t num_requests, const struct geopm_request_s *requests,
                                  struct geopm_stats_collector_s **collector);
 
+int geopm_stats_collector_enable_quantile(struct geopm_stats_collector_s *collector,
+                                          size_t request_idx);
+
 int geopm_stats_collector_update(struct geopm_stats_collector_s *collector);
 
 int geopm_stats_collector_update_count(const struct geopm_stats_collector_s *collector,
@@ -63,6 +77,10 @@ int geopm_stats_collector_report_yaml(const struct geopm_stats_collector_s *coll
 int geopm_stats_collector_report(const struct geopm_stats_collector_s *collector,
                                  size_t num_requests, struct geopm_report_s *report);
 
+int geopm_stats_collector_report_quantile(const struct geopm_stats_collector_s *collector,
+                                          size_t num_requests,
+                                          struct geopm_metric_quantile_s *quantiles);
+
 int geopm_stats_collector_reset(struct geopm_stats_collector_s *collector);
 
 int geopm_stats_collector_free(struct geopm_stats_collector_s *collector);
@@ -83,12 +101,16 @@ METRIC_MAX = _dl.GEOPM_METRIC_MAX
 METRIC_MEAN = _dl.GEOPM_METRIC_MEAN
 METRIC_STD = _dl.GEOPM_METRIC_STD
 NUM_METRIC_STATS = _dl.GEOPM_NUM_METRIC_STATS
+METRIC_QUANTILE_P50 = _dl.GEOPM_METRIC_QUANTILE_P50
+METRIC_QUANTILE_P90 = _dl.GEOPM_METRIC_QUANTILE_P90
+METRIC_QUANTILE_P99 = _dl.GEOPM_METRIC_QUANTILE_P99
+NUM_METRIC_QUANTILE = _dl.GEOPM_NUM_METRIC_QUANTILE
 
 class Collector:
     """ Object for aggregating statistics gathered from the PlatformIO interface of GEOPM
 
     """
-    def __init__(self, signal_config):
+    def __init__(self, signal_config, quantile_config=None):
         """Create stats collector
 
         Provide a list of read requests for PlatformIO.
@@ -98,6 +120,12 @@ class Collector:
                 signals where each tuple represents
                 (signal_name, domain_type, domain_idx).
 
+            quantile_config (list(int)): Indices into signal_config of the
+                requests that also report estimates of the median, 90th and
+                99th percentiles ('p50', 'p90' and 'p99').  The estimates are
+                within 1% of a sampled value and use bounded memory.
+                Default: no quantile estimates.
+
         """
         global _dl
         self._collector_ptr = None
@@ -117,6 +145,14 @@ class Collector:
         if err < 0:
             raise RuntimeError('geopm_stats_collector_create() failed: {}'.format(error.message(err)))
         self._collector_ptr = collector_ptr[0];
+        self._quantile_idx = set()
+        if quantile_config is not None:
+            for request_idx in quantile_config:
+                err = _dl.geopm_stats_collector_enable_quantile(self._collector_ptr, request_idx)
+                if err < 0:
+                    self.close()
+                    raise RuntimeError('geopm_stats_collector_enable_quantile() failed: {}'.format(error.message(err)))
+                self._quantile_idx.add(request_idx)
 
     def __enter__(self):
         """Enter context management for allocated geopm_stats_collector_s
@@ -223,6 +259,12 @@ class Collector:
         err = _dl.geopm_stats_collector_report(self._collector_ptr, self._num_signal, report_ptr)
         if err < 0:
             raise RuntimeError('geopm_stats_collector_report() failed: {}'.format(error.message(err)))
+        metric_quantile = None
+        if self._quantile_idx:
+            metric_quantile = gffi.gffi.new('struct geopm_metric_quantile_s[]', self._num_signal)
+            err = _dl.geopm_stats_collector_report_quantile(self._collector_ptr, self._num_signal, metric_quantile)
+            if err < 0:
+                raise RuntimeError('geopm_stats_collector_report_quantile() failed: {}'.format(error.message(err)))
         result = dict()
         result['host'] = gffi.gffi.string(report_ptr.host).decode()
         result['sample-time-first'] = gffi.gffi.string(report_ptr.sample_time_first).decode()
@@ -240,6 +282,10 @@ class Collector:
                                        "max": report_ptr.metric_stats[metric_idx].stats[METRIC_MAX],
                                        "mean": report_ptr.metric_stats[metric_idx].stats[METRIC_MEAN],
                                        "std": report_ptr.metric_stats[metric_idx].stats[METRIC_STD]}
+            if metric_idx in self._quantile_idx:
+                result['metrics'][name].update({"p50": metric_quantile[metric_idx].quantile[METRIC_QUANTILE_P50],
+                                                "p90": metric_quantile[metric_idx].quantile[METRIC_QUANTILE_P90],
+                                                "p99": metric_quantile[metric_idx].quantile[METRIC_QUANTILE_P99]})
         return result
 
     def report_csv(self, delimiter=',', print_header=True):
@@ -295,9 +341,8 @@ class Collector:
         header = ['host', 'sample-time-first', 'sample-time-total', 'sample-count', 'sample-period-mean', 'sample-period-std']
         data = [report[kk] for kk in header]
 
-        metric_stat_names = ['count', 'first', 'last', 'min', 'max', 'mean', 'std']
         for metric_name in sorted(report['metrics'].keys()):
-            for stat_name in metric_stat_names:
+            for stat_name in report['metrics'][metric_name]:
                 header.append(f'{metric_name}-{stat_name}')
                 data.append(report['metrics'][metric_name][stat_name])
         return header, data
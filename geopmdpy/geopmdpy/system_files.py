@@ -56,10 +56,42 @@ GEOPM_SERVICE_CONFIG_PATH_PERM = 0o700
 
 """
 
+GEOPM_RECORD_LOG_MAX_RECORD = 1024
+"""Default and minimum number of records in each bank of the
+application record log
+
+"""
+
 class InvalidClientError(Exception):
     def __init__(self, message):
         super().__init__(message)
 
+def get_record_log_max_record():
+    """Get the capacity of the application record log
+
+    The number of records in each bank of the shared memory record
+    log created for each profiled process.  It may be raised from
+    GEOPM_RECORD_LOG_MAX_RECORD with the environment variable of the
+    same name for applications that emit bursts of region events.
+    Invalid or smaller values are ignored with a warning.
+
+    Returns:
+        int: Number of records in each bank
+
+    """
+    result = GEOPM_RECORD_LOG_MAX_RECORD
+    value = os.environ.get('GEOPM_RECORD_LOG_MAX_RECORD')
+    if value is not None:
+        try:
+            result = int(value)
+        except ValueError:
+            result = -1
+        if result < GEOPM_RECORD_LOG_MAX_RECORD:
+            sys.stderr.write(f'Warning: <geopm-service> Invalid GEOPM_RECORD_LOG_MAX_RECORD: "{value}", '
+                             f'using {GEOPM_RECORD_LOG_MAX_RECORD}\n')
+            result = GEOPM_RECORD_LOG_MAX_RECORD
+    return result
+
 @lru_cache(None)
 def get_config_path():
     """Get the GEOPM config path, which may be a legacy path from earlier GEOPM
@@ -410,6 +442,7 @@ class ActiveSessions(object):
         self._session_schema = json.loads(schemas.GEOPM_ACTIVE_SESSIONS_SCHEMA)
         self._profiles = dict()
         self._region_names = dict()
+        self._record_log_max_record = get_record_log_max_record()
         secure_make_dirs(self._RUN_PATH,
                          perm_mode=GEOPM_SERVICE_RUN_PATH_PERM)
 
@@ -840,7 +873,12 @@ class ActiveSessions(object):
         else:
             self._profiles[profile_name] = {client_pid}
         self._sessions[client_pid]['profile_name'] = profile_name
-        size = 57384
+        # Matches ApplicationRecordLog::buffer_size(max_record): a 64
+        # byte header and two banks, each with a 16 byte header,
+        # max_record 32 byte records and max_record + 1 24 byte short
+        # regions.  The capacity is derived from the size.
+        max_record = self._record_log_max_record
+        size = 64 + 2 * (16 + 32 * max_record + 24 * (max_record + 1))
         shmem.create_prof('record-log', size, client_pid, uid, gid)
         self._update_session_file(client_pid)
 
@@ -18,6 +18,7 @@ with mock.patch('cffi.FFI.dlopen', return_value=mock.MagicMock()):
     from geopmdpy.system_files import ActiveSessions
     from geopmdpy.system_files import GEOPM_SERVICE_RUN_PATH_PERM
     from geopmdpy.system_files import InvalidClientError
+    from geopmdpy.system_files import get_record_log_max_record
 
 class TestActiveSessions(unittest.TestCase):
     json_good_example = {
@@ -381,7 +382,7 @@ class TestActiveSessions(unittest.TestCase):
             mock_process.assert_has_calls(calls)
 
             calls = [mock.call('status', 64 * os.cpu_count(), client_pid, client_uid, client_gid),
-                     mock.call('record-log', 57384, client_pid, client_uid, client_gid)]
+                     mock.call('record-log', 114832, client_pid, client_uid, client_gid)]
             mock_shmem_create.assert_has_calls(calls)
             self.assertEqual({client_pid}, act_sess.get_profile_pids(profile_name))
             updated_json_contents = dict(self.json_good_example)
@@ -407,6 +408,20 @@ class TestActiveSessions(unittest.TestCase):
             self.assertFalse(act_sess.is_client_active(client_pid))
             mock_remove.assert_called_once_with(full_file_path)
 
+    def test_record_log_max_record(self):
+        """Capacity of the record log may be raised by the environment
+
+        """
+        with mock.patch.dict('os.environ', clear=True):
+            self.assertEqual(1024, get_record_log_max_record())
+        with mock.patch.dict('os.environ', {'GEOPM_RECORD_LOG_MAX_RECORD': '4096'}):
+            self.assertEqual(4096, get_record_log_max_record())
+        for value in ['512', 'many']:
+            with mock.patch.dict('os.environ', {'GEOPM_RECORD_LOG_MAX_RECORD': value}), \
+                 mock.patch('sys.stderr.write') as mock_stderr:
+                self.assertEqual(1024, get_record_log_max_record())
+                mock_stderr.assert_called_once()
+
     def test_batch_server(self):
         """Assign the batch server PID to a client session
 
@@ -57,5 +57,26 @@ class TestCollector(unittest.TestCase):
             elif type(report['metrics']['TIME'][kk]) is int:
                 self.assertEqual(report['metrics']['TIME'][kk], report_yaml_obj['metrics']['TIME'][kk])
 
+    def test_quantile(self):
+        """Quantile estimates are reported only for the requested signals
+
+        """
+        config = [('TIME', 0, 0), ('TIME::ELAPSED', 0, 0)]
+        with Collector(config, quantile_config=[1]) as coll:
+            for loop_idx in loop.TimedLoop(0.01, num_period=10):
+                pio.read_batch()
+                coll.update()
+            report = coll.report()
+            header, data = coll.report_table()
+        self.assertNotIn('p50', report['metrics']['TIME'])
+        metric = report['metrics']['TIME::ELAPSED']
+        self.assertLessEqual(metric['min'] * 0.99, metric['p50'])
+        self.assertLessEqual(metric['p50'], metric['p90'])
+        self.assertLessEqual(metric['p90'], metric['p99'])
+        self.assertLessEqual(metric['p99'], metric['max'] * 1.01)
+        self.assertIn('TIME::ELAPSED-p99', header)
+        self.assertNotIn('TIME-p99', header)
+        self.assertEqual(len(header), len(data))
+
 if __name__ == '__main__':
     unittest.main()
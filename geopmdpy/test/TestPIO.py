@@ -51,6 +51,15 @@ class TestPIO(unittest.TestCase):
         except RuntimeError:
             sys.stdout.write('<warning> failed to read package power\n')
 
+    def test_read_signals(self):
+        expect_t0 = time.time()
+        actual = pio.read_signals([('TIME', topo.DOMAIN_CPU, 0),
+                                   ('TIME', 'board', 0)])
+        self.assertEqual(2, len(actual))
+        for actual_tt in actual:
+            self.assertAlmostEqual(0.0, actual_tt - actual[0], delta=0.1)
+        self.assertEqual([], pio.read_signals([]))
+
     def test_write_control(self):
         try:
             pio.write_control('CPU_FREQUENCY_MAX_CONTROL', 'package', 0, 1.0e9)
@@ -0,0 +1,17 @@
+#  Copyright (c) 2015 - 2024 Intel Corporation
+#  SPDX-License-Identifier: BSD-3-Clause
+#
+
+# Micro-benchmarks for hot paths in the runtime.  These are built by
+# "make checkprogs" but are not run by "make check".
+check_PROGRAMS += benchmark/edit_dist_bench \
+                  benchmark/record_log_bench \
+                  benchmark/report_bench \
+                  # end
+
+benchmark_edit_dist_bench_SOURCES = benchmark/edit_dist_bench.cpp
+benchmark_edit_dist_bench_LDADD = libgeopm.la
+benchmark_record_log_bench_SOURCES = benchmark/record_log_bench.cpp
+benchmark_record_log_bench_LDADD = libgeopm.la
+benchmark_report_bench_SOURCES = benchmark/report_bench.cpp
+benchmark_report_bench_LDADD = libgeopm.la
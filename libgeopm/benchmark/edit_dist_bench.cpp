@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "geopm_time.h"
+#include "EditDistPeriodicityDetector.hpp"
+#include "record.hpp"
+
+// Measures the cost of EditDistPeriodicityDetector::update() for each
+// of the given history sizes.  The records repeat a pattern of
+// PATTERN_LENGTH regions with one region replaced every few periods so
+// that the detector never settles on an exact match.
+
+static double run(int history_size, int pattern_length, int num_record, int &period)
+{
+    geopm::EditDistPeriodicityDetector detector(history_size);
+    geopm::record_s record {};
+    record.event = geopm::EVENT_REGION_ENTRY;
+    geopm_time_s time_0;
+    geopm_time_s time_1;
+    geopm_time(&time_0);
+    for (int record_idx = 0; record_idx < num_record; ++record_idx) {
+        record.signal = record_idx % pattern_length;
+        if (record_idx % (pattern_length * 3 + 1) == 0) {
+            record.signal = pattern_length;
+        }
+        detector.update(record);
+    }
+    geopm_time(&time_1);
+    period = detector.get_period();
+    return geopm_time_diff(&time_0, &time_1) / num_record;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 4) {
+        std::cerr << argv[0] << " NUM_RECORD PATTERN_LENGTH HISTORY_SIZE [HISTORY_SIZE ...]"
+                  << std::endl;
+        return -1;
+    }
+    int num_record = std::stoi(argv[1]);
+    int pattern_length = std::stoi(argv[2]);
+    std::vector<int> history_sizes;
+    for (int arg_idx = 3; arg_idx < argc; ++arg_idx) {
+        history_sizes.push_back(std::stoi(argv[arg_idx]));
+    }
+
+    std::cout << "HISTORY_SIZE,PERIOD,UPDATE_SECONDS,RECORDS_PER_SECOND" << std::endl;
+    for (int history_size : history_sizes) {
+        int period = -1;
+        double update_time = run(history_size, pattern_length, num_record, period);
+        std::cout << history_size << "," << period << ","
+                  << update_time << "," << 1.0 / update_time << std::endl;
+    }
+    return 0;
+}
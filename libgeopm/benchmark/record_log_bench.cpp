@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <unistd.h>
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "geopm_time.h"
+#include "geopm/SharedMemory.hpp"
+#include "ApplicationRecordLog.hpp"
+#include "Scheduler.hpp"
+#include "record.hpp"
+
+// Measures the cost of ApplicationRecordLog::enter() and exit() as
+// seen by the application, first with no reader and then while a
+// second thread drains the log with dump() at the given period the
+// way ApplicationSampler::update() does.
+
+static double run(geopm::ApplicationRecordLog &record_log, int num_loop)
+{
+    geopm_time_s time_0;
+    geopm_time_s time_1;
+    geopm_time_s now = {{1, 0}};
+    geopm_time(&time_0);
+    for (int loop_idx = 0; loop_idx < num_loop; ++loop_idx) {
+        record_log.enter(0x1234abcd, now);
+        record_log.exit(0x1234abcd, now);
+    }
+    geopm_time(&time_1);
+    return geopm_time_diff(&time_0, &time_1) / num_loop;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3) {
+        std::cerr << argv[0] << " LOOP_COUNT DUMP_PERIOD" << std::endl;
+        return -1;
+    }
+    int num_loop = std::stoi(argv[1]);
+    double period = std::stod(argv[2]);
+    std::string shmem_path = "/dev/shm/geopm-record-log-bench-" + std::to_string(getpid());
+    std::shared_ptr<geopm::SharedMemory> shmem =
+        geopm::SharedMemory::make_unique_owner(shmem_path,
+                                               geopm::ApplicationRecordLog::buffer_size());
+    geopm::ApplicationRecordLogImp record_log(shmem, getpid(), geopm::Scheduler::make_unique());
+    std::vector<geopm::record_s> records;
+    std::vector<geopm::short_region_s> short_regions;
+    records.reserve(geopm::ApplicationRecordLog::max_record());
+    short_regions.reserve(geopm::ApplicationRecordLog::max_region());
+
+    double idle_time = run(record_log, num_loop);
+    record_log.dump(records, short_regions);
+
+    std::atomic<bool> is_done(false);
+    std::thread reader([&]() {
+        struct timespec delay = {(time_t)period,
+                                 (long)((period - (time_t)period) * 1e9)};
+        while (!is_done) {
+            record_log.dump(records, short_regions);
+            clock_nanosleep(CLOCK_MONOTONIC, 0, &delay, nullptr);
+        }
+    });
+    double busy_time = run(record_log, num_loop);
+    is_done = true;
+    reader.join();
+    shmem->unlink();
+
+    std::cout << "MODE,ENTER_EXIT_SECONDS" << std::endl;
+    std::cout << "idle," << idle_time << std::endl;
+    std::cout << "dump," << busy_time << std::endl;
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "geopm_time.h"
+#include "Comm.hpp"
+#include "Reporter.hpp"
+
+// Measures the time and peak memory of the root controller while it
+// gathers and writes the report for each of the given node counts.
+// Every node sends a host section with NUM_REGION regions laid out
+// like the sections written by ReporterImp::create_report().  Each
+// node count is run in a child process so that its peak resident set
+// size is measured separately.  The report is written to /dev/null so
+// file system time is not included.
+
+// Comm with the given number of ranks that runs on rank zero.  Every
+// other rank sends the same host report as rank zero.
+class BenchComm : public geopm::NullComm
+{
+    public:
+        BenchComm(int num_rank)
+            : m_num_rank(num_rank)
+        {
+
+        }
+        int num_rank(void) const override
+        {
+            return m_num_rank;
+        }
+        void gather(const void *send_buf, size_t send_size, void *recv_buf,
+                    size_t recv_size, int root) const override
+        {
+            for (int rank_idx = 0; rank_idx < m_num_rank; ++rank_idx) {
+                std::copy((char *)send_buf, (char *)send_buf + send_size,
+                          (char *)recv_buf + rank_idx * recv_size);
+            }
+        }
+        void gatherv(const void *send_buf, size_t send_size, void *recv_buf,
+                     const std::vector<size_t> &recv_sizes,
+                     const std::vector<off_t> &rank_offset, int root) const override
+        {
+            for (int rank_idx = 0; rank_idx < m_num_rank; ++rank_idx) {
+                std::copy((char *)send_buf, (char *)send_buf + recv_sizes[rank_idx],
+                          (char *)recv_buf + rank_offset[rank_idx]);
+            }
+        }
+    private:
+        int m_num_rank;
+};
+
+static void write_fields(std::ostream &os, const std::string &indent, double value)
+{
+    static const std::vector<std::string> fields {
+        "sync-runtime (s)", "package-energy (J)", "dram-energy (J)",
+        "power (W)", "frequency (%)", "frequency (Hz)",
+        "time-hint-network (s)", "time-hint-ignore (s)",
+        "time-hint-compute (s)", "time-hint-memory (s)",
+        "time-hint-io (s)", "time-hint-serial (s)",
+        "time-hint-parallel (s)", "time-hint-unknown (s)",
+        "time-hint-unset (s)", "time-hint-spin (s)",
+    };
+    for (size_t field_idx = 0; field_idx < fields.size(); ++field_idx) {
+        os << indent << fields[field_idx] << ": " << value * (field_idx + 1) << std::endl;
+    }
+}
+
+static std::string host_report(int num_region)
+{
+    std::ostringstream os;
+    os << "  node0000:" << std::endl;
+    os << "    Regions:" << std::endl;
+    for (int region_idx = 0; region_idx < num_region; ++region_idx) {
+        os << "    -" << std::endl;
+        os << "      region: \"region_" << region_idx << "\"" << std::endl;
+        os << "      hash: 0x" << std::hex << 0x10000000 + region_idx << std::dec << std::endl;
+        os << "      runtime (s): " << 1.0 + region_idx * 0.001 << std::endl;
+        os << "      count: " << region_idx + 1 << std::endl;
+        write_fields(os, "      ", 1.0 + region_idx * 0.001);
+    }
+    for (const auto &section : {"Unmarked Totals:", "Epoch Totals:", "Application Totals:"}) {
+        os << "    " << section << std::endl;
+        os << "      runtime (s): 56" << std::endl;
+        os << "      count: 0" << std::endl;
+        write_fields(os, "      ", 56.0);
+    }
+    return os.str();
+}
+
+static double run(bool is_binary, int num_region, int num_node)
+{
+    geopm_time_s time_0;
+    geopm_time_s time_1;
+    geopm_time(&time_0);
+    std::string report = host_report(num_region);
+    if (is_binary) {
+        report = geopm::ReporterImp::compact_report(report);
+    }
+    std::ofstream os("/dev/null", std::ios::out | std::ios::binary);
+    geopm::ReporterImp::gather_report(report, std::make_shared<BenchComm>(num_node), os);
+    geopm_time(&time_1);
+    return geopm_time_diff(&time_0, &time_1);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        std::cerr << argv[0] << " NUM_REGION NUM_NODE [NUM_NODE ...]" << std::endl;
+        return -1;
+    }
+    int num_region = std::stoi(argv[1]);
+    std::vector<int> num_nodes;
+    for (int arg_idx = 2; arg_idx < argc; ++arg_idx) {
+        num_nodes.push_back(std::stoi(argv[arg_idx]));
+    }
+    size_t yaml_size = host_report(num_region).size();
+    size_t binary_size = geopm::ReporterImp::compact_report(host_report(num_region)).size();
+
+    std::cout << "FORMAT,NUM_NODE,REPORT_BYTES,SECONDS,MAX_RSS_KB" << std::endl;
+    for (bool is_binary : {false, true}) {
+        for (int num_node : num_nodes) {
+            int pipe_fd[2];
+            if (pipe(pipe_fd) != 0) {
+                return -1;
+            }
+            pid_t pid = fork();
+            if (pid == 0) {
+                close(pipe_fd[0]);
+                double seconds = run(is_binary, num_region, num_node);
+                int err = write(pipe_fd[1], &seconds, sizeof(seconds)) != sizeof(seconds);
+                close(pipe_fd[1]);
+                _exit(err);
+            }
+            close(pipe_fd[1]);
+            double seconds = NAN;
+            if (read(pipe_fd[0], &seconds, sizeof(seconds)) != sizeof(seconds)) {
+                seconds = NAN;
+            }
+            close(pipe_fd[0]);
+            int status = 0;
+            struct rusage usage {};
+            wait4(pid, &status, 0, &usage);
+            std::cout << (is_binary ? "binary," : "yaml,") << num_node << ","
+                      << num_node * (is_binary ? binary_size : yaml_size) << ","
+                      << seconds << "," << usage.ru_maxrss << std::endl;
+        }
+    }
+    return 0;
+}
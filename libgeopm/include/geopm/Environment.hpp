@@ -68,6 +68,9 @@ namespace geopm
             virtual double period(double default_period) const = 0;
             virtual int num_proc(void) const = 0;
             virtual bool do_ctl_local(void) const = 0;
+            virtual bool do_trace_binary(void) const;
+            virtual std::string wait_strategy(void) const;
+            virtual bool do_report_binary(void) const;
             static std::map<std::string, std::string> parse_environment_file(const std::string &env_file_path);
     };
 
@@ -97,6 +100,8 @@ namespace geopm
             bool do_trace(void) const override;
             bool do_trace_profile(void) const override;
             bool do_trace_endpoint_policy(void) const override;
+            bool do_trace_binary(void) const override;
+            bool do_report_binary(void) const override;
             bool do_profile() const override;
             int timeout(void) const override;
             static std::set<std::string> get_all_vars(void);
@@ -115,6 +120,7 @@ namespace geopm
             int debug_attach_process(void) const override;
             std::string init_control(void) const override;
             double period(double default_period) const override;
+            std::string wait_strategy(void) const override;
             int num_proc(void) const override;
             bool do_ctl_local(void) const override;
         protected:
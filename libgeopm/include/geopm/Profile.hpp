@@ -283,6 +283,10 @@ namespace geopm
             /// @brief Holds the set of CPUs that the rank process is
             ///        bound to.
             std::set<int> m_cpu_set;
+            /// @brief Index of the ApplicationStatus slot that
+            ///        holds the region of this process: the lowest
+            ///        CPU in m_cpu_set, or -1 if the set is empty.
+            int m_status_process;
 
             std::shared_ptr<ApplicationStatus> m_app_status;
             std::shared_ptr<ApplicationRecordLog> m_app_record_log;
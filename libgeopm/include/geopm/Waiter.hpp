@@ -6,7 +6,15 @@
 #ifndef WAITER_HPP_INCLUDE
 #define WAITER_HPP_INCLUDE
 
+#include <time.h>
+
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "geopm_time.h"
 #include "geopm_public.h"
 
@@ -16,12 +24,15 @@ namespace geopm
     class GEOPM_PUBLIC Waiter
     {
         public:
-            /// @brief Create a Waiter with "sleep" strategy
+            /// @brief Create a Waiter with the strategy selected by
+            ///        the GEOPM_WAIT_STRATEGY environment variable,
+            ///        "sleep" by default
             /// @param [in] period Duration in seconds to wait
             static std::unique_ptr<Waiter> make_unique(double period);
             /// @brief Create a Waiter
             /// @param [in] period Duration in seconds to wait
-            /// @param [in] strategy Wait algorithm ("sleep")
+            /// @param [in] strategy Wait algorithm ("sleep",
+            ///        "monotonic", "hybrid" or "timerfd")
             static std::unique_ptr<Waiter> make_unique(double period,
                                                        std::string strategy);
             Waiter() = default;
@@ -37,6 +48,12 @@ namespace geopm
             /// @brief Get the period for the waiter
             /// @return The duration of the wait
             virtual double period(void) const = 0;
+            /// @brief Summary of how late each call to wait()
+            ///        returned relative to the end of the period
+            /// @return Name value pairs for the host section of the
+            ///         report, empty if the Waiter does not keep
+            ///         these statistics
+            virtual std::vector<std::pair<std::string, std::string> > report(void) const;
     };
 
     /// @brief Class to support a periodic wait loop based on
@@ -55,6 +72,92 @@ namespace geopm
             geopm_time_s m_time_target;
             bool m_is_first_time;
     };
+
+    /// @brief Base class for a periodic wait loop that blocks until
+    ///        a deadline measured with a given clock.  Keeps a
+    ///        histogram of the time between each deadline and the
+    ///        return from wait().
+    class GEOPM_PUBLIC DeadlineWaiter : public Waiter
+    {
+        public:
+            DeadlineWaiter(double period, clockid_t clock_id);
+            virtual ~DeadlineWaiter() = default;
+            void reset(void) override;
+            void reset(double period) override;
+            void wait(void) override;
+            double period(void) const override;
+            std::vector<std::pair<std::string, std::string> > report(void) const override;
+        protected:
+            /// @brief Block until the clock reaches the target.
+            virtual void wait_until(const struct geopm_time_s &target) = 0;
+            /// @brief Called each time the target is moved.
+            virtual void arm(const struct geopm_time_s &target);
+            struct geopm_time_s now(void) const;
+            const clockid_t M_CLOCK_ID;
+        private:
+            void set_target(const struct geopm_time_s &target);
+            static constexpr int M_NUM_BUCKET = 7;
+            double m_period;
+            geopm_time_s m_time_target;
+            bool m_is_first_time;
+            std::array<uint64_t, M_NUM_BUCKET> m_lateness_count;
+            double m_lateness_total;
+            double m_lateness_max;
+    };
+
+    /// @brief Class to support a periodic wait loop based on
+    ///        clock_nanosleep() using CLOCK_REALTIME or
+    ///        CLOCK_MONOTONIC.
+    class GEOPM_PUBLIC ClockSleepWaiter : public DeadlineWaiter
+    {
+        public:
+            ClockSleepWaiter(double period, clockid_t clock_id);
+            virtual ~ClockSleepWaiter() = default;
+        protected:
+            void wait_until(const struct geopm_time_s &target) override;
+    };
+
+    /// @brief Class to support a periodic wait loop that sleeps with
+    ///        clock_nanosleep() until shortly before the deadline
+    ///        and spins on CLOCK_MONOTONIC for the remainder.
+    ///        Trades CPU time for lower wake up jitter.
+    class GEOPM_PUBLIC HybridWaiter : public DeadlineWaiter
+    {
+        public:
+            HybridWaiter(double period);
+            /// @param [in] period Duration in seconds to wait
+            /// @param [in] spin_duration Time in seconds before the
+            ///        deadline to stop sleeping and start spinning
+            HybridWaiter(double period, double spin_duration);
+            virtual ~HybridWaiter() = default;
+        protected:
+            void wait_until(const struct geopm_time_s &target) override;
+        private:
+            static constexpr double M_SPIN_DURATION = 100e-6;
+            const double m_spin_duration;
+    };
+
+    /// @brief Class to support a periodic wait loop based on a
+    ///        timerfd using CLOCK_MONOTONIC.  The descriptor is
+    ///        armed with the next deadline after each reset() and
+    ///        wait(), so it may be multiplexed with other file
+    ///        descriptors by poll(2) before calling wait().
+    class GEOPM_PUBLIC TimerfdWaiter : public DeadlineWaiter
+    {
+        public:
+            TimerfdWaiter(double period);
+            virtual ~TimerfdWaiter();
+            TimerfdWaiter(const TimerfdWaiter &other) = delete;
+            TimerfdWaiter &operator=(const TimerfdWaiter &other) = delete;
+            /// @brief File descriptor that is readable once the
+            ///        deadline for the next wait() has passed
+            int file_descriptor(void) const;
+        protected:
+            void wait_until(const struct geopm_time_s &target) override;
+            void arm(const struct geopm_time_s &target) override;
+        private:
+            int m_timer_fd;
+    };
 }
 
 #endif
@@ -178,7 +178,7 @@ namespace geopm
             AvgAccumulator() = default;
     };
 
-    class SumAccumulatorImp : public SumAccumulator
+    class SumAccumulatorImp final : public SumAccumulator
     {
         public:
             SumAccumulatorImp();
@@ -194,7 +194,7 @@ namespace geopm
             double m_last;
     };
 
-    class AvgAccumulatorImp : public AvgAccumulator
+    class AvgAccumulatorImp final : public AvgAccumulator
     {
         public:
             AvgAccumulatorImp();
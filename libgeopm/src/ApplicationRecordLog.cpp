@@ -6,6 +6,9 @@
 
 #include "ApplicationRecordLog.hpp"
 #include <unistd.h>
+#include <algorithm>
+#include <limits>
+#include <thread>
 #include "Scheduler.hpp"
 #include "geopm/SharedMemory.hpp"
 #include "geopm/Exception.hpp"
@@ -28,6 +31,13 @@ namespace geopm
         return M_LAYOUT_SIZE;
     }
 
+    size_t ApplicationRecordLog::buffer_size(size_t max_record)
+    {
+        return M_HEADER_SIZE + M_NUM_BANK * (M_BANK_HEADER_SIZE +
+                                             max_record * sizeof(record_s) +
+                                             (max_record + 1) * sizeof(short_region_s));
+    }
+
     size_t ApplicationRecordLog::max_record(void)
     {
         return M_MAX_RECORD;
@@ -38,6 +48,16 @@ namespace geopm
         return M_MAX_REGION;
     }
 
+    geopm_time_s ApplicationRecordLog::tsc_time(uint64_t tsc)
+    {
+        return {{(time_t)(tsc / 1000000000), (long)(tsc % 1000000000)}};
+    }
+
+    uint64_t ApplicationRecordLog::time_tsc(const geopm_time_s &time)
+    {
+        return (uint64_t)time.t.tv_sec * 1000000000 + (uint64_t)time.t.tv_nsec;
+    }
+
     ApplicationRecordLogImp::ApplicationRecordLogImp(std::shared_ptr<SharedMemory> shmem)
         : ApplicationRecordLogImp(std::move(shmem), getpid(), Scheduler::make_unique())
     {
@@ -48,6 +68,16 @@ namespace geopm
                                                      std::shared_ptr<Scheduler> scheduler)
         : m_process(process)
         , m_shmem(std::move(shmem))
+        , m_layout(nullptr)
+        , m_max_record(0)
+        , m_is_tsc(false)
+        , m_bank{}
+        , m_overflow()
+        , m_overflow_begin(0)
+        , m_overflow_size(0)
+        , m_num_drain(0)
+        , m_drain_time_total(0.0)
+        , m_drain_time_max(0.0)
         , m_epoch_count(0)
         , m_entered_region_hash(GEOPM_REGION_HASH_INVALID)
         , m_scheduler(std::move(scheduler))
@@ -56,40 +86,101 @@ namespace geopm
             throw Exception("ApplicationRecordLog: Shared memory provided in constructor is too small",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        // Each bank holds as many records as fit in the shared memory
+        size_t bank_size = (m_shmem->size() - M_HEADER_SIZE) / M_NUM_BANK;
+        bank_size -= bank_size % alignof(record_s);
+        size_t max_record = (bank_size - M_BANK_HEADER_SIZE - sizeof(short_region_s)) /
+                            (sizeof(record_s) + sizeof(short_region_s));
+        m_max_record = std::min(max_record, (size_t)std::numeric_limits<int32_t>::max() - 1);
+        m_layout = (m_layout_s *)(m_shmem->pointer());
+        // The shared memory is zero filled when created, so the first
+        // user declares the layout.  Both the Profile and the
+        // ApplicationSampler derive the same capacity from the size.
+        uint32_t version = 0;
+        if (m_layout->version.load(std::memory_order_acquire) == 0) {
+            m_layout->max_record.store(m_max_record, std::memory_order_relaxed);
+            m_layout->version.compare_exchange_strong(version, M_LAYOUT_VERSION,
+                                                      std::memory_order_acq_rel);
+        }
+        version = m_layout->version.load(std::memory_order_acquire);
+        if (version != M_LAYOUT_VERSION) {
+            throw Exception("ApplicationRecordLog: Shared memory layout version " +
+                            std::to_string(version) + " does not match expected version " +
+                            std::to_string(M_LAYOUT_VERSION),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (m_layout->max_record.load(std::memory_order_relaxed) != (uint32_t)m_max_record) {
+            throw Exception("ApplicationRecordLog: Shared memory declares a capacity of " +
+                            std::to_string(m_layout->max_record.load(std::memory_order_relaxed)) +
+                            " records, but its size provides for " + std::to_string(m_max_record),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        char *bank_ptr = (char *)(m_shmem->pointer()) + M_HEADER_SIZE;
+        for (auto &bank : m_bank) {
+            bank.header = (m_bank_header_s *)bank_ptr;
+            bank.record_table = (record_s *)(bank_ptr + M_BANK_HEADER_SIZE);
+            bank.region_table = (short_region_s *)(bank.record_table + m_max_record);
+            bank_ptr += bank_size;
+        }
+    }
+
+    ApplicationRecordLogImp::BankScope::BankScope(ApplicationRecordLogImp &log)
+        : m_layout(*log.m_layout)
+        , m_bank(log.m_bank[m_layout.state.fetch_or(M_STATE_BUSY, std::memory_order_acquire) & M_STATE_BANK])
+    {
+
+    }
+
+    ApplicationRecordLogImp::BankScope::~BankScope()
+    {
+        m_layout.sequence.fetch_add(1, std::memory_order_release);
+        m_layout.state.fetch_and(~M_STATE_BUSY, std::memory_order_release);
+    }
+
+    ApplicationRecordLogImp::m_bank_s &ApplicationRecordLogImp::BankScope::bank(void)
+    {
+        return m_bank;
     }
 
     void ApplicationRecordLogImp::enter(uint64_t hash, const geopm_time_s &time)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
-        auto emplace_pair = m_hash_region_enter_map.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(hash),
-            std::forward_as_tuple());
-        bool is_new  = emplace_pair.second;
-        m_region_enter_s &region_enter = emplace_pair.first->second;
-        region_enter.enter_time = time;
-        if (is_new) {
-            region_enter.record_idx = layout.num_record;
-            region_enter.region_idx = -1; // Not a short region yet
-            region_enter.is_short = false;
-            record_s enter_record = {
-               .time = time,
-               .process = m_process,
-               .event = EVENT_REGION_ENTRY,
-               .signal = hash,
+        BankScope scope(*this);
+        m_bank_s &bank = scope.bank();
+        check_reset(bank);
+        flush_overflow(bank);
+        record_s enter_record = {
+           .time = time,
+           .process = m_process,
+           .event = EVENT_REGION_ENTRY,
+           .signal = hash,
+        };
+        auto region_it = m_hash_region_enter_map.find(hash);
+        if (region_it != m_hash_region_enter_map.end()) {
+            region_it->second.enter_time = time;
+        }
+        else if (!is_full(bank)) {
+            m_hash_region_enter_map[hash] = {
+                .record_idx = bank.header->num_record,
+                .region_idx = -1, // Not a short region yet
+                .enter_time = time,
+                .is_short = false,
             };
-            append_record(layout, enter_record);
+            append_record(bank, enter_record);
+        }
+        else {
+            // The queued entry cannot be converted into a short
+            // region, so the matching exit is also sent as a record.
+            append_record(bank, enter_record);
         }
         m_entered_region_hash = hash;
     }
 
     void ApplicationRecordLogImp::exit(uint64_t hash, const geopm_time_s &time)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
+        BankScope scope(*this);
+        m_bank_s &bank = scope.bank();
+        check_reset(bank);
+        flush_overflow(bank);
 
         auto region_it = m_hash_region_enter_map.find(hash);
         if (region_it == m_hash_region_enter_map.end()) {
@@ -100,13 +191,34 @@ namespace geopm
                .event = EVENT_REGION_EXIT,
                .signal = hash,
             };
-            append_record(layout, exit_record);
+            append_record(bank, exit_record);
         }
         else {
             // This region was previous marked short or an entry
             // occurred in the same control loop.
             auto &enter_info = region_it->second;
             enter_info.is_short = true;
+            if (enter_info.record_idx == -1 && is_full(bank)) {
+                // There is no room to start a short region, queue an
+                // entry and exit pair instead.
+                record_s enter_record = {
+                    .time = enter_info.enter_time,
+                    .process = m_process,
+                    .event = EVENT_REGION_ENTRY,
+                    .signal = hash,
+                };
+                record_s exit_record = {
+                    .time = time,
+                    .process = m_process,
+                    .event = EVENT_REGION_EXIT,
+                    .signal = hash,
+                };
+                append_record(bank, enter_record);
+                append_record(bank, exit_record);
+                m_hash_region_enter_map.erase(region_it);
+                m_entered_region_hash = GEOPM_REGION_HASH_INVALID;
+                return;
+            }
             if (enter_info.record_idx == -1) {
                 GEOPM_DEBUG_ASSERT(enter_info.region_idx == -1,
                                    "Short region in list with no matching record");
@@ -119,36 +231,36 @@ namespace geopm
                     .event = EVENT_REGION_ENTRY,
                     .signal = hash,
                 };
-                enter_info.record_idx = layout.num_record;
-                append_record(layout, enter_record);
+                enter_info.record_idx = bank.header->num_record;
+                append_record(bank, enter_record);
             }
-            GEOPM_DEBUG_ASSERT(enter_info.record_idx >= 0 && enter_info.record_idx < layout.num_record,
+            GEOPM_DEBUG_ASSERT(enter_info.record_idx >= 0 && enter_info.record_idx < bank.header->num_record,
                                "Invalid record index");
 
             // find or add the region in short regions array
             int region_idx = enter_info.region_idx;
             if (region_idx == -1) {
-                region_idx = layout.num_region;
+                region_idx = bank.header->num_region;
                 enter_info.region_idx = region_idx;
-                ++(layout.num_region);
-                GEOPM_DEBUG_ASSERT(layout.num_region <= M_MAX_REGION,
+                ++(bank.header->num_region);
+                GEOPM_DEBUG_ASSERT(bank.header->num_region <= m_max_record + 1,
                                    "ApplicationRecordLogImp::exit(): too many regions entered and exited within one control loop");
                 // Add a new short region
-                layout.region_table[region_idx] = {
+                bank.region_table[region_idx] = {
                     .hash = hash,
                     .num_complete = 0,
                     .total_time = 0.0,
                 };
-                GEOPM_DEBUG_ASSERT(layout.record_table[enter_info.record_idx].event == EVENT_REGION_ENTRY,
+                GEOPM_DEBUG_ASSERT(bank.record_table[enter_info.record_idx].event == EVENT_REGION_ENTRY,
                                    "ApplicationRegionLog::exit(): adding a new short region when existing was not an entry.");
                 // Convert the region entry event into a short region event
-                layout.record_table[enter_info.record_idx].event = EVENT_SHORT_REGION;
-                layout.record_table[enter_info.record_idx].signal = region_idx;
+                bank.record_table[enter_info.record_idx].event = EVENT_SHORT_REGION;
+                bank.record_table[enter_info.record_idx].signal = region_idx;
             }
-            GEOPM_DEBUG_ASSERT(region_idx >= 0 && region_idx < layout.num_region,
+            GEOPM_DEBUG_ASSERT(region_idx >= 0 && region_idx < bank.header->num_region,
                                "Invalid region index");
             // Update the count and total time for the short region
-            auto &region = layout.region_table[region_idx];
+            auto &region = bank.region_table[region_idx];
             ++(region.num_complete);
             region.total_time += geopm_time_diff(&(enter_info.enter_time), &time);
         }
@@ -157,9 +269,6 @@ namespace geopm
 
     void ApplicationRecordLogImp::epoch(const geopm_time_s &time)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
 
         ++m_epoch_count;
         record_s epoch_record = {
@@ -168,7 +277,7 @@ namespace geopm
            .event = EVENT_EPOCH_COUNT,
            .signal = m_epoch_count,
         };
-        append_record(layout, epoch_record);
+        append_record(epoch_record);
     }
 
     void ApplicationRecordLogImp::cpuset_changed(const geopm_time_s &time)
@@ -184,23 +293,17 @@ namespace geopm
 
     void ApplicationRecordLogImp::affinity(const geopm_time_s &time, int cpu_idx)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
         record_s affinity_record = {
            .time = time,
            .process = m_process,
            .event = EVENT_AFFINITY,
            .signal = (uint64_t)cpu_idx,
         };
-        append_record(layout, affinity_record);
+        append_record(affinity_record);
     }
 
     void ApplicationRecordLogImp::start_profile(const geopm_time_s &time, const std::string &profile_name)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
         uint64_t profile_hash = geopm_crc32_str(profile_name.c_str());
         record_s profile_start_record = {
            .time = time,
@@ -208,14 +311,11 @@ namespace geopm
            .event = EVENT_START_PROFILE,
            .signal = profile_hash,
         };
-        append_record(layout, profile_start_record);
+        append_record(profile_start_record);
     }
 
     void ApplicationRecordLogImp::stop_profile(const geopm_time_s &time, const std::string &profile_name)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
         uint64_t profile_hash = geopm_crc32_str(profile_name.c_str());
         record_s profile_stop_record = {
            .time = time,
@@ -223,14 +323,11 @@ namespace geopm
            .event = EVENT_STOP_PROFILE,
            .signal = profile_hash,
         };
-        append_record(layout, profile_stop_record);
+        append_record(profile_stop_record);
     }
 
     void ApplicationRecordLogImp::overhead(const geopm_time_s &time, double overhead_sec)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
         uint64_t field = geopm_signal_to_field(overhead_sec);
         record_s overhead_record = {
            .time = time,
@@ -238,24 +335,77 @@ namespace geopm
            .event = EVENT_OVERHEAD,
            .signal = field,
         };
-        append_record(layout, overhead_record);
+        append_record(overhead_record);
+    }
+
+    void ApplicationRecordLogImp::enable_tsc(void)
+    {
+        geopm_time_s time;
+        if (geopm_time_tsc_to_time(geopm_time_tsc(), &time) == 0) {
+            m_is_tsc = true;
+            m_layout->is_tsc.store(1, std::memory_order_release);
+        }
+    }
+
+    bool ApplicationRecordLogImp::is_tsc_enabled(void) const
+    {
+        return m_layout->is_tsc.load(std::memory_order_acquire) != 0;
+    }
+
+    geopm_time_s ApplicationRecordLogImp::time_stamp(void) const
+    {
+        geopm_time_s result;
+        if (m_is_tsc) {
+            result = tsc_time(geopm_time_tsc());
+        }
+        else {
+            geopm_time(&result);
+        }
+        return result;
     }
 
     void ApplicationRecordLogImp::dump(std::vector<record_s> &records,
                                        std::vector<short_region_s> &short_regions)
     {
         // this function should not do anything with m_hash_region_enter_map
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        records.assign(layout.record_table, layout.record_table + layout.num_record);
-        short_regions.assign(layout.region_table, layout.region_table + layout.num_region);
-        layout.num_record = 0;
-        layout.num_region = 0;
+        geopm_time_s begin;
+        geopm_time_fast(&begin);
+        // Redirect the producer to the other bank
+        uint32_t state = m_layout->state.fetch_xor(M_STATE_BANK, std::memory_order_acq_rel);
+        if (state & M_STATE_BUSY) {
+            // Wait for the update that was in flight during the swap
+            uint32_t sequence = m_layout->sequence.load(std::memory_order_acquire);
+            while ((m_layout->state.load(std::memory_order_acquire) & M_STATE_BUSY) &&
+                   m_layout->sequence.load(std::memory_order_acquire) == sequence) {
+                std::this_thread::yield();
+            }
+        }
+        m_bank_s &bank = m_bank[state & M_STATE_BANK];
+        records.assign(bank.record_table, bank.record_table + bank.header->num_record);
+        short_regions.assign(bank.region_table, bank.region_table + bank.header->num_region);
+        bank.header->num_record = 0;
+        bank.header->num_region = 0;
+        double drain_time = geopm_time_fast_since(&begin);
+        ++m_num_drain;
+        m_drain_time_total += drain_time;
+        m_drain_time_max = std::max(m_drain_time_max, drain_time);
+    }
+
+    ApplicationRecordLog::stats_s ApplicationRecordLogImp::stats(void) const
+    {
+        return {
+            .num_overflow = m_layout->num_overflow.load(std::memory_order_relaxed),
+            .max_overflow = m_layout->max_overflow.load(std::memory_order_relaxed),
+            .num_drop = m_layout->num_drop.load(std::memory_order_relaxed),
+            .num_drain = m_num_drain,
+            .drain_time_total = m_drain_time_total,
+            .drain_time_max = m_drain_time_max,
+        };
     }
 
-    void ApplicationRecordLogImp::check_reset(m_layout_s &layout)
+    void ApplicationRecordLogImp::check_reset(m_bank_s &bank)
     {
-        if (layout.num_record == 0) {
+        if (bank.header->num_record == 0) {
             // Other side has cleared the records.
             // If currently in a short region, keep track of any short region data.
             auto region_enter_it = m_hash_region_enter_map.find(m_entered_region_hash);
@@ -279,17 +429,56 @@ namespace geopm
         }
     }
 
-    void ApplicationRecordLogImp::append_record(m_layout_s &layout, const record_s &record)
+    void ApplicationRecordLogImp::flush_overflow(m_bank_s &bank)
+    {
+        // Move records queued while the bank was full into the
+        // space made available by the last dump()
+        while (m_overflow_size != 0 &&
+               bank.header->num_record < m_max_record) {
+            bank.record_table[bank.header->num_record] = m_overflow[m_overflow_begin];
+            ++(bank.header->num_record);
+            m_overflow_begin = (m_overflow_begin + 1) % M_MAX_OVERFLOW;
+            --m_overflow_size;
+        }
+    }
+
+    bool ApplicationRecordLogImp::is_full(const m_bank_s &bank) const
     {
-        int record_idx = layout.num_record;
-        // Don't overrun the buffer
-        if (record_idx < M_MAX_RECORD) {
-            layout.record_table[record_idx] = record;
-            ++(layout.num_record);
+        // Records must not be added to the bank ahead of queued records
+        return m_overflow_size != 0 ||
+               bank.header->num_record >= m_max_record;
+    }
+
+    void ApplicationRecordLogImp::append_record(const record_s &record)
+    {
+        BankScope scope(*this);
+        m_bank_s &bank = scope.bank();
+        check_reset(bank);
+        flush_overflow(bank);
+        append_record(bank, record);
+    }
+
+    void ApplicationRecordLogImp::append_record(m_bank_s &bank, const record_s &record)
+    {
+        if (!is_full(bank)) {
+            bank.record_table[bank.header->num_record] = record;
+            ++(bank.header->num_record);
+        }
+        // Don't grow the queue without bound if the controller has
+        // stopped draining the log
+        else if (m_overflow_size < M_MAX_OVERFLOW) {
+            if (m_overflow.empty()) {
+                m_overflow.resize(M_MAX_OVERFLOW);
+            }
+            m_overflow[(m_overflow_begin + m_overflow_size) % M_MAX_OVERFLOW] = record;
+            ++m_overflow_size;
+            m_layout->num_overflow.fetch_add(1, std::memory_order_relaxed);
+            if (m_overflow_size > m_layout->max_overflow.load(std::memory_order_relaxed)) {
+                m_layout->max_overflow.store(m_overflow_size, std::memory_order_relaxed);
+            }
         }
         else {
-            throw Exception("ApplicationRecordLog: maximum number of records reached.",
-                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            m_layout->num_drop.fetch_add(1, std::memory_order_relaxed);
         }
     }
 }
@@ -6,6 +6,8 @@
 #ifndef APPLICATIONRECORDLOG_HPP_INCLUDE
 #define APPLICATIONRECORDLOG_HPP_INCLUDE
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
 #include <map>
@@ -18,7 +20,6 @@
 namespace geopm
 {
     class SharedMemory;
-    class SharedMemoryScopedLock;
     class Scheduler;
 
     /// @brief Provides an abstraction for a shared memory buffer that
@@ -53,6 +54,28 @@ namespace geopm
     /// number of calls to the hashed region and the total amount of
     /// time in the region, but the exact sequence and timing of
     /// events following the first enter() is not recorded.
+    ///
+    /// The shared memory is accessed without locks.  It holds two
+    /// banks of records: the Profile writes into the active bank
+    /// while the ApplicationSampler drains the inactive one.  Each
+    /// call to dump() swaps the active bank, so the application
+    /// never waits on the controller.  The controller waits at most
+    /// for a single in-flight update of the bank it is draining.
+    ///
+    /// The shared memory begins with a versioned header that
+    /// declares the capacity of each bank.  The capacity is derived
+    /// from the size of the shared memory, so a larger buffer may be
+    /// provided to applications that emit bursts of events.  Records
+    /// that do not fit in the active bank are queued by the Profile
+    /// and moved into the shared memory after the next dump(), so
+    /// they are delayed rather than lost.  If the controller stops
+    /// draining the log and the queue reaches its limit, further
+    /// records are dropped and counted.
+    ///
+    /// The Profile may stamp region and epoch events with the time
+    /// stamp counter, which is less expensive to read than
+    /// geopm_time().  The ApplicationSampler converts these records
+    /// into geopm_time() values after calling dump().
     class ApplicationRecordLog
     {
         public:
@@ -140,6 +163,59 @@ namespace geopm
             virtual void start_profile(const geopm_time_s &time, const std::string &profile_name) = 0;
             virtual void stop_profile(const geopm_time_s &time, const std::string &profile_name) = 0;
             virtual void overhead(const geopm_time_s &time, double overhead_sec) = 0;
+            /// @brief Stamp region and epoch events with the time
+            ///        stamp counter.
+            ///
+            /// Called by the Profile object before the first event.
+            /// Has no effect unless geopm_time_tsc_to_time() can
+            /// convert the counter, which calibrates the counter on
+            /// the first call.
+            virtual void enable_tsc(void) = 0;
+            /// @brief Check if the Profile enabled the time stamp
+            ///        counter for the shared memory.
+            ///
+            /// If true, the time of the region entry, exit, short
+            /// region and epoch records returned by dump() holds a
+            /// counter value in the format of tsc_time(), and the
+            /// total_time of the short regions is the number of
+            /// counts elapsed multiplied by 1E-9.
+            ///
+            /// @return True if the records carry counter values.
+            virtual bool is_tsc_enabled(void) const = 0;
+            /// @brief Get the time to pass to enter(), exit() and
+            ///        epoch().
+            ///
+            /// @return The current time from geopm_time(), or the
+            ///         current counter value in the format of
+            ///         tsc_time() if enable_tsc() took effect.
+            virtual geopm_time_s time_stamp(void) const = 0;
+            /// @brief Counters describing overflow of the shared
+            ///        memory and the cost of draining it.
+            struct stats_s {
+                /// Number of records that did not fit in the active
+                /// bank and were queued by the Profile.
+                uint64_t num_overflow;
+                /// Largest number of records queued at one time.
+                uint64_t max_overflow;
+                /// Number of records dropped because the queue was
+                /// full.
+                uint64_t num_drop;
+                /// Number of calls to dump().
+                uint64_t num_drain;
+                /// Total time in seconds spent in dump().
+                double drain_time_total;
+                /// Longest time in seconds spent in one dump().
+                double drain_time_max;
+            };
+            /// @brief Get the overflow and drain counters.
+            ///
+            /// The overflow counters are updated by the Profile in
+            /// shared memory and the drain counters are updated by
+            /// calls to dump().
+            ///
+            /// @return Counters accumulated since the log was
+            ///         created.
+            virtual stats_s stats(void) const = 0;
             /// @brief Gets the shared memory size requirement.
             ///
             /// This method returns the value to use when sizing the
@@ -148,10 +224,22 @@ namespace geopm
             ///
             /// @return Size requirement for SharedMemory object.
             static size_t buffer_size(void);
+            /// @brief Gets the shared memory size required for a
+            ///        given capacity.
+            ///
+            /// A buffer larger than buffer_size() increases the
+            /// number of records that each bank of the log can hold.
+            ///
+            /// @param [in] max_record Number of records that each
+            ///        bank of the log can hold.
+            ///
+            /// @return Size requirement for SharedMemory object.
+            static size_t buffer_size(size_t max_record);
             /// @brief Gets the maximum number of records.
             ///
             /// This method returns the value to use when reserving
-            /// elements in the records vector passed to dump().
+            /// elements in the records vector passed to dump() for a
+            /// buffer of size buffer_size().
             ///
             /// @return The maximum length of the records vector after
             ///         a call to dump().
@@ -159,16 +247,40 @@ namespace geopm
             /// @brief Gets the maximum number of short region events.
             ///
             /// This method returns the value to use when reserving
-            /// elements in the short_regions vector passed to dump().
+            /// elements in the short_regions vector passed to dump()
+            /// for a buffer of size buffer_size().
             ///
             /// @return The maximum length of the short_regions vector
             ///         after a call to dump().
             static size_t max_region(void);
+            /// @brief Store a time stamp counter value in a record
+            ///        time.
+            ///
+            /// The seconds and nanoseconds fields hold the quotient
+            /// and remainder of the count divided by 1E9, so the
+            /// difference of two such times is the number of counts
+            /// elapsed multiplied by 1E-9.
+            ///
+            /// @param [in] tsc Value returned by geopm_time_tsc().
+            ///
+            /// @return Record time holding the counter value.
+            static geopm_time_s tsc_time(uint64_t tsc);
+            /// @brief Get the counter value stored by tsc_time().
+            ///
+            /// @param [in] time Record time holding a counter value.
+            ///
+            /// @return The counter value.
+            static uint64_t time_tsc(const geopm_time_s &time);
         protected:
             ApplicationRecordLog() = default;
-            static constexpr size_t M_LAYOUT_SIZE = 57384;
+            static constexpr size_t M_LAYOUT_SIZE = 114832;
             static constexpr int M_MAX_RECORD = 1024;
             static constexpr int M_MAX_REGION = M_MAX_RECORD + 1;
+            /// Size of the header at the start of the shared memory.
+            static constexpr size_t M_HEADER_SIZE = 64;
+            /// Size of the header at the start of each bank.
+            static constexpr size_t M_BANK_HEADER_SIZE = 16;
+            static constexpr int M_NUM_BANK = 2;
     };
     class ApplicationRecordLogImp : public ApplicationRecordLog
     {
@@ -188,26 +300,107 @@ namespace geopm
             void start_profile(const geopm_time_s &time, const std::string &profile_name) override;
             void stop_profile(const geopm_time_s &time, const std::string &profile_name) override;
             void overhead(const geopm_time_s &time, double overhead_sec) override;
+            void enable_tsc(void) override;
+            bool is_tsc_enabled(void) const override;
+            geopm_time_s time_stamp(void) const override;
+            stats_s stats(void) const override;
         private:
-            struct m_layout_s {
+            /// Bit of m_layout_s::state selecting the bank written by
+            /// the producer.
+            static constexpr uint32_t M_STATE_BANK = 0x1;
+            /// Bit of m_layout_s::state set while the producer is
+            /// updating a bank.
+            static constexpr uint32_t M_STATE_BUSY = 0x2;
+            /// Version of the shared memory layout.  Increment when
+            /// the layout changes.
+            static constexpr uint32_t M_LAYOUT_VERSION = 4;
+            /// Maximum number of records queued by the Profile while
+            /// the active bank is full.
+            static constexpr size_t M_MAX_OVERFLOW = 64 * M_MAX_RECORD;
+            /// Start of each bank in shared memory.  It is followed
+            /// by the record table and then the short region table,
+            /// which hold max_record and max_record + 1 elements.
+            struct m_bank_header_s {
                 int32_t num_record;
-                record_s record_table[M_MAX_RECORD];
                 int32_t num_region;
-                short_region_s region_table[M_MAX_REGION];
+                char padding[8];
+            };
+            /// Pointers into one bank of the shared memory.
+            struct m_bank_s {
+                m_bank_header_s *header;
+                record_s *record_table;
+                short_region_s *region_table;
+            };
+            /// Start of the shared memory, followed by M_NUM_BANK
+            /// banks.
+            struct m_layout_s {
+                std::atomic<uint32_t> state;
+                std::atomic<uint32_t> sequence;
+                /// Zero until the first user of the shared memory
+                /// sets it to M_LAYOUT_VERSION.
+                std::atomic<uint32_t> version;
+                /// Number of records that each bank can hold.
+                std::atomic<uint32_t> max_record;
+                std::atomic<uint64_t> num_overflow;
+                std::atomic<uint64_t> max_overflow;
+                std::atomic<uint64_t> num_drop;
+                /// Set by enable_tsc() before the first record is
+                /// stamped with the counter.
+                std::atomic<uint32_t> is_tsc;
+                char padding[20];
             };
-            static_assert(sizeof(m_layout_s) <= M_LAYOUT_SIZE,
+            static_assert(std::atomic<uint32_t>::is_always_lock_free &&
+                          std::atomic<uint64_t>::is_always_lock_free,
+                          "ApplicationRecordLog requires lock free atomics in shared memory");
+            static_assert(sizeof(m_layout_s) == M_HEADER_SIZE &&
+                          sizeof(m_bank_header_s) == M_BANK_HEADER_SIZE,
+                          "ApplicationRecordLog shared memory header size changed");
+            static_assert(M_HEADER_SIZE + M_NUM_BANK * (M_BANK_HEADER_SIZE +
+                                                        M_MAX_RECORD * sizeof(record_s) +
+                                                        M_MAX_REGION * sizeof(short_region_s)) <= M_LAYOUT_SIZE,
                           "Layout size used in geopmdpy/system_files.py to create shared memory footprint is smaller than required by C++ code");
 
+            /// @brief Marks the producer busy for the lifetime of the
+            ///        object and selects the active bank.
+            class BankScope
+            {
+                public:
+                    BankScope(ApplicationRecordLogImp &log);
+                    BankScope(const BankScope &other) = delete;
+                    BankScope &operator=(const BankScope &other) = delete;
+                    ~BankScope();
+                    m_bank_s &bank(void);
+                private:
+                    m_layout_s &m_layout;
+                    m_bank_s &m_bank;
+            };
+
             struct m_region_enter_s {
                 int record_idx;
                 int region_idx;
                 geopm_time_s enter_time;
                 bool is_short;
             };
-            void check_reset(m_layout_s &layout);
-            void append_record(m_layout_s &layout, const record_s &record);
+            void check_reset(m_bank_s &bank);
+            void flush_overflow(m_bank_s &bank);
+            bool is_full(const m_bank_s &bank) const;
+            void append_record(m_bank_s &bank, const record_s &record);
+            void append_record(const record_s &record);
             int m_process;
             std::shared_ptr<SharedMemory> m_shmem;
+            m_layout_s *m_layout;
+            int m_max_record;
+            bool m_is_tsc;
+            std::array<m_bank_s, M_NUM_BANK> m_bank;
+            /// Ring of records queued while the bank is full.  It
+            /// is allocated with M_MAX_OVERFLOW elements on the
+            /// first overflow, which only happens in the Profile.
+            std::vector<record_s> m_overflow;
+            size_t m_overflow_begin;
+            size_t m_overflow_size;
+            uint64_t m_num_drain;
+            double m_drain_time_total;
+            double m_drain_time_max;
             std::map<uint64_t, m_region_enter_s> m_hash_region_enter_map;
             uint64_t m_epoch_count;
             uint64_t m_entered_region_hash;
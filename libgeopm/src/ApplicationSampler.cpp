@@ -9,6 +9,7 @@
 #include <iostream>
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstring>
 #include <cerrno>
 #include <stdexcept>
@@ -135,12 +136,28 @@ namespace geopm
         , m_overhead_time(0.0)
         , m_num_registered(0)
         , m_num_client(0)
+        , m_tsc_period(tsc_period())
     {
         if (m_is_cpu_active.empty()) {
             m_is_cpu_active.resize(m_num_cpu, false);
         }
     }
 
+    double ApplicationSamplerImp::tsc_period(void)
+    {
+        // The first conversion calibrates the counter, so this is
+        // done before the control loop starts
+        double result = NAN;
+        uint64_t tsc_begin = geopm_time_tsc();
+        geopm_time_s time_begin;
+        geopm_time_s time_end;
+        if (geopm_time_tsc_to_time(tsc_begin, &time_begin) == 0 &&
+            geopm_time_tsc_to_time(tsc_begin + M_TSC_PERIOD_COUNT, &time_end) == 0) {
+            result = geopm_time_diff(&time_begin, &time_end) / M_TSC_PERIOD_COUNT;
+        }
+        return result;
+    }
+
     void ApplicationSamplerImp::update(const geopm_time_s &curr_time)
     {
         if (!m_status) {
@@ -149,50 +166,51 @@ namespace geopm
         GEOPM_DEBUG_ASSERT((int) m_hint_time.size() == m_num_cpu &&
                            (int) m_hint_last.size() == m_num_cpu,
                            "Mismatch in CPU/hint vectors");
-        // Dump the record log from each process, filter the results,
-        // and reindex the short region event signals.
+        // Dump the record log from each process, then filter,
+        // validate and reindex the short region event signals in a
+        // single pass that appends to the record buffer.
 
         // Clear the buffers that we will be building.
         m_record_buffer.clear();
         m_short_region_buffer.clear();
+        // Reference for the records stamped with the time stamp
+        // counter, read once if any process uses the counter
+        bool is_tsc_ref = false;
+        geopm_time_s time_ref = {{0, 0}};
+        uint64_t tsc_ref = 0;
         // Iterate over the record log for each process
         for (auto &proc_map_it : m_process_map) {
-            // Record the location in the record buffer where this
-            // process' data begins for updating the short region
-            // event signals.
-            size_t record_offset = m_record_buffer.size();
             // Get data from the record log
             auto &proc_it = proc_map_it.second;
             proc_it.record_log->dump(proc_it.records, proc_it.short_regions);
-            if (m_is_filtered) {
-                // Filter and check the records and push them onto
-                // m_record_buffer
-                for (const auto &record_it : proc_it.records) {
-                    for (auto &filtered_it : proc_it.filter->filter(record_it)) {
-                        proc_it.valid.check(filtered_it);
-                        m_record_buffer.push_back(filtered_it);
-                    }
-                }
-            }
-            else {
-                // Check the records and push them onto m_record_buffer
-                for (const auto &record : proc_it.records) {
-                    proc_it.valid.check(record);
+            if (proc_it.record_log->is_tsc_enabled()) {
+                if (!is_tsc_ref) {
+                    geopm_time(&time_ref);
+                    tsc_ref = geopm_time_tsc();
+                    is_tsc_ref = true;
                 }
-                m_record_buffer.insert(m_record_buffer.end(),
-                                       proc_it.records.begin(),
-                                       proc_it.records.end());
+                update_tsc(time_ref, tsc_ref, proc_it.records, proc_it.short_regions);
             }
-            // Update the "signal" field for all of the short region
-            // events to have the right offset.
+            // Offset for the "signal" field of the short region
+            // events from this process
+            size_t short_region_offset = m_short_region_buffer.size();
             size_t short_region_remain = proc_it.short_regions.size();
-            for (auto record_it = m_record_buffer.begin() + record_offset;
-                 short_region_remain > 0 &&
-                 record_it != m_record_buffer.end();
-                 ++record_it) {
-                if (record_it->event == EVENT_SHORT_REGION) {
-                    record_it->signal += m_short_region_buffer.size();
-                    --short_region_remain;
+            for (const auto &record_it : proc_it.records) {
+                size_t record_begin = m_record_buffer.size();
+                if (m_is_filtered) {
+                    proc_it.filter->filter(record_it, m_record_buffer);
+                }
+                else {
+                    m_record_buffer.push_back(record_it);
+                }
+                for (auto out_it = m_record_buffer.begin() + record_begin;
+                     out_it != m_record_buffer.end(); ++out_it) {
+                    proc_it.valid.check(*out_it);
+                    if (short_region_remain > 0 &&
+                        out_it->event == EVENT_SHORT_REGION) {
+                        out_it->signal += short_region_offset;
+                        --short_region_remain;
+                    }
                 }
             }
             m_short_region_buffer.insert(m_short_region_buffer.end(),
@@ -219,6 +237,32 @@ namespace geopm
         update_stop();
     }
 
+    void ApplicationSamplerImp::update_tsc(const geopm_time_s &time_ref,
+                                           uint64_t tsc_ref,
+                                           std::vector<record_s> &records,
+                                           std::vector<short_region_s> &short_regions) const
+    {
+        if (std::isnan(m_tsc_period)) {
+            throw Exception("ApplicationSamplerImp::update(): Record log uses the time stamp counter, but it cannot be converted by the controller",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        for (auto &record : records) {
+            if (record.event == EVENT_REGION_ENTRY ||
+                record.event == EVENT_REGION_EXIT ||
+                record.event == EVENT_SHORT_REGION ||
+                record.event == EVENT_EPOCH_COUNT) {
+                // Convert relative to a reference read during this
+                // update so that the rate measured at startup does
+                // not accumulate error over a long run
+                int64_t delta = (int64_t)(tsc_ref - ApplicationRecordLog::time_tsc(record.time));
+                geopm_time_add(&time_ref, -delta * m_tsc_period, &(record.time));
+            }
+        }
+        for (auto &region : short_regions) {
+            region.total_time *= 1E9 * m_tsc_period;
+        }
+    }
+
     void ApplicationSamplerImp::update_start(void)
     {
         bool do_update_zero = false;
@@ -299,7 +343,10 @@ namespace geopm
             result = GEOPM_REGION_HASH_APP;
         }
         else if (m_is_cpu_active[cpu_idx]) {
-            result = m_status->get_hash(cpu_idx);
+            int process = m_status->get_process(cpu_idx);
+            if (process >= 0) {
+                result = m_status->get_hash(process);
+            }
         }
         return result;
     }
@@ -311,7 +358,11 @@ namespace geopm
             result = GEOPM_REGION_HINT_INACTIVE;
         }
         if (m_status != nullptr && m_is_cpu_active[cpu_idx]) {
-            result = m_status->get_hint(cpu_idx);
+            result = GEOPM_REGION_HINT_UNSET;
+            int process = m_status->get_process(cpu_idx);
+            if (process >= 0) {
+                result = m_status->get_hint(process);
+            }
         }
         return result;
     }
@@ -454,6 +505,34 @@ namespace geopm
         return result;
     }
 
+    std::vector<std::pair<std::string, std::string> > ApplicationSamplerImp::report_host(void) const
+    {
+        uint64_t num_overflow = 0;
+        uint64_t max_overflow = 0;
+        uint64_t num_drop = 0;
+        uint64_t num_drain = 0;
+        double drain_time_total = 0.0;
+        double drain_time_max = 0.0;
+        for (const auto &proc_map_it : m_process_map) {
+            auto stats = proc_map_it.second.record_log->stats();
+            num_overflow += stats.num_overflow;
+            max_overflow = std::max(max_overflow, stats.max_overflow);
+            num_drop += stats.num_drop;
+            num_drain += stats.num_drain;
+            drain_time_total += stats.drain_time_total;
+            drain_time_max = std::max(drain_time_max, stats.drain_time_max);
+        }
+        double drain_time_mean = num_drain == 0 ? 0.0 : drain_time_total / num_drain;
+        return {
+            {"Record log overflow count", std::to_string(num_overflow)},
+            {"Record log overflow max", std::to_string(max_overflow)},
+            {"Record log dropped count", std::to_string(num_drop)},
+            {"Record log drain count", std::to_string(num_drain)},
+            {"Record log drain time mean (s)", string_format_double(drain_time_mean)},
+            {"Record log drain time max (s)", string_format_double(drain_time_max)},
+        };
+    }
+
     int ApplicationSamplerImp::sampler_cpu(void)
     {
         int result = m_num_cpu - 1;
@@ -13,6 +13,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 
 #include "geopm_time.h"
 
@@ -115,6 +116,12 @@ namespace geopm
             virtual bool do_shutdown(void) const = 0;
             virtual double total_time(void) const = 0;
             virtual double overhead_time(void) const = 0;
+            /// @brief Summary of the record log overflow and drain
+            ///        counters for all connected processes.
+            ///
+            /// @return Name value pairs for the host section of the
+            ///         report.
+            virtual std::vector<std::pair<std::string, std::string> > report_host(void) const = 0;
         protected:
             ApplicationSampler() = default;
         private:
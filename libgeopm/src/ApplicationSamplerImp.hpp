@@ -54,6 +54,7 @@ namespace geopm
             bool do_shutdown(void) const override;
             double total_time(void) const override;
             double overhead_time(void) const override;
+            std::vector<std::pair<std::string, std::string> > report_host(void) const override;
             int sampler_cpu(void);
         private:
             std::map<int, m_process_s> connect_record_log(const std::vector<int> &client_pids);
@@ -61,6 +62,13 @@ namespace geopm
             void update_cpu_active(void);
             void update_start(void);
             void update_stop(void);
+            void update_tsc(const geopm_time_s &time_ref,
+                            uint64_t tsc_ref,
+                            std::vector<record_s> &records,
+                            std::vector<short_region_s> &short_regions) const;
+            static double tsc_period(void);
+            /// Number of counts used to measure tsc_period().
+            static constexpr uint64_t M_TSC_PERIOD_COUNT = 1000000000000ULL;
             std::vector<record_s> m_record_buffer;
             std::vector<short_region_s> m_short_region_buffer;
             std::shared_ptr<ApplicationStatus> m_status;
@@ -84,6 +92,9 @@ namespace geopm
             double m_overhead_time;
             int m_num_registered;
             int m_num_client;
+            /// Seconds per time stamp counter increment, or NAN if
+            /// the counter cannot be converted.
+            double m_tsc_period;
     };
 }
 
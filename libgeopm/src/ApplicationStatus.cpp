@@ -41,71 +41,113 @@ namespace geopm
             throw Exception("ApplicationStatus: shared memory incorrectly sized",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        // Note: no lock; all members of the struct are 32-bits and will be
-        // accessed atomically by hardware.
+        // Note: no lock; the packed region state is a lock free
+        // atomic and all other members of the struct are 32-bits and
+        // will be accessed atomically by hardware.
         m_buffer = (m_app_status_s *)m_shmem->pointer();
-        m_cache.resize(m_shmem->size());
+        m_cache.resize(m_num_cpu);
         update_cache();
     }
 
-    void ApplicationStatusImp::set_hint(int cpu_idx, uint64_t hint)
+    void ApplicationStatusImp::check_process(const std::string &func_name, int process) const
     {
-        if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
-            throw Exception("ApplicationStatusImp::set_hint(): invalid CPU index: " + std::to_string(cpu_idx),
+        if (process < 0 || process >= m_num_cpu) {
+            throw Exception("ApplicationStatusImp::" + func_name + "(): invalid process index: " + std::to_string(process),
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        geopm::check_hint(hint);
-        GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
-        // pack hint into 32 bits for atomic write
-        m_buffer[cpu_idx].hint = (uint32_t)hint;
     }
 
-    uint64_t ApplicationStatusImp::get_hint(int cpu_idx) const
+    void ApplicationStatusImp::check_cpu(const std::string &func_name, int cpu_idx) const
     {
         if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
-            throw Exception("ApplicationStatusImp::get_hint(): invalid CPU index: " + std::to_string(cpu_idx),
+            throw Exception("ApplicationStatusImp::" + func_name + "(): invalid CPU index: " + std::to_string(cpu_idx),
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        GEOPM_DEBUG_ASSERT(m_cache.size() == buffer_size(m_num_cpu),
+    }
+
+    uint32_t ApplicationStatusImp::region_generation(uint64_t region)
+    {
+        return (region >> M_REGION_GENERATION_SHIFT) & M_REGION_GENERATION_MASK;
+    }
+
+    void ApplicationStatusImp::set_process(const std::set<int> &cpu_set, int process)
+    {
+        check_process(__func__, process);
+        for (int cpu_idx : cpu_set) {
+            check_cpu(__func__, cpu_idx);
+        }
+        GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
+        for (int cpu_idx : cpu_set) {
+            m_buffer[cpu_idx].process = process + 1;
+        }
+    }
+
+    int ApplicationStatusImp::get_process(int cpu_idx) const
+    {
+        check_cpu(__func__, cpu_idx);
+        int result = m_cache[cpu_idx].process - 1;
+        if (result < 0 || result >= m_num_cpu) {
+            result = -1;
+        }
+        return result;
+    }
+
+    void ApplicationStatusImp::set_hint(int process, uint64_t hint)
+    {
+        check_process(__func__, process);
+        geopm::check_hint(hint);
+        GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
+        // Only the process that owns the slot writes to it, so the
+        // read-modify-write does not need to be a single atomic
+        // operation.
+        std::atomic<uint64_t> &region = m_buffer[process].region;
+        uint64_t value = region.load(std::memory_order_relaxed);
+        value &= ~(M_REGION_HINT_MASK << M_REGION_HINT_SHIFT);
+        value |= hint << M_REGION_HINT_SHIFT;
+        region.store(value, std::memory_order_release);
+    }
+
+    uint64_t ApplicationStatusImp::get_hint(int process) const
+    {
+        check_process(__func__, process);
+        GEOPM_DEBUG_ASSERT((int)m_cache.size() == m_num_cpu,
                            "Memory for m_cache not sized correctly");
-        uint64_t result = (uint64_t)m_cache[cpu_idx].hint;
+        uint64_t result = (m_cache[process].region >> M_REGION_HINT_SHIFT) & M_REGION_HINT_MASK;
         geopm::check_hint(result);
         return result;
     }
 
-    void ApplicationStatusImp::set_hash(int cpu_idx, uint64_t hash, uint64_t hint)
+    void ApplicationStatusImp::set_hash(int process, uint64_t hash, uint64_t hint)
     {
-        if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
-            throw Exception("ApplicationStatusImp::set_hash(): invalid CPU index: " + std::to_string(cpu_idx),
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
+        check_process(__func__, process);
         if (((~0ULL << 32) & hash) != 0) {
             throw Exception("ApplicationStatusImp::set_hash(): invalid region hash: " + std::to_string(hash),
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
         geopm::check_hint(hint);
         GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
-        m_buffer[cpu_idx].hash = (uint32_t)hash;
-        m_buffer[cpu_idx].hint = (uint32_t)hint;
+        std::atomic<uint64_t> &region = m_buffer[process].region;
+        uint64_t generation = region_generation(region.load(std::memory_order_relaxed));
+        generation = (generation + 1) & M_REGION_GENERATION_MASK;
+        // Hash, hint and generation are published together so the
+        // controller never observes a torn hash/hint pair.
+        region.store(hash |
+                     (hint << M_REGION_HINT_SHIFT) |
+                     (generation << M_REGION_GENERATION_SHIFT),
+                     std::memory_order_release);
     }
 
-    uint64_t ApplicationStatusImp::get_hash(int cpu_idx) const
+    uint64_t ApplicationStatusImp::get_hash(int process) const
     {
-        if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
-            throw Exception("ApplicationStatusImp::get_hash(): invalid CPU index: " + std::to_string(cpu_idx),
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
-        GEOPM_DEBUG_ASSERT(m_cache.size() == buffer_size(m_num_cpu),
+        check_process(__func__, process);
+        GEOPM_DEBUG_ASSERT((int)m_cache.size() == m_num_cpu,
                            "Memory for m_cache not sized correctly");
-        return m_cache[cpu_idx].hash;
+        return m_cache[process].region & 0xFFFFFFFFULL;
     }
 
     void ApplicationStatusImp::reset_work_units(int cpu_idx)
     {
-        if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
-            throw Exception("ApplicationStatusImp::reset_work_units(): invalid CPU index: " + std::to_string(cpu_idx),
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
+        check_cpu(__func__, cpu_idx);
         GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
         m_buffer[cpu_idx].total_work = 0;
         m_buffer[cpu_idx].completed_work = 0;
@@ -113,26 +155,29 @@ namespace geopm
 
     void ApplicationStatusImp::set_total_work_units(int cpu_idx, int work_units)
     {
-        if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
-            throw Exception("ApplicationStatusImp::set_total_work_units(): invalid CPU index: " + std::to_string(cpu_idx),
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
+        check_cpu(__func__, cpu_idx);
         if (work_units <= 0) {
             throw Exception("ApplicationStatusImp::set_total_work_units(): invalid number of work units: " + std::to_string(work_units),
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
 
         }
         GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
+        // Record the generation of the region in the owning process
+        // so that the progress is invalidated when the region ends.
+        uint32_t generation = 0;
+        int process = m_buffer[cpu_idx].process - 1;
+        if (process >= 0 && process < m_num_cpu) {
+            generation = region_generation(m_buffer[process].region.load(std::memory_order_relaxed));
+        }
+        m_buffer[cpu_idx].completed_work = 0;
+        m_buffer[cpu_idx].work_generation = generation;
         // total_work non-zero gates per thread use of completed_work
         m_buffer[cpu_idx].total_work = work_units;
     }
 
     void ApplicationStatusImp::increment_work_unit(int cpu_idx)
     {
-        if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
-            throw Exception("ApplicationStatusImp::increment_work_unit(): invalid CPU index: " + std::to_string(cpu_idx),
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
+        check_cpu(__func__, cpu_idx);
         GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
 
         if (m_buffer[cpu_idx].total_work != 0) {
@@ -142,16 +187,19 @@ namespace geopm
 
     double ApplicationStatusImp::get_progress_cpu(int cpu_idx) const
     {
-        if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
-            throw Exception("ApplicationStatusImp::get_progress_cpu(): invalid CPU index: " + std::to_string(cpu_idx),
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
-        GEOPM_DEBUG_ASSERT(m_cache.size() == buffer_size(m_num_cpu),
+        check_cpu(__func__, cpu_idx);
+        GEOPM_DEBUG_ASSERT((int)m_cache.size() == m_num_cpu,
                            "Memory for m_cache not sized correctly");
         double result = NAN;
-        int total_work = m_cache[cpu_idx].total_work;
-        if (total_work != 0) {
-            result = (double)m_cache[cpu_idx].completed_work / total_work;
+        const m_status_cache_s &status = m_cache[cpu_idx];
+        uint32_t generation = 0;
+        int process = status.process - 1;
+        if (process >= 0 && process < m_num_cpu) {
+            generation = region_generation(m_cache[process].region);
+        }
+        int total_work = status.total_work;
+        if (total_work != 0 && status.work_generation == generation) {
+            result = (double)status.completed_work / total_work;
         }
         return result;
     }
@@ -159,8 +207,16 @@ namespace geopm
     void ApplicationStatusImp::update_cache(void)
     {
         GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
-        GEOPM_DEBUG_ASSERT(m_cache.size() == buffer_size(m_num_cpu),
+        GEOPM_DEBUG_ASSERT((int)m_cache.size() == m_num_cpu,
                            "Memory for m_cache not sized correctly");
-        std::copy(m_buffer, m_buffer + m_num_cpu, m_cache.begin());
+        for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
+            const m_app_status_s &status = m_buffer[cpu_idx];
+            m_status_cache_s &cache = m_cache[cpu_idx];
+            cache.region = status.region.load(std::memory_order_acquire);
+            cache.process = status.process;
+            cache.total_work = status.total_work;
+            cache.completed_work = status.completed_work;
+            cache.work_generation = status.work_generation;
+        }
     }
 }
@@ -8,7 +8,9 @@
 
 #include <cstdint>
 
+#include <atomic>
 #include <memory>
+#include <string>
 #include <vector>
 #include <set>
 
@@ -23,27 +25,51 @@ namespace geopm
     ///        region hint.  There will be one ApplicationStatus for
     ///        the node (board domain) on each side of the shared
     ///        memory.
+    ///
+    /// The region hash and hint are stored once per process in a
+    /// status slot that is updated with a single atomic write.  Each
+    /// CPU records the index of the slot for the process that it is
+    /// assigned to, and the controller uses get_process() to map
+    /// CPUs onto process slots.  Per-CPU state is only used to track
+    /// the progress of threads within a parallel region.
     class ApplicationStatus
     {
         public:
             virtual ~ApplicationStatus() = default;
 
-            /// @brief Set the current hint bits for a CPU.
-            /// @param [in] cpu_idx Index of the Linux logical CPU
+            /// @brief Assign a set of CPUs to a process status slot.
+            /// @param [in] cpu_set Indices of the Linux logical CPUs
+            ///             the process is affinitized to.
+            /// @param [in] process Index of the status slot for the
+            ///             process, by convention the lowest CPU
+            ///             index in the cpu_set.
+            virtual void set_process(const std::set<int> &cpu_set, int process) = 0;
+            /// @brief Get the status slot of the process assigned to
+            ///        a CPU.
+            /// @param [in] cpu_idx Index of the Linux logical CPU.
+            /// @return Index of the process status slot, or -1 if no
+            ///         process has been assigned to the CPU.
+            virtual int get_process(int cpu_idx) const = 0;
+            /// @brief Set the current hint bits for a process.
+            /// @param [in] process Index of the process status slot.
             /// @param [in] hint Bitfield of hint to set for the
-            ///             CPU.  Any existing hint will be
+            ///             process.  Any existing hint will be
             ///             overwritten.
-            virtual void set_hint(int cpu_idx, uint64_t hint) = 0;
-            /// @brief Get the current hint bits for a CPU.
-            /// @param [in] cpu_idx Index of the Linux logical CPU.
-            /// @return The current hint for the given CPU.
-            virtual uint64_t get_hint(int cpu_idx) const = 0;
+            virtual void set_hint(int process, uint64_t hint) = 0;
+            /// @brief Get the current hint bits for a process.
+            /// @param [in] process Index of the process status slot.
+            /// @return The current hint for the given process.
+            virtual uint64_t get_hint(int process) const = 0;
             /// @brief Set the hash and hint of the region currently
-            ///        running on a CPU.
-            virtual void set_hash(int cpu_idx, uint64_t hash, uint64_t hint) = 0;
-            /// @brief Get the hash of the region currently running on
-            ///        a CPU.
-            virtual uint64_t get_hash(int cpu_idx) const = 0;
+            ///        running in a process.  This invalidates the
+            ///        thread progress of all CPUs assigned to the
+            ///        process.
+            /// @param [in] process Index of the process status slot.
+            virtual void set_hash(int process, uint64_t hash, uint64_t hint) = 0;
+            /// @brief Get the hash of the region currently running in
+            ///        a process.
+            /// @param [in] process Index of the process status slot.
+            virtual uint64_t get_hash(int process) const = 0;
             virtual void reset_work_units(int cpu_idx) = 0;
             /// @brief Reset the total work units for all threads to
             ///        be completed as part of a parallel region.
@@ -59,7 +85,9 @@ namespace geopm
             ///        units that have been completed.
             /// @param [in] cpu_idx Index of the Linux logical CPU.
             /// @return Fraction of the total work completed by this
-            ///         CPU.
+            ///         CPU, or NAN if the total work is not set or
+            ///         the region hash of the process has been set
+            ///         since the total work was set.
             virtual double get_progress_cpu(int cpu_idx) const = 0;
             /// @brief Updates the local memory with the latest values from
             ///        the shared memory.  Any calls to get methods will use
@@ -93,35 +121,60 @@ namespace geopm
             ApplicationStatusImp(int num_cpu,
                                  std::shared_ptr<SharedMemory> shmem);
             virtual ~ApplicationStatusImp() = default;
-            void set_hint(int cpu_idx, uint64_t hint) override;
-            uint64_t get_hint(int cpu_idx) const override;
-            void set_hash(int cpu_idx, uint64_t hash, uint64_t hint) override;
-            uint64_t get_hash(int cpu_idx) const override;
+            void set_process(const std::set<int> &cpu_set, int process) override;
+            int get_process(int cpu_idx) const override;
+            void set_hint(int process, uint64_t hint) override;
+            uint64_t get_hint(int process) const override;
+            void set_hash(int process, uint64_t hash, uint64_t hint) override;
+            uint64_t get_hash(int process) const override;
             void reset_work_units(int cpu_idx) override;
             void set_total_work_units(int cpu_idx, int work_units) override;
             void increment_work_unit(int cpu_idx) override;
             double get_progress_cpu(int cpu_idx) const override;
             void update_cache(void) override;
         private:
-            // These fields must all be 32-bit int
+            /// Bits of m_app_status_s::region holding the region
+            /// hash, hint and generation of the process slot.  The
+            /// generation is incremented each time the hash is set
+            /// so that stale thread progress can be detected.
+            static constexpr int M_REGION_HINT_SHIFT = 32;
+            static constexpr uint64_t M_REGION_HINT_MASK = 0xFFULL;
+            static constexpr int M_REGION_GENERATION_SHIFT = 40;
+            static constexpr uint64_t M_REGION_GENERATION_MASK = 0xFFFFFFULL;
+            // The packed region state is only written by the process
+            // that owns the slot; the other fields must all be 32-bit
+            // int.
             struct m_app_status_s
             {
-                int32_t process; // can be negative, indicating unset process
-                uint32_t hint;
-                uint32_t hash;
+                std::atomic<uint64_t> region;
+                int32_t process; // process slot plus one, zero indicating unset process
                 uint32_t total_work;
                 uint32_t completed_work;
-                char padding[44];
+                uint32_t work_generation;
+                char padding[40];
             };
+            static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                          "ApplicationStatus requires lock free atomics in shared memory");
             static_assert((sizeof(ApplicationStatusImp::m_app_status_s) % geopm::hardware_destructive_interference_size) == 0,
                           "m_app_status_s not aligned to cache lines");
             static_assert(sizeof(ApplicationStatusImp::m_app_status_s) == ApplicationStatus::M_STATUS_SIZE,
                           "M_STATUS_SIZE does not match size of m_app_status_s");
+            struct m_status_cache_s
+            {
+                uint64_t region;
+                int32_t process;
+                uint32_t total_work;
+                uint32_t completed_work;
+                uint32_t work_generation;
+            };
+            void check_process(const std::string &func_name, int process) const;
+            void check_cpu(const std::string &func_name, int cpu_idx) const;
+            static uint32_t region_generation(uint64_t region);
 
             int m_num_cpu;
             std::shared_ptr<SharedMemory> m_shmem;
             m_app_status_s *m_buffer;
-            std::vector<m_app_status_s> m_cache;
+            std::vector<m_status_cache_s> m_cache;
     };
 }
 
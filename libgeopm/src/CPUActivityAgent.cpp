@@ -474,6 +474,8 @@ namespace geopm
                           std::to_string(m_resolved_f_uncore_efficient)});
         result.push_back({"Resolved Uncore Frequency Range",
                           std::to_string(m_resolved_f_uncore_max - m_resolved_f_uncore_efficient)});
+        auto wait_report = m_waiter->report();
+        result.insert(result.end(), wait_report.begin(), wait_report.end());
         return result;
     }
 
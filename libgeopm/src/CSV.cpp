@@ -5,6 +5,9 @@
 
 #include <climits>
 #include <cinttypes>
+#include <cstring>
+#include <algorithm>
+#include <iostream>
 
 #include "geopm_version.h"
 #include "geopm_hash.h"
@@ -12,9 +15,21 @@
 #include "CSV.hpp"
 #include "geopm/Exception.hpp"
 #include "geopm/Environment.hpp"
+#include "record.hpp"
 
 namespace geopm
 {
+    static std::string csv_header(const std::string &host_name, const std::string &start_time)
+    {
+        std::ostringstream result;
+        result << "# geopm_version: " << geopm_version() << "\n"
+               << "# start_time: " << start_time << "\n"
+               << "# profile_name: " << environment().profile() << "\n"
+               << "# node_name: " << host_name << "\n"
+               << "# agent: " << environment().agent() << "\n";
+        return result.str();
+    }
+
     CSVImp::CSVImp(const std::string &file_path,
                    const std::string &host_name,
                    const std::string &start_time,
@@ -108,11 +123,7 @@ namespace geopm
 
     void CSVImp::write_header(const std::string &host_name, const std::string &start_time)
     {
-        m_buffer << "# geopm_version: " << geopm_version() << "\n"
-                 << "# start_time: " << start_time << "\n"
-                 << "# profile_name: " << environment().profile() << "\n"
-                 << "# node_name: " << host_name << "\n"
-                 << "# agent: " << environment().agent() << "\n";
+        m_buffer << csv_header(host_name, start_time);
     }
 
     void CSVImp::activate(void)
@@ -137,4 +148,305 @@ namespace geopm
         }
         m_buffer << '\n';
     }
+
+    const std::string CSVBinaryImp::M_MAGIC = "GEOPMCSV";
+
+    CSVBinaryImp::CSVBinaryImp(const std::string &file_path,
+                               const std::string &host_name,
+                               const std::string &start_time,
+                               size_t buffer_size)
+        : M_FORMAT_NAME {"double", "float", "integer", "hex", "raw64",
+                         "event", "event_signal"}
+        , m_file_path(file_path)
+        , m_header(csv_header(host_name, start_time))
+        , m_buffer_limit(buffer_size)
+        , m_is_active(false)
+        , m_is_back_full(false)
+        , m_is_done(false)
+        , m_write_error(0)
+    {
+        if (host_name.size()) {
+            m_file_path += "-" + host_name;
+        }
+        m_stream.open(m_file_path, std::ios::binary);
+        if (!m_stream.good()) {
+            throw Exception("Unable to open CSV file '" + m_file_path + "'",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
+
+    CSVBinaryImp::~CSVBinaryImp()
+    {
+        if (m_is_active) {
+            try {
+                flush();
+            }
+            catch (const Exception &ex) {
+                std::cerr << "Warning: <geopm> " << ex.what() << std::endl;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_back_mutex);
+                m_is_done = true;
+            }
+            m_back_cv.notify_all();
+            m_writer.join();
+        }
+    }
+
+    void CSVBinaryImp::add_column(const std::string &name)
+    {
+        add_column(name, "double");
+    }
+
+    void CSVBinaryImp::add_column(const std::string &name, const std::string &format)
+    {
+        if (m_is_active) {
+            throw Exception("CSVBinaryImp::add_column() cannot be called after activate()",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (std::find(M_FORMAT_NAME.begin(), M_FORMAT_NAME.end(), format) == M_FORMAT_NAME.end()) {
+            throw Exception("CSVBinaryImp::add_column(), format is unknown: " + format,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_column_name.push_back(name);
+        m_column_format.push_back(format);
+    }
+
+    static const std::string &binary_format_name(const std::function<std::string(double)> &format)
+    {
+        static const std::string empty;
+        static const std::map<std::string(*)(double), std::string> format_map {
+            {string_format_double, "double"},
+            {string_format_float, "float"},
+            {string_format_integer, "integer"},
+            {string_format_hex, "hex"},
+            {string_format_raw64, "raw64"},
+        };
+        auto format_ptr = format.target<std::string(*)(double)>();
+        if (format_ptr == nullptr) {
+            return empty;
+        }
+        auto it = format_map.find(*format_ptr);
+        return it == format_map.end() ? empty : it->second;
+    }
+
+    void CSVBinaryImp::add_column(const std::string &name, std::function<std::string(double)> format)
+    {
+        if (m_is_active) {
+            throw Exception("CSVBinaryImp::add_column() cannot be called after activate()",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        const std::string &format_name = binary_format_name(format);
+        if (format_name.empty()) {
+            throw Exception("CSVBinaryImp::add_column(), format function cannot be stored in a binary file for column: " + name,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        add_column(name, format_name);
+    }
+
+    bool CSVBinaryImp::is_format_supported(const std::function<std::string(double)> &format)
+    {
+        return !binary_format_name(format).empty();
+    }
+
+    void CSVBinaryImp::activate(void)
+    {
+        if (m_is_active) {
+            return;
+        }
+        std::ostringstream schema;
+        uint32_t version = M_VERSION;
+        uint32_t num_column = m_column_name.size();
+        uint64_t header_size = m_header.size();
+        schema.write(M_MAGIC.data(), M_MAGIC.size());
+        schema.write((const char *)&version, sizeof(version));
+        schema.write((const char *)&num_column, sizeof(num_column));
+        schema.write((const char *)&header_size, sizeof(header_size));
+        schema << m_header;
+        for (size_t col_idx = 0; col_idx != m_column_name.size(); ++col_idx) {
+            for (const auto &str : {m_column_name[col_idx], m_column_format[col_idx]}) {
+                uint32_t str_size = str.size();
+                schema.write((const char *)&str_size, sizeof(str_size));
+                schema << str;
+            }
+        }
+        m_stream << schema.str();
+        m_stream.flush();
+        if (!m_stream.good()) {
+            throw Exception("CSVBinaryImp::activate(): Unable to write schema to '" + m_file_path + "'",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        // Round the buffer down to whole rows with at least one row
+        size_t row_size = std::max<size_t>(num_column, 1);
+        m_buffer_limit = std::max<size_t>(m_buffer_limit / sizeof(double) / row_size, 1) * row_size;
+        m_front.reserve(m_buffer_limit);
+        m_back.reserve(m_buffer_limit);
+        m_is_active = true;
+        m_writer = std::thread(&CSVBinaryImp::write_loop, this);
+    }
+
+    void CSVBinaryImp::update(const std::vector<double> &sample)
+    {
+        if (!m_is_active) {
+            throw Exception("CSVBinaryImp::activate() must be called prior to update",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (sample.size() != m_column_format.size()) {
+            throw Exception("CSVBinaryImp::update(): Input vector incorrectly sized",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_front.insert(m_front.end(), sample.begin(), sample.end());
+        if (m_front.size() >= m_buffer_limit) {
+            hand_off();
+        }
+    }
+
+    void CSVBinaryImp::flush(void)
+    {
+        if (!m_is_active) {
+            return;
+        }
+        if (!m_front.empty()) {
+            hand_off();
+        }
+        std::unique_lock<std::mutex> lock(m_back_mutex);
+        m_back_cv.wait(lock, [this]() { return !m_is_back_full; });
+        if (m_write_error != 0) {
+            int err = m_write_error;
+            m_write_error = 0;
+            throw Exception("CSVBinaryImp::flush(): Unable to write to '" + m_file_path + "'",
+                            err, __FILE__, __LINE__);
+        }
+    }
+
+    void CSVBinaryImp::hand_off(void)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_back_mutex);
+            m_back_cv.wait(lock, [this]() { return !m_is_back_full; });
+            std::swap(m_front, m_back);
+            m_is_back_full = true;
+        }
+        m_back_cv.notify_all();
+    }
+
+    void CSVBinaryImp::write_loop(void)
+    {
+        std::unique_lock<std::mutex> lock(m_back_mutex);
+        while (true) {
+            m_back_cv.wait(lock, [this]() { return m_is_back_full || m_is_done; });
+            if (!m_is_back_full) {
+                break;
+            }
+            // The back buffer is owned by this thread until
+            // m_is_back_full is cleared
+            lock.unlock();
+            m_stream.write((const char *)m_back.data(), m_back.size() * sizeof(double));
+            m_stream.flush();
+            int err = m_stream.good() ? 0 : (errno ? errno : GEOPM_ERROR_RUNTIME);
+            m_stream.clear();
+            m_back.clear();
+            lock.lock();
+            if (err != 0) {
+                m_write_error = err;
+            }
+            m_is_back_full = false;
+            m_back_cv.notify_all();
+        }
+    }
+
+    void CSVBinaryImp::convert(const std::string &binary_path, std::ostream &csv_stream)
+    {
+        enum column_type_e {
+            M_COLUMN_FUNCTION,
+            M_COLUMN_EVENT,
+            M_COLUMN_EVENT_SIGNAL,
+        };
+        static const std::map<std::string, std::function<std::string(double)> > format_function {
+            {"double", string_format_double},
+            {"float", string_format_float},
+            {"integer", string_format_integer},
+            {"hex", string_format_hex},
+            {"raw64", string_format_raw64},
+        };
+        std::ifstream binary_stream(binary_path, std::ios::binary);
+        if (!binary_stream.good()) {
+            throw Exception("CSVBinaryImp::convert(): Unable to open binary file '" + binary_path + "'",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        std::string magic(M_MAGIC.size(), '\0');
+        uint32_t version = 0;
+        uint32_t num_column = 0;
+        uint64_t header_size = 0;
+        binary_stream.read(&magic[0], magic.size());
+        binary_stream.read((char *)&version, sizeof(version));
+        binary_stream.read((char *)&num_column, sizeof(num_column));
+        binary_stream.read((char *)&header_size, sizeof(header_size));
+        if (!binary_stream.good() || magic != M_MAGIC || version != M_VERSION) {
+            throw Exception("CSVBinaryImp::convert(): File is not a binary CSV file of a supported version: " + binary_path,
+                            GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+        }
+        auto read_string = [&binary_stream, &binary_path](size_t size) {
+            std::string result(size, '\0');
+            binary_stream.read(&result[0], size);
+            if (!binary_stream.good()) {
+                throw Exception("CSVBinaryImp::convert(): Schema is truncated in binary file: " + binary_path,
+                                GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+            }
+            return result;
+        };
+        csv_stream << read_string(header_size);
+        std::vector<int> column_type(num_column);
+        std::vector<std::function<std::string(double)> > column_function(num_column);
+        for (uint32_t col_idx = 0; col_idx != num_column; ++col_idx) {
+            uint32_t str_size = 0;
+            binary_stream.read((char *)&str_size, sizeof(str_size));
+            std::string name = read_string(str_size);
+            binary_stream.read((char *)&str_size, sizeof(str_size));
+            std::string format = read_string(str_size);
+            if (format == "event") {
+                column_type[col_idx] = M_COLUMN_EVENT;
+            }
+            else if (format == "event_signal") {
+                column_type[col_idx] = M_COLUMN_EVENT_SIGNAL;
+            }
+            else {
+                auto it = format_function.find(format);
+                if (it == format_function.end()) {
+                    throw Exception("CSVBinaryImp::convert(): Unknown format \"" + format + "\" in binary file: " + binary_path,
+                                    GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+                }
+                column_type[col_idx] = M_COLUMN_FUNCTION;
+                column_function[col_idx] = it->second;
+            }
+            if (col_idx != 0) {
+                csv_stream << '|';
+            }
+            csv_stream << name;
+        }
+        csv_stream << '\n';
+        std::vector<double> row(num_column);
+        while (num_column != 0 &&
+               binary_stream.read((char *)row.data(), row.size() * sizeof(double))) {
+            int event = 0;
+            for (uint32_t col_idx = 0; col_idx != num_column; ++col_idx) {
+                if (col_idx != 0) {
+                    csv_stream << '|';
+                }
+                switch (column_type[col_idx]) {
+                    case M_COLUMN_EVENT:
+                        event = row[col_idx];
+                        csv_stream << event_name(event);
+                        break;
+                    case M_COLUMN_EVENT_SIGNAL:
+                        csv_stream << event_signal_format(event, row[col_idx]);
+                        break;
+                    default:
+                        csv_stream << column_function[col_idx](row[col_idx]);
+                        break;
+                }
+            }
+            csv_stream << '\n';
+        }
+    }
 }
@@ -7,11 +7,14 @@
 #define CSV_HPP_INCLUDE
 
 #include <vector>
+#include <condition_variable>
 #include <functional>
 #include <map>
+#include <mutex>
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <thread>
 
 namespace geopm
 {
@@ -105,6 +108,88 @@ namespace geopm
             off_t m_buffer_limit;
             bool m_is_active;
     };
+
+    /// @brief CSV implementation that stores the table in a binary
+    ///        file.  The file begins with a schema containing the
+    ///        same meta-data as the CSV header, the column names and
+    ///        the name of the format for each column.  The schema is
+    ///        followed by fixed-width rows of double precision
+    ///        values.  Rows are copied into one of two buffers by
+    ///        update() and a background thread writes the other
+    ///        buffer to the file, so update() does not format values
+    ///        or wait on file IO unless both buffers are full.  The
+    ///        convert() method creates the text CSV from the binary
+    ///        file.
+    ///
+    ///        Columns must be formatted with one of the format names
+    ///        accepted by CSV::add_column() or with one of the
+    ///        corresponding geopm::string_format_*() functions.  Two
+    ///        additional format names are supported for profile
+    ///        traces: "event" prints the column with
+    ///        geopm::event_name(), and "event_signal" prints the
+    ///        column with geopm::event_signal_format() based on the
+    ///        value of the "event" column in the same row.
+    class CSVBinaryImp : public CSV
+    {
+        public:
+            CSVBinaryImp(const std::string &file_path,
+                         const std::string &host_name,
+                         const std::string &start_time,
+                         size_t buffer_size);
+            CSVBinaryImp(const CSVBinaryImp &other) = delete;
+            CSVBinaryImp & operator=(const CSVBinaryImp &other) = delete;
+            virtual ~CSVBinaryImp();
+            void add_column(const std::string &name) override;
+            void add_column(const std::string &name,
+                            const std::string &format) override;
+            void add_column(const std::string &name,
+                            std::function<std::string(double)> format) override;
+            void activate(void) override;
+            void update(const std::vector<double> &sample) override;
+            void flush(void) override;
+            /// @brief Check if a format function can be stored in
+            ///        the schema of a binary file.
+            /// @param [in] format Function that converts a double
+            ///        precision value into a string.
+            /// @return True if the function is one of the
+            ///         geopm::string_format_*() functions that has a
+            ///         format name.
+            static bool is_format_supported(const std::function<std::string(double)> &format);
+            /// @brief Write the text CSV that CSVImp would have
+            ///        created for the rows stored in a binary file.
+            ///        A partial row at the end of the file is
+            ///        ignored.
+            /// @param [in] binary_path Path to a file created by
+            ///        CSVBinaryImp.
+            /// @param [out] csv_stream Stream where the CSV text is
+            ///        written.
+            static void convert(const std::string &binary_path,
+                                std::ostream &csv_stream);
+        private:
+            static constexpr uint32_t M_VERSION = 1;
+            static const std::string M_MAGIC;
+            // Move the front buffer to the writer thread, waiting
+            // for the previous hand off to complete
+            void hand_off(void);
+            void write_loop(void);
+
+            const std::vector<std::string> M_FORMAT_NAME;
+            std::string m_file_path;
+            std::string m_header;
+            std::vector<std::string> m_column_name;
+            std::vector<std::string> m_column_format;
+            std::ofstream m_stream;
+            size_t m_buffer_limit;
+            bool m_is_active;
+            std::vector<double> m_front;
+            std::vector<double> m_back;
+            std::mutex m_back_mutex;
+            std::condition_variable m_back_cv;
+            bool m_is_back_full;
+            bool m_is_done;
+            int m_write_error;
+            std::thread m_writer;
+    };
 }
 
 #endif
@@ -412,6 +412,10 @@ namespace geopm
         }
 
         auto agent_host_report = m_agent[0]->report_host();
+        auto sampler_host_report = m_application_sampler.report_host();
+        agent_host_report.insert(agent_host_report.end(),
+                                 sampler_host_report.begin(),
+                                 sampler_host_report.end());
 
         m_reporter->generate(m_agent_name,
                              agent_report_header,
@@ -434,7 +438,13 @@ namespace geopm
     {
         bool do_send = false;
         if (m_is_root) {
-            if (m_do_endpoint) {
+            if (m_do_endpoint && !m_endpoint->is_policy_updated()) {
+                // Policy has not been written since the last read
+                std::copy(m_last_policy.begin(), m_last_policy.end(),
+                          m_in_policy.begin());
+                do_send = false;
+            }
+            else if (m_do_endpoint) {
                 (void) m_endpoint->read_policy(m_in_policy);
                 bool equal = std::equal(m_in_policy.begin(), m_in_policy.end(),
                                         m_last_policy.begin(),
@@ -8,6 +8,8 @@
 
 #include "TensorOneD.hpp"
 #include "TensorTwoD.hpp"
+#include "TensorMatrix.hpp"
+#include "TensorMath.hpp"
 
 #include "geopm/Exception.hpp"
 #include "geopm/Helper.hpp"
@@ -27,6 +29,7 @@ namespace geopm
     DenseLayerImp::DenseLayerImp(const TensorTwoD &weights, const TensorOneD &biases) 
         : m_weights(weights)
         , m_biases(biases)
+        , m_math(TensorMath::make_shared())
     {
         if (weights.get_rows() == 0 && weights.get_cols() == 0) {
             throw Exception("DenseLayerImp::" + std::string(__func__) +
@@ -39,6 +42,18 @@ namespace geopm
                             "Incompatible dimensions for weights and biases.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+
+        size_t num_output = weights.get_rows();
+        size_t num_input = weights.get_cols();
+        m_weights_t.set_dim(num_input, num_output);
+        m_biases_row.set_dim(1, num_output);
+        for (size_t output_idx = 0; output_idx < num_output; ++output_idx) {
+            const auto &weights_row = weights.get_data()[output_idx].get_data();
+            for (size_t input_idx = 0; input_idx < num_input; ++input_idx) {
+                m_weights_t(input_idx, output_idx) = weights_row[input_idx];
+            }
+            m_biases_row(0, output_idx) = biases[output_idx];
+        }
     }
 
     TensorOneD DenseLayerImp::forward(const TensorOneD &input) const
@@ -52,6 +67,18 @@ namespace geopm
         return m_biases + m_weights * input;
     }
 
+    void DenseLayerImp::forward(const TensorMatrix &input, bool do_sigmoid,
+                                TensorMatrix &output) const
+    {
+        if (input.get_cols() != m_weights_t.get_rows()) {
+            throw Exception("DenseLayerImp::" + std::string(__func__) +
+                            "Input vector dimension is incompatible with network.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+
+        m_math->multiply_add(input, m_weights_t, m_biases_row, do_sigmoid, output);
+    }
+
     size_t DenseLayerImp::get_input_dim() const
     {
         return m_weights.get_cols();
@@ -11,6 +11,7 @@
 namespace geopm
 {
     class TensorTwoD;
+    class TensorMatrix;
 
     /// @brief Class to store dense layers and perform operations on 
     ///        the layers' 1D and 2D Tensors, aka vectors and matrices, 
@@ -42,6 +43,23 @@ namespace geopm
             ///
             /// @return Returns a TensorOneD vector of output values.
             virtual TensorOneD forward(const TensorOneD &input) const = 0;
+            /// @brief Perform inference for a batch of inputs, one per
+            ///        row, in a single matrix-matrix pass.
+            ///
+            /// @param [in] input TensorMatrix with one vector of input
+            ///        signals per row.
+            ///
+            /// @param [in] do_sigmoid Apply the logistic sigmoid to
+            ///        the output values.
+            ///
+            /// @param [out] output Resized to one row per input and
+            ///        one column per output value.  Storage is reused
+            ///        when it is large enough.
+            ///
+            /// @throws geopm::Exception if input dimension is incompatible
+            ///         with the DenseLayer.
+            virtual void forward(const TensorMatrix &input, bool do_sigmoid,
+                                 TensorMatrix &output) const = 0;
             /// @brief Get the dimension required for the input TensorOneD
             /// 
             /// @return Returns a size_t equal to the number of columns of weights
@@ -10,6 +10,7 @@
 
 #include "TensorOneD.hpp"
 #include "TensorTwoD.hpp"
+#include "TensorMatrix.hpp"
 
 namespace geopm
 {
@@ -35,6 +36,8 @@ namespace geopm
             ///
             /// @returns Returns a TensorOneD object of output values
             TensorOneD forward(const TensorOneD &input) const override;
+            void forward(const TensorMatrix &input, bool do_sigmoid,
+                         TensorMatrix &output) const override;
             /// @brief Get the dimension required for the input TensorOneD
             /// 
             /// @return Returns a size_t equal to the number of columns of weights
@@ -47,6 +50,11 @@ namespace geopm
         private:
             TensorTwoD m_weights;
             TensorOneD m_biases;
+            // Copies of the weights and biases in the layout used by
+            // TensorMath::multiply_add()
+            TensorMatrix m_weights_t;
+            TensorMatrix m_biases_row;
+            std::shared_ptr<TensorMath> m_math;
     };
 }
 
@@ -37,6 +37,32 @@ namespace geopm
         return std::make_shared<DomainNetMapImp>(nn_path, domain_type, domain_index);
     }
 
+    std::vector<std::shared_ptr<DomainNetMap> > DomainNetMap::make_shared(const std::string &nn_path,
+                                                                          geopm_domain_e domain_type,
+                                                                          const std::vector<int> &domain_indices)
+    {
+        return DomainNetMapImp::make_shared_batch(nn_path, domain_type, domain_indices,
+                                                  platform_io(), NNFactory::make_shared());
+    }
+
+    std::vector<std::shared_ptr<DomainNetMap> > DomainNetMapImp::make_shared_batch(
+        const std::string &nn_path, geopm_domain_e domain_type,
+        const std::vector<int> &domain_indices, PlatformIO &plat_io,
+        std::shared_ptr<NNFactory> nn_factory)
+    {
+        std::vector<std::shared_ptr<DomainNetMap> > result;
+        if (!domain_indices.empty()) {
+            auto first = std::make_shared<DomainNetMapImp>(nn_path, domain_type,
+                                                           domain_indices[0],
+                                                           plat_io, nn_factory);
+            result.push_back(first);
+            for (size_t idx = 1; idx < domain_indices.size(); ++idx) {
+                result.push_back(std::make_shared<DomainNetMapImp>(*first, domain_indices[idx]));
+            }
+        }
+        return result;
+    }
+
     DomainNetMapImp::DomainNetMapImp(const std::string &nn_path,
                                      geopm_domain_e domain_type,
                                      int domain_index)
@@ -52,6 +78,9 @@ namespace geopm
                                      std::shared_ptr<NNFactory> nn_factory)
         : m_platform_io(plat_io)
         , m_nn_factory(std::move(nn_factory))
+        , m_domain_type(domain_type)
+        , m_batch(std::make_shared<m_batch_s>())
+        , m_batch_row(0)
     {
         std::ifstream file(nn_path);
 
@@ -147,9 +176,9 @@ namespace geopm
             layers.push_back(json_to_DenseLayer(layer));
         }
 
-        m_neural_net = m_nn_factory->createLocalNeuralNet(layers);
+        m_batch->neural_net = m_nn_factory->createLocalNeuralNet(layers);
 
-        if (signal_inputs_size + delta_inputs_size != m_neural_net->get_input_dim()) {
+        if (signal_inputs_size + delta_inputs_size != m_batch->neural_net->get_input_dim()) {
             throw Exception("DomainNetMapImp::" + std::string(__func__) +
                             ": Neural net input dimension must match the number of "
                             "signal and delta inputs.",
@@ -164,7 +193,7 @@ namespace geopm
         }
 
         if (nnet_json["trace_outputs"].array_items().size()
-            != m_neural_net->get_output_dim()) {
+            != m_batch->neural_net->get_output_dim()) {
             throw Exception("DomainNetMapImp::" + std::string(__func__) +
                             ": Neural net output dimension must match the number of "
                             "trace outputs.",
@@ -178,10 +207,8 @@ namespace geopm
                                     ": Neural net signal inputs must be strings.",
                                     GEOPM_ERROR_INVALID, __FILE__, __LINE__);
                 }
-                m_signal_inputs.push_back({m_platform_io.push_signal(input.string_value(),
-                                                                     domain_type,
-                                                                     domain_index),
-                                           NAN});
+                m_signal_names.push_back(input.string_value());
+                push_signal_input(m_signal_names.back(), domain_index);
             }
         }
 
@@ -193,13 +220,9 @@ namespace geopm
                                     ": Neural net delta inputs must be tuples of strings.",
                                     GEOPM_ERROR_INVALID, __FILE__, __LINE__);
                 }
-                m_delta_inputs.push_back({m_platform_io.push_signal(input[0].string_value(),
-                                                                    domain_type,
-                                                                    domain_index),
-                                          m_platform_io.push_signal(input[1].string_value(),
-                                                                    domain_type,
-                                                                    domain_index),
-                                          NAN, NAN, NAN, NAN});
+                m_delta_names.emplace_back(input[0].string_value(),
+                                           input[1].string_value());
+                push_delta_input(m_delta_names.back(), domain_index);
             }
         }
 
@@ -211,6 +234,48 @@ namespace geopm
             }
             m_trace_outputs.push_back(output.string_value());
         }
+
+        m_batch->input.set_dim(1, m_batch->neural_net->get_input_dim());
+        m_batch->is_output_stale = false;
+    }
+
+    DomainNetMapImp::DomainNetMapImp(const DomainNetMapImp &other, int domain_index)
+        : m_platform_io(other.m_platform_io)
+        , m_nn_factory(other.m_nn_factory)
+        , m_domain_type(other.m_domain_type)
+        , m_signal_names(other.m_signal_names)
+        , m_delta_names(other.m_delta_names)
+        , m_batch(other.m_batch)
+        , m_batch_row(m_batch->input.get_rows())
+        , m_trace_outputs(other.m_trace_outputs)
+    {
+        for (const auto &name : m_signal_names) {
+            push_signal_input(name, domain_index);
+        }
+        for (const auto &names : m_delta_names) {
+            push_delta_input(names, domain_index);
+        }
+        m_batch->input.set_dim(m_batch_row + 1, m_batch->input.get_cols());
+    }
+
+    void DomainNetMapImp::push_signal_input(const std::string &name, int domain_index)
+    {
+        m_signal_inputs.push_back({m_platform_io.push_signal(name,
+                                                             m_domain_type,
+                                                             domain_index),
+                                   NAN});
+    }
+
+    void DomainNetMapImp::push_delta_input(const std::pair<std::string, std::string> &names,
+                                           int domain_index)
+    {
+        m_delta_inputs.push_back({m_platform_io.push_signal(names.first,
+                                                            m_domain_type,
+                                                            domain_index),
+                                  m_platform_io.push_signal(names.second,
+                                                            m_domain_type,
+                                                            domain_index),
+                                  NAN, NAN, NAN, NAN});
     }
 
     std::shared_ptr<DenseLayer> DomainNetMapImp::json_to_DenseLayer(const json11::Json &obj) const
@@ -301,23 +366,33 @@ namespace geopm
 
     void DomainNetMapImp::sample()
     {
-        std::vector<double> xs;
+        double *xs = m_batch->input.row(m_batch_row);
 
         // Sample latest signal values
         for (auto &input : m_signal_inputs) {
             input.signal = m_platform_io.sample(input.batch_idx);
-            xs.push_back(input.signal);
+            *xs++ = input.signal;
         }
         for (auto &input : m_delta_inputs) {
             input.signal_num_last = input.signal_num;
             input.signal_den_last = input.signal_den;
             input.signal_num = m_platform_io.sample(input.batch_idx_num);
             input.signal_den = m_platform_io.sample(input.batch_idx_den);
-            xs.push_back((input.signal_num - input.signal_num_last) /
-                         (input.signal_den - input.signal_den_last));
+            *xs++ = (input.signal_num - input.signal_num_last) /
+                    (input.signal_den - input.signal_den_last);
         }
 
-        m_last_output = m_neural_net->forward(m_nn_factory->createTensorOneD(xs));
+        m_batch->is_output_stale = true;
+    }
+
+    // Evaluate the neural net for every domain in the batch if any
+    // domain has been sampled since the last evaluation.
+    void DomainNetMapImp::update_output() const
+    {
+        if (m_batch->is_output_stale) {
+            m_batch->neural_net->forward(m_batch->input, m_batch->output);
+            m_batch->is_output_stale = false;
+        }
     }
 
     std::vector<std::string> DomainNetMapImp::trace_names() const
@@ -327,17 +402,22 @@ namespace geopm
 
     std::vector<double> DomainNetMapImp::trace_values() const
     {
-        std::vector<double> rval(m_last_output.get_data().begin(),
-                                 m_last_output.get_data().end());
+        update_output();
+        std::vector<double> rval;
+        if (m_batch_row < m_batch->output.get_rows()) {
+            const double *output = m_batch->output.row(m_batch_row);
+            rval.assign(output, output + m_batch->output.get_cols());
+        }
         return rval;
     }
 
     std::map<std::string, double> DomainNetMapImp::last_output() const
     {
         std::map<std::string, double> rval;
+        std::vector<double> output = trace_values();
 
-        for (size_t idx=0; idx<m_last_output.get_dim(); ++idx) {
-            rval[m_trace_outputs.at(idx)] = m_last_output[idx];
+        for (size_t idx=0; idx<output.size(); ++idx) {
+            rval[m_trace_outputs.at(idx)] = output[idx];
         }
 
         return rval;
@@ -66,6 +66,26 @@ namespace geopm
                                                              geopm_domain_e domain_type,
                                                              int domain_index);
 
+            /// @brief Returns one DomainNetMap for each of the given
+            ///        domains of a type, loading the neural net from
+            ///        the json file once.  The returned objects share
+            ///        the neural net and evaluate it for all of the
+            ///        domains in one batched pass the first time an
+            ///        output is requested after the domains are
+            ///        sampled.
+            ///
+            /// @param [in] nn_path Path to neural net json
+            ///
+            /// @param [in] domain_type Domain type, defined by geopm_domain_e enum
+            ///
+            /// @param [in] domain_indices Indices of the domains to be measured
+            ///
+            /// @throws geopm::Exception under the same conditions as
+            ///         the single domain make_shared().
+            static std::vector<std::shared_ptr<DomainNetMap> > make_shared(const std::string &nn_path,
+                                                                           geopm_domain_e domain_type,
+                                                                           const std::vector<int> &domain_indices);
+
             virtual ~DomainNetMap() = default;
             /// @brief Samples latest signals for a specific domain and applies the 
             ///        resulting TensorOneD state to the neural net.
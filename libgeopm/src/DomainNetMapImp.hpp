@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <set>
+#include <utility>
 
 #include "geopm/json11.hpp"
 
@@ -17,6 +18,7 @@
 #include "LocalNeuralNet.hpp"
 #include "TensorOneD.hpp"
 #include "TensorTwoD.hpp"
+#include "TensorMatrix.hpp"
 #include "NNFactory.hpp"
 
 namespace geopm
@@ -32,6 +34,16 @@ namespace geopm
             DomainNetMapImp(const std::string &nn_path, geopm_domain_e domain_type,
                             int domain_index, PlatformIO &plat_io,
                             std::shared_ptr<NNFactory> nn_factory);
+            /// @brief Evaluate the neural net of another DomainNetMapImp
+            ///        for a different domain of the same type.  The
+            ///        new domain is added to the batch of inputs that
+            ///        is shared with \p other.
+            DomainNetMapImp(const DomainNetMapImp &other, int domain_index);
+
+            static std::vector<std::shared_ptr<DomainNetMap> > make_shared_batch(
+                const std::string &nn_path, geopm_domain_e domain_type,
+                const std::vector<int> &domain_indices, PlatformIO &plat_io,
+                std::shared_ptr<NNFactory> nn_factory);
 
             void sample() override;
             /// @brief Generates the names for trace columns from the appropriate field in the neural net.
@@ -51,6 +63,10 @@ namespace geopm
             std::shared_ptr<DenseLayer> json_to_DenseLayer(const json11::Json &obj) const;
             TensorOneD json_to_TensorOneD(const json11::Json &obj) const;
             TensorTwoD json_to_TensorTwoD(const json11::Json &obj) const;
+            void push_signal_input(const std::string &name, int domain_index);
+            void push_delta_input(const std::pair<std::string, std::string> &names,
+                                  int domain_index);
+            void update_output() const;
 
             PlatformIO &m_platform_io;
             std::shared_ptr<NNFactory> m_nn_factory;
@@ -71,12 +87,25 @@ namespace geopm
                 double signal_den_last;
             };
 
+            // Inputs and outputs for all of the domains that share a
+            // neural net, one row per domain.
+            struct m_batch_s
+            {
+                std::shared_ptr<LocalNeuralNet> neural_net;
+                TensorMatrix input;
+                TensorMatrix output;
+                bool is_output_stale;
+            };
+
             static const std::set<std::string> M_EXPECTED_KEYS;
             // Size in bytes
             static constexpr int M_MAX_NNET_SIZE = 1024 * 1024;
-            std::shared_ptr<LocalNeuralNet> m_neural_net;
+            geopm_domain_e m_domain_type;
+            std::vector<std::string> m_signal_names;
+            std::vector<std::pair<std::string, std::string> > m_delta_names;
+            std::shared_ptr<m_batch_s> m_batch;
+            size_t m_batch_row;
 
-            TensorOneD m_last_output;
             std::vector<m_signal_s> m_signal_inputs;
             std::vector<m_delta_signal_s> m_delta_inputs;
             std::vector<std::string> m_trace_outputs;
@@ -13,7 +13,9 @@
 #include <dlfcn.h>
 #include <cxxabi.h>
 #include <limits.h>
+#include <algorithm>
 #include <iostream>
+#include <mutex>
 
 #include "ELF.hpp"
 #include "geopm/Exception.hpp"
@@ -77,6 +79,92 @@ namespace geopm
         return result;
     }
 
+    ELFSymbolTable::ELFSymbolTable(const std::map<size_t, std::string> &symbol_map)
+    {
+        m_location.reserve(symbol_map.size());
+        m_name_begin.reserve(symbol_map.size() + 1);
+        size_t buffer_size = 0;
+        for (const auto &symbol : symbol_map) {
+            buffer_size += symbol.second.size();
+        }
+        m_name_buffer.reserve(buffer_size);
+        for (const auto &symbol : symbol_map) {
+            m_location.push_back(symbol.first);
+            m_name_begin.push_back(m_name_buffer.size());
+            m_name_buffer += symbol.second;
+        }
+        m_name_begin.push_back(m_name_buffer.size());
+    }
+
+    size_t ELFSymbolTable::num_symbol(void) const
+    {
+        return m_location.size();
+    }
+
+    std::pair<size_t, std::string> ELFSymbolTable::lookup(size_t offset) const
+    {
+        std::pair<size_t, std::string> result(0, "");
+        auto location_it = std::upper_bound(m_location.begin(), m_location.end(), offset);
+        if (location_it != m_location.begin()) {
+            size_t symbol_idx = std::distance(m_location.begin(), location_it) - 1;
+            size_t name_begin = m_name_begin[symbol_idx];
+            result.first = m_location[symbol_idx];
+            result.second = m_name_buffer.substr(name_begin, m_name_begin[symbol_idx + 1] - name_begin);
+        }
+        return result;
+    }
+
+    std::shared_ptr<const ELFSymbolTable> elf_symbol_table(const std::string &file_path)
+    {
+        return std::make_shared<const ELFSymbolTable>(elf_symbol_map(file_path));
+    }
+
+    /// @brief Get the symbol index for the object file reported by
+    ///        dladdr().  The index is built on first use and cached
+    ///        by the dli_fname string.  If the file cannot be read
+    ///        as ELF, an empty index is cached so that the file is
+    ///        not read again.
+    static std::shared_ptr<const ELFSymbolTable> object_symbol_table(const char *dli_fname)
+    {
+        static std::mutex s_cache_mutex;
+        static std::map<std::string, std::shared_ptr<const ELFSymbolTable> > s_cache;
+
+        std::string object_name(dli_fname);
+        std::lock_guard<std::mutex> lock(s_cache_mutex);
+        auto cache_it = s_cache.find(object_name);
+        if (cache_it != s_cache.end()) {
+            return cache_it->second;
+        }
+        // If dli_fname is not an absolute path nor a shared
+        // object, assume the file points to current
+        // executable (/proc/self/exe).
+        std::string file_name(object_name);
+        if (file_name.find('/') == std::string::npos &&
+            file_name.find(".so") == std::string::npos) {
+            file_name = "/proc/self/exe";
+            char file_name_cstr[NAME_MAX];
+            int name_len = readlink(file_name.c_str(), file_name_cstr, NAME_MAX - 1);
+            if (name_len > 0 && name_len < NAME_MAX) {
+                file_name_cstr[name_len] = '\0';
+                file_name = file_name_cstr;
+            }
+        }
+        std::shared_ptr<const ELFSymbolTable> result;
+        try {
+            result = elf_symbol_table(file_name);
+        }
+        catch (const Exception &ex) {
+            // If the ELF read fails, just swallow the exception
+            std::string what(ex.what());
+            if (what.find("ELFImp") == std::string::npos) {
+                throw ex;
+            }
+            result = std::make_shared<const ELFSymbolTable>(std::map<size_t, std::string>{});
+        }
+        s_cache.emplace(object_name, result);
+        return result;
+    }
+
     std::pair<size_t, std::string> symbol_lookup(const void *instruction_ptr)
     {
         std::pair<size_t, std::string> result(0, "");
@@ -101,41 +189,13 @@ namespace geopm
                     base_addr = (size_t)info.dli_fbase;
                 }
                 target -= base_addr;
-                // If dli_fname is not an absolute path nor a shared
-                // object, assume the file points to current
-                // executable (/proc/self/exe).
-                std::string file_name(info.dli_fname);
-                if (file_name.find('/') == std::string::npos &&
-                    file_name.find(".so") == std::string::npos) {
-                    file_name = "/proc/self/exe";
-                    char file_name_cstr[NAME_MAX];
-                    int name_len = readlink(file_name.c_str(), file_name_cstr, NAME_MAX - 1);
-                    if (name_len > 0 && name_len < NAME_MAX) {
-                        file_name_cstr[name_len] = '\0';
-                        file_name = file_name_cstr;
-                    }
-                }
-                // Generate the symbol map from the object file and
-                // find the target address
-                try {
-                    std::map<size_t, std::string> symbol_map(elf_symbol_map(file_name));
-                    auto symbol_it = symbol_map.upper_bound(target);
-                    if (symbol_it != symbol_map.begin()) {
-                        --symbol_it;
-                    }
-                    if (symbol_it->first <= target) {
-                        result = *symbol_it;
-                        // Add back the random base address so it can be
-                        // compared with the input.
-                        result.first += base_addr;
-                    }
-                }
-                catch (const Exception &ex) {
-                   // If the ELF read fails, just swallow the exception
-                   std::string what(ex.what());
-                   if (what.find("ELFImp") == std::string::npos) {
-                       throw ex;
-                   }
+                // Find the target address in the symbol index of the
+                // object file
+                result = object_symbol_table(info.dli_fname)->lookup(target);
+                if (result.second.size()) {
+                    // Add back the random base address so it can be
+                    // compared with the input.
+                    result.first += base_addr;
                 }
             }
         }
@@ -198,7 +258,7 @@ namespace geopm
             throw Exception("ELFImp::ELFImp(): file_path invalid: " + file_path,
                             errno ? errno : GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        m_elf_handle = elf_begin(m_file_desc, ELF_C_READ, nullptr);
+        m_elf_handle = elf_begin(m_file_desc, ELF_C_READ_MMAP, nullptr);
         if (!m_elf_handle) {
             (void)close(m_file_desc);
             throw Exception("ELFImp::ELFImp(): libelf init failed on file: " + file_path,
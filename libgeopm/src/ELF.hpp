@@ -9,11 +9,16 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 
 namespace geopm
 {
     /// @brief Look up the nearest symbol lower than an instruction
     ///        address.
+    ///
+    /// The symbol index for each object file is built on the first
+    /// lookup of an address within that object and is reused for
+    /// all later lookups in the same object.
     /// @param [in] instruction_ptr Address of an instruction or function.
     /// @return Pair of symbol location and symbol name.  If symbol
     ///         couldn't be found, location is zero and symbol name is
@@ -25,6 +30,42 @@ namespace geopm
     /// @param [in] file_path Path to ELF encoded binary file.
     /// @return Map from symbol location to symbol name.
     std::map<size_t, std::string> elf_symbol_map(const std::string &file_path);
+
+    /// @brief Index of the symbols in one ELF file sorted by
+    ///        location.
+    ///
+    /// The locations are stored in a flat array that is searched
+    /// with a binary search, and the names are packed into a single
+    /// string buffer.
+    class ELFSymbolTable
+    {
+        public:
+            /// @brief Construct the index from a map of symbol
+            ///        location to symbol name.
+            /// @param [in] symbol_map Map from symbol location to
+            ///        symbol name.
+            ELFSymbolTable(const std::map<size_t, std::string> &symbol_map);
+            virtual ~ELFSymbolTable() = default;
+            /// @brief Number of symbols in the index.
+            /// @return Number of symbols.
+            size_t num_symbol(void) const;
+            /// @brief Find the symbol with the largest location that
+            ///        is less than or equal to an offset.
+            /// @param [in] offset Offset into the ELF file.
+            /// @return Pair of symbol location and symbol name.  If
+            ///         no symbol is at or below the offset, location
+            ///         is zero and symbol name is empty.
+            std::pair<size_t, std::string> lookup(size_t offset) const;
+        private:
+            std::vector<size_t> m_location;
+            std::vector<size_t> m_name_begin;
+            std::string m_name_buffer;
+    };
+
+    /// @brief Build the symbol index for an ELF file.
+    /// @param [in] file_path Path to ELF encoded binary file.
+    /// @return Symbol index for the file.
+    std::shared_ptr<const ELFSymbolTable> elf_symbol_table(const std::string &file_path);
 }
 
 #endif
@@ -142,6 +142,13 @@ namespace geopm
     std::vector<record_s> EditDistEpochRecordFilter::filter(const record_s &record)
     {
         std::vector<record_s> result;
+        filter(record, result);
+        return result;
+    }
+
+    void EditDistEpochRecordFilter::filter(const record_s &record,
+                                           std::vector<record_s> &result)
+    {
         // EVENT_EPOCH_COUNT needs to be filtered but everything else passes through.
         if (record.event != EVENT_EPOCH_COUNT) {
             result.push_back(record);
@@ -156,7 +163,6 @@ namespace geopm
                 }
             }
         }
-        return result;
     }
 
 
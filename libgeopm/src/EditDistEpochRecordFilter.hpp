@@ -54,6 +54,8 @@ namespace geopm
             EditDistEpochRecordFilter(const std::string &name);
             virtual ~EditDistEpochRecordFilter() = default;
             std::vector<record_s> filter(const record_s &record) override;
+            void filter(const record_s &record,
+                        std::vector<record_s> &result) override;
             /// @brief Static function that will parse the filter
             ///        string for the edit_distance into the constructor
             ///        arguments for a EditDistanceEpochRecordFilter.
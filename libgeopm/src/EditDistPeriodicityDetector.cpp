@@ -16,15 +16,29 @@
 
 namespace geopm
 {
+    // This value is supposed to be INF but not so large that it gets
+    // wrapped around when a small value is added to it.
+    static constexpr uint32_t M_DIST_INF = std::numeric_limits<uint32_t>::max() / 2;
+    // Number of columns updated together by update_row().  Rows are
+    // padded so that the last block may extend past the history.
+    static constexpr int M_DP_BLOCK = 8;
+
     EditDistPeriodicityDetector::EditDistPeriodicityDetector(int history_buffer_size)
         : m_history_buffer(history_buffer_size)
         , m_history_buffer_size(history_buffer_size)
         , m_period(-1)
         , m_score(-1)
         , m_record_count(0)
-        , m_DP(history_buffer_size * history_buffer_size * history_buffer_size)
+        , m_DP_row_size(history_buffer_size + M_DP_BLOCK)
+        , m_DP((size_t)history_buffer_size * m_DP_row_size)
+        , m_DP_empty_row(m_DP_row_size)
+        , m_DP_inf_row(m_DP_row_size, M_DIST_INF)
+        , m_DP_last_row(m_DP_row_size)
+        , m_DP_last_row_above(m_DP_row_size)
     {
-
+        for (int jj = 0; jj < m_DP_row_size; ++jj) {
+            m_DP_empty_row[jj] = jj;
+        }
     }
 
     void EditDistPeriodicityDetector::update(const record_s &record)
@@ -36,32 +50,37 @@ namespace geopm
         }
     }
 
-    size_t EditDistPeriodicityDetector::Didx(int ii, int jj, int mm) const {
-        return (ii % m_history_buffer_size) * m_history_buffer_size * m_history_buffer_size +
-               (jj % m_history_buffer_size) * m_history_buffer_size +
-               (mm % m_history_buffer_size);
+    uint32_t *EditDistPeriodicityDetector::DP_row(int ii)
+    {
+        return m_DP.data() + (size_t)(ii % m_history_buffer_size) * m_DP_row_size;
     }
 
-    void EditDistPeriodicityDetector::Dset(int ii, int jj, int mm, uint32_t val) {
-        m_DP[Didx(ii, jj, mm)] = val;
+    uint32_t EditDistPeriodicityDetector::DP_diag(int mm) const
+    {
+        uint32_t result = M_DIST_INF;
+        int jj = m_record_count - mm;
+        if (jj < m_history_buffer_size) {
+            result = m_DP[(size_t)(mm % m_history_buffer_size) * m_DP_row_size + jj];
+        }
+        return result;
     }
 
-    uint32_t EditDistPeriodicityDetector::Dget(int ii, int jj, int mm) const {
-        // This value is supposed to be INF but not so large that it gets wrapped around when
-        // a small value is added to it.
-        uint32_t result = std::numeric_limits<uint32_t>::max() / 2;
-
-        // D[ii, jj, mm] is the string-edit distance between records [0..ii) and
-        // [mm..mm+jj). If ii is too short, the values will be truncated.
-        // Likewise, if mm is too small, this refers to data that has been lost.
-        // We want to truncate values of jj that are too *large*.
-        if (m_record_count - ii < m_history_buffer_size &&
-            jj < m_history_buffer_size &&
-            m_record_count - mm < m_history_buffer_size) {
-            result = m_DP[Didx(ii, jj, mm)];
+    // Update one row of the edit distance table for all candidate
+    // periods at once.  The three input rows are distinct from the
+    // output row, so there is no dependency between columns and each
+    // fixed size block is vectorized by the compiler.  Values past
+    // num_col are never read.
+    static void update_row(const uint32_t *__restrict__ row_above,
+                           const uint32_t *__restrict__ last_row_above,
+                           const uint32_t *__restrict__ last_row,
+                           uint32_t term, int num_col, uint32_t *__restrict__ row)
+    {
+        for (int block = 1; block <= num_col; block += M_DP_BLOCK) {
+            for (int jj = block; jj < block + M_DP_BLOCK; ++jj) {
+                uint32_t val = std::min(row_above[jj] + 1, last_row[jj - 1] + 1);
+                row[jj] = std::min(val, last_row_above[jj - 1] + term);
+            }
         }
-
-        return result;
     }
 
     void EditDistPeriodicityDetector::calc_period(void) {
@@ -69,53 +88,49 @@ namespace geopm
             return;
         }
 
+        // D[ii, jj, mm] is the string-edit distance between records
+        // [0..ii) and [mm..mm+jj) where the prefix may begin at any
+        // record.  When the record at index n - 1 is added, only the
+        // values where jj == n - mm change, and each of those depends
+        // only on the value for the same mm computed when the
+        // previous record was added.  The table therefore stores a
+        // single value for each (ii, jj) pair where jj = n - mm, and
+        // each row ii is updated in place from the previous values of
+        // rows ii and ii - 1.  Rows for records that are no longer in
+        // the history buffer, or values where jj exceeds the history,
+        // are treated as infinite.
         int num_recs_in_hist = m_history_buffer.size();
-
-        for (int ii = std::max({0, m_record_count - m_history_buffer_size}); ii < m_record_count; ++ii) {
-            Dset(ii, 0, m_record_count - 1, 0);
-        }
-        for (int mm = std::max({0, m_record_count - m_history_buffer_size}); mm < m_record_count; ++mm) {
-            Dset(0, m_record_count - mm, mm, m_record_count - mm);
-        }
-
         uint64_t last_rec_in_history = m_history_buffer.value(num_recs_in_hist - 1);
-        for (int mm = std::max({1, m_record_count - m_history_buffer_size}); mm < m_record_count; ++mm) {
-            for (int ii = std::max({1, m_record_count - m_history_buffer_size}); ii < mm + 1; ++ii) {
-                // If the record to be compared to the latest addition is not new enough to reside in the
-                // history buffer, by default it is not a match. If it is in the history buffer, the penalty
-                // term is 0 if they are equal.
-
-                // ii is the length of the first substring that we are comparing against. If there were
-                // no history truncation, we would be comparing entry ii - 1 (0-indexed) to the latest
-                // record, entry m_record_count - 1.
-
-                // entry_age is 1 for the most recent entry (it goes from 1 to m_record_count, inclusive)
-                int entry_age = m_record_count - (ii - 1);
-                // If entry_age is above num_recs_in_hist, it will no longer be in our buffer.
-                bool cond_newrec = entry_age <= num_recs_in_hist;
-                int term = 2;
-                if (cond_newrec) {
-                    // We still have the desired record, so we can compare it to the new one.
-                    uint64_t compared_rec = m_history_buffer.value(num_recs_in_hist - entry_age);
-                    if (compared_rec == last_rec_in_history) {
-                        term = 0;
-                    }
-                }
-                // The value that will go into the D matrix (i.e. penalty) is the minimum of the
-                // added penalties from all directions (add/subtract/replace).
-                uint32_t d_value = std::min({Dget(ii - 1, m_record_count - mm    , mm) + 1,
-                                             Dget(ii    , m_record_count - mm - 1, mm) + 1,
-                                             Dget(ii - 1, m_record_count - mm - 1, mm) + term});
-                Dset(ii, m_record_count - mm, mm, d_value);
-            }
+        int ii_begin = std::max(1, m_record_count - m_history_buffer_size + 1);
+        const uint32_t *row_above = m_DP_inf_row.data();
+        if (m_record_count < m_history_buffer_size) {
+            row_above = m_DP_empty_row.data();
+        }
+        std::copy(row_above, row_above + m_DP_row_size, m_DP_last_row_above.begin());
+        for (int ii = ii_begin; ii < m_record_count; ++ii) {
+            // Only values with ii <= mm are used: jj ranges from 1 to
+            // the number of records that follow record ii - 1.
+            int num_col = m_record_count - ii;
+            uint32_t *row = DP_row(ii);
+            // Any record may begin a match with the empty string.
+            row[0] = 0;
+            std::copy(row, row + num_col, m_DP_last_row.begin());
+            // The penalty term is 0 if record ii - 1 matches the
+            // latest record, and 2 (delete plus insert) otherwise.
+            uint64_t compared_rec = m_history_buffer.value(num_recs_in_hist - num_col - 1);
+            uint32_t term = compared_rec == last_rec_in_history ? 0 : 2;
+            update_row(row_above, m_DP_last_row_above.data(), m_DP_last_row.data(),
+                       term, num_col, row);
+            std::swap(m_DP_last_row, m_DP_last_row_above);
+            row_above = row;
         }
 
         int mm = std::max({(int)(m_record_count / 2.0 + 0.5), m_record_count - m_history_buffer_size});
         int bestm = mm;
-        uint32_t bestval = Dget(mm, m_record_count - mm, mm);
+        uint32_t bestval = DP_diag(mm);
         ++mm;
         for(; mm < m_record_count; ++mm) {
-            uint32_t val = Dget(mm, m_record_count - mm, mm);
+            uint32_t val = DP_diag(mm);
             if(val < bestval) {
                 bestval = val;
                 bestm = mm;
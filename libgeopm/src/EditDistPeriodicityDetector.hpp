@@ -41,9 +41,8 @@ namespace geopm
             int num_records(void) const;
         private:
             void calc_period();
-            size_t Didx(int ii, int jj, int mm) const;
-            uint32_t Dget(int ii, int jj, int mm) const;
-            void Dset(int ii, int jj, int mm, uint32_t val);
+            uint32_t *DP_row(int ii);
+            uint32_t DP_diag(int mm) const;
             uint64_t get_history_value(int index) const;
             int find_smallest_repeating_pattern(int index) const;
 
@@ -52,7 +51,18 @@ namespace geopm
             int m_period;
             int m_score;
             int m_record_count;
+            const int m_DP_row_size;
+            /// Edit distance table with one row per record in the
+            /// history (indexed modulo the history size) and one
+            /// column per candidate period length.
             std::vector<uint32_t> m_DP;
+            /// Distances for the empty prefix of the history.
+            std::vector<uint32_t> m_DP_empty_row;
+            /// Distances for a record that is no longer in the history.
+            std::vector<uint32_t> m_DP_inf_row;
+            /// Copies of the previous values of the rows being updated.
+            std::vector<uint32_t> m_DP_last_row;
+            std::vector<uint32_t> m_DP_last_row_above;
     };
 }
 
@@ -8,13 +8,17 @@
 
 #include <cmath>
 #include <cstring>
+#include <cerrno>
+#include <climits>
 #include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <time.h>
 
 #include <algorithm>
 #include <string>
 #include <fstream>
-#include <thread>
-#include <chrono>
+#include <new>
 #include <stdexcept>
 
 #include "geopm/Environment.hpp"
@@ -40,6 +44,42 @@ namespace geopm
         return "-sample";
     }
 
+    void EndpointImp::shm_write_begin(std::atomic<uint32_t> &sequence)
+    {
+        sequence.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void EndpointImp::shm_write_end(std::atomic<uint32_t> &sequence)
+    {
+        sequence.fetch_add(1, std::memory_order_release);
+    }
+
+    void EndpointImp::shm_notify(std::atomic<uint32_t> &notify)
+    {
+        notify.fetch_add(1, std::memory_order_release);
+        long ret = syscall(SYS_futex, &notify, FUTEX_WAKE, INT_MAX,
+                           nullptr, nullptr, 0);
+        if (ret == -1) {
+            throw Exception("EndpointImp::shm_notify(): System call failed: futex(2)",
+                            errno ? errno : GEOPM_ERROR_RUNTIME,
+                            __FILE__, __LINE__);
+        }
+    }
+
+    void EndpointImp::shm_wait(std::atomic<uint32_t> &notify, uint32_t value, double timeout)
+    {
+        struct timespec timeout_ts = {(time_t)timeout,
+                                      (long)(std::fmod(timeout, 1.0) * 1e9)};
+        long ret = syscall(SYS_futex, &notify, FUTEX_WAIT, value,
+                           &timeout_ts, nullptr, 0);
+        if (ret == -1 && errno != ETIMEDOUT && errno != EAGAIN && errno != EINTR) {
+            throw Exception("EndpointImp::shm_wait(): System call failed: futex(2)",
+                            errno ? errno : GEOPM_ERROR_RUNTIME,
+                            __FILE__, __LINE__);
+        }
+    }
+
     EndpointImp::EndpointImp(const std::string &data_path)
         : EndpointImp(data_path, nullptr, nullptr, 0, 0)
     {
@@ -78,12 +118,10 @@ namespace geopm
             m_sample_shmem = SharedMemory::make_unique_owner(m_path + shm_sample_postfix(), shmem_size);
         }
         auto lock_p = m_policy_shmem->get_scoped_lock();
-        struct geopm_endpoint_policy_shmem_s *data_p = (struct geopm_endpoint_policy_shmem_s*)m_policy_shmem->pointer();
-        *data_p = {};
+        new (m_policy_shmem->pointer()) geopm_endpoint_policy_shmem_s {};
 
         auto lock_s = m_sample_shmem->get_scoped_lock();
-        struct geopm_endpoint_sample_shmem_s *data_s = (struct geopm_endpoint_sample_shmem_s*)m_sample_shmem->pointer();
-        *data_s = {};
+        new (m_sample_shmem->pointer()) geopm_endpoint_sample_shmem_s {};
         m_is_open = true;
     }
 
@@ -112,9 +150,11 @@ namespace geopm
         }
         auto policy_lock = m_policy_shmem->get_scoped_lock();
         auto data = (struct geopm_endpoint_policy_shmem_s *)m_policy_shmem->pointer();
+        shm_write_begin(data->sequence);
         data->count = policy.size();
         std::copy(policy.begin(), policy.end(), data->values);
         geopm_time(&data->timestamp);
+        shm_write_end(data->sequence);
     }
 
     double EndpointImp::read_sample(std::vector<double> &sample)
@@ -127,13 +167,16 @@ namespace geopm
             throw Exception("EndpointImp::" + std::string(__func__) + "(): output sample vector is incorrect size.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        auto lock = m_sample_shmem->get_scoped_lock();
         struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) m_sample_shmem->pointer(); // Managed by shmem subsystem.
 
-        int num_sample = data->count;
-        std::copy(data->values, data->values + data->count, sample.begin());
-        geopm_time_s ts = data->timestamp;
-        if (sample.size() != (size_t)num_sample) {
+        size_t num_sample = 0;
+        geopm_time_s ts;
+        shm_read(*m_sample_shmem, data->sequence, [&]() {
+            num_sample = data->count;
+            std::copy_n(data->values, std::min(num_sample, sample.size()), sample.begin());
+            ts = data->timestamp;
+        });
+        if (sample.size() != num_sample) {
             throw Exception("EndpointImpUser::" + std::string(__func__) + "(): Data read from shmem does not match number of samples.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
@@ -146,11 +189,13 @@ namespace geopm
             throw Exception("EndpointImp::" + std::string(__func__) + "(): cannot use shmem before calling open()",
                             GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
         }
-        auto lock = m_sample_shmem->get_scoped_lock();
         struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) m_sample_shmem->pointer(); // Managed by shmem subsystem.
 
         char agent_name[GEOPM_ENDPOINT_AGENT_NAME_MAX];
-        std::copy(data->agent, data->agent + GEOPM_ENDPOINT_AGENT_NAME_MAX, agent_name);
+        shm_read(*m_sample_shmem, data->sequence, [&]() {
+            std::copy(data->agent, data->agent + GEOPM_ENDPOINT_AGENT_NAME_MAX, agent_name);
+        });
+        agent_name[GEOPM_ENDPOINT_AGENT_NAME_MAX - 1] = '\0';
         std::string agent = agent_name;
         if (agent != "") {
             m_num_policy = Agent::num_policy(agent_name);
@@ -161,39 +206,51 @@ namespace geopm
 
     void EndpointImp::wait_for_agent_attach(double timeout)
     {
-        std::string agent = get_agent();
-        geopm_time_s start;
-        geopm_time(&start);
-        while (m_continue_loop && agent == "") {
-            agent = get_agent();
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            if (timeout >= 0 && geopm_time_since(&start) >= timeout) {
-                throw Exception("EndpointImp::" + std::string(__func__) +
-                                "(): timed out waiting for controller.",
-                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
-            }
-        }
+        wait_for_agent(true, timeout, __func__);
     }
 
     void EndpointImp::wait_for_agent_detach(double timeout)
     {
-        std::string agent = get_agent();
+        wait_for_agent(false, timeout, __func__);
+    }
+
+    void EndpointImp::wait_for_agent(bool is_attach, double timeout, const std::string &func_name)
+    {
+        if (!m_is_open) {
+            throw Exception("EndpointImp::" + func_name + "(): cannot use shmem before calling open()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
         geopm_time_s start;
         geopm_time(&start);
-        while (m_continue_loop && agent != "") {
-            agent = get_agent();
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            if (timeout >= 0 && geopm_time_since(&start) >= timeout) {
-                throw Exception("EndpointImp::" + std::string(__func__) +
-                                "(): timed out waiting for controller.",
-                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        auto data = (struct geopm_endpoint_sample_shmem_s *)m_sample_shmem->pointer();
+        // Load the notify word before checking the agent so that an
+        // attach or detach in between ends the wait
+        uint32_t notify = data->notify.load(std::memory_order_acquire);
+        std::string agent = get_agent();
+        while (m_continue_loop && (agent == "") == is_attach) {
+            double wait_time = M_WAIT_INTERVAL;
+            if (timeout >= 0) {
+                double remaining = timeout - geopm_time_since(&start);
+                if (remaining <= 0) {
+                    throw Exception("EndpointImp::" + func_name +
+                                    "(): timed out waiting for controller.",
+                                    GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+                }
+                wait_time = std::min(wait_time, remaining);
             }
+            shm_wait(data->notify, notify, wait_time);
+            notify = data->notify.load(std::memory_order_acquire);
+            agent = get_agent();
         }
     }
 
     void EndpointImp::stop_wait_loop(void)
     {
         m_continue_loop = false;
+        if (m_is_open) {
+            auto data = (struct geopm_endpoint_sample_shmem_s *)m_sample_shmem->pointer();
+            shm_notify(data->notify);
+        }
     }
 
     void EndpointImp::reset_wait_loop(void)
@@ -9,19 +9,26 @@
 #include <pthread.h>
 #include <limits.h>
 
+#include <atomic>
+
 #include "geopm_endpoint.h"
 #include "geopm_time.h"
 #include "geopm/Endpoint.hpp"
+#include "geopm/SharedMemory.hpp"
 
 namespace geopm
 {
     struct geopm_endpoint_policy_shmem_header {
+        std::atomic<uint32_t> sequence; // 4 bytes
+        uint32_t padding;     // 4 bytes
         geopm_time_s timestamp;   // 16 bytes
         size_t count;         // 8 bytes
         double values;        // 8 bytes
     };
 
     struct geopm_endpoint_sample_shmem_header {
+        std::atomic<uint32_t> sequence; // 4 bytes
+        std::atomic<uint32_t> notify;   // 4 bytes
         geopm_time_s timestamp;   // 16 bytes
         char agent[GEOPM_ENDPOINT_AGENT_NAME_MAX]; // 256 bytes
         char profile_name[GEOPM_ENDPOINT_PROFILE_NAME_MAX];   // 256 bytes
@@ -31,6 +38,10 @@ namespace geopm
     };
 
     struct geopm_endpoint_policy_shmem_s {
+        /// @brief Incremented before and after each update, odd
+        ///        while an update is in progress.
+        std::atomic<uint32_t> sequence;
+        uint32_t padding;
         /// @brief Time that the memory was last updated.
         geopm_time_s timestamp;
         /// @brief Specifies the size of the following array.
@@ -40,6 +51,12 @@ namespace geopm
     };
 
     struct geopm_endpoint_sample_shmem_s {
+        /// @brief Incremented before and after each update, odd
+        ///        while an update is in progress.
+        std::atomic<uint32_t> sequence;
+        /// @brief Incremented when an agent attaches or detaches,
+        ///        waiters sleep on this word with futex(2).
+        std::atomic<uint32_t> notify;
         /// @brief Time that the memory was last updated.
         geopm_time_s timestamp;
         /// @brief Holds the name of the Agent attached, if any.
@@ -58,8 +75,9 @@ namespace geopm
 
     static_assert(sizeof(struct geopm_endpoint_policy_shmem_s) == 4096, "Alignment issue with geopm_endpoint_policy_shmem_s.");
     static_assert(sizeof(struct geopm_endpoint_sample_shmem_s) == 4096, "Alignment issue with geopm_endpoint_sample_shmem_s.");
-
-    class SharedMemory;
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) &&
+                  std::atomic<uint32_t>::is_always_lock_free,
+                  "Endpoint requires lock free atomics in shared memory");
 
     class EndpointImp : public Endpoint
     {
@@ -89,7 +107,36 @@ namespace geopm
             std::set<std::string> get_hostnames(void) override;
             static std::string shm_policy_postfix(void);
             static std::string shm_sample_postfix(void);
+            /// @brief Mark the start of an update to shared memory.
+            ///
+            /// Writers hold the shared memory lock for the duration
+            /// of the update.
+            static void shm_write_begin(std::atomic<uint32_t> &sequence);
+            /// @brief Mark the end of an update to shared memory.
+            static void shm_write_end(std::atomic<uint32_t> &sequence);
+            /// @brief Read from shared memory without taking the lock.
+            ///
+            /// Calls read_func until it runs without a concurrent
+            /// update.  If the writer is busy for several attempts,
+            /// read_func is called while holding the lock.  The
+            /// read_func must tolerate inconsistent data.
+            ///
+            /// @return Sequence number of the update that was read.
+            template <typename func_type>
+            static uint32_t shm_read(SharedMemory &shmem,
+                                     const std::atomic<uint32_t> &sequence,
+                                     func_type read_func);
+            /// @brief Wake all processes waiting on the notify word.
+            static void shm_notify(std::atomic<uint32_t> &notify);
+            /// @brief Wait until the notify word differs from value,
+            ///        a wake up, or the timeout.
+            static void shm_wait(std::atomic<uint32_t> &notify, uint32_t value, double timeout);
         private:
+            void wait_for_agent(bool is_attach, double timeout, const std::string &func_name);
+            static constexpr int M_NUM_READ_ATTEMPT = 4;
+            // Upper bound on each sleep in the wait loops so that
+            // writers which do not notify are still observed
+            static constexpr double M_WAIT_INTERVAL = 0.1;
             std::string m_path;
             std::shared_ptr<SharedMemory> m_policy_shmem;
             std::shared_ptr<SharedMemory> m_sample_shmem;
@@ -98,6 +145,26 @@ namespace geopm
             bool m_is_open;
             volatile bool m_continue_loop;
     };
+
+    template <typename func_type>
+    uint32_t EndpointImp::shm_read(SharedMemory &shmem,
+                                   const std::atomic<uint32_t> &sequence,
+                                   func_type read_func)
+    {
+        for (int attempt_idx = 0; attempt_idx < M_NUM_READ_ATTEMPT; ++attempt_idx) {
+            uint32_t before = sequence.load(std::memory_order_acquire);
+            if ((before & 1) == 0) {
+                read_func();
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sequence.load(std::memory_order_relaxed) == before) {
+                    return before;
+                }
+            }
+        }
+        auto lock = shmem.get_scoped_lock();
+        read_func();
+        return sequence.load(std::memory_order_relaxed);
+    }
 }
 
 #endif
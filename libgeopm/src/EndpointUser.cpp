@@ -9,6 +9,8 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
 
 #include "EndpointImp.hpp"  // for shmem region structs and constants
@@ -47,6 +49,7 @@ namespace geopm
         , m_policy_shmem(std::move(policy_shmem))
         , m_sample_shmem(std::move(sample_shmem))
         , m_num_sample(num_sample)
+        , m_policy_sequence(UINT32_MAX)
     {
         // Attach to shared memory here and send across agent,
         // profile, hostname list.  Once user attaches to sample
@@ -59,8 +62,6 @@ namespace geopm
             m_sample_shmem = SharedMemory::make_unique_user(m_path + EndpointImp::shm_sample_postfix(),
                                                             environment().timeout());
         }
-        auto lock = m_sample_shmem->get_scoped_lock();
-        auto data = (struct geopm_endpoint_sample_shmem_s *)m_sample_shmem->pointer();
         if (agent_name.size() >= GEOPM_ENDPOINT_AGENT_NAME_MAX) {
             throw Exception("EndpointImp(): Agent name is too long for endpoint storage: " + agent_name,
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
@@ -69,13 +70,6 @@ namespace geopm
             throw Exception("EndpointImp(): Profile name is too long for endpoint storage: " + profile_name,
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        data->count = m_num_sample;
-        std::fill(data->values, data->values + m_num_sample, NAN);
-        geopm_time(&data->timestamp);
-        data->agent[GEOPM_ENDPOINT_AGENT_NAME_MAX - 1] = '\0';
-        data->profile_name[GEOPM_ENDPOINT_PROFILE_NAME_MAX - 1] = '\0';
-        strncpy(data->agent, agent_name.c_str(), GEOPM_ENDPOINT_AGENT_NAME_MAX - 1);
-        strncpy(data->profile_name, profile_name.c_str(), GEOPM_ENDPOINT_PROFILE_NAME_MAX - 1);
         /// write hostnames to file
         m_hostlist_path = hostlist_path;
         if (m_hostlist_path == "") {
@@ -94,8 +88,23 @@ namespace geopm
         for (const auto &host : hosts) {
             outfile << host << "\n";
         }
+        outfile.close();
+
+        auto lock = m_sample_shmem->get_scoped_lock();
+        auto data = (struct geopm_endpoint_sample_shmem_s *)m_sample_shmem->pointer();
+        EndpointImp::shm_write_begin(data->sequence);
+        data->count = m_num_sample;
+        std::fill(data->values, data->values + m_num_sample, NAN);
+        geopm_time(&data->timestamp);
+        data->agent[GEOPM_ENDPOINT_AGENT_NAME_MAX - 1] = '\0';
+        data->profile_name[GEOPM_ENDPOINT_PROFILE_NAME_MAX - 1] = '\0';
+        strncpy(data->agent, agent_name.c_str(), GEOPM_ENDPOINT_AGENT_NAME_MAX - 1);
+        strncpy(data->profile_name, profile_name.c_str(), GEOPM_ENDPOINT_PROFILE_NAME_MAX - 1);
         data->hostlist_path[GEOPM_ENDPOINT_HOSTLIST_PATH_MAX -1] = '\0';
         strncpy(data->hostlist_path, m_hostlist_path.c_str(), GEOPM_ENDPOINT_HOSTLIST_PATH_MAX - 1);
+        EndpointImp::shm_write_end(data->sequence);
+        // Wake the resource manager if it is waiting for the attach
+        EndpointImp::shm_notify(data->notify);
     }
 
     EndpointUserImp::~EndpointUserImp()
@@ -103,29 +112,48 @@ namespace geopm
         // detach from shared memory
         auto lock = m_sample_shmem->get_scoped_lock();
         auto data = (struct geopm_endpoint_sample_shmem_s *)m_sample_shmem->pointer();
+        EndpointImp::shm_write_begin(data->sequence);
         data->agent[0] = '\0';
         data->profile_name[0] = '\0';
         data->hostlist_path[0] = '\0';
+        EndpointImp::shm_write_end(data->sequence);
+        try {
+            EndpointImp::shm_notify(data->notify);
+        }
+        catch (...) {
+            // Waiters still observe the detach when their bounded
+            // sleep expires
+        }
         unlink(m_hostlist_path.c_str());
     }
 
     double EndpointUserImp::read_policy(std::vector<double> &policy)
     {
-        auto lock = m_policy_shmem->get_scoped_lock();
         auto data = (struct geopm_endpoint_policy_shmem_s *) m_policy_shmem->pointer(); // Managed by shmem subsystem.
 
-        int num_policy = data->count;
-        if (policy.size() < (size_t)num_policy) {
+        size_t num_policy = 0;
+        geopm_time_s ts;
+        uint32_t sequence = EndpointImp::shm_read(*m_policy_shmem, data->sequence, [&]() {
+            num_policy = data->count;
+            // Fill in missing policy values with NAN (default)
+            std::fill(policy.begin(), policy.end(), NAN);
+            std::copy_n(data->values, std::min(num_policy, policy.size()), policy.begin());
+            ts = data->timestamp;
+        });
+        if (policy.size() < num_policy) {
             throw Exception("EndpointUserImp::" + std::string(__func__) + "(): Data read from shmem does not fit in policy vector.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        // Fill in missing policy values with NAN (default)
-        std::fill(policy.begin(), policy.end(), NAN);
-        std::copy(data->values, data->values + data->count, policy.begin());
-        geopm_time_s ts = data->timestamp;
+        m_policy_sequence = sequence;
         return geopm_time_since(&ts);
     }
 
+    bool EndpointUserImp::is_policy_updated(void)
+    {
+        auto data = (struct geopm_endpoint_policy_shmem_s *) m_policy_shmem->pointer(); // Managed by shmem subsystem.
+        return data->sequence.load(std::memory_order_acquire) != m_policy_sequence;
+    }
+
     void EndpointUserImp::write_sample(const std::vector<double> &sample)
     {
         if (sample.size() != m_num_sample) {
@@ -134,9 +162,11 @@ namespace geopm
         }
         auto lock = m_sample_shmem->get_scoped_lock();
         auto data = (struct geopm_endpoint_sample_shmem_s *)m_sample_shmem->pointer();
+        EndpointImp::shm_write_begin(data->sequence);
         data->count = sample.size();
         std::copy(sample.begin(), sample.end(), data->values);
         // also update timestamp
         geopm_time(&data->timestamp);
+        EndpointImp::shm_write_end(data->sequence);
     }
 }
@@ -30,6 +30,11 @@ namespace geopm
             /// @param [in] sample The values to write.  The order is
             ///        specified by the Agent.
             virtual void write_sample(const std::vector<double> &sample) = 0;
+            /// @brief Check if the policy was written since the last
+            ///        call to read_policy().  Does not take the shmem
+            ///        lock.
+            /// @return True if read_policy() may return new values.
+            virtual bool is_policy_updated(void) = 0;
             /// @brief Factory method for the EndpointUser receiving
             ///        the policy.
             static std::unique_ptr<EndpointUser> make_unique(const std::string &policy_path,
@@ -57,12 +62,14 @@ namespace geopm
             virtual ~EndpointUserImp();
             double read_policy(std::vector<double> &policy) override;
             void write_sample(const std::vector<double> &sample) override;
+            bool is_policy_updated(void) override;
         private:
             std::string m_path;
             std::unique_ptr<SharedMemory> m_policy_shmem;
             std::unique_ptr<SharedMemory> m_sample_shmem;
             std::string m_hostlist_path;
             size_t m_num_sample;
+            uint32_t m_policy_sequence;
     };
 }
 
@@ -61,6 +61,21 @@ namespace geopm
         return ret;
     }
 
+    bool Environment::do_trace_binary(void) const
+    {
+        return false;
+    }
+
+    std::string Environment::wait_strategy(void) const
+    {
+        return "sleep";
+    }
+
+    bool Environment::do_report_binary(void) const
+    {
+        return false;
+    }
+
     EnvironmentImp::EnvironmentImp()
         : EnvironmentImp(DEFAULT_CONFIG_PATH, OVERRIDE_CONFIG_PATH)
     {
@@ -79,7 +94,8 @@ namespace geopm
                              {"GEOPM_MAX_FAN_OUT", "16"},
                              {"GEOPM_TIMEOUT", "30"},
                              {"GEOPM_DEBUG_ATTACH", "-1"},
-                             {"GEOPM_NUM_PROC", "1"}})
+                             {"GEOPM_NUM_PROC", "1"},
+                             {"GEOPM_WAIT_STRATEGY", "sleep"}})
         , m_default_config_path(default_config_path)
         , m_override_config_path(override_config_path)
     {
@@ -113,6 +129,7 @@ namespace geopm
         return {"GEOPM_CTL",
                 "GEOPM_REPORT",
                 "GEOPM_REPORT_SIGNALS",
+                "GEOPM_REPORT_BINARY",
                 "GEOPM_COMM",
                 "GEOPM_POLICY",
                 "GEOPM_ENDPOINT",
@@ -121,6 +138,7 @@ namespace geopm
                 "GEOPM_TRACE_SIGNALS",
                 "GEOPM_TRACE_PROFILE",
                 "GEOPM_TRACE_ENDPOINT_POLICY",
+                "GEOPM_TRACE_BINARY",
                 "GEOPM_TIMEOUT",
                 "GEOPM_DEBUG_ATTACH",
                 "GEOPM_PROFILE",
@@ -131,6 +149,7 @@ namespace geopm
                 "GEOPM_RECORD_FILTER",
                 "GEOPM_INIT_CONTROL",
                 "GEOPM_PERIOD",
+                "GEOPM_WAIT_STRATEGY",
                 "GEOPM_NUM_PROC",
                 "GEOPM_PROGRAM_FILTER",
                 "GEOPM_CTL_LOCAL"};
@@ -258,6 +277,11 @@ namespace geopm
         return result;
     }
 
+    std::string EnvironmentImp::wait_strategy(void) const
+    {
+        return lookup("GEOPM_WAIT_STRATEGY");
+    }
+
     std::string EnvironmentImp::trace(void) const
     {
         return lookup("GEOPM_TRACE");
@@ -383,6 +407,16 @@ namespace geopm
         return is_set("GEOPM_TRACE_ENDPOINT_POLICY");
     }
 
+    bool EnvironmentImp::do_trace_binary(void) const
+    {
+        return is_set("GEOPM_TRACE_BINARY");
+    }
+
+    bool EnvironmentImp::do_report_binary(void) const
+    {
+        return is_set("GEOPM_REPORT_BINARY");
+    }
+
     bool EnvironmentImp::do_profile(void) const
     {
         bool result = false;
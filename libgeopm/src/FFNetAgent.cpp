@@ -90,11 +90,21 @@ namespace geopm
         }
 
         if (net_map.empty()) {
-            for (const m_domain_key_s domain_key : m_domains) {
-                m_net_map[domain_key] =
-                    DomainNetMap::make_shared(get_env_value(M_NNET_ENVNAME.at(domain_key.type)),
-                                              domain_key.type,
-                                              domain_key.index);
+            // All domains of a type share one neural net that is
+            // evaluated for every domain in a single batch.
+            for (geopm_domain_e domain_type : m_domain_types) {
+                std::vector<int> domain_indices;
+                for (const m_domain_key_s domain_key : m_domains) {
+                    if (domain_key.type == domain_type) {
+                        domain_indices.push_back(domain_key.index);
+                    }
+                }
+                auto type_net_maps =
+                    DomainNetMap::make_shared(get_env_value(M_NNET_ENVNAME.at(domain_type)),
+                                              domain_type, domain_indices);
+                for (size_t idx = 0; idx < domain_indices.size(); ++idx) {
+                    m_net_map[{domain_type, domain_indices[idx]}] = type_net_maps[idx];
+                }
             }
         }
         else {
@@ -265,7 +275,7 @@ namespace geopm
 
     std::vector<std::pair<std::string, std::string> > FFNetAgent::report_host(void) const
     {
-        return {};
+        return m_waiter->report();
     }
 
     // This Agent does not add any per-region details
@@ -407,6 +407,8 @@ namespace geopm
         std::string frequency_map_data = my_json.dump();
         frequency_map_data.erase(std::remove(frequency_map_data.begin(), frequency_map_data.end(), '"'), frequency_map_data.end());
         result.push_back(std::make_pair("Frequency map", frequency_map_data));
+        auto wait_report = m_waiter->report();
+        result.insert(result.end(), wait_report.begin(), wait_report.end());
 
         return result;
     }
@@ -397,6 +397,8 @@ namespace geopm
         result.push_back({"Resolved Max Frequency", std::to_string(m_resolved_f_gpu_max)});
         result.push_back({"Resolved Efficient Frequency", std::to_string(m_resolved_f_gpu_efficient)});
         result.push_back({"Resolved Frequency Range", std::to_string(m_f_range)});
+        auto wait_report = m_waiter->report();
+        result.insert(result.end(), wait_report.begin(), wait_report.end());
 
         return result;
     }
@@ -38,6 +38,7 @@ namespace geopm
         }
 
         m_layers = std::move(layers);
+        m_activations.resize(m_layers.size() - 1);
     }
 
     TensorOneD LocalNeuralNetImp::forward(const TensorOneD &inp) const
@@ -62,6 +63,23 @@ namespace geopm
         return tmp;
     }
 
+    void LocalNeuralNetImp::forward(const TensorMatrix &inp, TensorMatrix &out)
+    {
+        if (inp.get_cols() != m_layers[0]->get_input_dim()) {
+            throw Exception("LocalNeuralNetImp::" + std::string(__func__) +
+                            ": Input vector dimension is incompatible with network.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+
+        const TensorMatrix *layer_inp = &inp;
+        for (size_t idx = 0; idx < m_activations.size(); ++idx) {
+            // Apply a sigmoid on all but the last layer
+            m_layers[idx]->forward(*layer_inp, true, m_activations[idx]);
+            layer_inp = &m_activations[idx];
+        }
+        m_layers.back()->forward(*layer_inp, false, out);
+    }
+
     size_t LocalNeuralNetImp::get_input_dim() const {
         return m_layers[0]->get_input_dim();
     }
@@ -12,6 +12,7 @@
 namespace geopm
 {
     class TensorTwoD;
+    class TensorMatrix;
 
     ///  @brief Class to manage data and operations of feed forward neural nets
     ///         required for neural net inference.
@@ -35,6 +36,21 @@ namespace geopm
             ///
             /// @return Returns a TensorOneD vector of output values.
             virtual TensorOneD forward(const TensorOneD &inp) const = 0;
+            /// @brief Perform inference for a batch of inputs, for
+            ///        example one per domain, with one matrix-matrix
+            ///        pass per layer.  Intermediate activations are
+            ///        kept between calls, so repeated calls with the
+            ///        same batch size do not allocate.
+            ///
+            /// @param [in] inp TensorMatrix with one vector of input
+            ///        signals per row.
+            ///
+            /// @param [out] out Resized to one row per input and one
+            ///        column per output value.
+            ///
+            /// @throws geopm::Exception if input dimension is incompatible
+            /// with network.
+            virtual void forward(const TensorMatrix &inp, TensorMatrix &out) = 0;
             /// @brief Get the dimension required for the input TensorOneD
             /// 
             /// @return Returns a size_t equal to the number of columns of weights
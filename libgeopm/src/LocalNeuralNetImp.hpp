@@ -7,6 +7,7 @@
 #define LOCALNEURALNETIMP_HPP_INCLUDE
 
 #include "LocalNeuralNet.hpp"
+#include "TensorMatrix.hpp"
 
 namespace geopm
 {
@@ -29,6 +30,7 @@ namespace geopm
             ///
             /// @return Returns a TensorOneD vector of output values.
             TensorOneD forward(const TensorOneD &inp) const override;
+            void forward(const TensorMatrix &inp, TensorMatrix &out) override;
             /// @brief Get the dimension required for the input TensorOneD
             /// 
             /// @return Returns a size_t equal to the number of columns of weights
@@ -40,6 +42,8 @@ namespace geopm
 
         private:
             std::vector<std::shared_ptr<DenseLayer> > m_layers;
+            // Outputs of all but the last layer for batched inference
+            std::vector<TensorMatrix> m_activations;
     };
 }
 
@@ -108,7 +108,7 @@ namespace geopm
 
     std::vector<std::pair<std::string, std::string> > MonitorAgent::report_host(void) const
     {
-        return {};
+        return m_waiter->report();
     }
 
     std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > MonitorAgent::report_region(void) const
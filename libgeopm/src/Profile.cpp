@@ -72,6 +72,7 @@ namespace geopm
         , m_current_hash(GEOPM_REGION_HASH_UNMARKED)
         , m_num_cpu(num_cpu)
         , m_cpu_set(std::move(cpu_set))
+        , m_status_process(-1)
         , m_app_status(std::move(app_status))
         , m_app_record_log(std::move(app_record_log))
         , m_overhead_time(0.0)
@@ -145,8 +146,11 @@ namespace geopm
         }
         uint64_t hint = m_hint_stack.size() == 0 ? GEOPM_REGION_HINT_UNSET :
                         m_hint_stack.top();
-        for (auto cpu_idx : m_cpu_set) {
-            m_app_status->set_hash(cpu_idx, m_current_hash, hint);
+        m_status_process = -1;
+        if (!m_cpu_set.empty()) {
+            m_status_process = *m_cpu_set.begin();
+            m_app_status->set_process(m_cpu_set, m_status_process);
+            m_app_status->set_hash(m_status_process, m_current_hash, hint);
         }
         geopm_time_s now;
         geopm_time(&now);
@@ -173,6 +177,9 @@ namespace geopm
             std::shared_ptr<SharedMemory> shmem = SharedMemory::make_unique_user(shmem_path, 0);
             m_app_record_log = ApplicationRecordLog::make_unique(std::move(shmem));
         }
+        // Region and epoch events are stamped with the time stamp
+        // counter if it is supported, calibrate it once here
+        m_app_record_log->enable_tsc();
         m_app_record_log->start_profile(geopm::time_zero(), m_prof_name);
     }
 
@@ -264,11 +271,9 @@ namespace geopm
         if (m_current_hash == GEOPM_REGION_HASH_UNMARKED) {
             // not currently in a region; enter region
             m_current_hash = hash;
-            geopm_time_s now;
-            geopm_time(&now);
-            m_app_record_log->enter(hash, now);
-            for (const int &cpu_idx : m_cpu_set) {
-                m_app_status->set_hash(cpu_idx, hash, hint);
+            m_app_record_log->enter(hash, m_app_record_log->time_stamp());
+            if (m_status_process >= 0) {
+                m_app_status->set_hash(m_status_process, hash, hint);
             }
         }
         else {
@@ -295,8 +300,7 @@ namespace geopm
 #endif
 
         uint64_t hash = geopm_region_id_hash(region_id);
-        geopm_time_s now;
-        geopm_time(&now);
+        geopm_time_s now = m_app_record_log->time_stamp();
 
         if (m_hint_stack.empty()) {
             throw Exception("Profile::exit(): expected at least one enter before exit call",
@@ -308,16 +312,12 @@ namespace geopm
             // leaving outermost region, clear hints and exit region
             m_app_record_log->exit(hash, now);
             m_current_hash = GEOPM_REGION_HASH_UNMARKED;
-            // reset both progress ints; calling post() outside of
-            // region is an error
-            for (auto cpu : m_cpu_set) {
-                // Note: does not use thread_init() because the region
-                // hash has been cleared first.  This prevents thread
-                // progress from decreasing at the end of a region.
-                // The thread progress value is not valid outside of a
-                // region.
-                m_app_status->set_hash(cpu, m_current_hash, GEOPM_REGION_HINT_UNSET);
-                m_app_status->reset_work_units(cpu);
+            // Setting the hash invalidates the thread progress of
+            // all CPUs in the process; calling post() outside of
+            // region is an error.  The thread progress value is not
+            // valid outside of a region.
+            if (m_status_process >= 0) {
+                m_app_status->set_hash(m_status_process, m_current_hash, GEOPM_REGION_HINT_UNSET);
             }
         }
         else {
@@ -345,9 +345,7 @@ namespace geopm
         geopm_time(&overhead_entry);
 #endif
 
-        geopm_time_s now;
-        geopm_time(&now);
-        m_app_record_log->epoch(now);
+        m_app_record_log->epoch(m_app_record_log->time_stamp());
 
 #ifdef GEOPM_OVERHEAD
         m_overhead_time += geopm_time_since(&overhead_entry);
@@ -403,8 +401,8 @@ namespace geopm
         if (!m_is_enabled) {
             return;
         }
-        for (auto cpu : m_cpu_set) {
-            m_app_status->set_hint(cpu, hint);
+        if (m_status_process >= 0) {
+            m_app_status->set_hint(m_status_process, hint);
         }
     }
 
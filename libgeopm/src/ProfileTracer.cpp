@@ -35,7 +35,8 @@ namespace geopm
                            environment().do_trace_profile(),
                            environment().trace_profile(),
                            hostname(),
-                           ApplicationSampler::application_sampler())
+                           ApplicationSampler::application_sampler(),
+                           environment().do_trace_binary())
     {
 
     }
@@ -46,12 +47,24 @@ namespace geopm
                                        bool is_trace_enabled,
                                        const std::string &file_name,
                                        const std::string &host_name,
-                                       ApplicationSampler& application_sampler)
+                                       ApplicationSampler& application_sampler,
+                                       bool is_trace_binary)
         : m_is_trace_enabled(is_trace_enabled)
+        , m_is_trace_binary(is_trace_binary)
         , m_time_zero(time_zero)
     {
         m_application_sampler = &application_sampler;
-        if (m_is_trace_enabled) {
+        if (m_is_trace_enabled && m_is_trace_binary) {
+            // Short region handles are replaced with the region hash
+            // in update() so that the file can be converted offline
+            m_csv = geopm::make_unique<CSVBinaryImp>(file_name, host_name, start_time, buffer_size);
+            m_csv->add_column("TIME", "double");
+            m_csv->add_column("PROCESS", "integer");
+            m_csv->add_column("EVENT", "event");
+            m_csv->add_column("SIGNAL", "event_signal");
+            m_csv->activate();
+        }
+        else if (m_is_trace_enabled) {
             m_csv = geopm::make_unique<CSVImp>(file_name, host_name, start_time, buffer_size);
 
             m_csv->add_column("TIME", "double");
@@ -80,36 +93,12 @@ namespace geopm
         }
         else {
             // This is a call to format the signal column
-            switch (event_type) {
-                case EVENT_REGION_ENTRY:
-                case EVENT_REGION_EXIT:
-                    result = string_format_hex(value);
-                    break;
-                case EVENT_EPOCH_COUNT:
-                    result = string_format_integer(value);
-                    break;
-                case EVENT_SHORT_REGION:
-                    GEOPM_DEBUG_ASSERT(m_application_sampler != nullptr,
-                        "The ProfileTracerImp::ProfileTracerImp() must be called prior to calling ProfileTracerImp::event_format()");
-                    result = string_format_hex(m_application_sampler->get_short_region(value).hash);
-                    break;
-                case EVENT_AFFINITY:
-                    result = string_format_integer(value);
-                    break;
-                case EVENT_START_PROFILE:
-                    result = string_format_hex(value);
-                    break;
-                case EVENT_STOP_PROFILE:
-                    result = string_format_hex(value);
-                    break;
-                case EVENT_OVERHEAD:
-                    result = string_format_double(geopm_field_to_signal(value));
-                    break;
-                default:
-                    result = "INVALID";
-                    GEOPM_DEBUG_ASSERT(false, "ProfileTracer::event_format(): event out of range");
-                    break;
+            if (event_type == EVENT_SHORT_REGION) {
+                GEOPM_DEBUG_ASSERT(m_application_sampler != nullptr,
+                    "The ProfileTracerImp::ProfileTracerImp() must be called prior to calling ProfileTracerImp::event_format()");
+                value = m_application_sampler->get_short_region(value).hash;
             }
+            result = event_signal_format(event_type, value);
             // The next call will be to format the event column
             is_signal = false;
         }
@@ -127,6 +116,9 @@ namespace geopm
                 sample[M_COLUMN_PROCESS] = it.process;
                 sample[M_COLUMN_EVENT] = it.event;
                 sample[M_COLUMN_SIGNAL] = it.signal;
+                if (m_is_trace_binary && it.event == EVENT_SHORT_REGION) {
+                    sample[M_COLUMN_SIGNAL] = m_application_sampler->get_short_region(it.signal).hash;
+                }
                 m_csv->update(sample);
             }
         }
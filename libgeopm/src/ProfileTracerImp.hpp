@@ -26,7 +26,8 @@ namespace geopm
                              bool is_trace_enabled,
                              const std::string &file_name,
                              const std::string &host_name,
-                             ApplicationSampler& application_sampler = ApplicationSampler::application_sampler());
+                             ApplicationSampler& application_sampler = ApplicationSampler::application_sampler(),
+                             bool is_trace_binary = false);
             virtual ~ProfileTracerImp();
             void update(const std::vector<record_s> &records);
          private:
@@ -38,6 +39,7 @@ namespace geopm
                 M_NUM_COLUMN
             };
             bool m_is_trace_enabled;
+            bool m_is_trace_binary;
             std::unique_ptr<CSV> m_csv;
             geopm_time_s m_time_zero;
             static ApplicationSampler* m_application_sampler;
@@ -129,6 +129,13 @@ namespace geopm
     std::vector<record_s> ProxyEpochRecordFilter::filter(const record_s &record)
     {
         std::vector<record_s> result;
+        filter(record, result);
+        return result;
+    }
+
+    void ProxyEpochRecordFilter::filter(const record_s &record,
+                                        std::vector<record_s> &result)
+    {
         if (record.event != EVENT_EPOCH_COUNT) {
             result.push_back(record);
             if (record.event == EVENT_REGION_ENTRY &&
@@ -143,6 +150,5 @@ namespace geopm
                 ++m_count;
             }
         }
-        return result;
     }
 }
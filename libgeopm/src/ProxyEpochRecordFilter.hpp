@@ -69,7 +69,9 @@ namespace geopm
             ///
             /// @return An empty vector or a vector of length one
             ///         containing a record of an epoch event.
-            std::vector<record_s> filter(const record_s &record);
+            std::vector<record_s> filter(const record_s &record) override;
+            void filter(const record_s &record,
+                        std::vector<record_s> &result) override;
             /// @brief Static function that will parse the filter
             ///        string for the proxy_epoch into the constructor
             ///        arguments for a ProxyEpochRecordFilter.
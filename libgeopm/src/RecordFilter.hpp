@@ -36,6 +36,21 @@ namespace geopm
             /// @return Vector of zero or more records to update the
             ///         filtered stream.
             virtual std::vector<record_s> filter(const record_s &record) = 0;
+            /// @brief Apply a filter to a stream of records without
+            ///        allocating a vector for each update.
+            ///
+            /// Same as filter(const record_s &) except that the
+            /// filtered values are appended to the end of an existing
+            /// vector.  The default implementation calls the other
+            /// overload; derived classes should override it to avoid
+            /// the temporary vector.
+            ///
+            /// @param [in] record The update value to be filtered.
+            ///
+            /// @param [in,out] result Vector that zero or more
+            ///        filtered records are appended to.
+            virtual void filter(const record_s &record,
+                                std::vector<record_s> &result);
     };
 }
 
@@ -15,7 +15,6 @@
 #include <sstream>
 #include <fstream>
 #include <algorithm>
-#include <numeric>
 #include <iostream>
 #include <iomanip>
 
@@ -53,7 +52,8 @@ namespace geopm
                       environment().policy(),
                       environment().do_endpoint(),
                       environment().profile(),
-                      environment().do_ctl_local())
+                      environment().do_ctl_local(),
+                      environment().do_report_binary())
     {
 
     }
@@ -69,7 +69,8 @@ namespace geopm
                              const std::string &policy_path,
                              bool do_endpoint,
                              const std::string &profile_name,
-                             bool do_ctl_local)
+                             bool do_ctl_local,
+                             bool do_binary)
         : m_start_time(start_time)
         , m_report_name(report_name)
         , m_platform_io(platform_io)
@@ -88,6 +89,7 @@ namespace geopm
         , m_sample_delay(0.0)
         , m_profile_name(profile_name)
         , m_do_ctl_local(do_ctl_local)
+        , m_do_binary(do_binary)
     {
         GEOPM_DEBUG_ASSERT(m_sample_agg != nullptr, "m_sample_agg cannot be null");
         if (!m_rank) {
@@ -164,11 +166,17 @@ namespace geopm
         int rank = comm->rank();
         std::ofstream common_report;
         if (!rank) {
-            common_report.open(m_report_name);
+            common_report.open(m_report_name, std::ios::out | std::ios::binary);
             if (!common_report.good()) {
                 throw Exception("Failed to open report file", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
             }
-            common_report << create_header(agent_name, m_profile_name, agent_report_header);
+            std::string header = create_header(agent_name, m_profile_name, agent_report_header);
+            if (m_do_binary) {
+                common_report << M_BINARY_MAGIC << compact_report(header);
+            }
+            else {
+                common_report << header;
+            }
         }
 
         std::string host_report = create_report(application_io.region_name_set(),
@@ -176,11 +184,15 @@ namespace geopm
                                                 tree_comm.overhead_send(),
                                                 agent_host_report,
                                                 agent_region_report);
-        std::string full_report = gather_report(host_report, std::move(comm));
+        if (m_do_binary) {
+            host_report = compact_report(host_report);
+        }
+        gather_report(host_report, std::move(comm), common_report);
 
         if (!rank) {
-            common_report << full_report;
-            common_report << std::endl;
+            if (!m_do_binary) {
+                common_report << std::endl;
+            }
             common_report.close();
         }
     }
@@ -356,37 +368,185 @@ namespace geopm
         return report.str();
     }
 
-    std::string ReporterImp::gather_report(const std::string &host_report, std::shared_ptr<Comm> comm)
+    void ReporterImp::gather_report(const std::string &host_report,
+                                    std::shared_ptr<Comm> comm,
+                                    std::ostream &os)
     {
         // aggregate reports from every node
         size_t buffer_size = host_report.size();
-        std::vector<char> report_buffer;
-        std::vector<size_t> buffer_size_array;
-        std::vector<off_t> buffer_displacement;
         int num_ranks = comm->num_rank();
-        buffer_size_array.resize(num_ranks);
-        buffer_displacement.resize(num_ranks);
+        std::vector<size_t> buffer_size_array(num_ranks);
         comm->gather(&buffer_size, sizeof(size_t), buffer_size_array.data(),
                      sizeof(size_t), 0);
+        // Every rank needs the sizes to agree on the batches
+        comm->broadcast(buffer_size_array.data(),
+                        sizeof(size_t) * buffer_size_array.size(), 0);
+
+        // Split the ranks into contiguous batches that fit in the
+        // chunk size, a rank with a larger report is sent alone
+        std::vector<int> batch_begin {0};
+        size_t batch_size = 0;
+        for (int rank_idx = 0; rank_idx < num_ranks; ++rank_idx) {
+            if (batch_size != 0 &&
+                batch_size + buffer_size_array[rank_idx] > M_GATHER_CHUNK_SIZE) {
+                batch_begin.push_back(rank_idx);
+                batch_size = 0;
+            }
+            batch_size += buffer_size_array[rank_idx];
+        }
+        batch_begin.push_back(num_ranks);
 
-        if (comm->rank() == 0) {
-            int full_report_size = std::accumulate(buffer_size_array.begin(), buffer_size_array.end(), 0) + 1;
-            report_buffer.resize(full_report_size);
-            buffer_displacement[0] = 0;
-            for (int i = 1; i < num_ranks; ++i) {
-                buffer_displacement[i] = buffer_displacement[i-1] + buffer_size_array[i-1];
+        int rank = comm->rank();
+        std::vector<char> report_buffer;
+        std::vector<size_t> recv_size(num_ranks);
+        std::vector<off_t> recv_offset(num_ranks);
+        for (size_t batch_idx = 0; batch_idx + 1 < batch_begin.size(); ++batch_idx) {
+            int begin = batch_begin[batch_idx];
+            int end = batch_begin[batch_idx + 1];
+            std::fill(recv_size.begin(), recv_size.end(), 0);
+            std::fill(recv_offset.begin(), recv_offset.end(), 0);
+            off_t offset = 0;
+            for (int rank_idx = begin; rank_idx < end; ++rank_idx) {
+                recv_size[rank_idx] = buffer_size_array[rank_idx];
+                recv_offset[rank_idx] = offset;
+                offset += buffer_size_array[rank_idx];
+            }
+            if (rank == 0) {
+                report_buffer.resize(offset);
+            }
+            bool is_sender = rank >= begin && rank < end;
+            comm->gatherv(host_report.data(), is_sender ? buffer_size : 0,
+                          report_buffer.data(), recv_size, recv_offset, 0);
+            if (rank == 0) {
+                os.write(report_buffer.data(), report_buffer.size());
             }
         }
+    }
 
-        comm->gatherv((void *) (host_report.c_str()), sizeof(char) * buffer_size,
-                      (void *) report_buffer.data(), buffer_size_array, buffer_displacement, 0);
-        if (report_buffer.size() != 0) {
-            report_buffer.back() = '\0';
+    static void write_varint(std::string &buffer, uint64_t value)
+    {
+        while (value >= 0x80) {
+            buffer.push_back((char)((value & 0x7F) | 0x80));
+            value >>= 7;
         }
-        else {
-            report_buffer.push_back('\0');
+        buffer.push_back((char)value);
+    }
+
+    static uint64_t read_varint(std::istream &is, uint64_t max_value)
+    {
+        uint64_t result = 0;
+        int shift = 0;
+        int byte = 0;
+        do {
+            byte = is.get();
+            if (byte == EOF || shift > 63) {
+                throw Exception("ReporterImp::convert(): Binary report is truncated or corrupt",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            result |= (uint64_t)(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        if (result > max_value) {
+            throw Exception("ReporterImp::convert(): Binary report is corrupt",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    std::string ReporterImp::compact_report(const std::string &yaml_report)
+    {
+        if (!yaml_report.empty() && yaml_report.back() != '\n') {
+            throw Exception("ReporterImp::compact_report(): Report must end with a new line",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        // Each line is "<indent><key>: <value>" or "<indent><key>",
+        // keys and values are replaced by an index into a table of
+        // the distinct strings in the section.
+        std::vector<const std::string *> string_table;
+        std::map<std::string, uint64_t> string_idx;
+        auto intern = [&string_table, &string_idx](std::string &&str) -> uint64_t
+        {
+            auto it = string_idx.emplace(std::move(str), string_table.size());
+            if (it.second) {
+                string_table.push_back(&(it.first->first));
+            }
+            return it.first->second;
+        };
+        std::string lines;
+        uint64_t num_line = 0;
+        size_t line_begin = 0;
+        while (line_begin < yaml_report.size()) {
+            size_t line_end = yaml_report.find('\n', line_begin);
+            size_t key_begin = yaml_report.find_first_not_of(' ', line_begin);
+            size_t sep = yaml_report.find(": ", key_begin);
+            write_varint(lines, key_begin - line_begin);
+            if (sep < line_end) {
+                write_varint(lines, intern(yaml_report.substr(key_begin, sep - key_begin)));
+                write_varint(lines, intern(yaml_report.substr(sep + 2, line_end - sep - 2)) + 1);
+            }
+            else {
+                write_varint(lines, intern(yaml_report.substr(key_begin, line_end - key_begin)));
+                write_varint(lines, 0);
+            }
+            ++num_line;
+            line_begin = line_end + 1;
+        }
+        std::string section;
+        write_varint(section, string_table.size());
+        for (const auto &str : string_table) {
+            write_varint(section, str->size());
+            section += *str;
+        }
+        write_varint(section, num_line);
+        section += lines;
+
+        std::string result;
+        write_varint(result, section.size());
+        result += section;
+        return result;
+    }
+
+    void ReporterImp::convert(std::istream &binary_report,
+                              std::ostream &yaml_report)
+    {
+        std::string magic(sizeof(M_BINARY_MAGIC) - 1, '\0');
+        binary_report.read(&magic[0], magic.size());
+        if (magic != M_BINARY_MAGIC) {
+            throw Exception("ReporterImp::convert(): Input is not a binary report or the format version is not supported",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        std::string section;
+        std::vector<std::string> string_table;
+        while (binary_report.peek() != EOF) {
+            section.resize(read_varint(binary_report, UINT64_MAX));
+            binary_report.read(&section[0], section.size());
+            if ((size_t)binary_report.gcount() != section.size()) {
+                throw Exception("ReporterImp::convert(): Binary report is truncated or corrupt",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            std::istringstream section_stream(section);
+            string_table.resize(read_varint(section_stream, section.size()));
+            for (auto &str : string_table) {
+                str.resize(read_varint(section_stream, section.size()));
+                section_stream.read(&str[0], str.size());
+            }
+            uint64_t num_line = read_varint(section_stream, section.size());
+            for (uint64_t line_idx = 0; line_idx < num_line; ++line_idx) {
+                uint64_t indent = read_varint(section_stream, section.size());
+                uint64_t key_idx = read_varint(section_stream, string_table.size());
+                uint64_t value_idx = read_varint(section_stream, string_table.size());
+                if (key_idx == string_table.size()) {
+                    throw Exception("ReporterImp::convert(): Binary report is corrupt",
+                                    GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                }
+                yaml_report << std::string(indent, ' ') << string_table[key_idx];
+                if (value_idx != 0) {
+                    yaml_report << ": " << string_table[value_idx - 1];
+                }
+                yaml_report << "\n";
+            }
         }
-        return report_buffer.data();
+        yaml_report << std::endl;
     }
 
     void ReporterImp::init_sync_fields(void)
@@ -13,6 +13,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <istream>
 #include <ostream>
 #include <functional>
 
@@ -101,7 +102,8 @@ namespace geopm
                         const std::string &policy_path,
                         bool do_endpoint,
                         const std::string &profile_name,
-                        bool do_ctl_local);
+                        bool do_ctl_local,
+                        bool do_binary);
             virtual ~ReporterImp() = default;
             void init(void) override;
             void update(void) override;
@@ -119,6 +121,37 @@ namespace geopm
                                  const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report) override;
             void total_time(double total) override;
             void overhead(double overhead_sec, double sample_delay) override;
+            /// @brief Gather the host reports from every rank and
+            ///        write them to the stream on rank zero.  The
+            ///        reports are received in batches of ranks so
+            ///        that rank zero never holds more than one batch.
+            /// @param [in] host_report Report section for this rank.
+            /// @param [in] comm Communicator for all controllers.
+            /// @param [out] os Stream written on rank zero.
+            static void gather_report(const std::string &host_report,
+                                      std::shared_ptr<Comm> comm,
+                                      std::ostream &os);
+            /// @brief Encode a section of a YAML report in the
+            ///        compact binary report format.
+            ///
+            /// Each line is stored as its indentation and indices
+            /// into a table of the distinct keys and values in the
+            /// section, so the text of fields repeated for every
+            /// region is stored once.  The encoded section is
+            /// prefixed with its size so that sections can be
+            /// concatenated.
+            /// @param [in] yaml_report Report text, every line must
+            ///             end with a newline.
+            /// @return Encoded section.
+            static std::string compact_report(const std::string &yaml_report);
+            /// @brief Convert a binary report into the YAML report
+            ///        that would have been written without
+            ///        GEOPM_REPORT_BINARY.
+            /// @param [in] binary_report Stream holding the binary
+            ///             report.
+            /// @param [out] yaml_report Stream for the YAML report.
+            static void convert(std::istream &binary_report,
+                                std::ostream &yaml_report);
 
         private:
             /// @brief number of spaces for each indentation
@@ -136,6 +169,12 @@ namespace geopm
             static constexpr int M_INDENT_EPOCH_FIELD = M_INDENT_EPOCH + 1;
             static constexpr int M_INDENT_TOTALS = M_INDENT_HOST_NAME + 1;
             static constexpr int M_INDENT_TOTALS_FIELD = M_INDENT_TOTALS + 1;
+            /// @brief Upper bound on the bytes of host reports
+            ///        received by rank zero in each gather
+            static constexpr size_t M_GATHER_CHUNK_SIZE = 16 * 1024 * 1024;
+            /// @brief Identifies a binary report file and the
+            ///        version of its format
+            static constexpr char M_BINARY_MAGIC[] = "GEOPM_REPORT_BINARY_1\n";
             /// @brief Set up structures used to calculate region-synchronous
             ///        field data to be sampled from SampleAggregator.
             void init_sync_fields(void);
@@ -162,7 +201,6 @@ namespace geopm
             std::string create_report(const std::set<std::string> &region_name_set, double max_memory, double comm_overhead,
                                       const std::vector<std::pair<std::string, std::string> > &agent_host_report,
                                       const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report);
-            std::string gather_report(const std::string &host_report, std::shared_ptr<Comm> comm);
 
             std::string m_start_time;
             std::string m_report_name;
@@ -199,6 +237,7 @@ namespace geopm
             double m_sample_delay;
             const std::string m_profile_name;
             bool m_do_ctl_local;
+            bool m_do_binary;
     };
 }
 
@@ -70,6 +70,38 @@ namespace geopm
         return result;
     }
 
+    int SampleAggregatorImp::group_position(const std::vector<int> &group_pos, int signal_idx)
+    {
+        int result = -1;
+        if (signal_idx >= 0 && (size_t)signal_idx < group_pos.size()) {
+            result = group_pos[signal_idx];
+        }
+        return result;
+    }
+
+    template <typename accum_type>
+    void SampleAggregatorImp::push_group_signal(m_signal_group_s<accum_type> &group,
+                                                std::vector<int> &group_pos,
+                                                int signal_idx,
+                                                int domain_type,
+                                                int domain_idx)
+    {
+        if ((size_t)signal_idx >= group_pos.size()) {
+            group_pos.resize(signal_idx + 1, -1);
+        }
+        group_pos[signal_idx] = group.size();
+        group.signal_idx.push_back(signal_idx);
+        group.region_hash_idx.push_back(m_platform_io.push_signal("REGION_HASH", domain_type, domain_idx));
+        group.epoch_count_idx.push_back(m_platform_io.push_signal("EPOCH_COUNT", domain_type, domain_idx));
+        group.value_last.push_back(NAN);
+        group.region_hash_last.push_back(GEOPM_REGION_HASH_INVALID);
+        group.region_idx_last.push_back(-1);
+        group.epoch_count_last.push_back(0);
+        group.app_accum.emplace_back();
+        group.epoch_accum.emplace_back();
+        group.period_accum.emplace_back();
+    }
+
     int SampleAggregatorImp::push_signal_total(const std::string &signal_name,
                                                int domain_type,
                                                int domain_idx)
@@ -79,25 +111,12 @@ namespace geopm
                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
         int result = m_platform_io.push_signal(signal_name, domain_type, domain_idx);
-        auto bad_it = m_avg_signal.find(result);
-        if (bad_it != m_avg_signal.end()) {
+        if (group_position(m_avg_pos, result) != -1) {
            throw Exception("SampleAggregatorImp::push_signal_total(): signal already pushed for average",
                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        auto signal_it = m_sum_signal.find(result);
-        if (signal_it == m_sum_signal.end()) {
-            m_sum_signal[result] = {
-                NAN,
-                m_platform_io.push_signal("REGION_HASH", domain_type, domain_idx),
-                GEOPM_REGION_HASH_INVALID,
-                m_platform_io.push_signal("EPOCH_COUNT", domain_type, domain_idx),
-                0,
-                SumAccumulator::make_unique(),
-                SumAccumulator::make_unique(),
-                SumAccumulator::make_unique(),
-                {},
-                {},
-           };
+        if (group_position(m_sum_pos, result) == -1) {
+            push_group_signal(m_sum_signal, m_sum_pos, result, domain_type, domain_idx);
         }
         return result;
     }
@@ -111,86 +130,85 @@ namespace geopm
                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
         int result = m_platform_io.push_signal(signal_name, domain_type, domain_idx);
-        auto bad_it = m_sum_signal.find(result);
-        if (bad_it != m_sum_signal.end()) {
+        if (group_position(m_sum_pos, result) != -1) {
            throw Exception("SampleAggregatorImp::push_signal_average(): signal already pushed for total",
                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        auto signal_it = m_avg_signal.find(result);
-        if (signal_it == m_avg_signal.end()) {
-            m_avg_signal[result] = {
-                NAN,
-                m_platform_io.push_signal("REGION_HASH", domain_type, domain_idx),
-                GEOPM_REGION_HASH_INVALID,
-                m_platform_io.push_signal("EPOCH_COUNT", domain_type, domain_idx),
-                0,
-                AvgAccumulator::make_unique(),
-                AvgAccumulator::make_unique(),
-                AvgAccumulator::make_unique(),
-                {},
-                {},
-           };
+        if (group_position(m_avg_pos, result) == -1) {
+            push_group_signal(m_avg_signal, m_avg_pos, result, domain_type, domain_idx);
         }
         return result;
     }
 
-    template<typename type>
-    typename std::map<uint64_t, std::shared_ptr<type> >::iterator
-    sample_aggregator_emplace_hash(
-        std::map<uint64_t, std::shared_ptr<type> > &hash_accum_map,
-        uint64_t hash)
+    template <typename accum_type>
+    void SampleAggregatorImp::grow_group_region(m_signal_group_s<accum_type> &group)
     {
-        typename std::map<uint64_t, std::shared_ptr<type> >::iterator result;
-        result = hash_accum_map.find(hash);
-        if (result == hash_accum_map.end()) {
-            auto empl_ret = hash_accum_map.emplace(hash, type::make_unique());
-            result = empl_ret.first;
-        }
-        return result;
+        size_t num_accum = m_region_idx.size() * group.size();
+        group.region_accum.resize(num_accum);
+        group.region_seen.resize(num_accum, 0);
+    }
+
+    int SampleAggregatorImp::region_index(uint64_t region_hash)
+    {
+        auto emplace_ret = m_region_idx.emplace(region_hash, m_region_idx.size());
+        if (emplace_ret.second) {
+            // First time any signal has observed the region: add a
+            // row of accumulators for every signal
+            grow_group_region(m_sum_signal);
+            grow_group_region(m_avg_signal);
+        }
+        return emplace_ret.first->second;
     }
 
-    template <typename type>
-    void sample_aggregator_update_epoch(type &signal, int epoch_count)
+    template <typename group_type>
+    void sample_aggregator_update_epoch(group_type &group, size_t pos, int epoch_count)
     {
         // If the epoch count has changed, call the exit/enter
-        if (epoch_count != signal.epoch_count_last) {
-            if (signal.epoch_count_last != 0) {
-                signal.epoch_accum->exit();
+        if (epoch_count != group.epoch_count_last[pos]) {
+            if (group.epoch_count_last[pos] != 0) {
+                group.epoch_accum[pos].exit();
             }
-            signal.epoch_accum->enter();
-            signal.epoch_count_last = epoch_count;
+            group.epoch_accum[pos].enter();
+            group.epoch_count_last[pos] = epoch_count;
         }
     }
 
-    template <typename type>
-    void sample_aggregator_update_hash_exit(type &signal, uint64_t hash)
+    template <typename group_type>
+    void sample_aggregator_update_hash_exit(group_type &group, size_t pos, uint64_t hash)
     {
-        if (signal.region_hash_last != hash) {
+        if (group.region_hash_last[pos] != hash) {
             // If we have exited a valid region, call exit()
-            if (signal.region_hash_last != GEOPM_REGION_HASH_UNMARKED) {
-                signal.region_accum_it->second->exit();
+            if (group.region_hash_last[pos] != GEOPM_REGION_HASH_UNMARKED) {
+                group.region_accum[group.region_idx_last[pos] * group.size() + pos].exit();
             }
         }
     }
 
-    template <typename type>
-    void sample_aggregator_update_hash_enter(type &signal, uint64_t hash)
+    template <typename group_type>
+    void sample_aggregator_update_hash_enter(group_type &group, size_t pos, uint64_t hash)
     {
-        if (signal.region_hash_last != hash) {
+        if (group.region_hash_last[pos] != hash) {
             // If we have entered a valid region, call enter()
             if (hash != GEOPM_REGION_HASH_UNMARKED) {
-                signal.region_accum_it->second->enter();
+                group.region_accum[group.region_idx_last[pos] * group.size() + pos].enter();
             }
         }
     }
 
-    template <typename type>
-    void sample_aggregator_update_period(type &signal, int period)
+    template <typename group_type>
+    void sample_aggregator_update_period(group_type &group, size_t pos, int period)
     {
         if (period != 0) {
-            signal.period_accum->exit();
+            group.period_accum[pos].exit();
         }
-        signal.period_accum->enter();
+        group.period_accum[pos].enter();
+    }
+
+    template <typename group_type>
+    void sample_aggregator_set_region(group_type &group, size_t pos, int region_idx)
+    {
+        group.region_idx_last[pos] = region_idx;
+        group.region_seen[region_idx * group.size() + pos] = 1;
     }
 
     uint64_t SampleAggregatorImp::sample_to_hash(double sample)
@@ -224,19 +242,18 @@ namespace geopm
     void SampleAggregatorImp::update_total(void)
     {
         int period = get_period();
+        size_t num_signal = m_sum_signal.size();
         // Update all of the sum aggregators
-        for (auto &signal_it : m_sum_signal) {
-            int signal_idx = signal_it.first;
-            m_sum_signal_s &signal = signal_it.second;
-            double sample = m_platform_io.sample(signal_idx);
-            uint64_t hash = sample_to_hash(m_platform_io.sample(signal.region_hash_idx));
-            int epoch_count = m_platform_io.sample(signal.epoch_count_idx);
+        for (size_t pos = 0; pos < num_signal; ++pos) {
+            double sample = m_platform_io.sample(m_sum_signal.signal_idx[pos]);
+            uint64_t hash = sample_to_hash(m_platform_io.sample(m_sum_signal.region_hash_idx[pos]));
+            int epoch_count = m_platform_io.sample(m_sum_signal.epoch_count_idx[pos]);
             if (!m_is_updated) {
                 // On first call just initialize the signal values
-                signal.sample_last = sample;
-                signal.region_hash_last = hash;
-                signal.epoch_count_last = epoch_count;
-                signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                m_sum_signal.value_last[pos] = sample;
+                m_sum_signal.region_hash_last[pos] = hash;
+                m_sum_signal.epoch_count_last[pos] = epoch_count;
+                sample_aggregator_set_region(m_sum_signal, pos, region_index(hash));
             }
             else {
                 if (std::isnan(sample)) {
@@ -244,30 +261,30 @@ namespace geopm
                 }
                 // Measure the change since the last update
                 double delta = 0;
-                if (!std::isnan(signal.sample_last)) {
-                    delta = sample - signal.sample_last;
+                if (!std::isnan(m_sum_signal.value_last[pos])) {
+                    delta = sample - m_sum_signal.value_last[pos];
                 }
                 // Update that application totals
-                signal.app_accum->update(delta);
+                m_sum_signal.app_accum[pos].update(delta);
                 // If we have observed our first epoch, update epoch totals
-                if (signal.epoch_count_last != 0) {
-                    signal.epoch_accum->update(delta);
+                if (m_sum_signal.epoch_count_last[pos] != 0) {
+                    m_sum_signal.epoch_accum[pos].update(delta);
                 }
                 // Update the periodic totals
-                signal.period_accum->update(delta);
+                m_sum_signal.period_accum[pos].update(delta);
                 // Update region totals
-                signal.region_accum_it->second->update(delta);
-                sample_aggregator_update_epoch(signal, epoch_count);
-                sample_aggregator_update_hash_exit(signal, hash);
-                if (signal.region_hash_last != hash) {
-                    signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                m_sum_signal.region_accum[m_sum_signal.region_idx_last[pos] * num_signal + pos].update(delta);
+                sample_aggregator_update_epoch(m_sum_signal, pos, epoch_count);
+                sample_aggregator_update_hash_exit(m_sum_signal, pos, hash);
+                if (m_sum_signal.region_hash_last[pos] != hash) {
+                    sample_aggregator_set_region(m_sum_signal, pos, region_index(hash));
                 }
-                sample_aggregator_update_hash_enter(signal, hash);
+                sample_aggregator_update_hash_enter(m_sum_signal, pos, hash);
                 if (period != m_period_last) {
-                    sample_aggregator_update_period(signal, period);
+                    sample_aggregator_update_period(m_sum_signal, pos, period);
                 }
-                signal.region_hash_last = hash;
-                signal.sample_last = sample;
+                m_sum_signal.region_hash_last[pos] = hash;
+                m_sum_signal.value_last[pos] = sample;
             }
         }
     }
@@ -275,46 +292,48 @@ namespace geopm
     void SampleAggregatorImp::update_average(void)
     {
         int period = get_period();
-        // Update all of the average aggregators
-        for (auto &signal_it : m_avg_signal) {
-            int signal_idx = signal_it.first;
-            m_avg_signal_s &signal = signal_it.second;
-            double time = m_platform_io.sample(m_time_idx);
-            double sample = m_platform_io.sample(signal_idx);
-            uint64_t hash = sample_to_hash(m_platform_io.sample(signal.region_hash_idx));
-            int epoch_count = m_platform_io.sample(signal.epoch_count_idx);
+        size_t num_signal = m_avg_signal.size();
+        if (num_signal == 0) {
+            return;
+        }
+        // The time stamp is shared by all of the average aggregators
+        double time = m_platform_io.sample(m_time_idx);
+        for (size_t pos = 0; pos < num_signal; ++pos) {
+            double sample = m_platform_io.sample(m_avg_signal.signal_idx[pos]);
+            uint64_t hash = sample_to_hash(m_platform_io.sample(m_avg_signal.region_hash_idx[pos]));
+            int epoch_count = m_platform_io.sample(m_avg_signal.epoch_count_idx[pos]);
             if (!m_is_updated) {
                 // On first call just initialize the signal values
-                signal.time_last = 0.0;
-                signal.region_hash_last = hash;
-                signal.epoch_count_last = epoch_count;
-                signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                m_avg_signal.value_last[pos] = 0.0;
+                m_avg_signal.region_hash_last[pos] = hash;
+                m_avg_signal.epoch_count_last[pos] = epoch_count;
+                sample_aggregator_set_region(m_avg_signal, pos, region_index(hash));
             }
             else {
                 // Measure the time change since the last update
-                double delta = time - signal.time_last;
+                double delta = time - m_avg_signal.value_last[pos];
                 // Update that application totals
-                signal.app_accum->update(delta, sample);
+                m_avg_signal.app_accum[pos].update(delta, sample);
                 // If we have observed our first epoch, update epoch totals
-                if (signal.epoch_count_last != 0) {
-                    signal.epoch_accum->update(delta, sample);
+                if (m_avg_signal.epoch_count_last[pos] != 0) {
+                    m_avg_signal.epoch_accum[pos].update(delta, sample);
                 }
                 // Update the periodic totals
-                signal.period_accum->update(delta, sample);
+                m_avg_signal.period_accum[pos].update(delta, sample);
                 // Update region totals
-                signal.region_accum_it->second->update(delta, sample);
+                m_avg_signal.region_accum[m_avg_signal.region_idx_last[pos] * num_signal + pos].update(delta, sample);
 
-                sample_aggregator_update_epoch(signal, epoch_count);
-                sample_aggregator_update_hash_exit(signal, hash);
-                if (signal.region_hash_last != hash) {
-                    signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                sample_aggregator_update_epoch(m_avg_signal, pos, epoch_count);
+                sample_aggregator_update_hash_exit(m_avg_signal, pos, hash);
+                if (m_avg_signal.region_hash_last[pos] != hash) {
+                    sample_aggregator_set_region(m_avg_signal, pos, region_index(hash));
                 }
-                sample_aggregator_update_hash_enter(signal, hash);
+                sample_aggregator_update_hash_enter(m_avg_signal, pos, hash);
                 if (period != m_period_last) {
-                    sample_aggregator_update_period(signal, period);
+                    sample_aggregator_update_period(m_avg_signal, pos, period);
                 }
-                signal.region_hash_last = hash;
-                signal.time_last = time;
+                m_avg_signal.region_hash_last[pos] = hash;
+                m_avg_signal.value_last[pos] = time;
             }
         }
     }
@@ -334,17 +353,17 @@ namespace geopm
         }
 
         double result = NAN;
-        auto sum_it = m_sum_signal.find(signal_idx);
-        if (sum_it != m_sum_signal.end()) {
-            result = sum_it->second.app_accum->total();
+        int sum_pos = group_position(m_sum_pos, signal_idx);
+        if (sum_pos != -1) {
+            result = m_sum_signal.app_accum[sum_pos].total();
         }
         else {
-            auto avg_it = m_avg_signal.find(signal_idx);
-            if (avg_it == m_avg_signal.end()) {
+            int avg_pos = group_position(m_avg_pos, signal_idx);
+            if (avg_pos == -1) {
                 throw Exception("SampleAggregator::sample_application(): Invalid signal index: signal index not pushed with push_signal_total() or push_signal_average()",
                                 GEOPM_ERROR_INVALID, __FILE__, __LINE__);
             }
-            result = avg_it->second.app_accum->average();
+            result = m_avg_signal.app_accum[avg_pos].average();
         }
         return result;
     }
@@ -352,26 +371,28 @@ namespace geopm
     double SampleAggregatorImp::sample_epoch_helper(int signal_idx, bool is_last)
     {
         double result = NAN;
-        auto sum_it = m_sum_signal.find(signal_idx);
-        if (sum_it != m_sum_signal.end()) {
+        int sum_pos = group_position(m_sum_pos, signal_idx);
+        if (sum_pos != -1) {
+            const auto &accum = m_sum_signal.epoch_accum[sum_pos];
             if (is_last) {
-                result = sum_it->second.epoch_accum->interval_total();
+                result = accum.interval_total();
             }
             else {
-                result = sum_it->second.epoch_accum->total();
+                result = accum.total();
             }
         }
         else {
-            auto avg_it = m_avg_signal.find(signal_idx);
-            if (avg_it == m_avg_signal.end()) {
+            int avg_pos = group_position(m_avg_pos, signal_idx);
+            if (avg_pos == -1) {
                 throw Exception("SampleAggregator::sample_epoch(): Invalid signal index: signal index not pushed with push_signal_total() or push_signal_average()",
                                 GEOPM_ERROR_INVALID, __FILE__, __LINE__);
             }
+            const auto &accum = m_avg_signal.epoch_accum[avg_pos];
             if (is_last) {
-                result = avg_it->second.epoch_accum->interval_average();
+                result = accum.interval_average();
             }
             else {
-                result = avg_it->second.epoch_accum->average();
+                result = accum.average();
             }
         }
         return result;
@@ -380,38 +401,41 @@ namespace geopm
     double SampleAggregatorImp::sample_region_helper(int signal_idx, uint64_t region_hash, bool is_last)
     {
         double result = NAN;
-        auto sum_it = m_sum_signal.find(signal_idx);
-        if (sum_it != m_sum_signal.end()) {
-            const auto &region_accum = sum_it->second.region_accum;
-            auto region_accum_it = region_accum.find(region_hash);
-            if (region_accum_it == region_accum.end()) {
+        int region_idx = -1;
+        auto region_it = m_region_idx.find(region_hash);
+        if (region_it != m_region_idx.end()) {
+            region_idx = region_it->second;
+        }
+        int sum_pos = group_position(m_sum_pos, signal_idx);
+        if (sum_pos != -1) {
+            size_t accum_idx = region_idx * m_sum_signal.size() + sum_pos;
+            if (region_idx == -1 || !m_sum_signal.region_seen[accum_idx]) {
                 result = 0.0;
             }
             else {
-                auto accum_ptr = region_accum_it->second;
+                const auto &accum = m_sum_signal.region_accum[accum_idx];
                 if (is_last) {
-                    result = accum_ptr->interval_total();
+                    result = accum.interval_total();
                 }
                 else {
-                    result = accum_ptr->total();
+                    result = accum.total();
                 }
             }
         }
         else {
-            auto avg_it = m_avg_signal.find(signal_idx);
-            if (avg_it == m_avg_signal.end()) {
+            int avg_pos = group_position(m_avg_pos, signal_idx);
+            if (avg_pos == -1) {
                 throw Exception("SampleAggregator::sample_region(): Invalid signal index: signal index not pushed with push_signal_total() or push_signal_average()",
                                 GEOPM_ERROR_INVALID, __FILE__, __LINE__);
             }
-            const auto &region_accum = avg_it->second.region_accum;
-            auto region_accum_it = region_accum.find(region_hash);
-            if (region_accum_it != region_accum.end()) {
-                auto accum_ptr = region_accum_it->second;
+            size_t accum_idx = region_idx * m_avg_signal.size() + avg_pos;
+            if (region_idx != -1 && m_avg_signal.region_seen[accum_idx]) {
+                const auto &accum = m_avg_signal.region_accum[accum_idx];
                 if (is_last) {
-                    result = accum_ptr->interval_average();
+                    result = accum.interval_average();
                 }
                 else {
-                    result = accum_ptr->average();
+                    result = accum.average();
                 }
             }
         }
@@ -466,17 +490,17 @@ namespace geopm
         }
 
         double result = NAN;
-        auto sum_it = m_sum_signal.find(signal_idx);
-        if (sum_it != m_sum_signal.end()) {
-            result = sum_it->second.period_accum->interval_total();
+        int sum_pos = group_position(m_sum_pos, signal_idx);
+        if (sum_pos != -1) {
+            result = m_sum_signal.period_accum[sum_pos].interval_total();
         }
         else {
-            auto avg_it = m_avg_signal.find(signal_idx);
-            if (avg_it == m_avg_signal.end()) {
+            int avg_pos = group_position(m_avg_pos, signal_idx);
+            if (avg_pos == -1) {
                 throw Exception("SampleAggregator::sample_period(): Invalid signal index: signal index not pushed with push_signal_total() or push_signal_average()",
                                 GEOPM_ERROR_INVALID, __FILE__, __LINE__);
             }
-            result = avg_it->second.period_accum->interval_average();
+            result = m_avg_signal.period_accum[avg_pos].interval_average();
         }
         return result;
     }
@@ -8,15 +8,15 @@
 
 #include <cmath>
 
-#include <map>
+#include <unordered_map>
+#include <vector>
 
 #include "geopm/SampleAggregator.hpp"
+#include "Accumulator.hpp"
 
 namespace geopm
 {
     class PlatformIO;
-    class SumAccumulator;
-    class AvgAccumulator;
 
     class SampleAggregatorImp : public SampleAggregator
     {
@@ -43,70 +43,77 @@ namespace geopm
             double sample_period_last(int signal_idx) override;
 
         private:
-            // All of the data relating to a pushed "total" signal
-            struct m_sum_signal_s {
-                // Value of the signal from last control interval
-                double sample_last;
+            // Accumulators and state for all signals pushed with the
+            // same aggregation type.  Each vector holds one entry for
+            // each signal, in the order the signals were pushed; the
+            // position of a signal is the same in every vector.
+            template <typename accum_type>
+            struct m_signal_group_s {
+                size_t size(void) const
+                {
+                    return signal_idx.size();
+                }
+                // PlatformIO signal index to get the signal value
+                std::vector<int> signal_idx;
                 // PlatformIO signal index to get the region hash
-                int region_hash_idx;
-                // Value of the hash from last control interval
-                uint64_t region_hash_last;
+                std::vector<int> region_hash_idx;
                 // PlatformIO signal index to get the epoch count
-                int epoch_count_idx;
-                // Value of the epoch count from last control interval
-                int epoch_count_last;
-                // Accumulator for application totals (always updated)
-                std::shared_ptr<SumAccumulator> app_accum;
-                // Accumulator for epoch totals (updated after first epoch call)
-                std::shared_ptr<SumAccumulator> epoch_accum;
-                // Accumulator for periodic totals (always updated)
-                std::shared_ptr<SumAccumulator> period_accum;
-                // Map from region hash to an accumulator for that region
-                std::map<uint64_t, std::shared_ptr<SumAccumulator> > region_accum;
-                // Iterator pointing to the region_hash_last map location
-                std::map<uint64_t, std::shared_ptr<SumAccumulator> >::iterator region_accum_it;
-            };
-
-            // All of the data relating to each pushed "average" signal
-            struct m_avg_signal_s {
-                // Time stamp from last control interval
-                double time_last;
-                // PlatformIO signal index to get the region hash
-                int region_hash_idx;
+                std::vector<int> epoch_count_idx;
+                // Value of the signal (total) or time stamp (average)
+                // from last control interval
+                std::vector<double> value_last;
                 // Value of the hash from last control interval
-                uint64_t region_hash_last;
-                // PlatformIO signal index to get the epoch count
-                int epoch_count_idx;
+                std::vector<uint64_t> region_hash_last;
+                // Region index of region_hash_last
+                std::vector<int> region_idx_last;
                 // Value of the epoch count from last control interval
-                int epoch_count_last;
+                std::vector<int> epoch_count_last;
                 // Accumulator for application totals (always updated)
-                std::shared_ptr<AvgAccumulator> app_accum;
+                std::vector<accum_type> app_accum;
                 // Accumulator for epoch totals (updated after first epoch call)
-                std::shared_ptr<AvgAccumulator> epoch_accum;
+                std::vector<accum_type> epoch_accum;
                 // Accumulator for periodic totals (always updated)
-                std::shared_ptr<AvgAccumulator> period_accum;
-                // Map from region hash to an accumulator for that region
-                std::map<uint64_t, std::shared_ptr<AvgAccumulator> > region_accum;
-                // Iterator pointing to the region_hash_last map location
-                std::map<uint64_t, std::shared_ptr<AvgAccumulator> >::iterator region_accum_it;
+                std::vector<accum_type> period_accum;
+                // Accumulator for each region and signal, stored in
+                // one row per region index: the accumulator for a
+                // signal is at region_idx * size() + signal position.
+                std::vector<accum_type> region_accum;
+                // Non-zero if the signal has observed the region, in
+                // the same layout as region_accum
+                std::vector<char> region_seen;
             };
 
+            template <typename accum_type>
+            void push_group_signal(m_signal_group_s<accum_type> &group,
+                                   std::vector<int> &group_pos,
+                                   int signal_idx,
+                                   int domain_type,
+                                   int domain_idx);
+            template <typename accum_type>
+            void grow_group_region(m_signal_group_s<accum_type> &group);
             void update_total(void);
             void update_average(void);
             double sample_epoch_helper(int signal_idx, bool is_last);
             double sample_region_helper(int signal_idx, uint64_t region_hash, bool is_last);
             uint64_t sample_to_hash(double sample);
+            int region_index(uint64_t region_hash);
+            static int group_position(const std::vector<int> &group_pos, int signal_idx);
 
             PlatformIO &m_platform_io;
             // PlatformIO signal index for time of last sample
             int m_time_idx;
             bool m_is_updated;
-            // Map from index returned by push_signal_total() to the
-            // signal structure
-            std::map<int, m_sum_signal_s> m_sum_signal;
-            // Map from index returned by push_signal_average() to the
-            // signal structure
-            std::map<int, m_avg_signal_s> m_avg_signal;
+            // Signals pushed with push_signal_total()
+            m_signal_group_s<SumAccumulatorImp> m_sum_signal;
+            // Signals pushed with push_signal_average()
+            m_signal_group_s<AvgAccumulatorImp> m_avg_signal;
+            // Map from PlatformIO signal index to the position of the
+            // signal in m_sum_signal or m_avg_signal, -1 if not pushed
+            std::vector<int> m_sum_pos;
+            std::vector<int> m_avg_pos;
+            // Map from region hash to region index, shared by all
+            // signals
+            std::unordered_map<uint64_t, int> m_region_idx;
             double m_period_duration;
             int m_period_last;
     };
@@ -8,6 +8,7 @@
 #include "TensorMath.hpp"
 #include "TensorOneD.hpp"
 #include "TensorTwoD.hpp"
+#include "TensorMatrix.hpp"
 
 #include <cmath>
 #include <algorithm>
@@ -73,27 +74,32 @@ namespace geopm
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
 
-        std::vector<double> rval(tensor_a.get_dim());
         const auto &vec_a = tensor_a.get_data();
         const auto &vec_b = tensor_b.get_data();
 
-        return std::inner_product(vec_a.begin(), vec_a.end(), vec_b.begin(), 0);
+        return std::inner_product(vec_a.begin(), vec_a.end(), vec_b.begin(), 0.0);
+    }
+
+    static double sigmoid_value(double value)
+    {
+        double result = 0.0;
+        // Note that a divide by zero error is impossible because denominator is 1+e^-x
+        double retval = exp(-value);
+
+        if (retval == HUGE_VAL) {
+            errno = 0;
+        }
+        else {
+            result = 1 / (1 + retval);
+        }
+        return result;
     }
 
     TensorOneD TensorMathImp::sigmoid(const TensorOneD &tensor) const
     {
         TensorOneD rval(tensor.get_dim());
         for (size_t idx = 0; idx < tensor.get_dim(); ++idx) {
-            // Note that a divide by zero error is impossible because denominator is 1+e^-x
-            double retval = exp(-tensor[idx]);
-
-            if (retval == HUGE_VAL) {
-                errno = 0;
-                rval[idx] = 0;
-            }
-            else {
-                rval[idx] = 1/(1 + retval);
-            }
+            rval[idx] = sigmoid_value(tensor[idx]);
         }
         return rval;
     }
@@ -107,12 +113,64 @@ namespace geopm
         }
 
         const auto &MAT = tensor_a.get_data();
+        const auto &vec_b = tensor_b.get_data();
 
-        TensorOneD rval(tensor_a.get_rows());
+        std::vector<double> rval(tensor_a.get_rows());
 
         for (size_t idx = 0; idx < tensor_a.get_rows(); ++idx) {
-            rval[idx] = MAT[idx] * tensor_b;
+            const auto &row = MAT[idx].get_data();
+            rval[idx] = std::inner_product(row.begin(), row.end(), vec_b.begin(), 0.0);
+        }
+        return TensorOneD(rval);
+    }
+
+    // Add a scaled row of the weights to the output.  The arrays do
+    // not overlap and the length is a whole number of blocks, so the
+    // compiler vectorizes the inner loop.
+    static void axpy_blocks(double scale, const double *__restrict__ weights,
+                            size_t length, double *__restrict__ output)
+    {
+        for (size_t block = 0; block < length; block += TensorMatrix::M_BLOCK_SIZE) {
+            const double *weights_block = weights + block;
+            double *output_block = output + block;
+            for (size_t idx = 0; idx < TensorMatrix::M_BLOCK_SIZE; ++idx) {
+                output_block[idx] += scale * weights_block[idx];
+            }
+        }
+    }
+
+    void TensorMathImp::multiply_add(const TensorMatrix &input,
+                                     const TensorMatrix &weights_t,
+                                     const TensorMatrix &bias,
+                                     bool do_sigmoid,
+                                     TensorMatrix &output) const
+    {
+        if (input.get_cols() != weights_t.get_rows() ||
+            bias.get_rows() != 1 ||
+            bias.get_cols() != weights_t.get_cols()) {
+            throw Exception("TensorMathImp::" + std::string(__func__) +
+                            ": Attempted to multiply matrices with incompatible dimensions.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+
+        size_t num_input = input.get_cols();
+        size_t num_output = weights_t.get_cols();
+        output.set_dim(input.get_rows(), num_output);
+        size_t stride = output.get_stride();
+        const double *bias_row = bias.row(0);
+        for (size_t row_idx = 0; row_idx < input.get_rows(); ++row_idx) {
+            const double *input_row = input.row(row_idx);
+            double *output_row = output.row(row_idx);
+            std::copy(bias_row, bias_row + stride, output_row);
+            for (size_t input_idx = 0; input_idx < num_input; ++input_idx) {
+                axpy_blocks(input_row[input_idx], weights_t.row(input_idx),
+                            stride, output_row);
+            }
+            if (do_sigmoid) {
+                for (size_t output_idx = 0; output_idx < num_output; ++output_idx) {
+                    output_row[output_idx] = sigmoid_value(output_row[output_idx]);
+                }
+            }
         }
-        return rval;
     }
 }
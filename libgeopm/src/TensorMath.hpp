@@ -13,6 +13,7 @@ namespace geopm
 {
     class TensorOneD;
     class TensorTwoD;
+    class TensorMatrix;
 
     /// @brief Class to perform operations on 1D and 2D Tensors,
     ///        aka vectors and matrices, suitable for use in
@@ -63,6 +64,33 @@ namespace geopm
             /// @throws geopm::Exception if the sizes are incompatible, i.e. if 2D
             ///         tensor number of columns is unequal to 1D tensor number of rows
             virtual TensorOneD multiply(const TensorTwoD &, const TensorOneD &) const = 0;
+            /// @brief Evaluate a dense neural net layer for a batch of
+            ///        inputs: each row of the output is the matching
+            ///        row of the input multiplied by the weights plus
+            ///        the bias, optionally passed through the logistic
+            ///        sigmoid.  A batch with one row is a matrix-vector
+            ///        product.
+            ///
+            /// @param [in] input Matrix with one input vector per row.
+            ///
+            /// @param [in] weights_t Transpose of the layer weights:
+            ///        one row per input and one column per output.
+            ///
+            /// @param [in] bias Matrix with one row and one column per
+            ///        output.
+            ///
+            /// @param [in] do_sigmoid Apply the sigmoid to the result.
+            ///
+            /// @param [out] output Resized to one row per input row and
+            ///        one column per output.  Storage is reused when
+            ///        it is large enough.
+            ///
+            /// @throws geopm::Exception if the sizes are incompatible.
+            virtual void multiply_add(const TensorMatrix &input,
+                                      const TensorMatrix &weights_t,
+                                      const TensorMatrix &bias,
+                                      bool do_sigmoid,
+                                      TensorMatrix &output) const = 0;
     };
 
     class TensorMathImp : public TensorMath
@@ -75,6 +103,11 @@ namespace geopm
             double inner_product(const TensorOneD &tensor_a, const TensorOneD &tensor_b) const override;
             TensorOneD sigmoid(const TensorOneD &tensor) const override;
             TensorOneD multiply(const TensorTwoD &, const TensorOneD &) const override;
+            void multiply_add(const TensorMatrix &input,
+                              const TensorMatrix &weights_t,
+                              const TensorMatrix &bias,
+                              bool do_sigmoid,
+                              TensorMatrix &output) const override;
     };
 }
 #endif /* TENSORMATH_HPP_INCLUDE */
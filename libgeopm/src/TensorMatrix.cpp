@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "TensorMatrix.hpp"
+
+#include <algorithm>
+
+#include "geopm/Exception.hpp"
+
+namespace geopm
+{
+    TensorMatrix::TensorMatrix()
+        : TensorMatrix(0, 0)
+    {
+    }
+
+    TensorMatrix::TensorMatrix(size_t rows, size_t cols)
+        : m_rows(0)
+        , m_cols(0)
+        , m_stride(0)
+    {
+        set_dim(rows, cols);
+    }
+
+    TensorMatrix::TensorMatrix(const std::vector<std::vector<double> > &input)
+        : TensorMatrix(input.size(), input.empty() ? 0 : input[0].size())
+    {
+        for (size_t row_idx = 0; row_idx < m_rows; ++row_idx) {
+            if (input[row_idx].size() != m_cols) {
+                throw Exception("TensorMatrix::" + std::string(__func__) +
+                                ": Attempt to load non-rectangular matrix.",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            std::copy(input[row_idx].begin(), input[row_idx].end(), row(row_idx));
+        }
+    }
+
+    size_t TensorMatrix::get_rows() const
+    {
+        return m_rows;
+    }
+
+    size_t TensorMatrix::get_cols() const
+    {
+        return m_cols;
+    }
+
+    size_t TensorMatrix::get_stride() const
+    {
+        return m_stride;
+    }
+
+    void TensorMatrix::set_dim(size_t rows, size_t cols)
+    {
+        size_t stride = (cols + M_BLOCK_SIZE - 1) / M_BLOCK_SIZE * M_BLOCK_SIZE;
+        if (cols != m_cols) {
+            m_data.assign(rows * stride, 0.0);
+        }
+        else {
+            m_data.resize(rows * stride, 0.0);
+        }
+        m_rows = rows;
+        m_cols = cols;
+        m_stride = stride;
+    }
+
+    double *TensorMatrix::row(size_t idx)
+    {
+        return m_data.data() + idx * m_stride;
+    }
+
+    const double *TensorMatrix::row(size_t idx) const
+    {
+        return m_data.data() + idx * m_stride;
+    }
+
+    double &TensorMatrix::operator()(size_t row_idx, size_t col_idx)
+    {
+        return m_data[row_idx * m_stride + col_idx];
+    }
+
+    double TensorMatrix::operator()(size_t row_idx, size_t col_idx) const
+    {
+        return m_data[row_idx * m_stride + col_idx];
+    }
+
+    bool TensorMatrix::operator==(const TensorMatrix &other) const
+    {
+        bool result = m_rows == other.m_rows && m_cols == other.m_cols;
+        for (size_t row_idx = 0; result && row_idx < m_rows; ++row_idx) {
+            result = std::equal(row(row_idx), row(row_idx) + m_cols, other.row(row_idx));
+        }
+        return result;
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TENSORMATRIX_HPP_INCLUDE
+#define TENSORMATRIX_HPP_INCLUDE
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Allocator for std::vector that aligns the storage to
+    ///        ALIGN bytes.
+    template <typename T, size_t ALIGN>
+    class AlignedAllocator
+    {
+        public:
+            using value_type = T;
+            template <typename U>
+            struct rebind
+            {
+                using other = AlignedAllocator<U, ALIGN>;
+            };
+            AlignedAllocator() = default;
+            template <typename U>
+            AlignedAllocator(const AlignedAllocator<U, ALIGN> &other)
+            {
+
+            }
+            T *allocate(size_t num_elem)
+            {
+                return static_cast<T *>(::operator new(num_elem * sizeof(T),
+                                                       std::align_val_t(ALIGN)));
+            }
+            void deallocate(T *ptr, size_t num_elem)
+            {
+                ::operator delete(ptr, std::align_val_t(ALIGN));
+            }
+            template <typename U>
+            bool operator==(const AlignedAllocator<U, ALIGN> &other) const
+            {
+                return true;
+            }
+            template <typename U>
+            bool operator!=(const AlignedAllocator<U, ALIGN> &other) const
+            {
+                return false;
+            }
+    };
+
+    /// @brief Row-major matrix of doubles stored in one contiguous
+    ///        allocation, used by the batched neural net inference
+    ///        kernels in TensorMath.
+    ///
+    /// Each row starts on a cache line boundary and the row stride is
+    /// padded to a whole number of cache lines.  Kernels may read and
+    /// write the padding so that they operate on full blocks without
+    /// a scalar remainder loop.
+    class TensorMatrix
+    {
+        public:
+            /// @brief Number of doubles in each block of a row; row
+            ///        strides are a multiple of this value.
+            static constexpr size_t M_BLOCK_SIZE = 8;
+
+            TensorMatrix();
+            /// @brief Constructor setting dimensions with all
+            ///        elements initialized to zero.
+            TensorMatrix(size_t rows, size_t cols);
+            /// @brief Constructor input from a vector of rows.
+            ///
+            /// @throws geopm::Exception if input is not rectangular.
+            TensorMatrix(const std::vector<std::vector<double> > &input);
+            virtual ~TensorMatrix() = default;
+            /// @brief Get number of rows in the matrix
+            size_t get_rows() const;
+            /// @brief Get number of columns in the matrix
+            size_t get_cols() const;
+            /// @brief Get the number of doubles between the start of
+            ///        consecutive rows.
+            size_t get_stride() const;
+            /// @brief Set dimensions of the matrix
+            ///
+            /// The storage is only reallocated if the new size
+            /// exceeds the capacity, so a matrix used to hold
+            /// intermediate results may be resized on each use
+            /// without allocating.  If the number of columns is
+            /// unchanged, the values in the rows that remain are
+            /// preserved; otherwise all elements are set to zero.
+            void set_dim(size_t rows, size_t cols);
+            /// @brief Pointer to the first element of a row
+            double *row(size_t idx);
+            const double *row(size_t idx) const;
+            /// @brief Reference to the element at row \p row_idx and
+            ///        column \p col_idx.
+            double &operator()(size_t row_idx, size_t col_idx);
+            double operator()(size_t row_idx, size_t col_idx) const;
+            /// @brief Compare dimensions and values, ignoring padding
+            bool operator==(const TensorMatrix &other) const;
+        private:
+            static constexpr size_t M_ALIGNMENT = M_BLOCK_SIZE * sizeof(double);
+            size_t m_rows;
+            size_t m_cols;
+            size_t m_stride;
+            std::vector<double, AlignedAllocator<double, M_ALIGNMENT> > m_data;
+    };
+}
+#endif /* TENSORMATRIX_HPP_INCLUDE */
@@ -31,7 +31,8 @@ namespace geopm
     TracerImp::TracerImp(const std::string &start_time)
         : TracerImp(start_time, environment().trace(), hostname(),
                     environment().do_trace(), PlatformIOProf::platform_io(), platform_topo(),
-                    environment_signal_parser(PlatformIOProf::platform_io().signal_names(), environment().trace_signals()))
+                    environment_signal_parser(PlatformIOProf::platform_io().signal_names(), environment().trace_signals()),
+                    environment().do_trace_binary())
     {
 
     }
@@ -42,8 +43,13 @@ namespace geopm
                          bool do_trace,
                          PlatformIO &platform_io,
                          const PlatformTopo &platform_topo,
-                         const std::vector<std::pair<std::string, int> > &env_column)
-        : m_is_trace_enabled(do_trace)
+                         const std::vector<std::pair<std::string, int> > &env_column,
+                         bool do_trace_binary)
+        : m_file_path(file_path)
+        , m_start_time(start_time)
+        , m_hostname(hostname)
+        , m_is_trace_enabled(do_trace)
+        , m_is_trace_binary(do_trace_binary)
         , m_platform_io(platform_io)
         , m_platform_topo(platform_topo)
         , m_env_column(env_column)
@@ -53,7 +59,10 @@ namespace geopm
         , m_region_progress_idx(-1)
         , m_region_runtime_idx(-1)
     {
-        if (m_is_trace_enabled) {
+        if (m_is_trace_enabled && m_is_trace_binary) {
+            m_csv = geopm::make_unique<CSVBinaryImp>(file_path, hostname, start_time, M_BUFFER_SIZE);
+        }
+        else if (m_is_trace_enabled) {
             m_csv = geopm::make_unique<CSVImp>(file_path, hostname, start_time, M_BUFFER_SIZE);
         }
     }
@@ -119,6 +128,23 @@ namespace geopm
                     base_columns.push_back({env_sig.at(sig_idx), env_dom.at(sig_idx), dom_idx, env_form.at(sig_idx)});
                 }
             }
+            if (m_is_trace_binary) {
+                // Agents may provide format functions that cannot be
+                // stored in the binary schema
+                bool is_supported = std::all_of(col_formats.begin(), col_formats.end(),
+                                                CSVBinaryImp::is_format_supported) &&
+                                    std::all_of(base_columns.begin(), base_columns.end(),
+                                                [](const m_request_s &col) {
+                                                    return CSVBinaryImp::is_format_supported(col.format);
+                                                });
+                if (!is_supported) {
+                    std::cerr << "Warning: <geopm> TracerImp::columns(): trace column format "
+                              << "is not supported in binary traces, writing CSV trace" << std::endl;
+                    m_csv.reset();
+                    m_csv = geopm::make_unique<CSVImp>(m_file_path, m_hostname, m_start_time, M_BUFFER_SIZE);
+                    m_is_trace_binary = false;
+                }
+            }
             // set up columns to be sampled by TracerImp
             for (const auto &col : base_columns) {
                 m_column_idx.push_back(m_platform_io.push_signal(col.name,
@@ -58,7 +58,8 @@ namespace geopm
                       bool do_trace,
                       PlatformIO &platform_io,
                       const PlatformTopo &platform_topo,
-                      const std::vector<std::pair<std::string, int> > &env_column);
+                      const std::vector<std::pair<std::string, int> > &env_column,
+                      bool do_trace_binary = false);
             /// @brief TracerImp destructor, virtual.
             virtual ~TracerImp() = default;
             void columns(const std::vector<std::string> &agent_cols,
@@ -78,9 +79,10 @@ namespace geopm
             std::vector<std::function<std::string(double)> > env_formats(void);
 
             std::string m_file_path;
-            std::string m_header;
+            std::string m_start_time;
             std::string m_hostname;
             bool m_is_trace_enabled;
+            bool m_is_trace_binary;
 
             PlatformIO &m_platform_io;
             const PlatformTopo &m_platform_topo;
@@ -6,9 +6,16 @@
 
 #include "geopm/Waiter.hpp"
 
+#include <errno.h>
 #include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
 
+#include <algorithm>
+
+#include "geopm/Environment.hpp"
 #include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
 #include "geopm_time.h"
 
 
@@ -16,14 +23,23 @@ namespace geopm
 {
     std::unique_ptr<Waiter> Waiter::make_unique(double period)
     {
-        return Waiter::make_unique(period, "sleep");
+        return Waiter::make_unique(period, environment().wait_strategy());
     }
 
     std::unique_ptr<Waiter> Waiter::make_unique(double period,
                                                 std::string strategy)
     {
         if (strategy == "sleep") {
-            return std::make_unique<SleepWaiter>(period);
+            return std::make_unique<ClockSleepWaiter>(period, CLOCK_REALTIME);
+        }
+        else if (strategy == "monotonic") {
+            return std::make_unique<ClockSleepWaiter>(period, CLOCK_MONOTONIC);
+        }
+        else if (strategy == "hybrid") {
+            return std::make_unique<HybridWaiter>(period);
+        }
+        else if (strategy == "timerfd") {
+            return std::make_unique<TimerfdWaiter>(period);
         }
         else {
             throw Exception("Waiter::make_unique(): Unknown strategy: " + strategy,
@@ -31,6 +47,11 @@ namespace geopm
         }
     }
 
+    std::vector<std::pair<std::string, std::string> > Waiter::report(void) const
+    {
+        return {};
+    }
+
     SleepWaiter::SleepWaiter(double period)
         : m_period(period)
         , m_time_target({{0, 0}})
@@ -74,4 +95,200 @@ namespace geopm
     {
         return m_period;
     }
+
+    DeadlineWaiter::DeadlineWaiter(double period, clockid_t clock_id)
+        : M_CLOCK_ID(clock_id)
+        , m_period(period)
+        , m_time_target({{0, 0}})
+        , m_is_first_time(true)
+        , m_lateness_count{}
+        , m_lateness_total(0.0)
+        , m_lateness_max(0.0)
+    {
+
+    }
+
+    struct geopm_time_s DeadlineWaiter::now(void) const
+    {
+        struct geopm_time_s result = {{0, 0}};
+        clock_gettime(M_CLOCK_ID, &(result.t));
+        return result;
+    }
+
+    void DeadlineWaiter::set_target(const struct geopm_time_s &target)
+    {
+        m_time_target = target;
+        arm(m_time_target);
+    }
+
+    void DeadlineWaiter::arm(const struct geopm_time_s &target)
+    {
+
+    }
+
+    void DeadlineWaiter::reset(void)
+    {
+        struct geopm_time_s target = now();
+        geopm_time_add(&target, m_period, &target);
+        set_target(target);
+    }
+
+    void DeadlineWaiter::reset(double period)
+    {
+        m_period = period;
+        reset();
+    }
+
+    void DeadlineWaiter::wait(void)
+    {
+        if (m_is_first_time) {
+            reset();
+            m_is_first_time = false;
+        }
+        wait_until(m_time_target);
+        struct geopm_time_s wake = now();
+        double lateness = std::max(0.0, geopm_time_diff(&m_time_target, &wake));
+        // Bucket boundaries are the decades from 1 us to 100 ms
+        int bucket = 0;
+        for (double bound = 1e-6;
+             bucket < M_NUM_BUCKET - 1 && lateness >= bound;
+             bound *= 10.0) {
+            ++bucket;
+        }
+        ++m_lateness_count[bucket];
+        m_lateness_total += lateness;
+        m_lateness_max = std::max(m_lateness_max, lateness);
+        struct geopm_time_s target;
+        geopm_time_add(&m_time_target, m_period, &target);
+        set_target(target);
+    }
+
+    double DeadlineWaiter::period(void) const
+    {
+        return m_period;
+    }
+
+    std::vector<std::pair<std::string, std::string> > DeadlineWaiter::report(void) const
+    {
+        static const std::array<std::string, M_NUM_BUCKET> bucket_names = {
+            "Wait lateness < 1 us",
+            "Wait lateness 1 us - 10 us",
+            "Wait lateness 10 us - 100 us",
+            "Wait lateness 100 us - 1 ms",
+            "Wait lateness 1 ms - 10 ms",
+            "Wait lateness 10 ms - 100 ms",
+            "Wait lateness >= 100 ms",
+        };
+        uint64_t wait_count = 0;
+        for (const auto &count : m_lateness_count) {
+            wait_count += count;
+        }
+        double lateness_mean = wait_count == 0 ? 0.0 : m_lateness_total / wait_count;
+        std::vector<std::pair<std::string, std::string> > result {
+            {"Wait count", std::to_string(wait_count)},
+            {"Wait lateness mean (s)", string_format_double(lateness_mean)},
+            {"Wait lateness max (s)", string_format_double(m_lateness_max)},
+        };
+        for (int bucket = 0; bucket < M_NUM_BUCKET; ++bucket) {
+            result.push_back({bucket_names[bucket],
+                              std::to_string(m_lateness_count[bucket])});
+        }
+        return result;
+    }
+
+    ClockSleepWaiter::ClockSleepWaiter(double period, clockid_t clock_id)
+        : DeadlineWaiter(period, clock_id)
+    {
+
+    }
+
+    void ClockSleepWaiter::wait_until(const struct geopm_time_s &target)
+    {
+        int err = 0;
+        do {
+            err = clock_nanosleep(M_CLOCK_ID, TIMER_ABSTIME,
+                                  &(target.t), nullptr);
+        } while(err == EINTR);
+
+        if (err != 0) {
+            throw Exception("Waiter::wait(): Failed with error: ",
+                            err, __FILE__, __LINE__);
+        }
+    }
+
+    HybridWaiter::HybridWaiter(double period)
+        : HybridWaiter(period, M_SPIN_DURATION)
+    {
+
+    }
+
+    HybridWaiter::HybridWaiter(double period, double spin_duration)
+        : DeadlineWaiter(period, CLOCK_MONOTONIC)
+        , m_spin_duration(spin_duration)
+    {
+
+    }
+
+    void HybridWaiter::wait_until(const struct geopm_time_s &target)
+    {
+        struct geopm_time_s sleep_target;
+        geopm_time_add(&target, -m_spin_duration, &sleep_target);
+        int err = 0;
+        do {
+            err = clock_nanosleep(M_CLOCK_ID, TIMER_ABSTIME,
+                                  &(sleep_target.t), nullptr);
+        } while(err == EINTR);
+
+        if (err != 0) {
+            throw Exception("Waiter::wait(): Failed with error: ",
+                            err, __FILE__, __LINE__);
+        }
+        struct geopm_time_s curr_time = now();
+        while (geopm_time_comp(&curr_time, &target)) {
+            curr_time = now();
+        }
+    }
+
+    TimerfdWaiter::TimerfdWaiter(double period)
+        : DeadlineWaiter(period, CLOCK_MONOTONIC)
+        , m_timer_fd(timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC))
+    {
+        if (m_timer_fd == -1) {
+            throw Exception("TimerfdWaiter::TimerfdWaiter(): System call failed: timerfd_create(2)",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
+
+    TimerfdWaiter::~TimerfdWaiter()
+    {
+        close(m_timer_fd);
+    }
+
+    int TimerfdWaiter::file_descriptor(void) const
+    {
+        return m_timer_fd;
+    }
+
+    void TimerfdWaiter::arm(const struct geopm_time_s &target)
+    {
+        struct itimerspec timer_value = {{0, 0}, target.t};
+        if (timerfd_settime(m_timer_fd, TFD_TIMER_ABSTIME, &timer_value, nullptr) == -1) {
+            throw Exception("TimerfdWaiter::arm(): System call failed: timerfd_settime(2)",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
+
+    void TimerfdWaiter::wait_until(const struct geopm_time_s &target)
+    {
+        uint64_t num_expire = 0;
+        ssize_t num_read = 0;
+        do {
+            num_read = read(m_timer_fd, &num_expire, sizeof(num_expire));
+        } while (num_read == -1 && errno == EINTR);
+
+        if (num_read != sizeof(num_expire)) {
+            throw Exception("TimerfdWaiter::wait(): System call failed: read(2)",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
 }
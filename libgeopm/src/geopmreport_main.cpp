@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+
+#include <fstream>
+#include <iostream>
+
+#include "geopm_error.h"
+#include "geopm/Exception.hpp"
+#include "Reporter.hpp"
+#include "OptionParser.hpp"
+
+
+static int main_imp(int argc, char **argv);
+
+int main(int argc, char **argv)
+{
+    int err = 0;
+    try {
+        err = main_imp(argc, argv);
+    }
+    catch (const geopm::Exception &ex) {
+        std::cerr << "Error: geopmreport: " << ex.what() << "\n\n";
+        err = ex.err_value();
+    }
+    return err;
+}
+
+static int main_imp(int argc, char **argv)
+{
+    geopm::OptionParser parser{"geopmreport", std::cout, std::cerr, ""};
+    parser.add_option("output", 'o', "output", "",
+                      "path to the YAML report to create, standard output if not specified");
+    parser.add_example_usage("[-o YAML_REPORT] BINARY_REPORT");
+    bool early_exit = parser.parse(argc, argv);
+    if (early_exit) {
+        return 0;
+    }
+
+    auto pos_args = parser.get_positional_args();
+    if (pos_args.size() != 1) {
+        std::cerr << "Error: geopmreport: A single binary report file must be specified" << std::endl;
+        return EINVAL;
+    }
+    std::ifstream input_stream(pos_args[0], std::ios::in | std::ios::binary);
+    if (!input_stream.good()) {
+        throw geopm::Exception("Unable to open binary report '" + pos_args[0] + "'",
+                               errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+    }
+    std::string output = parser.get_value("output");
+    if (output.empty()) {
+        geopm::ReporterImp::convert(input_stream, std::cout);
+    }
+    else {
+        std::ofstream output_stream(output);
+        if (!output_stream.good()) {
+            throw geopm::Exception("Unable to open YAML report '" + output + "'",
+                                   errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        geopm::ReporterImp::convert(input_stream, output_stream);
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+
+#include <fstream>
+#include <iostream>
+
+#include "geopm_error.h"
+#include "geopm/Exception.hpp"
+#include "CSV.hpp"
+#include "OptionParser.hpp"
+
+
+static int main_imp(int argc, char **argv);
+
+int main(int argc, char **argv)
+{
+    int err = 0;
+    try {
+        err = main_imp(argc, argv);
+    }
+    catch (const geopm::Exception &ex) {
+        std::cerr << "Error: geopmtrace: " << ex.what() << "\n\n";
+        err = ex.err_value();
+    }
+    return err;
+}
+
+static int main_imp(int argc, char **argv)
+{
+    geopm::OptionParser parser{"geopmtrace", std::cout, std::cerr, ""};
+    parser.add_option("output", 'o', "output", "",
+                      "path to the CSV file to create, standard output if not specified");
+    parser.add_example_usage("[-o CSV_TRACE] BINARY_TRACE");
+    bool early_exit = parser.parse(argc, argv);
+    if (early_exit) {
+        return 0;
+    }
+
+    auto pos_args = parser.get_positional_args();
+    if (pos_args.size() != 1) {
+        std::cerr << "Error: geopmtrace: A single binary trace file must be specified" << std::endl;
+        return EINVAL;
+    }
+    std::string output = parser.get_value("output");
+    if (output.empty()) {
+        geopm::CSVBinaryImp::convert(pos_args[0], std::cout);
+    }
+    else {
+        std::ofstream output_stream(output);
+        if (!output_stream.good()) {
+            throw geopm::Exception("Unable to open CSV file '" + output + "'",
+                                   errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        geopm::CSVBinaryImp::convert(pos_args[0], output_stream);
+    }
+    return 0;
+}
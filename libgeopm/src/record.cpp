@@ -10,6 +10,9 @@
 #include <utility>
 
 #include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm_debug.hpp"
+#include "geopm_field.h"
 #include "geopm_hint.h"
 
 namespace geopm
@@ -54,6 +57,32 @@ namespace geopm
         return it->second;
     }
 
+    std::string event_signal_format(int event_type, double signal)
+    {
+        std::string result;
+        switch (event_type) {
+            case EVENT_REGION_ENTRY:
+            case EVENT_REGION_EXIT:
+            case EVENT_SHORT_REGION:
+            case EVENT_START_PROFILE:
+            case EVENT_STOP_PROFILE:
+                result = string_format_hex(signal);
+                break;
+            case EVENT_EPOCH_COUNT:
+            case EVENT_AFFINITY:
+                result = string_format_integer(signal);
+                break;
+            case EVENT_OVERHEAD:
+                result = string_format_double(geopm_field_to_signal(signal));
+                break;
+            default:
+                result = "INVALID";
+                GEOPM_DEBUG_ASSERT(false, "event_signal_format(): event out of range");
+                break;
+        }
+        return result;
+    }
+
     std::string hint_name(uint64_t hint)
     {
         static const std::string hint_names[] = {
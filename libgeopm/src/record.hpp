@@ -45,6 +45,14 @@ namespace geopm
     /// @brief Convert a human-readable event type string to
     ///        an event_e
     int event_type(const std::string &event_name);
+    /// @brief Format the signal field of a record as a string.
+    /// @param [in] event_type One of the event_e values that
+    ///        determines the meaning of the signal.
+    /// @param [in] signal Signal field of the record.  For
+    ///        EVENT_SHORT_REGION the signal must be the hash of the
+    ///        short region rather than the handle.
+    /// @return The string used for the signal in profile traces.
+    std::string event_signal_format(int event_type, double signal);
     /// @brief Format a string to represent a hint enum from the
     ///        geopm_region_hint_e.
     /// @param [in] hint One of the hint enum values.
@@ -3,6 +3,10 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <atomic>
+#include <cstring>
+#include <thread>
+
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "geopm_test.hpp"
@@ -69,40 +73,80 @@ TEST_F(ApplicationRecordLogTest, empty_dump)
     std::vector<record_s> records;
     std::vector<short_region_s> short_regions;
     EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
-        .Times(1);
+        .Times(0);
     m_record_log->dump(records, short_regions);
     EXPECT_EQ(0ULL, records.size());
     EXPECT_EQ(0ULL, short_regions.size());
 }
 
-TEST_F(ApplicationRecordLogTest, scoped_lock_test)
+TEST_F(ApplicationRecordLogTest, lock_free_test)
 {
     uint64_t hash = 0x1234abcd;
     geopm_time_s time = {{2, 0}};
 
-    {
-        EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
-            .Times(1);
-        m_record_log->enter(hash, time);
-    }
-    {
-        EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
-            .Times(1);
-        m_record_log->exit(hash, time);
-    }
-    {
-        EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
-            .Times(1);
-        m_record_log->epoch(time);
-    }
-    {
-        std::vector<record_s> records;
-        std::vector<short_region_s> short_regions;
-        EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
-            .Times(1);
+    EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
+        .Times(0);
+    m_record_log->enter(hash, time);
+    m_record_log->exit(hash, time);
+    m_record_log->epoch(time);
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+    m_record_log->dump(records, short_regions);
+}
+
+TEST_F(ApplicationRecordLogTest, concurrent_dump)
+{
+    // Producer and consumer run in separate threads; every
+    // completed region must be accounted for exactly once.
+    const int num_iteration = 100000;
+    const uint64_t hash = 0x1234abcd;
+    std::atomic<bool> is_done(false);
+    std::thread producer([&]() {
+        geopm_time_s time = {{2, 0}};
+        for (int iter = 0; iter < num_iteration; ++iter) {
+            m_record_log->enter(hash, time);
+            time.t.tv_nsec += 1;
+            m_record_log->exit(hash, time);
+            if (iter % 1000 == 0) {
+                m_record_log->epoch(time);
+            }
+        }
+        is_done = true;
+    });
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+    records.reserve(ApplicationRecordLog::max_record());
+    short_regions.reserve(ApplicationRecordLog::max_region());
+    int num_entry = 0;
+    int num_exit = 0;
+    int num_short = 0;
+    uint64_t last_epoch = 0;
+    bool is_last = false;
+    while (!is_last) {
+        is_last = is_done;
         m_record_log->dump(records, short_regions);
+        for (const auto &record : records) {
+            EXPECT_EQ(M_PROC_ID, record.process);
+            if (record.event == geopm::EVENT_REGION_ENTRY) {
+                ++num_entry;
+            }
+            else if (record.event == geopm::EVENT_REGION_EXIT) {
+                ++num_exit;
+            }
+            else if (record.event == geopm::EVENT_SHORT_REGION) {
+                ASSERT_LT(record.signal, short_regions.size());
+                num_short += short_regions[record.signal].num_complete;
+            }
+            else if (record.event == geopm::EVENT_EPOCH_COUNT) {
+                EXPECT_LT(last_epoch, record.signal);
+                last_epoch = record.signal;
+            }
+        }
     }
-
+    producer.join();
+    EXPECT_EQ(num_entry, num_exit);
+    EXPECT_EQ(num_iteration, num_short + num_exit);
+    EXPECT_EQ((uint64_t)(num_iteration + 999) / 1000, last_epoch);
 }
 
 TEST_F(ApplicationRecordLogTest, one_entry)
@@ -269,14 +313,33 @@ TEST_F(ApplicationRecordLogTest, overflow_record_table)
     std::vector<short_region_s> short_regions;
 
     int max_size = 1024;
-    for (int ii = 0; ii < max_size; ++ii) {
+    int num_overflow = 10;
+    for (int ii = 0; ii < max_size + num_overflow; ++ii) {
         m_record_log->epoch({ii, 0});
     }
-    GEOPM_EXPECT_THROW_MESSAGE(m_record_log->epoch({max_size, 0}),
-                               GEOPM_ERROR_RUNTIME, "maximum number of records reached");
+    auto stats = m_record_log->stats();
+    EXPECT_EQ((uint64_t)num_overflow, stats.num_overflow);
+    EXPECT_EQ((uint64_t)num_overflow, stats.max_overflow);
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ((size_t)max_size, records.size());
+    EXPECT_EQ((uint64_t)max_size, records.back().signal);
+
+    // Queued records are moved into the log before the next record
+    m_record_log->epoch({max_size + num_overflow, 0});
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ((size_t)num_overflow + 1, records.size());
+    for (int ii = 0; ii <= num_overflow; ++ii) {
+        EXPECT_EQ(geopm::EVENT_EPOCH_COUNT, records[ii].event);
+        EXPECT_EQ((uint64_t)(max_size + ii + 1), records[ii].signal);
+    }
+    stats = m_record_log->stats();
+    EXPECT_EQ((uint64_t)num_overflow, stats.num_overflow);
+    EXPECT_EQ(2ULL, stats.num_drain);
+    EXPECT_LE(0.0, stats.drain_time_total);
+    EXPECT_LE(stats.drain_time_max, stats.drain_time_total);
 }
 
-TEST_F(ApplicationRecordLogTest, cannot_overflow_region_table)
+TEST_F(ApplicationRecordLogTest, overflow_region_table)
 {
     std::vector<record_s> records;
     std::vector<short_region_s> short_regions;
@@ -293,6 +356,205 @@ TEST_F(ApplicationRecordLogTest, cannot_overflow_region_table)
         m_record_log->enter(hash+ii, {6+ii, 0});
         m_record_log->exit(hash+ii, {6+ii, 0});
     }
-    GEOPM_EXPECT_THROW_MESSAGE(m_record_log->enter(hash+max_size, {6+max_size, 0}),
-                               GEOPM_ERROR_RUNTIME, "maximum number of records reached");
+    // Regions entered while the log is full are not short regions
+    m_record_log->enter(hash+max_size, {6+max_size, 0});
+    m_record_log->exit(hash+max_size, {7+max_size, 0});
+    EXPECT_EQ(2ULL, m_record_log->stats().num_overflow);
+    m_record_log->dump(records, short_regions);
+    EXPECT_EQ((size_t)max_size, records.size());
+    EXPECT_EQ((size_t)max_size, short_regions.size());
+
+    m_record_log->epoch({8+max_size, 0});
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ(3ULL, records.size());
+    EXPECT_EQ(geopm::EVENT_REGION_ENTRY, records[0].event);
+    EXPECT_EQ(hash+max_size, records[0].signal);
+    EXPECT_EQ(geopm::EVENT_REGION_EXIT, records[1].event);
+    EXPECT_EQ(hash+max_size, records[1].signal);
+    EXPECT_EQ(geopm::EVENT_EPOCH_COUNT, records[2].event);
+    EXPECT_EQ(0ULL, short_regions.size());
+}
+
+TEST_F(ApplicationRecordLogTest, overflow_short_region_exit)
+{
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+    uint64_t hash = 0xABCD;
+
+    // Short region that is entered when the log is drained
+    m_record_log->enter(hash, {2, 0});
+    m_record_log->exit(hash, {3, 0});
+    m_record_log->enter(hash, {4, 0});
+    m_record_log->dump(records, short_regions);
+
+    int max_size = 1024;
+    for (int ii = 0; ii < max_size; ++ii) {
+        m_record_log->epoch({5, 0});
+    }
+    // Exit cannot be recorded as a short region, so it is sent as
+    // an entry and exit pair
+    m_record_log->exit(hash, {6, 0});
+    m_record_log->dump(records, short_regions);
+    EXPECT_EQ((size_t)max_size, records.size());
+    EXPECT_EQ(0ULL, short_regions.size());
+    m_record_log->epoch({7, 0});
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ(3ULL, records.size());
+    EXPECT_EQ(geopm::EVENT_REGION_ENTRY, records[0].event);
+    EXPECT_EQ(geopm::EVENT_REGION_EXIT, records[1].event);
+    EXPECT_EQ(hash, records[1].signal);
+    EXPECT_EQ(geopm::EVENT_EPOCH_COUNT, records[2].event);
+}
+
+TEST_F(ApplicationRecordLogTest, overflow_short_region_time)
+{
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+    uint64_t hash = 0xABCD;
+
+    // Region marked short, and then entered again before the dump
+    m_record_log->enter(hash, {2, 0});
+    m_record_log->exit(hash, {3, 0});
+    m_record_log->enter(hash, {4, 500000000});
+    m_record_log->dump(records, short_regions);
+
+    int max_size = 1024;
+    for (int ii = 0; ii < max_size; ++ii) {
+        m_record_log->epoch({5, 0});
+    }
+    // The queued entry keeps the time of the enter() call
+    m_record_log->exit(hash, {6, 0});
+    m_record_log->dump(records, short_regions);
+    m_record_log->epoch({7, 0});
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ(3ULL, records.size());
+    ASSERT_EQ(geopm::EVENT_REGION_ENTRY, records[0].event);
+    ASSERT_EQ(geopm::EVENT_REGION_EXIT, records[1].event);
+    EXPECT_EQ(4, records[0].time.t.tv_sec);
+    EXPECT_EQ(500000000, records[0].time.t.tv_nsec);
+    EXPECT_EQ(6, records[1].time.t.tv_sec);
+    EXPECT_DOUBLE_EQ(1.5, geopm_time_diff(&records[0].time, &records[1].time));
+}
+
+TEST_F(ApplicationRecordLogTest, overflow_order)
+{
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+    // Fill the bank and the overflow queue, then keep adding a record
+    // after each dump so that the queue wraps around
+    int max_size = 1024;
+    int max_overflow = 64 * max_size;
+    int num_record = max_size + max_overflow;
+    for (int ii = 0; ii < num_record; ++ii) {
+        m_record_log->epoch({ii, 0});
+    }
+    std::vector<record_s> result;
+    int num_extra = 2 * max_size;
+    for (int ii = 0; ii < num_extra; ++ii) {
+        m_record_log->dump(records, short_regions);
+        result.insert(result.end(), records.begin(), records.end());
+        m_record_log->epoch({num_record + ii, 0});
+    }
+    do {
+        m_record_log->dump(records, short_regions);
+        result.insert(result.end(), records.begin(), records.end());
+        // Each record added flushes the queue into the bank
+        m_record_log->epoch({num_record + num_extra, 0});
+    } while (result.size() < (size_t)(num_record + num_extra));
+    ASSERT_LE((size_t)(num_record + num_extra), result.size());
+    for (int ii = 0; ii < num_record + num_extra; ++ii) {
+        ASSERT_EQ(ii, result[ii].time.t.tv_sec);
+    }
+}
+
+TEST_F(ApplicationRecordLogTest, overflow_limit)
+{
+    // The queue is bounded if the log is never drained, records
+    // past the limit are dropped and counted
+    size_t max_size = 65 * 1024;
+    for (size_t ii = 0; ii < max_size; ++ii) {
+        m_record_log->epoch({2, 0});
+    }
+    EXPECT_EQ(0ULL, m_record_log->stats().num_drop);
+    EXPECT_NO_THROW(m_record_log->epoch({3, 0}));
+    EXPECT_NO_THROW(m_record_log->epoch({4, 0}));
+    auto stats = m_record_log->stats();
+    EXPECT_EQ(2ULL, stats.num_drop);
+    EXPECT_EQ(64ULL * 1024, stats.max_overflow);
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ(1024ULL, records.size());
+    // The queued records are delivered after the drain
+    m_record_log->epoch({5, 0});
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ(1024ULL, records.size());
+    EXPECT_EQ(2, records.back().time.t.tv_sec);
+}
+
+TEST_F(ApplicationRecordLogTest, large_buffer)
+{
+    size_t max_record = 4 * ApplicationRecordLog::max_record();
+    size_t buffer_size = ApplicationRecordLog::buffer_size(max_record);
+    EXPECT_EQ(ApplicationRecordLog::buffer_size(),
+              ApplicationRecordLog::buffer_size(ApplicationRecordLog::max_record()));
+    auto shmem = std::make_shared<MockSharedMemory>(buffer_size);
+    ApplicationRecordLogImp producer(shmem, M_PROC_ID, m_scheduler);
+    ApplicationRecordLogImp consumer(shmem, M_PROC_ID, m_scheduler);
+    for (size_t ii = 0; ii < max_record; ++ii) {
+        producer.epoch({2, 0});
+    }
+    EXPECT_EQ(0ULL, producer.stats().num_overflow);
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+    consumer.dump(records, short_regions);
+    EXPECT_EQ(max_record, records.size());
+
+    // A buffer of a different size cannot use the same layout
+    auto small_shmem = std::make_shared<MockSharedMemory>(ApplicationRecordLog::buffer_size());
+    memcpy(small_shmem->pointer(), shmem->pointer(), 16);
+    GEOPM_EXPECT_THROW_MESSAGE(ApplicationRecordLogImp(small_shmem, M_PROC_ID, m_scheduler),
+                               GEOPM_ERROR_INVALID, "Shared memory declares a capacity of 4096 records");
+}
+
+TEST_F(ApplicationRecordLogTest, layout_version)
+{
+    auto shmem = std::make_shared<MockSharedMemory>(ApplicationRecordLog::buffer_size());
+    // Version field follows the state and sequence fields
+    ((uint32_t *)shmem->pointer())[2] = 1;
+    GEOPM_EXPECT_THROW_MESSAGE(ApplicationRecordLogImp(shmem, M_PROC_ID, m_scheduler),
+                               GEOPM_ERROR_INVALID, "Shared memory layout version 1 does not match");
+}
+
+TEST_F(ApplicationRecordLogTest, tsc_time)
+{
+    uint64_t tsc = 1234567890123ULL;
+    geopm_time_s time = ApplicationRecordLog::tsc_time(tsc);
+    EXPECT_EQ(1234, time.t.tv_sec);
+    EXPECT_EQ(567890123, time.t.tv_nsec);
+    EXPECT_EQ(tsc, ApplicationRecordLog::time_tsc(time));
+    // Differences of record times are counts multiplied by 1E-9
+    geopm_time_s time_end = ApplicationRecordLog::tsc_time(tsc + 5000000000ULL);
+    EXPECT_NEAR(5.0, geopm_time_diff(&time, &time_end), 1E-9);
+}
+
+TEST_F(ApplicationRecordLogTest, enable_tsc)
+{
+    EXPECT_FALSE(m_record_log->is_tsc_enabled());
+    geopm_time_s time;
+    if (geopm_time_tsc_to_time(geopm_time_tsc(), &time) != 0) {
+        m_record_log->enable_tsc();
+        EXPECT_FALSE(m_record_log->is_tsc_enabled());
+        GTEST_SKIP() << "Time stamp counter cannot be converted on this system";
+    }
+    m_record_log->enable_tsc();
+    EXPECT_TRUE(m_record_log->is_tsc_enabled());
+    // The controller finds the setting in the shared memory
+    ApplicationRecordLogImp reader(m_mock_shared_memory, M_PROC_ID, m_scheduler);
+    EXPECT_TRUE(reader.is_tsc_enabled());
+    uint64_t tsc_begin = geopm_time_tsc();
+    uint64_t tsc = ApplicationRecordLog::time_tsc(m_record_log->time_stamp());
+    uint64_t tsc_end = geopm_time_tsc();
+    EXPECT_LE(tsc_begin, tsc);
+    EXPECT_LE(tsc, tsc_end);
 }
@@ -22,6 +22,7 @@
 
 using testing::_;
 using testing::Return;
+using testing::ReturnArg;
 using testing::SetArgReferee;
 using testing::DoAll;
 using geopm::ApplicationSampler;
@@ -56,6 +57,10 @@ void ApplicationSamplerTest::SetUp()
     m_record_log_0 = std::make_shared<MockApplicationRecordLog>();
     m_record_log_1 = std::make_shared<MockApplicationRecordLog>();
     m_mock_status = std::make_shared<MockApplicationStatus>();
+    // Each process is bound to one CPU and its status slot is the
+    // index of that CPU.
+    EXPECT_CALL(*m_mock_status, get_process(_))
+        .WillRepeatedly(ReturnArg<0>());
     m_num_cpu = 4;
     m_scheduler = std::make_shared<MockScheduler>();
     m_client_cpu_map[0] = {0};
@@ -67,6 +72,10 @@ void ApplicationSamplerTest::SetUp()
     EXPECT_CALL(*m_scheduler, proc_cpuset(234))
        .WillRepeatedly([](){return geopm::make_cpu_set(4, {1});});
 
+    EXPECT_CALL(*m_record_log_0, is_tsc_enabled())
+        .WillRepeatedly(Return(false));
+    EXPECT_CALL(*m_record_log_1, is_tsc_enabled())
+        .WillRepeatedly(Return(false));
     m_process_map[0].filter = m_filter_0;
     m_process_map[0].record_log = m_record_log_0;
     m_process_map[234].filter = m_filter_1;
@@ -375,6 +384,60 @@ TEST_F(ApplicationSamplerTest, short_regions)
                                "event_signal does not match any short region handle");
 }
 
+TEST_F(ApplicationSamplerTest, tsc_records)
+{
+    geopm_time_s time_begin;
+    if (geopm_time_tsc_to_time(geopm_time_tsc(), &time_begin) != 0) {
+        GTEST_SKIP() << "Time stamp counter cannot be converted on this system";
+    }
+    uint64_t region_hash = 0xabcdULL;
+    uint64_t tsc_count = 2000000;
+    geopm_time(&time_begin);
+    uint64_t tsc_begin = geopm_time_tsc();
+    geopm_time_s tsc_time = ApplicationRecordLog::tsc_time(tsc_begin);
+    geopm_time_s time_later = {{time_begin.t.tv_sec + 1, 0}};
+    std::vector<record_s> message_buffer {
+    //   time        process    event                        signal
+        {tsc_time,   0,         geopm::EVENT_REGION_ENTRY,   region_hash},
+        {tsc_time,   0,         geopm::EVENT_SHORT_REGION,   0},
+        {tsc_time,   0,         geopm::EVENT_EPOCH_COUNT,    1},
+        {time_later, 0,         geopm::EVENT_OVERHEAD,       0},
+    };
+    std::vector<short_region_s> short_region_buffer {
+    //   hash         num_complete, total_time
+        {region_hash, 3,            tsc_count * 1E-9}
+    };
+    std::vector<record_s> empty_message_buffer;
+    std::vector<short_region_s> empty_short_region_buffer;
+    EXPECT_CALL(*m_record_log_0, is_tsc_enabled())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*m_record_log_0, dump(_, _))
+        .WillOnce(DoAll(SetArgReferee<0>(message_buffer),
+                        SetArgReferee<1>(short_region_buffer)));
+    EXPECT_CALL(*m_record_log_1, dump(_, _))
+        .WillOnce(DoAll(SetArgReferee<0>(empty_message_buffer),
+                        SetArgReferee<1>(empty_short_region_buffer)));
+    EXPECT_CALL(*m_mock_status, update_cache());
+    EXPECT_CALL(*m_mock_status, get_hint(_))
+        .WillRepeatedly(Return(GEOPM_REGION_HINT_UNKNOWN));
+    m_app_sampler->update({{1, 0}});
+    std::vector<record_s> records = m_app_sampler->get_records();
+    ASSERT_EQ(4U, records.size());
+    // Counter values are converted to the time they were read
+    for (int record_idx = 0; record_idx < 3; ++record_idx) {
+        EXPECT_NEAR(0.0, geopm_time_diff(&time_begin, &(records[record_idx].time)), 1E-3);
+    }
+    // Other events already carry a time
+    EXPECT_EQ(time_later.t.tv_sec, records[3].time.t.tv_sec);
+    EXPECT_EQ(0, records[3].time.t.tv_nsec);
+    // Short region time is converted from counts to seconds
+    geopm_time_s time_end;
+    geopm_time_tsc_to_time(tsc_begin, &time_begin);
+    geopm_time_tsc_to_time(tsc_begin + tsc_count, &time_end);
+    EXPECT_NEAR(geopm_time_diff(&time_begin, &time_end),
+                m_app_sampler->get_short_region(0).total_time, 1E-8);
+}
+
 TEST_F(ApplicationSamplerTest, hash)
 {
     uint64_t region_a = 0xAAAA;
@@ -389,6 +452,28 @@ TEST_F(ApplicationSamplerTest, hash)
     EXPECT_EQ(region_b, hash);
 }
 
+TEST_F(ApplicationSamplerTest, hash_process)
+{
+    // CPUs 0 and 1 are both bound to the process in slot 0, and no
+    // process has been assigned to CPU 1 yet in the second check.
+    uint64_t region_a = 0xAAAA;
+    EXPECT_CALL(*m_mock_status, get_process(0))
+        .WillRepeatedly(Return(0));
+    EXPECT_CALL(*m_mock_status, get_process(1))
+        .WillOnce(Return(0))
+        .WillOnce(Return(-1))
+        .WillOnce(Return(-1));
+    EXPECT_CALL(*m_mock_status, get_hash(0))
+        .WillRepeatedly(Return(region_a));
+    EXPECT_CALL(*m_mock_status, get_hint(0))
+        .WillRepeatedly(Return(GEOPM_REGION_HINT_COMPUTE));
+    EXPECT_EQ(region_a, m_app_sampler->cpu_region_hash(0));
+    EXPECT_EQ(region_a, m_app_sampler->cpu_region_hash(1));
+    EXPECT_EQ(GEOPM_REGION_HASH_INVALID, m_app_sampler->cpu_region_hash(1));
+    EXPECT_EQ(GEOPM_REGION_HINT_UNSET, m_app_sampler->cpu_hint(1));
+    EXPECT_EQ(GEOPM_REGION_HINT_COMPUTE, m_app_sampler->cpu_hint(0));
+}
+
 TEST_F(ApplicationSamplerTest, hint)
 {
     EXPECT_CALL(*m_mock_status, get_hint(0))
@@ -571,3 +656,36 @@ TEST_F(ApplicationSamplerTest, sampler_cpu)
     EXPECT_EQ(1, CPU_ISSET(2, cpu_set.get()));
     EXPECT_EQ(0, CPU_ISSET(3, cpu_set.get()));
 }
+
+TEST_F(ApplicationSamplerTest, report_host)
+{
+    geopm::ApplicationRecordLog::stats_s stats_0 = {
+        .num_overflow = 10,
+        .max_overflow = 8,
+        .num_drop = 0,
+        .num_drain = 4,
+        .drain_time_total = 4e-6,
+        .drain_time_max = 2e-6,
+    };
+    geopm::ApplicationRecordLog::stats_s stats_1 = {
+        .num_overflow = 5,
+        .max_overflow = 5,
+        .num_drop = 3,
+        .num_drain = 4,
+        .drain_time_total = 12e-6,
+        .drain_time_max = 6e-6,
+    };
+    EXPECT_CALL(*m_record_log_0, stats())
+        .WillOnce(Return(stats_0));
+    EXPECT_CALL(*m_record_log_1, stats())
+        .WillOnce(Return(stats_1));
+    std::vector<std::pair<std::string, std::string> > expected {
+        {"Record log overflow count", "15"},
+        {"Record log overflow max", "8"},
+        {"Record log dropped count", "3"},
+        {"Record log drain count", "8"},
+        {"Record log drain time mean (s)", geopm::string_format_double(2e-6)},
+        {"Record log drain time max (s)", geopm::string_format_double(6e-6)},
+    };
+    EXPECT_EQ(expected, m_app_sampler->report_host());
+}
@@ -91,15 +91,15 @@ TEST_F(ApplicationStatusTest, hints)
 
 
     GEOPM_EXPECT_THROW_MESSAGE(m_status->set_hint(-1, NETWORK),
-                               GEOPM_ERROR_INVALID, "invalid CPU index");
+                               GEOPM_ERROR_INVALID, "invalid process index");
     GEOPM_EXPECT_THROW_MESSAGE(m_status->set_hint(99, NETWORK),
-                               GEOPM_ERROR_INVALID, "invalid CPU index");
+                               GEOPM_ERROR_INVALID, "invalid process index");
     GEOPM_EXPECT_THROW_MESSAGE(m_status->set_hint(0, 1ULL << 32),
                                GEOPM_ERROR_INVALID, "hint out of range");
     GEOPM_EXPECT_THROW_MESSAGE(m_status->get_hint(-1),
-                               GEOPM_ERROR_INVALID, "invalid CPU index");
+                               GEOPM_ERROR_INVALID, "invalid process index");
     GEOPM_EXPECT_THROW_MESSAGE(m_status->get_hint(99),
-                               GEOPM_ERROR_INVALID, "invalid CPU index");
+                               GEOPM_ERROR_INVALID, "invalid process index");
     std::vector<uint64_t> bad_data(8, ~0ULL);
     memcpy(m_mock_shared_memory->pointer(), bad_data.data(), 64);
     m_status->update_cache();
@@ -129,15 +129,15 @@ TEST_F(ApplicationStatusTest, hash)
     EXPECT_EQ(GEOPM_REGION_HINT_IGNORE, m_status->get_hint(3));
 
     GEOPM_EXPECT_THROW_MESSAGE(m_status->set_hash(-1, 0xDD, GEOPM_REGION_HINT_UNSET),
-                               GEOPM_ERROR_INVALID, "invalid CPU index");
+                               GEOPM_ERROR_INVALID, "invalid process index");
     GEOPM_EXPECT_THROW_MESSAGE(m_status->set_hash(99, 0xDD, GEOPM_REGION_HINT_UNSET),
-                               GEOPM_ERROR_INVALID, "invalid CPU index");
+                               GEOPM_ERROR_INVALID, "invalid process index");
     GEOPM_EXPECT_THROW_MESSAGE(m_status->set_hash(0, (0xFFULL << 32), GEOPM_REGION_HINT_UNSET),
                                GEOPM_ERROR_INVALID, "invalid region hash");
     GEOPM_EXPECT_THROW_MESSAGE(m_status->get_hash(-1),
-                               GEOPM_ERROR_INVALID, "invalid CPU index");
+                               GEOPM_ERROR_INVALID, "invalid process index");
     GEOPM_EXPECT_THROW_MESSAGE(m_status->get_hash(99),
-                               GEOPM_ERROR_INVALID, "invalid CPU index");
+                               GEOPM_ERROR_INVALID, "invalid process index");
 }
 
 TEST_F(ApplicationStatusTest, work_progress)
@@ -247,3 +247,78 @@ TEST_F(ApplicationStatusTest, update_cache)
     EXPECT_EQ(0.25, m_status->get_progress_cpu(0));
 
 }
+
+TEST_F(ApplicationStatusTest, process)
+{
+    for (int cpu_idx = 0; cpu_idx < M_NUM_CPU; ++cpu_idx) {
+        EXPECT_EQ(-1, m_status->get_process(cpu_idx));
+    }
+    m_status->set_process({0, 1}, 0);
+    m_status->set_process({2, 3}, 2);
+    // process assignment visible after update
+    EXPECT_EQ(-1, m_status->get_process(3));
+    m_status->update_cache();
+    EXPECT_EQ(0, m_status->get_process(0));
+    EXPECT_EQ(0, m_status->get_process(1));
+    EXPECT_EQ(2, m_status->get_process(2));
+    EXPECT_EQ(2, m_status->get_process(3));
+
+    // region is shared by all CPUs of a process
+    m_status->set_hash(0, 0xAA, GEOPM_REGION_HINT_COMPUTE);
+    m_status->set_hash(2, 0xBB, GEOPM_REGION_HINT_MEMORY);
+    m_status->update_cache();
+    EXPECT_EQ(0xAAULL, m_status->get_hash(m_status->get_process(1)));
+    EXPECT_EQ(GEOPM_REGION_HINT_COMPUTE, m_status->get_hint(m_status->get_process(1)));
+    EXPECT_EQ(0xBBULL, m_status->get_hash(m_status->get_process(3)));
+    EXPECT_EQ(GEOPM_REGION_HINT_MEMORY, m_status->get_hint(m_status->get_process(3)));
+
+    // changing the hint does not change the hash
+    m_status->set_hint(2, GEOPM_REGION_HINT_NETWORK);
+    m_status->update_cache();
+    EXPECT_EQ(0xBBULL, m_status->get_hash(2));
+    EXPECT_EQ(GEOPM_REGION_HINT_NETWORK, m_status->get_hint(2));
+
+    GEOPM_EXPECT_THROW_MESSAGE(m_status->set_process({0}, -1),
+                               GEOPM_ERROR_INVALID, "invalid process index");
+    GEOPM_EXPECT_THROW_MESSAGE(m_status->set_process({0}, 99),
+                               GEOPM_ERROR_INVALID, "invalid process index");
+    GEOPM_EXPECT_THROW_MESSAGE(m_status->set_process({0, 99}, 0),
+                               GEOPM_ERROR_INVALID, "invalid CPU index");
+    GEOPM_EXPECT_THROW_MESSAGE(m_status->get_process(-1),
+                               GEOPM_ERROR_INVALID, "invalid CPU index");
+    GEOPM_EXPECT_THROW_MESSAGE(m_status->get_process(99),
+                               GEOPM_ERROR_INVALID, "invalid CPU index");
+}
+
+TEST_F(ApplicationStatusTest, work_progress_region_change)
+{
+    m_status->set_process({0, 1}, 0);
+    m_status->set_hash(0, 0xAA, GEOPM_REGION_HINT_UNSET);
+    m_status->set_total_work_units(0, 4);
+    m_status->set_total_work_units(1, 2);
+    m_status->increment_work_unit(0);
+    m_status->increment_work_unit(1);
+    m_status->update_cache();
+    EXPECT_DOUBLE_EQ(0.25, m_status->get_progress_cpu(0));
+    EXPECT_DOUBLE_EQ(0.50, m_status->get_progress_cpu(1));
+
+    // nested hint change does not invalidate progress
+    m_status->set_hint(0, GEOPM_REGION_HINT_NETWORK);
+    m_status->update_cache();
+    EXPECT_DOUBLE_EQ(0.25, m_status->get_progress_cpu(0));
+    EXPECT_DOUBLE_EQ(0.50, m_status->get_progress_cpu(1));
+
+    // leaving the region invalidates progress for all CPUs of the
+    // process without writing to each CPU
+    m_status->set_hash(0, GEOPM_REGION_HASH_UNMARKED, GEOPM_REGION_HINT_UNSET);
+    m_status->update_cache();
+    EXPECT_TRUE(std::isnan(m_status->get_progress_cpu(0)));
+    EXPECT_TRUE(std::isnan(m_status->get_progress_cpu(1)));
+
+    // new total work in the next region resets completed work
+    m_status->set_hash(0, 0xBB, GEOPM_REGION_HINT_UNSET);
+    m_status->set_total_work_units(0, 8);
+    m_status->update_cache();
+    EXPECT_DOUBLE_EQ(0.0, m_status->get_progress_cpu(0));
+    EXPECT_TRUE(std::isnan(m_status->get_progress_cpu(1)));
+}
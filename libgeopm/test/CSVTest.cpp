@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <fstream>
+#include <iostream>
 #include <memory>
 #include <string>
 #include <vector>
@@ -196,3 +198,96 @@ TEST_F(CSVTest, negative)
     csv->update({1.0});
     unlink(output_path.c_str());
 }
+
+TEST_F(CSVTest, binary_convert)
+{
+    std::string text_path = "CSVTest-binary_convert-text";
+    std::string binary_path = "CSVTest-binary_convert-binary";
+    std::vector<double> sample = {6.103515625e-05,
+                                  0.5,
+                                  1024,
+                                  0x20000000000000ULL,
+                                  geopm_field_to_signal(0xFFFFFFFFFFFFFFFFULL),
+                                  6.103515625e-05};
+    size_t num_row = 3 * m_buffer_size;
+    {
+        // The small buffer forces many hand offs to the writer thread
+        geopm::CSVImp text(text_path, m_host_name, m_start_time, m_buffer_size);
+        geopm::CSVBinaryImp binary(binary_path, m_host_name, m_start_time, m_buffer_size);
+        std::vector<geopm::CSV *> csvs {&text, &binary};
+        for (auto csv : csvs) {
+            csv->add_column("COLUMN_DOUBLE", "double");
+            csv->add_column("COLUMN_FLOAT", "float");
+            csv->add_column("COLUMN_INTEGER", geopm::string_format_integer);
+            csv->add_column("COLUMN_HEX", "hex");
+            csv->add_column("COLUMN_RAW64", geopm::string_format_raw64);
+            csv->add_column("COLUMN_DEFAULT");
+            csv->activate();
+        }
+        for (size_t count = 0; count != num_row; ++count) {
+            sample[2] = count;
+            text.update(sample);
+            binary.update(sample);
+        }
+        binary.flush();
+    }
+    text_path += "-" + m_host_name;
+    binary_path += "-" + m_host_name;
+    std::ostringstream converted;
+    geopm::CSVBinaryImp::convert(binary_path, converted);
+    std::string expect = geopm::read_file(text_path);
+    EXPECT_EQ(7 + num_row, geopm::string_split(expect, "\n").size());
+    EXPECT_EQ(expect, converted.str());
+
+    // A partial row at the end of the file is ignored
+    {
+        std::ofstream binary_stream(binary_path, std::ios::binary | std::ios::app);
+        binary_stream.write((const char *)sample.data(), sizeof(double));
+    }
+    converted.str("");
+    geopm::CSVBinaryImp::convert(binary_path, converted);
+    EXPECT_EQ(expect, converted.str());
+    unlink(text_path.c_str());
+    unlink(binary_path.c_str());
+}
+
+TEST_F(CSVTest, binary_negative)
+{
+    std::string output_path = "CSVTest-binary_negative-output";
+    GEOPM_EXPECT_THROW_MESSAGE(geopm::make_unique<geopm::CSVBinaryImp>("/path/does/not/exist",
+                                                                       "", m_start_time, m_buffer_size),
+                               ENOENT, "Unable to open");
+    GEOPM_EXPECT_THROW_MESSAGE(geopm::CSVBinaryImp::convert("/path/does/not/exist", std::cout),
+                               ENOENT, "Unable to open");
+    {
+        std::unique_ptr<geopm::CSV> csv =
+            geopm::make_unique<geopm::CSVBinaryImp>(output_path, "", m_start_time, m_buffer_size);
+        GEOPM_EXPECT_THROW_MESSAGE(csv->add_column("name", "bad-format"),
+                                   GEOPM_ERROR_INVALID, "format is unknown");
+        auto custom_format = [](double value) {
+            return std::string("custom");
+        };
+        EXPECT_FALSE(geopm::CSVBinaryImp::is_format_supported(custom_format));
+        EXPECT_TRUE(geopm::CSVBinaryImp::is_format_supported(geopm::string_format_hex));
+        GEOPM_EXPECT_THROW_MESSAGE(csv->add_column("name", custom_format),
+                                   GEOPM_ERROR_INVALID, "cannot be stored");
+        csv->add_column("name");
+        GEOPM_EXPECT_THROW_MESSAGE(csv->update({1.0}),
+                                   GEOPM_ERROR_INVALID, "activate() must be called prior");
+        csv->activate();
+        GEOPM_EXPECT_THROW_MESSAGE(csv->add_column("another"),
+                                   GEOPM_ERROR_INVALID, "cannot be called after activate");
+        GEOPM_EXPECT_THROW_MESSAGE(csv->update({1.0, 2.0}),
+                                   GEOPM_ERROR_INVALID, "incorrectly sized");
+        csv->update({1.0});
+    }
+    // A CSV file is not a binary file
+    std::string text_path = "CSVTest-binary_negative-text";
+    {
+        geopm::CSVImp text(text_path, "", m_start_time, m_buffer_size);
+    }
+    GEOPM_EXPECT_THROW_MESSAGE(geopm::CSVBinaryImp::convert(text_path, std::cout),
+                               GEOPM_ERROR_FILE_PARSE, "not a binary CSV file");
+    unlink(output_path.c_str());
+    unlink(text_path.c_str());
+}
@@ -310,6 +310,7 @@ TEST_F(ControllerTest, run_with_no_policy)
 
     EXPECT_CALL(*m_level_agent[root_level], report_header()).WillOnce(Return(m_agent_report));
     EXPECT_CALL(*m_level_agent[0], report_host()).WillOnce(Return(m_agent_report));
+    EXPECT_CALL(m_application_sampler, report_host());
     EXPECT_CALL(*m_level_agent[0], report_region()).WillOnce(Return(m_region_names));
     EXPECT_CALL(*m_reporter_ptr, generate(_, _, _, _, _, _, _));
     EXPECT_CALL(*m_tracer_ptr, flush());
@@ -411,8 +412,12 @@ TEST_F(ControllerTest, single_node)
     EXPECT_CALL(m_platform_io, write_batch()).Times(m_num_step);
     std::vector<double> endpoint_policy = {8.8, 9.9};
     ASSERT_EQ(m_num_send_down, (int)endpoint_policy.size());
-    EXPECT_CALL(*m_endpoint_ptr, read_policy(_)).Times(m_num_step)
-        .WillRepeatedly(DoAll(SetArgReferee<0>(endpoint_policy), Return(0)));
+    // policy is only read after it is updated
+    EXPECT_CALL(*m_endpoint_ptr, is_policy_updated()).Times(m_num_step)
+        .WillOnce(Return(true))
+        .WillRepeatedly(Return(false));
+    EXPECT_CALL(*m_endpoint_ptr, read_policy(_)).Times(1)
+        .WillOnce(DoAll(SetArgReferee<0>(endpoint_policy), Return(0)));
     EXPECT_CALL(*m_reporter_ptr, update()).Times(m_num_step);
     EXPECT_CALL(*m_tracer_ptr, update(_)).Times(m_num_step);
     EXPECT_CALL(*m_profile_tracer, update(_)).Times(m_num_step);
@@ -438,6 +443,7 @@ TEST_F(ControllerTest, single_node)
     // generate report and trace
     EXPECT_CALL(*agent, report_header()).WillOnce(Return(m_agent_report));
     EXPECT_CALL(*agent, report_host()).WillOnce(Return(m_agent_report));
+    EXPECT_CALL(m_application_sampler, report_host());
     EXPECT_CALL(*agent, report_region()).WillOnce(Return(m_region_names));
     EXPECT_CALL(*m_reporter_ptr, generate(_, _, _, _, _, _, _));
     EXPECT_CALL(*m_tracer_ptr, flush());
@@ -492,6 +498,7 @@ TEST_F(ControllerTest, two_level_controller_1)
     m_tree_comm_ptr->reset_spy();
 
     // should not interact with endpoint
+    EXPECT_CALL(*m_endpoint_ptr, is_policy_updated()).Times(0);
     EXPECT_CALL(*m_endpoint_ptr, read_policy(_)).Times(0);
     EXPECT_CALL(*m_endpoint_ptr, write_sample(_)).Times(0);
     EXPECT_CALL(*m_policy_tracer_ptr, update(_)).Times(0);
@@ -523,6 +530,7 @@ TEST_F(ControllerTest, two_level_controller_1)
     EXPECT_CALL(*agent, report_header()).Times(0);
 
     EXPECT_CALL(*agent, report_host()).WillOnce(Return(m_agent_report));
+    EXPECT_CALL(m_application_sampler, report_host());
     EXPECT_CALL(*agent, report_region()).WillOnce(Return(m_region_names));
     EXPECT_CALL(*m_reporter_ptr, generate(_, _, _, _, _, _, _));
     EXPECT_CALL(*m_tracer_ptr, flush());
@@ -586,6 +594,7 @@ TEST_F(ControllerTest, two_level_controller_2)
     m_tree_comm_ptr->reset_spy();
 
     // should not interact with endpoint
+    EXPECT_CALL(*m_endpoint_ptr, is_policy_updated()).Times(0);
     EXPECT_CALL(*m_endpoint_ptr, read_policy(_)).Times(0);
     EXPECT_CALL(*m_endpoint_ptr, write_sample(_)).Times(0);
     EXPECT_CALL(*m_policy_tracer_ptr, update(_)).Times(0);
@@ -626,6 +635,7 @@ TEST_F(ControllerTest, two_level_controller_2)
         EXPECT_CALL(*agent, report_header()).Times(0);
     }
     EXPECT_CALL(*m_level_agent[0], report_host()).WillOnce(Return(m_agent_report));
+    EXPECT_CALL(m_application_sampler, report_host());
     EXPECT_CALL(*m_level_agent[0], report_region()).WillOnce(Return(m_region_names));
     EXPECT_CALL(*m_reporter_ptr, generate(_, _, _, _, _, _, _));
     EXPECT_CALL(*m_tracer_ptr, flush());
@@ -687,8 +697,12 @@ TEST_F(ControllerTest, two_level_controller_0)
     EXPECT_CALL(m_platform_io, read_batch()).Times(m_num_step);
     std::vector<double> endpoint_policy = {8.8, 9.9};
     ASSERT_EQ(m_num_send_down, (int)endpoint_policy.size());
-    EXPECT_CALL(*m_endpoint_ptr, read_policy(_)).Times(m_num_step)
-        .WillRepeatedly(DoAll(SetArgReferee<0>(endpoint_policy), Return(0)));
+    // policy is only read after it is updated
+    EXPECT_CALL(*m_endpoint_ptr, is_policy_updated()).Times(m_num_step)
+        .WillOnce(Return(true))
+        .WillRepeatedly(Return(false));
+    EXPECT_CALL(*m_endpoint_ptr, read_policy(_)).Times(1)
+        .WillOnce(DoAll(SetArgReferee<0>(endpoint_policy), Return(0)));
     EXPECT_CALL(*m_reporter_ptr, update()).Times(m_num_step);
     EXPECT_CALL(*m_tracer_ptr, update(_)).Times(m_num_step);
     EXPECT_CALL(*m_profile_tracer, update(_)).Times(m_num_step);
@@ -729,6 +743,7 @@ TEST_F(ControllerTest, two_level_controller_0)
 
     EXPECT_CALL(*m_level_agent[root_level], report_header()).WillOnce(Return(m_agent_report));
     EXPECT_CALL(*m_level_agent[0], report_host()).WillOnce(Return(m_agent_report));
+    EXPECT_CALL(m_application_sampler, report_host());
     EXPECT_CALL(*m_level_agent[0], report_region()).WillOnce(Return(m_region_names));
     EXPECT_CALL(*m_reporter_ptr, generate(_, _, _, _, _, _, _));
     EXPECT_CALL(*m_tracer_ptr, flush());
@@ -25,8 +25,10 @@
 
 using geopm::DomainNetMap;
 using geopm::DomainNetMapImp;
+using geopm::TensorMatrix;
 using ::testing::ByMove;
 using ::testing::ElementsAre;
+using ::testing::Invoke;
 using ::testing::Mock;
 using ::testing::Return;
 using ::testing::_;
@@ -488,9 +490,6 @@ TEST_F(DomainNetMapTest, test_plumbing)
     good_json.close();
 
     EXPECT_CALL(*m_fake_nn_factory, createTensorOneD(_))
-        .WillOnce(Return(m_biases))
-        .WillOnce(Return(m_tmp1));
-    EXPECT_CALL(*m_fake_nn_factory, createTensorOneD(ElementsAre(0, 2, -4)))
         .WillOnce(Return(m_biases));
     EXPECT_CALL(*m_fake_nn_factory, createTensorTwoD(m_weight_vals))
         .WillOnce(Return(m_weights));
@@ -519,8 +518,17 @@ TEST_F(DomainNetMapTest, test_plumbing)
     DomainNetMapImp net_map(M_FILENAME, GEOPM_DOMAIN_PACKAGE, 0,
                             m_fake_plat_io, m_fake_nn_factory);
 
-    EXPECT_CALL(*m_fake_nn, forward(_)).WillRepeatedly(Return(m_tmp1));
-
+    // The net is evaluated once, with the inputs from the second sample
+    TensorMatrix expected_input(std::vector<std::vector<double> >{{0, 2, -4}});
+    EXPECT_CALL(*m_fake_nn, forward(expected_input, _))
+        .WillOnce(Invoke([this](const TensorMatrix &input, TensorMatrix &output) {
+            output.set_dim(1, m_tmp1.get_dim());
+            for (size_t idx = 0; idx < m_tmp1.get_dim(); ++idx) {
+                output(0, idx) = m_tmp1[idx];
+            }
+        }));
+
+    EXPECT_EQ(std::vector<double>(), net_map.trace_values());
     net_map.sample();
     net_map.sample();
     EXPECT_EQ(std::vector<std::string>({"GEO", "PM", "@", "INTEL", "2023"}),
@@ -529,3 +537,55 @@ TEST_F(DomainNetMapTest, test_plumbing)
     std::map<std::string, double> expected_output({{"GEO", 4}, {"PM", 3}, {"@", -1}, {"INTEL", 0}, {"2023", 2}});
     EXPECT_EQ(expected_output, net_map.last_output());
 }
+
+TEST_F(DomainNetMapTest, test_batch)
+{
+    std::ofstream good_json(M_FILENAME);
+    good_json <<
+        "{\"layers\": ["
+        "[[[1], [2]], [3, 4]]"
+        "],"
+        "\"signal_inputs\": [\"A\"],"
+        "\"trace_outputs\": [\"X\", \"Y\"]}" << std::endl;
+    good_json.close();
+
+    // The neural net is loaded once for both domains
+    EXPECT_CALL(*m_fake_nn_factory, createTensorOneD(_))
+        .WillOnce(Return(m_biases));
+    EXPECT_CALL(*m_fake_nn_factory, createTensorTwoD(_))
+        .WillOnce(Return(m_weights));
+    EXPECT_CALL(*m_fake_nn_factory, createDenseLayer(_, _))
+        .WillOnce(Return(m_fake_layer));
+    EXPECT_CALL(*m_fake_nn_factory, createLocalNeuralNet(ElementsAre(m_fake_layer)))
+        .WillOnce(Return(m_fake_nn));
+    EXPECT_CALL(*m_fake_nn, get_input_dim()).WillRepeatedly(Return(1));
+    EXPECT_CALL(*m_fake_nn, get_output_dim()).WillRepeatedly(Return(2));
+
+    EXPECT_CALL(m_fake_plat_io, push_signal("A", GEOPM_DOMAIN_GPU, 1)).WillOnce(Return(0));
+    EXPECT_CALL(m_fake_plat_io, push_signal("A", GEOPM_DOMAIN_GPU, 3)).WillOnce(Return(1));
+    EXPECT_CALL(m_fake_plat_io, sample(0)).WillOnce(Return(5));
+    EXPECT_CALL(m_fake_plat_io, sample(1)).WillOnce(Return(7));
+
+    std::vector<std::shared_ptr<DomainNetMap> > net_maps =
+        DomainNetMapImp::make_shared_batch(M_FILENAME, GEOPM_DOMAIN_GPU, {1, 3},
+                                           m_fake_plat_io, m_fake_nn_factory);
+    ASSERT_EQ(2u, net_maps.size());
+
+    // Both domains are evaluated in one call with one row each
+    TensorMatrix expected_input(std::vector<std::vector<double> >{{5}, {7}});
+    EXPECT_CALL(*m_fake_nn, forward(expected_input, _))
+        .WillOnce(Invoke([](const TensorMatrix &input, TensorMatrix &output) {
+            output.set_dim(input.get_rows(), 2);
+            for (size_t row = 0; row < input.get_rows(); ++row) {
+                output(row, 0) = input(row, 0);
+                output(row, 1) = 2 * input(row, 0);
+            }
+        }));
+
+    net_maps[0]->sample();
+    net_maps[1]->sample();
+    EXPECT_EQ(std::vector<double>({7, 14}), net_maps[1]->trace_values());
+    EXPECT_EQ(std::vector<double>({5, 10}), net_maps[0]->trace_values());
+    std::map<std::string, double> expected_output({{"X", 7}, {"Y", 14}});
+    EXPECT_EQ(expected_output, net_maps[1]->last_output());
+}
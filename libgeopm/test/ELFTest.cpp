@@ -76,3 +76,41 @@ TEST_F(ELFTest, symbol_lookup)
     symbol = geopm::symbol_lookup((void*)fn_off);
     EXPECT_EQ("geopm_crc32_str", symbol.second);
 }
+
+TEST_F(ELFTest, symbol_table_lookup)
+{
+    geopm::ELFSymbolTable table({{0x100, "alpha"},
+                                 {0x200, "beta"},
+                                 {0x280, ""},
+                                 {0x300, "gamma"}});
+    EXPECT_EQ(4ULL, table.num_symbol());
+    std::pair<size_t, std::string> expect(0, "");
+    EXPECT_EQ(expect, table.lookup(0x0));
+    EXPECT_EQ(expect, table.lookup(0xff));
+    expect = {0x100, "alpha"};
+    EXPECT_EQ(expect, table.lookup(0x100));
+    EXPECT_EQ(expect, table.lookup(0x1ff));
+    expect = {0x200, "beta"};
+    EXPECT_EQ(expect, table.lookup(0x27f));
+    expect = {0x280, ""};
+    EXPECT_EQ(expect, table.lookup(0x2ff));
+    expect = {0x300, "gamma"};
+    EXPECT_EQ(expect, table.lookup(0x300));
+    EXPECT_EQ(expect, table.lookup(~0ULL));
+
+    geopm::ELFSymbolTable empty_table({});
+    EXPECT_EQ(0ULL, empty_table.num_symbol());
+    expect = {0, ""};
+    EXPECT_EQ(expect, empty_table.lookup(0x100));
+}
+
+TEST_F(ELFTest, symbol_table_matches_map)
+{
+    std::map<size_t, std::string> off_sym_map(geopm::elf_symbol_map(m_program_name));
+    std::shared_ptr<const geopm::ELFSymbolTable> table(geopm::elf_symbol_table(m_program_name));
+    ASSERT_EQ(off_sym_map.size(), table->num_symbol());
+    for (const auto &symbol : off_sym_map) {
+        std::pair<size_t, std::string> expect(symbol.first, symbol.second);
+        EXPECT_EQ(expect, table->lookup(symbol.first));
+    }
+}
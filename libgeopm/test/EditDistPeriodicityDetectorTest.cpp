@@ -135,6 +135,30 @@ TEST_F(EditDistPeriodicityDetectorTest, fft_small)
     check_vals(m_trace_file_prefix + "fft_small.trace", warmup, period, history_size);
 }
 
+/// Pattern: (ABCDE)x100 with a history longer than the pattern
+/// repeats and shorter than the trace
+TEST_F(EditDistPeriodicityDetectorTest, long_history)
+{
+    int warmup = 9;
+    int period = 5;
+    int history_size = 300;
+    int num_rec = 500;
+
+    std::vector<record_s> recs(num_rec);
+    std::vector<std::vector<int> > expected;
+    for (int rec_idx = 0; rec_idx < num_rec; ++rec_idx) {
+        recs[rec_idx].event = geopm::EVENT_REGION_ENTRY;
+        recs[rec_idx].signal = 0xA + rec_idx % period;
+        if (rec_idx < warmup) {
+            expected.push_back({-1, 0});
+        }
+        else {
+            expected.push_back({period, 0});
+        }
+    }
+    check_vals(recs, expected, history_size);
+}
+
 /// HELPER FUNCTIONS
 
 /// start: inclusive
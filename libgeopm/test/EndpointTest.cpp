@@ -164,14 +164,18 @@ TEST_F(EndpointTestIntegration, write_read_policy)
     EndpointUserImp mios(m_shm_path, nullptr, nullptr, "myagent", 0, "", "", {});
 
     std::vector<double> result(values.size());
+    EXPECT_TRUE(mios.is_policy_updated());
     mios.read_policy(result);
     EXPECT_EQ(values, result);
+    EXPECT_FALSE(mios.is_policy_updated());
 
     values[0] = 888;
     mio->write_policy(values);
+    EXPECT_TRUE(mios.is_policy_updated());
     usleep(10);
     double age = mios.read_policy(result);
     EXPECT_EQ(values, result);
+    EXPECT_FALSE(mios.is_policy_updated());
     EXPECT_LT(0.0, age);
     EXPECT_LT(age, 0.01);
     mio->close();
@@ -429,3 +433,116 @@ TEST_F(EndpointTest, wait_detach_timeout_0)
     EXPECT_EQ("", mio->get_agent());
     mio->close();
 }
+
+TEST_F(EndpointTest, wait_before_open_throws)
+{
+    EndpointImp gp(m_shm_path, nullptr, nullptr, 0, 0);
+    GEOPM_EXPECT_THROW_MESSAGE(gp.wait_for_agent_attach(0), GEOPM_ERROR_RUNTIME,
+                               "cannot use shmem before calling open()");
+    GEOPM_EXPECT_THROW_MESSAGE(gp.wait_for_agent_detach(0), GEOPM_ERROR_RUNTIME,
+                               "cannot use shmem before calling open()");
+}
+
+TEST_F(EndpointTest, shm_wait_timeout)
+{
+    std::atomic<uint32_t> notify(1);
+    geopm_time_s before;
+    geopm_time(&before);
+    // notify word no longer holds the expected value; return immediately
+    EndpointImp::shm_wait(notify, 0, m_timeout);
+    EXPECT_GT(m_timeout / 2.0, geopm_time_since(&before));
+    // nothing wakes the waiter; return after the timeout
+    geopm_time(&before);
+    EndpointImp::shm_wait(notify, 1, 0.05);
+    EXPECT_NEAR(0.05, geopm_time_since(&before), 0.05);
+}
+
+TEST_F(EndpointTest, shm_notify_wakes_waiter)
+{
+    GEOPM_TEST_EXTENDED("Requires multiple threads");
+    std::atomic<uint32_t> notify(0);
+    geopm_time_s before;
+    geopm_time(&before);
+    auto run_thread = std::async(std::launch::async, [this, &notify]() {
+        EndpointImp::shm_wait(notify, 0, m_timeout);
+    });
+    ASSERT_TRUE(run_thread.valid());
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EndpointImp::shm_notify(notify);
+    EXPECT_EQ(1U, notify.load());
+    // woken long before the timeout
+    auto result = run_thread.wait_for(std::chrono::seconds(m_timeout - 1));
+    EXPECT_NE(result, std::future_status::timeout);
+    run_thread.get();
+    EXPECT_GT(m_timeout / 2.0, geopm_time_since(&before));
+}
+
+TEST_F(EndpointTest, wait_woken_when_agent_attaches)
+{
+    GEOPM_TEST_EXTENDED("Requires multiple threads");
+    set_up_expectations();
+
+    struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) m_sample_shmem->pointer();
+    std::shared_ptr<Endpoint> mio = std::make_shared<EndpointImp>(m_shm_path, m_policy_shmem, m_sample_shmem, 0, 0);
+    mio->open();
+
+    auto run_thread = std::async(std::launch::async,
+                                 &Endpoint::wait_for_agent_attach,
+                                 mio,
+                                 m_timeout);
+    ASSERT_TRUE(run_thread.valid());
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    geopm_time_s before;
+    geopm_time(&before);
+    // simulate agent attach the way EndpointUser does it
+    EndpointImp::shm_write_begin(data->sequence);
+    strncpy(data->agent, "monitor", GEOPM_ENDPOINT_AGENT_NAME_MAX);
+    EndpointImp::shm_write_end(data->sequence);
+    EndpointImp::shm_notify(data->notify);
+    run_thread.get();
+    // woken before the 100 ms bound on each sleep expires
+    EXPECT_GT(0.05, geopm_time_since(&before));
+    mio->close();
+}
+
+TEST_F(EndpointTest, shm_read_retry)
+{
+    std::atomic<uint32_t> sequence(2);
+    EXPECT_CALL(*m_sample_shmem, get_scoped_lock()).Times(0);
+    int num_read = 0;
+    // a writer completes an update during the first read
+    uint32_t result = EndpointImp::shm_read(*m_sample_shmem, sequence, [&]() {
+        if (num_read == 0) {
+            sequence += 2;
+        }
+        ++num_read;
+    });
+    EXPECT_EQ(2, num_read);
+    EXPECT_EQ(4U, result);
+}
+
+TEST_F(EndpointTest, shm_read_fallback)
+{
+    // writer is busy during every lock free attempt
+    std::atomic<uint32_t> sequence(3);
+    EXPECT_CALL(*m_sample_shmem, get_scoped_lock()).Times(1);
+    int num_read = 0;
+    uint32_t result = EndpointImp::shm_read(*m_sample_shmem, sequence, [&]() {
+        ++num_read;
+    });
+    // only read while holding the lock
+    EXPECT_EQ(1, num_read);
+    EXPECT_EQ(3U, result);
+    testing::Mock::VerifyAndClearExpectations(m_sample_shmem.get());
+
+    // writer completes an update during every lock free attempt
+    sequence = 4;
+    EXPECT_CALL(*m_sample_shmem, get_scoped_lock()).Times(1);
+    num_read = 0;
+    EndpointImp::shm_read(*m_sample_shmem, sequence, [&]() {
+        sequence += 2;
+        ++num_read;
+    });
+    // four lock free attempts and one read while holding the lock
+    EXPECT_EQ(5, num_read);
+}
@@ -82,6 +82,8 @@ void EnvironmentTest::expect_vars(std::map<std::string, std::string> exp_vars) c
 {
     EXPECT_EQ(exp_vars.find("GEOPM_TRACE") != exp_vars.end(), m_env->do_trace());
     EXPECT_EQ(exp_vars.find("GEOPM_TRACE_PROFILE") != exp_vars.end(), m_env->do_trace_profile());
+    EXPECT_EQ(exp_vars.find("GEOPM_TRACE_BINARY") != exp_vars.end(), m_env->do_trace_binary());
+    EXPECT_EQ(exp_vars.find("GEOPM_REPORT_BINARY") != exp_vars.end(), m_env->do_report_binary());
     EXPECT_EQ(exp_vars["GEOPM_REPORT"], m_env->report());
 #ifdef GEOPM_ENABLE_MPI
     EXPECT_EQ(exp_vars["GEOPM_COMM"], m_env->comm());
@@ -655,6 +657,16 @@ TEST_F(EnvironmentTest, init_control_unset)
     EXPECT_EQ("", m_env->init_control());
 }
 
+TEST_F(EnvironmentTest, wait_strategy)
+{
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("sleep", m_env->wait_strategy());
+
+    setenv("GEOPM_WAIT_STRATEGY", "hybrid", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("hybrid", m_env->wait_strategy());
+}
+
 TEST_F(EnvironmentTest, signal_parser)
 {
     std::vector<std::pair<std::string, int> >& expected_signals = m_trace_signals;
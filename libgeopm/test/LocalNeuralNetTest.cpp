@@ -13,15 +13,20 @@
 #include "LocalNeuralNetImp.hpp"
 #include "DenseLayer.hpp"
 #include "TensorOneD.hpp"
+#include "TensorTwoD.hpp"
+#include "TensorMatrix.hpp"
 
 #include "MockDenseLayer.hpp"
 #include "MockTensorMath.hpp"
 #include "TensorOneDMatcher.hpp"
 
 using geopm::TensorOneD;
+using geopm::TensorTwoD;
+using geopm::TensorMatrix;
 using geopm::DenseLayer;
 using geopm::LocalNeuralNet;
 using geopm::LocalNeuralNetImp;
+using ::testing::Invoke;
 using ::testing::Mock;
 using ::testing::Return;
 using ::testing::_;
@@ -95,3 +100,51 @@ TEST_F(LocalNeuralNetTest, test_bad_dimensions)
                                    "Input vector dimension is incompatible");
     }
 }
+
+TEST_F(LocalNeuralNetTest, test_batch_inference)
+{
+    LocalNeuralNetImp net({m_fake_layer1, m_fake_layer2});
+    TensorMatrix input({{1, 2}, {3, 4}});
+    TensorMatrix hidden({{1, 2, 3, 4}, {5, 6, 7, 8}});
+    TensorMatrix expected({{1, 2, 3}, {4, 5, 6}});
+
+    // The sigmoid is applied by all but the last layer
+    EXPECT_CALL(*m_fake_layer1, forward(input, true, _))
+        .WillOnce(Invoke([&hidden](const TensorMatrix &inp, bool do_sigmoid,
+                                   TensorMatrix &out) {
+            out = hidden;
+        }));
+    EXPECT_CALL(*m_fake_layer2, forward(hidden, false, _))
+        .WillOnce(Invoke([&expected](const TensorMatrix &inp, bool do_sigmoid,
+                                     TensorMatrix &out) {
+            out = expected;
+        }));
+
+    TensorMatrix output;
+    net.forward(input, output);
+    EXPECT_EQ(expected, output);
+
+    GEOPM_EXPECT_THROW_MESSAGE(net.forward(hidden, output),
+                               GEOPM_ERROR_INVALID,
+                               "Input vector dimension is incompatible");
+}
+
+TEST_F(LocalNeuralNetTest, test_batch_matches_single)
+{
+    TensorTwoD weights1(std::vector<std::vector<double> >{{0.5, -0.25}, {0.1, 0.2}, {-0.3, 0.7}});
+    TensorOneD biases1(std::vector<double>{0.1, -0.2, 0.3});
+    TensorTwoD weights2(std::vector<std::vector<double> >{{1.5, -0.5, 0.25}});
+    TensorOneD biases2(std::vector<double>{-0.1});
+    LocalNeuralNetImp net({geopm::DenseLayer::make_unique(weights1, biases1),
+                           geopm::DenseLayer::make_unique(weights2, biases2)});
+    std::vector<std::vector<double> > inputs {{0.0, 1.0}, {2.0, -1.0}, {-0.5, 0.25}};
+    TensorMatrix input(inputs);
+    TensorMatrix output;
+    net.forward(input, output);
+    ASSERT_EQ(inputs.size(), output.get_rows());
+    ASSERT_EQ(1u, output.get_cols());
+    for (size_t row = 0; row < inputs.size(); ++row) {
+        TensorOneD expected = net.forward(TensorOneD(inputs[row]));
+        EXPECT_NEAR(expected[0], output(row, 0), 1e-12);
+    }
+}
@@ -125,6 +125,7 @@ test_geopm_test_SOURCES = test/AccumulatorTest.cpp \
                           test/SSTClosGovernorTest.cpp \
                           test/SSTFrequencyLimitDetectorTest.cpp \
                           test/TensorMathTest.cpp \
+                          test/TensorMatrixTest.cpp \
                           test/TensorOneDTest.cpp \
                           test/TensorOneDIntegrationTest.cpp \
                           test/TensorOneDMatcher.cpp \
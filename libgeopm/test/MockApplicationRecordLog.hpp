@@ -25,6 +25,10 @@ class MockApplicationRecordLog : public geopm::ApplicationRecordLog
         MOCK_METHOD(void, start_profile, (const geopm_time_s &time, const std::string &profile_name), (override));
         MOCK_METHOD(void, stop_profile, (const geopm_time_s &time, const std::string &profile_name), (override));
         MOCK_METHOD(void, overhead, (const geopm_time_s &time, double overhead_sec), (override));
+        MOCK_METHOD(void, enable_tsc, (), (override));
+        MOCK_METHOD(bool, is_tsc_enabled, (), (const, override));
+        MOCK_METHOD(geopm_time_s, time_stamp, (), (const, override));
+        MOCK_METHOD(stats_s, stats, (), (const, override));
 };
 
 #endif
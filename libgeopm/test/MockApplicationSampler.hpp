@@ -28,6 +28,8 @@ class MockApplicationSampler : public geopm::ApplicationSampler
         MOCK_METHOD(bool, do_shutdown, (), (const, override));
         MOCK_METHOD(double, total_time, (), (const, override));
         MOCK_METHOD(double, overhead_time, (), (const, override));
+        MOCK_METHOD((std::vector<std::pair<std::string, std::string> >),
+                    report_host, (), (const, override));
         std::vector<geopm::record_s> get_records(void) const override;
         /// Inject records to be used by next call to get_records()
         /// @todo: figure out input type for this
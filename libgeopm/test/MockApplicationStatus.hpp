@@ -13,11 +13,14 @@
 class MockApplicationStatus : public geopm::ApplicationStatus
 {
     public:
-        MOCK_METHOD(void, set_hint, (int cpu_idx, uint64_t hints), (override));
-        MOCK_METHOD(uint64_t, get_hint, (int cpu_idx), (const, override));
-        MOCK_METHOD(void, set_hash, (int cpu_idx, uint64_t hash, uint64_t hint),
+        MOCK_METHOD(void, set_process, (const std::set<int> &cpu_set, int process),
                     (override));
-        MOCK_METHOD(uint64_t, get_hash, (int cpu_idx), (const, override));
+        MOCK_METHOD(int, get_process, (int cpu_idx), (const, override));
+        MOCK_METHOD(void, set_hint, (int process, uint64_t hints), (override));
+        MOCK_METHOD(uint64_t, get_hint, (int process), (const, override));
+        MOCK_METHOD(void, set_hash, (int process, uint64_t hash, uint64_t hint),
+                    (override));
+        MOCK_METHOD(uint64_t, get_hash, (int process), (const, override));
         MOCK_METHOD(void, reset_work_units, (int cpu_idx), (override));
         MOCK_METHOD(void, set_total_work_units, (int cpu_idx, int work_units),
                     (override));
@@ -9,12 +9,16 @@
 #include "gmock/gmock.h"
 #include "DenseLayer.hpp"
 #include "TensorOneD.hpp"
+#include "TensorMatrix.hpp"
 
 class MockDenseLayer : public geopm::DenseLayer
 {
     public:
         MOCK_METHOD(geopm::TensorOneD, forward, (const geopm::TensorOneD &input),
                     (const override));
+        MOCK_METHOD(void, forward, (const geopm::TensorMatrix &input, bool do_sigmoid,
+                                    geopm::TensorMatrix &output),
+                    (const override));
         MOCK_METHOD(size_t, get_input_dim, (), (const override));
         MOCK_METHOD(size_t, get_output_dim, (), (const override));
 };
@@ -16,6 +16,7 @@ class MockEndpointUser : public geopm::EndpointUser
         MOCK_METHOD(double, read_policy, (std::vector<double> & policy), (override));
         MOCK_METHOD(void, write_sample, (const std::vector<double> &sample),
                     (override));
+        MOCK_METHOD(bool, is_policy_updated, (), (override));
 };
 
 #endif
@@ -8,12 +8,16 @@
 
 #include "gmock/gmock.h"
 #include "LocalNeuralNet.hpp"
+#include "TensorMatrix.hpp"
 
 class MockLocalNeuralNet : public geopm::LocalNeuralNet
 {
     public:
         MOCK_METHOD(geopm::TensorOneD, forward, (const geopm::TensorOneD &input),
                     (const override));
+        MOCK_METHOD(void, forward, (const geopm::TensorMatrix &input,
+                                    geopm::TensorMatrix &output),
+                    (override));
         MOCK_METHOD(size_t, get_input_dim, (), (const override));
         MOCK_METHOD(size_t, get_output_dim, (), (const override));
 };
@@ -11,6 +11,7 @@
 #include "TensorMath.hpp"
 #include "TensorOneD.hpp"
 #include "TensorTwoD.hpp"
+#include "TensorMatrix.hpp"
 
 class MockTensorMath : public geopm::TensorMath
 {
@@ -25,6 +26,10 @@ class MockTensorMath : public geopm::TensorMath
                     (const, override));
         MOCK_METHOD(geopm::TensorOneD, multiply, (const geopm::TensorTwoD& tensor_a,
                     const geopm::TensorOneD& tensor_b), (const, override));
+        MOCK_METHOD(void, multiply_add, (const geopm::TensorMatrix &input,
+                    const geopm::TensorMatrix &weights_t,
+                    const geopm::TensorMatrix &bias, bool do_sigmoid,
+                    geopm::TensorMatrix &output), (const, override));
 };
 
 #endif
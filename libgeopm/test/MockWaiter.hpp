@@ -16,6 +16,8 @@ class MockWaiter : public geopm::Waiter
         MOCK_METHOD(void, reset, (double period), (override));
         MOCK_METHOD(void, wait, (), (override));
         MOCK_METHOD(double, period, (), (const, override));
+        MOCK_METHOD((std::vector<std::pair<std::string, std::string> >), report,
+                    (), (const, override));
 };
 
 #endif
@@ -61,10 +61,14 @@ void ProfileTest::SetUp()
 
     EXPECT_CALL(*m_service_proxy, platform_start_profile("profile"));
     EXPECT_CALL(*m_service_proxy, platform_stop_profile(_));
+    EXPECT_CALL(*m_record_log, enable_tsc());
+    EXPECT_CALL(*m_record_log, time_stamp())
+        .WillRepeatedly(Return(geopm_time_s {{1, 0}}));
     EXPECT_CALL(*m_record_log, cpuset_changed(_));
     EXPECT_CALL(*m_record_log, start_profile(_, "profile"));
+    // The status slot for the process is the lowest CPU in its set
+    EXPECT_CALL(*m_status, set_process(m_cpu_list, 2));
     EXPECT_CALL(*m_status, set_hash(2, GEOPM_REGION_HASH_UNMARKED, GEOPM_REGION_HINT_UNSET));
-    EXPECT_CALL(*m_status, set_hash(3, GEOPM_REGION_HASH_UNMARKED, GEOPM_REGION_HINT_UNSET));
     EXPECT_CALL(*m_record_log, overhead(_, _));
     EXPECT_CALL(*m_record_log, stop_profile(_, "profile"));
 
@@ -89,16 +93,13 @@ TEST_F(ProfileTest, enter_exit)
 
     EXPECT_CALL(*m_record_log, enter(hash, _));
     EXPECT_CALL(*m_status, set_hash(2, hash, hint));
-    EXPECT_CALL(*m_status, set_hash(3, hash, hint));
     m_profile->enter(region_id);
 
     EXPECT_CALL(*m_record_log, exit(hash, _));
-    // hint is cleared when exiting top-level region
+    // hint is cleared when exiting top-level region; setting the
+    // hash also invalidates the progress of each CPU
     EXPECT_CALL(*m_status, set_hash(2, GEOPM_REGION_HASH_UNMARKED, GEOPM_REGION_HINT_UNSET));
-    EXPECT_CALL(*m_status, set_hash(3, GEOPM_REGION_HASH_UNMARKED, GEOPM_REGION_HINT_UNSET));
-    // progress is cleared when exiting top-level region
-    EXPECT_CALL(*m_status, reset_work_units(2));
-    EXPECT_CALL(*m_status, reset_work_units(3));
+    EXPECT_CALL(*m_status, reset_work_units(_)).Times(0);
 
     m_profile->exit(region_id);
 }
@@ -122,7 +123,6 @@ TEST_F(ProfileTest, enter_exit_nested)
         // enter region and set hint
         EXPECT_CALL(*m_record_log, enter(usr_hash, _));
         EXPECT_CALL(*m_status, set_hash(2, usr_hash, usr_hint));
-        EXPECT_CALL(*m_status, set_hash(3, usr_hash, usr_hint));
         m_profile->enter(usr_region_id);
     }
     {
@@ -130,23 +130,18 @@ TEST_F(ProfileTest, enter_exit_nested)
         EXPECT_CALL(*m_record_log, enter(_, _)).Times(0);
         EXPECT_CALL(*m_status, set_hash(_, _, _)).Times(0);
         EXPECT_CALL(*m_status, set_hint(2, mpi_hint));
-        EXPECT_CALL(*m_status, set_hint(3, mpi_hint));
         m_profile->enter(mpi_region_id);
     }
     {
         // don't exit, just restore hint
         EXPECT_CALL(*m_record_log, exit(_, _)).Times(0);
         EXPECT_CALL(*m_status, set_hint(2, usr_hint));
-        EXPECT_CALL(*m_status, set_hint(3, usr_hint));
         m_profile->exit(mpi_region_id);
     }
     {
         // exit region and unset hint
         EXPECT_CALL(*m_record_log, exit(usr_hash, _));
         EXPECT_CALL(*m_status, set_hash(2, GEOPM_REGION_HASH_UNMARKED, GEOPM_REGION_HINT_UNSET));
-        EXPECT_CALL(*m_status, set_hash(3, GEOPM_REGION_HASH_UNMARKED, GEOPM_REGION_HINT_UNSET));
-        EXPECT_CALL(*m_status, reset_work_units(2));
-        EXPECT_CALL(*m_status, reset_work_units(3));
         m_profile->exit(usr_region_id);
     }
 }
@@ -165,7 +160,7 @@ TEST_F(ProfileTest, progress_multithread)
     uint64_t hash = geopm_region_id_hash(region_id);
     {
         EXPECT_CALL(*m_record_log, enter(hash, _));
-        EXPECT_CALL(*m_status, set_hash(_, _, _)).Times(2);
+        EXPECT_CALL(*m_status, set_hash(_, _, _)).Times(1);
         m_profile->enter(region_id);
     }
     {
@@ -186,10 +181,8 @@ TEST_F(ProfileTest, progress_multithread)
 
     {
         EXPECT_CALL(*m_record_log, exit(hash, _));
-        EXPECT_CALL(*m_status, set_hash(_, _, _)).Times(2);
-        // clear progress when exiting
-        EXPECT_CALL(*m_status, reset_work_units(2));
-        EXPECT_CALL(*m_status, reset_work_units(3));
+        // setting the hash clears progress when exiting
+        EXPECT_CALL(*m_status, set_hash(_, _, _)).Times(1);
         m_profile->exit(region_id);
     }
     // TODO: make it an error to set values for other CPUs not
@@ -5,10 +5,12 @@
 
 
 #include <memory>
+#include <sstream>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "ProfileTracerImp.hpp"
 #include "geopm/Helper.hpp"
+#include "CSV.hpp"
 #include "record.hpp"
 #include "geopm_prof.h"
 #include "geopm_time.h"
@@ -113,3 +115,47 @@ TEST_F(ProfileTracerTest, format)
     int err = unlink(m_output_path.c_str());
     EXPECT_EQ(0, err);
 }
+
+TEST_F(ProfileTracerTest, format_binary)
+{
+    EXPECT_CALL(m_application_sampler, get_short_region(88))
+        .WillOnce(Return(geopm::short_region_s{
+            0xdeadbeef, 2, 3.14
+        }));
+
+    {
+        std::unique_ptr<ProfileTracer> tracer = geopm::make_unique<ProfileTracerImp>(
+            m_start_time, geopm_time_s {{0, 0}}, 2, true, m_path, m_host_name,
+            m_application_sampler, true);
+        tracer->update(m_data);
+    }
+
+    std::ostringstream output;
+    geopm::CSVBinaryImp::convert(m_output_path, output);
+    std::vector<std::string> output_lines = geopm::string_split(output.str(), "\n");
+    std::vector<std::string> expect_lines = {
+        "TIME|PROCESS|EVENT|SIGNAL",
+        "10|0|REGION_ENTRY|0xfa5920d6",
+        "11|1|REGION_ENTRY|0xfa5920d6",
+        "12|2|REGION_ENTRY|0xfa5920d6",
+        "13|3|REGION_ENTRY|0xfa5920d6",
+        "34|3|REGION_EXIT|0xfa5920d6",
+        "35|2|REGION_EXIT|0xfa5920d6",
+        "36|1|REGION_EXIT|0xfa5920d6",
+        "37|0|REGION_EXIT|0xfa5920d6",
+        "40|0|EVENT_SHORT_REGION|0xdeadbeef",
+        "41|1|EPOCH_COUNT|1"
+    };
+    auto expect_it = expect_lines.begin();
+    for (const auto &output_it : output_lines) {
+        if (expect_it != expect_lines.end() &&
+            !output_it.empty() &&
+            output_it[0] != '#') {
+            EXPECT_EQ(*expect_it, output_it);
+            ++expect_it;
+        }
+    }
+    EXPECT_EQ(expect_lines.end(), expect_it);
+    int err = unlink(m_output_path.c_str());
+    EXPECT_EQ(0, err);
+}
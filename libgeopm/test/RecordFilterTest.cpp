@@ -48,3 +48,26 @@ TEST_F(RecordFilterTest, make_edit_distance)
     ASSERT_EQ(1ULL, result.size());
     EXPECT_EQ(geopm::EVENT_REGION_ENTRY, result[0].event);
 }
+
+TEST_F(RecordFilterTest, filter_append)
+{
+    std::shared_ptr<RecordFilter> filter = RecordFilter::make_unique("proxy_epoch,0xabcd1234,2");
+    record_s entry {{{0, 0}}, 0, geopm::EVENT_REGION_ENTRY, 0xabcd1234};
+    record_s epoch {{{0, 0}}, 0, geopm::EVENT_EPOCH_COUNT, 1};
+    std::vector<record_s> result;
+    filter->filter(entry, result);
+    ASSERT_EQ(2ULL, result.size());
+    EXPECT_EQ(geopm::EVENT_REGION_ENTRY, result[0].event);
+    EXPECT_EQ(geopm::EVENT_EPOCH_COUNT, result[1].event);
+    // Output is appended to existing records
+    filter->filter(entry, result);
+    ASSERT_EQ(3ULL, result.size());
+    EXPECT_EQ(geopm::EVENT_REGION_ENTRY, result[2].event);
+    // Epoch events from the application are removed
+    filter->filter(epoch, result);
+    EXPECT_EQ(3ULL, result.size());
+    filter->filter(entry, result);
+    ASSERT_EQ(5ULL, result.size());
+    EXPECT_EQ(geopm::EVENT_EPOCH_COUNT, result[4].event);
+    EXPECT_EQ(2ULL, result[4].signal);
+}
@@ -24,6 +24,7 @@
 #include "geopm_prof.h"
 #include "geopm_hash.h"
 #include "geopm_version.h"
+#include "geopm_test.hpp"
 
 
 using geopm::Reporter;
@@ -35,21 +36,42 @@ using testing::_;
 using testing::SaveArg;
 using testing::SetArgPointee;
 
-// Mock for gathering reports; assumes one node only
+// Mock for gathering reports.  Rank zero sends the report generated by
+// the test, the reports of any other ranks are provided by the test.
 class ReporterTestMockComm : public MockComm
 {
     public:
+        struct gatherv_call_s {
+            std::vector<size_t> recv_sizes;
+            std::vector<off_t> rank_offset;
+        };
         void gather(const void *send_buf, size_t send_size, void *recv_buf,
                     size_t recv_size, int root) const override
         {
             *((size_t*)(recv_buf)) = *((size_t*)(send_buf));
+            for (size_t rank_idx = 1; rank_idx <= m_other_report.size(); ++rank_idx) {
+                ((size_t*)(recv_buf))[rank_idx] = m_other_report[rank_idx - 1].size();
+            }
         }
         void gatherv(const void *send_buf, size_t send_size, void *recv_buf,
                      const std::vector<size_t> &recv_sizes,
                      const std::vector<off_t> &rank_offset, int root) const override
         {
-            memcpy(recv_buf, send_buf, send_size);
+            m_gatherv_call.push_back({recv_sizes, rank_offset});
+            if (recv_sizes[0] != 0) {
+                m_host_report.assign((const char *)send_buf, send_size);
+                memcpy((char *)recv_buf + rank_offset[0], send_buf, send_size);
+            }
+            for (size_t rank_idx = 1; rank_idx < recv_sizes.size(); ++rank_idx) {
+                if (recv_sizes[rank_idx] != 0) {
+                    memcpy((char *)recv_buf + rank_offset[rank_idx],
+                           m_other_report[rank_idx - 1].data(), recv_sizes[rank_idx]);
+                }
+            }
         }
+        std::vector<std::string> m_other_report;
+        mutable std::vector<gatherv_call_s> m_gatherv_call;
+        mutable std::string m_host_report;
 };
 
 class ReporterTest : public testing::Test
@@ -81,7 +103,7 @@ class ReporterTest : public testing::Test
         };
         ReporterTest();
         void TearDown(void);
-        void generate_setup(void);
+        void generate_setup(int num_rank = 1);
         std::string m_report_name = "test_reporter.out";
 
         MockPlatformIO m_platform_io;
@@ -237,7 +259,7 @@ void ReporterTest::TearDown(void)
 void check_report(std::istream &expected, std::istream &result);
 
 // Common settings for generate* tests
-void ReporterTest::generate_setup(void)
+void ReporterTest::generate_setup(int num_rank)
 {
     // ApplicationIO calls: to be removed
     EXPECT_CALL(m_application_io, region_name_set()).WillOnce(Return(m_region_set));
@@ -327,7 +349,7 @@ void ReporterTest::generate_setup(void)
     // Other calls
     EXPECT_CALL(m_tree_comm, overhead_send()).WillOnce(Return(678 * 56));
     EXPECT_CALL(*m_comm, rank()).WillRepeatedly(Return(0));
-    EXPECT_CALL(*m_comm, num_rank()).WillOnce(Return(1));
+    EXPECT_CALL(*m_comm, num_rank()).WillOnce(Return(num_rank));
 }
 
 TEST_F(ReporterTest, generate)
@@ -352,6 +374,7 @@ TEST_F(ReporterTest, generate)
                                                  "",
                                                  true,
                                                  m_profile_name,
+                                                 false,
                                                  false);
     m_reporter->init();
 
@@ -540,6 +563,7 @@ TEST_F(ReporterTest, generate_conditional)
                                                  "",
                                                  true,
                                                  m_profile_name,
+                                                 false,
                                                  false);
     m_reporter->init();
     m_reporter->total_time(56.0);
@@ -733,6 +757,171 @@ TEST_F(ReporterTest, generate_conditional)
     check_report(exp_istream, report);
 }
 
+TEST_F(ReporterTest, generate_gather_batches)
+{
+    EXPECT_CALL(m_platform_io, signal_names()).WillOnce(Return(std::set<std::string>{}));
+    generate_setup(6);
+    // Matches ReporterImp::M_GATHER_CHUNK_SIZE
+    const size_t chunk_size = 16 * 1024 * 1024;
+    const size_t mib = 1024 * 1024;
+    // Rank 1 fits in a batch with rank 0, rank 2 does not, rank 3
+    // is larger than a chunk and is sent alone, and ranks 4 and 5
+    // share the last batch
+    std::vector<size_t> other_size {10 * mib, 7 * mib, chunk_size + 4 * mib, 1 * mib, 2 * mib};
+    for (size_t rank_idx = 0; rank_idx < other_size.size(); ++rank_idx) {
+        m_comm->m_other_report.emplace_back(other_size[rank_idx], 'a' + rank_idx);
+    }
+    EXPECT_CALL(*m_comm, broadcast(_, 6 * sizeof(size_t), 0));
+
+    const std::vector<std::pair<std::string, int> > env_signals = {
+        {"CPU_ENERGY", geopm_domain_e::GEOPM_DOMAIN_PACKAGE}
+    };
+    m_reporter = geopm::make_unique<ReporterImp>(m_start_time,
+                                                 m_platform_io,
+                                                 m_platform_topo,
+                                                 0,
+                                                 m_sample_agg,
+                                                 m_region_agg,
+                                                 m_report_name,
+                                                 env_signals,
+                                                 "",
+                                                 true,
+                                                 m_profile_name,
+                                                 false,
+                                                 false);
+    m_reporter->init();
+    m_reporter->update();
+    m_reporter->total_time(56.0);
+    m_reporter->overhead(0.123, 0.321);
+    m_reporter->generate("my_agent", {}, {}, m_region_agent_detail,
+                         m_application_io,
+                         m_comm, m_tree_comm);
+
+    size_t host_size = m_comm->m_host_report.size();
+    ASSERT_LT(0ULL, host_size);
+    ASSERT_EQ(4ULL, m_comm->m_gatherv_call.size());
+    const auto &call = m_comm->m_gatherv_call;
+    EXPECT_EQ(std::vector<size_t>({host_size, other_size[0], 0, 0, 0, 0}), call[0].recv_sizes);
+    EXPECT_EQ(std::vector<off_t>({0, (off_t)host_size, 0, 0, 0, 0}), call[0].rank_offset);
+    EXPECT_EQ(std::vector<size_t>({0, 0, other_size[1], 0, 0, 0}), call[1].recv_sizes);
+    EXPECT_EQ(std::vector<off_t>({0, 0, 0, 0, 0, 0}), call[1].rank_offset);
+    EXPECT_EQ(std::vector<size_t>({0, 0, 0, other_size[2], 0, 0}), call[2].recv_sizes);
+    EXPECT_EQ(std::vector<off_t>({0, 0, 0, 0, 0, 0}), call[2].rank_offset);
+    EXPECT_EQ(std::vector<size_t>({0, 0, 0, 0, other_size[3], other_size[4]}), call[3].recv_sizes);
+    EXPECT_EQ(std::vector<off_t>({0, 0, 0, 0, 0, (off_t)other_size[3]}), call[3].rank_offset);
+
+    // The host reports follow the header in rank order, as they did
+    // when all ranks were received by a single gather
+    std::string expected_hosts = m_comm->m_host_report;
+    for (const auto &other_report : m_comm->m_other_report) {
+        expected_hosts += other_report;
+    }
+    expected_hosts += "\n";
+    std::string report = geopm::read_file(m_report_name);
+    ASSERT_LT(expected_hosts.size(), report.size());
+    std::string header = report.substr(0, report.size() - expected_hosts.size());
+    EXPECT_EQ(0ULL, header.find("GEOPM Version: "));
+    EXPECT_EQ(header.size() - std::string("Hosts:\n").size(), header.rfind("Hosts:\n"));
+    // Compare without printing the whole report on failure
+    EXPECT_TRUE(report.compare(header.size(), std::string::npos, expected_hosts) == 0);
+}
+
+TEST_F(ReporterTest, generate_binary)
+{
+    EXPECT_CALL(m_platform_io, signal_names()).WillOnce(Return(std::set<std::string>{}));
+    generate_setup(2);
+    std::string other_yaml = "  other-host:\n"
+                             "    Application Totals:\n"
+                             "      runtime (s): 56\n"
+                             "      count: 0\n";
+    m_comm->m_other_report.push_back(ReporterImp::compact_report(other_yaml));
+    EXPECT_CALL(*m_comm, broadcast(_, 2 * sizeof(size_t), 0));
+
+    const std::vector<std::pair<std::string, int> > env_signals = {
+        {"CPU_ENERGY", geopm_domain_e::GEOPM_DOMAIN_PACKAGE}
+    };
+    m_reporter = geopm::make_unique<ReporterImp>(m_start_time,
+                                                 m_platform_io,
+                                                 m_platform_topo,
+                                                 0,
+                                                 m_sample_agg,
+                                                 m_region_agg,
+                                                 m_report_name,
+                                                 env_signals,
+                                                 "",
+                                                 true,
+                                                 m_profile_name,
+                                                 false,
+                                                 true);
+    m_reporter->init();
+    m_reporter->update();
+    m_reporter->total_time(56.0);
+    m_reporter->overhead(0.123, 0.321);
+    m_reporter->generate("my_agent", {}, {}, m_region_agent_detail,
+                         m_application_io,
+                         m_comm, m_tree_comm);
+
+    const std::string magic = "GEOPM_REPORT_BINARY_1\n";
+    std::string binary = geopm::read_file(m_report_name);
+    EXPECT_EQ(0ULL, binary.find(magic));
+    std::istringstream binary_stream(binary);
+    std::ostringstream yaml_stream;
+    ReporterImp::convert(binary_stream, yaml_stream);
+    std::string yaml = yaml_stream.str();
+
+    // Host section generated on this rank
+    std::istringstream host_stream(magic + m_comm->m_host_report);
+    std::ostringstream host_yaml_stream;
+    ReporterImp::convert(host_stream, host_yaml_stream);
+    std::string host_yaml = host_yaml_stream.str();
+    host_yaml.pop_back();
+    EXPECT_THAT(host_yaml, HasSubstr("    -\n      region: \"all2all\"\n"));
+    EXPECT_LT(m_comm->m_host_report.size(), host_yaml.size());
+
+    std::string expected_hosts = "Hosts:\n" + host_yaml + other_yaml + "\n";
+    EXPECT_EQ(0ULL, yaml.find("GEOPM Version: "));
+    ASSERT_LT(expected_hosts.size(), yaml.size());
+    EXPECT_EQ(expected_hosts, yaml.substr(yaml.size() - expected_hosts.size()));
+}
+
+TEST(ReporterBinaryTest, compact_report)
+{
+    // Indentation, repeated keys and values, separators in values,
+    // lines without a value and empty lines are all preserved
+    std::string yaml = "Hosts:\n"
+                       "  host-0:\n"
+                       "    -\n"
+                       "      region: \"a: b\"\n"
+                       "      count: 0\n"
+                       "    -\n"
+                       "      region: \"c\"\n"
+                       "      count: 0\n"
+                       "\n"
+                       "      empty: \n"
+                       "key:value\n";
+    std::string compact = ReporterImp::compact_report(yaml);
+    std::istringstream binary_stream("GEOPM_REPORT_BINARY_1\n" + compact + compact);
+    std::ostringstream yaml_stream;
+    ReporterImp::convert(binary_stream, yaml_stream);
+    EXPECT_EQ(yaml + yaml + "\n", yaml_stream.str());
+    EXPECT_LT(compact.size(), yaml.size());
+
+    std::ostringstream empty_stream;
+    std::istringstream header_stream("GEOPM_REPORT_BINARY_1\n");
+    ReporterImp::convert(header_stream, empty_stream);
+    EXPECT_EQ("\n", empty_stream.str());
+
+    GEOPM_EXPECT_THROW_MESSAGE(ReporterImp::compact_report("key: value"),
+                               GEOPM_ERROR_INVALID, "must end with a new line");
+    std::istringstream text_stream(yaml);
+    GEOPM_EXPECT_THROW_MESSAGE(ReporterImp::convert(text_stream, yaml_stream),
+                               GEOPM_ERROR_INVALID, "not a binary report");
+    std::istringstream truncated_stream("GEOPM_REPORT_BINARY_1\n" +
+                                        compact.substr(0, compact.size() - 1));
+    GEOPM_EXPECT_THROW_MESSAGE(ReporterImp::convert(truncated_stream, yaml_stream),
+                               GEOPM_ERROR_INVALID, "truncated or corrupt");
+}
+
 void check_report(std::istream &expected, std::istream &result)
 {
     char exp_line[1024];
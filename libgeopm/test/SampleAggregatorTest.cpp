@@ -265,6 +265,59 @@ TEST_F(SampleAggregatorTest, sample_application)
     EXPECT_DOUBLE_EQ(0.0, m_agg->sample_region(M_SIGNAL_TIME, 0x9999));
 }
 
+TEST_F(SampleAggregatorTest, sample_region_average)
+{
+    uint64_t regionA = 0x4444;
+    uint64_t regionB = 0x5555;
+    // The CPU observes both regions, the package only observes region A
+    std::vector<double> time {0, 1, 2, 3};
+    std::vector<double> rid_cpu_0 {(double)regionA, (double)regionB,
+                                   (double)regionB, (double)regionA};
+    std::vector<double> cycles {0, 100, 300, 600};
+    std::vector<double> energy {10, 20, 30, 40};
+
+    EXPECT_CALL(m_platio, push_signal("CYCLES", GEOPM_DOMAIN_CPU, 0));
+    EXPECT_CALL(m_platio, push_signal("REGION_HASH", GEOPM_DOMAIN_CPU, 0));
+    EXPECT_CALL(m_platio, push_signal("ENERGY", GEOPM_DOMAIN_PACKAGE, 0))
+        .Times(2);
+    EXPECT_CALL(m_platio, push_signal("REGION_HASH", GEOPM_DOMAIN_PACKAGE, 0));
+    EXPECT_EQ(M_SIGNAL_CYCLES_0, m_agg->push_signal_total("CYCLES", GEOPM_DOMAIN_CPU, 0));
+    EXPECT_EQ(M_SIGNAL_ENERGY_0, m_agg->push_signal_average("ENERGY", GEOPM_DOMAIN_PACKAGE, 0));
+    GEOPM_EXPECT_THROW_MESSAGE(m_agg->push_signal_total("ENERGY", GEOPM_DOMAIN_PACKAGE, 0),
+                               GEOPM_ERROR_INVALID, "signal already pushed for average");
+
+    for (size_t idx = 0; idx < time.size(); ++idx) {
+        EXPECT_CALL(m_platio, sample(M_SIGNAL_TIME))
+            .WillRepeatedly(Return(time[idx]));
+        EXPECT_CALL(m_platio, sample(M_SIGNAL_CYCLES_0))
+            .WillRepeatedly(Return(cycles[idx]));
+        EXPECT_CALL(m_platio, sample(M_SIGNAL_ENERGY_0))
+            .WillRepeatedly(Return(energy[idx]));
+        EXPECT_CALL(m_platio, sample(M_SIGNAL_R_HASH_CPU_0))
+            .WillRepeatedly(Return(rid_cpu_0[idx]));
+        EXPECT_CALL(m_platio, sample(M_SIGNAL_R_HASH_PKG_0))
+            .WillRepeatedly(Return(regionA));
+        EXPECT_CALL(m_platio, sample(M_SIGNAL_EPOCH_COUNT))
+            .WillRepeatedly(Return(0));
+        m_agg->update();
+    }
+
+    EXPECT_DOUBLE_EQ(100.0, m_agg->sample_region(M_SIGNAL_CYCLES_0, regionA));
+    EXPECT_DOUBLE_EQ(500.0, m_agg->sample_region(M_SIGNAL_CYCLES_0, regionB));
+    EXPECT_DOUBLE_EQ(500.0, m_agg->sample_region_last(M_SIGNAL_CYCLES_0, regionB));
+    EXPECT_DOUBLE_EQ(600.0, m_agg->sample_application(M_SIGNAL_CYCLES_0));
+    EXPECT_DOUBLE_EQ(30.0, m_agg->sample_region(M_SIGNAL_ENERGY_0, regionA));
+    EXPECT_DOUBLE_EQ(30.0, m_agg->sample_application(M_SIGNAL_ENERGY_0));
+    EXPECT_DOUBLE_EQ(40.0, m_agg->sample_period_last(M_SIGNAL_ENERGY_0));
+    // Region B was observed by the CPU signal but not by the
+    // package signal
+    EXPECT_TRUE(std::isnan(m_agg->sample_region(M_SIGNAL_ENERGY_0, regionB)));
+    EXPECT_TRUE(std::isnan(m_agg->sample_region_last(M_SIGNAL_ENERGY_0, regionB)));
+    // Unseen region
+    EXPECT_TRUE(std::isnan(m_agg->sample_region(M_SIGNAL_ENERGY_0, 0x9999)));
+    EXPECT_DOUBLE_EQ(0.0, m_agg->sample_region(M_SIGNAL_CYCLES_0, 0x9999));
+}
+
 TEST_F(SampleAggregatorTest, epoch_application_total)
 {
     uint64_t reg_normal = 0x3333;
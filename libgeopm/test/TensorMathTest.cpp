@@ -14,8 +14,10 @@
 #include "TensorMath.hpp"
 #include "TensorOneD.hpp"
 #include "TensorTwoD.hpp"
+#include "TensorMatrix.hpp"
 
 using geopm::TensorMathImp;
+using geopm::TensorMatrix;
 using geopm::TensorOneD;
 using geopm::TensorTwoD;
 
@@ -91,6 +93,12 @@ TEST_F(TensorMathTest, test_dot)
     EXPECT_EQ(11, m_math.inner_product(m_one, m_two));
 }
 
+TEST_F(TensorMathTest, test_dot_fraction)
+{
+    TensorOneD half({0.5, 0.25});
+    EXPECT_DOUBLE_EQ(0.4375, m_math.inner_product(half, TensorOneD({0.5, 0.75})));
+}
+
 TEST_F(TensorMathTest, test_sigmoid)
 {
     TensorOneD activations(5), boundary_act(2);
@@ -135,3 +143,58 @@ TEST_F(TensorMathTest, test_bad_dimensions)
     m_row.set_dim(1, 2);
     GEOPM_EXPECT_THROW_MESSAGE(m_math.multiply(m_mat, m_row[0]), GEOPM_ERROR_INVALID, "incompatible dimensions");
 }
+
+TEST_F(TensorMathTest, test_multiply_add)
+{
+    // More outputs than one block of a row to cover the padding
+    size_t num_input = 5;
+    size_t num_output = TensorMatrix::M_BLOCK_SIZE + 3;
+    size_t num_batch = 3;
+    TensorTwoD weights(num_output, num_input);
+    TensorMatrix weights_t(num_input, num_output);
+    TensorOneD bias(num_output);
+    TensorMatrix bias_row(1, num_output);
+    for (size_t out_idx = 0; out_idx < num_output; ++out_idx) {
+        for (size_t in_idx = 0; in_idx < num_input; ++in_idx) {
+            weights[out_idx][in_idx] = 0.1 * out_idx - 0.07 * in_idx;
+            weights_t(in_idx, out_idx) = weights[out_idx][in_idx];
+        }
+        bias[out_idx] = 0.5 - 0.05 * out_idx;
+        bias_row(0, out_idx) = bias[out_idx];
+    }
+    TensorMatrix input(num_batch, num_input);
+    std::vector<TensorOneD> input_vec(num_batch, TensorOneD(num_input));
+    for (size_t row = 0; row < num_batch; ++row) {
+        for (size_t in_idx = 0; in_idx < num_input; ++in_idx) {
+            input(row, in_idx) = 0.3 * row + 0.2 * in_idx - 0.4;
+            input_vec[row][in_idx] = input(row, in_idx);
+        }
+    }
+
+    TensorMatrix output;
+    TensorMatrix output_sigmoid;
+    m_math.multiply_add(input, weights_t, bias_row, false, output);
+    m_math.multiply_add(input, weights_t, bias_row, true, output_sigmoid);
+    ASSERT_EQ(num_batch, output.get_rows());
+    ASSERT_EQ(num_output, output.get_cols());
+    for (size_t row = 0; row < num_batch; ++row) {
+        TensorOneD expected = m_math.add(bias, m_math.multiply(weights, input_vec[row]));
+        TensorOneD expected_sigmoid = m_math.sigmoid(expected);
+        for (size_t out_idx = 0; out_idx < num_output; ++out_idx) {
+            EXPECT_NEAR(expected[out_idx], output(row, out_idx), 1e-12);
+            EXPECT_NEAR(expected_sigmoid[out_idx], output_sigmoid(row, out_idx), 1e-12);
+        }
+    }
+
+    // The output storage is reused for a smaller batch
+    const double *data = output.row(0);
+    input.set_dim(1, num_input);
+    m_math.multiply_add(input, weights_t, bias_row, false, output);
+    EXPECT_EQ(1u, output.get_rows());
+    EXPECT_EQ(data, output.row(0));
+
+    GEOPM_EXPECT_THROW_MESSAGE(m_math.multiply_add(weights_t, weights_t, bias_row, false, output),
+                               GEOPM_ERROR_INVALID, "incompatible dimensions");
+    GEOPM_EXPECT_THROW_MESSAGE(m_math.multiply_add(input, weights_t, input, false, output),
+                               GEOPM_ERROR_INVALID, "incompatible dimensions");
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cstdint>
+
+#include "gtest/gtest.h"
+#include "geopm/Exception.hpp"
+
+#include "TensorMatrix.hpp"
+#include "geopm_test.hpp"
+
+using geopm::TensorMatrix;
+
+TEST(TensorMatrixTest, dims_and_values)
+{
+    TensorMatrix mat({{1, 2, 3}, {4, 5, 6}});
+    EXPECT_EQ(2u, mat.get_rows());
+    EXPECT_EQ(3u, mat.get_cols());
+    EXPECT_EQ(TensorMatrix::M_BLOCK_SIZE, mat.get_stride());
+    EXPECT_EQ(1, mat(0, 0));
+    EXPECT_EQ(3, mat(0, 2));
+    EXPECT_EQ(4, mat(1, 0));
+    EXPECT_EQ(6, mat.row(1)[2]);
+    EXPECT_EQ(mat.row(0) + mat.get_stride(), mat.row(1));
+
+    mat(1, 1) = -1;
+    EXPECT_EQ(-1, mat(1, 1));
+    TensorMatrix copy = mat;
+    copy(0, 0) = 7;
+    EXPECT_EQ(1, mat(0, 0));
+    EXPECT_FALSE(copy == mat);
+    copy(0, 0) = 1;
+    EXPECT_TRUE(copy == mat);
+
+    TensorMatrix wide(1, TensorMatrix::M_BLOCK_SIZE + 1);
+    EXPECT_EQ(2 * TensorMatrix::M_BLOCK_SIZE, wide.get_stride());
+    EXPECT_EQ(0, wide(0, TensorMatrix::M_BLOCK_SIZE));
+}
+
+TEST(TensorMatrixTest, alignment)
+{
+    TensorMatrix mat(5, 3);
+    for (size_t row = 0; row < mat.get_rows(); ++row) {
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(mat.row(row)) % 64) << row;
+    }
+}
+
+TEST(TensorMatrixTest, set_dim)
+{
+    TensorMatrix mat({{1, 2}, {3, 4}});
+    // Adding rows keeps the existing values
+    mat.set_dim(3, 2);
+    EXPECT_EQ(3u, mat.get_rows());
+    EXPECT_EQ(1, mat(0, 0));
+    EXPECT_EQ(4, mat(1, 1));
+    EXPECT_EQ(0, mat(2, 0));
+    // Shrinking does not reallocate
+    const double *data = mat.row(0);
+    mat.set_dim(1, 2);
+    EXPECT_EQ(data, mat.row(0));
+    EXPECT_EQ(2, mat(0, 1));
+    // Changing the number of columns clears the values
+    mat.set_dim(1, 3);
+    EXPECT_EQ(0, mat(0, 0));
+    EXPECT_EQ(0, mat(0, 1));
+}
+
+TEST(TensorMatrixTest, bad_input)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(TensorMatrix({{1, 2}, {3}}),
+                               GEOPM_ERROR_INVALID, "non-rectangular");
+}
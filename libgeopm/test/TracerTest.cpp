@@ -12,6 +12,7 @@
 
 #include "geopm/Helper.hpp"
 #include "Tracer.hpp"
+#include "CSV.hpp"
 #include "geopm/PlatformIO.hpp"
 #include "geopm/PlatformTopo.hpp"
 #include "MockPlatformIO.hpp"
@@ -48,6 +49,7 @@ class TracerTest : public ::testing::Test
         std::string m_start_time = "Tue Nov  6 08:00:00 2018";
         std::vector<struct m_request_s> m_default_cols;
         const int m_num_extra_cols = 3;
+        std::vector<std::pair<std::string, int> > m_env_signals;
         std::unique_ptr<geopm::TracerImp> m_tracer;
 };
 
@@ -80,7 +82,7 @@ void TracerTest::SetUp(void)
         {"CPU_CYCLES_REFERENCE", GEOPM_DOMAIN_BOARD, 0, geopm::string_format_integer},
         {"CPU_CORE_TEMPERATURE", GEOPM_DOMAIN_BOARD, 0, geopm::string_format_double},
     };
-    const std::vector<std::pair<std::string, int> > env_signals = {
+    m_env_signals = {
         {"EXTRA", geopm_domain_e::GEOPM_DOMAIN_BOARD},
         {"EXTRA_SPECIAL", geopm_domain_e::GEOPM_DOMAIN_CPU}
     };
@@ -112,7 +114,7 @@ void TracerTest::SetUp(void)
     }
 
     m_tracer = geopm::make_unique<TracerImp>(m_start_time, m_path, m_hostname, true,
-                                             m_platform_io, m_platform_topo, env_signals);
+                                             m_platform_io, m_platform_topo, m_env_signals);
 }
 
 void TracerTest::TearDown(void)
@@ -204,6 +206,64 @@ TEST_F(TracerTest, region_entry_exit)
     check_trace(expected, result);
 }
 
+TEST_F(TracerTest, update_samples_binary)
+{
+    m_tracer = geopm::make_unique<TracerImp>(m_start_time, m_path, m_hostname, true,
+                                             m_platform_io, m_platform_topo, m_env_signals,
+                                             true);
+    int idx = 0;
+    for (auto cc : m_default_cols) {
+        EXPECT_CALL(m_platform_io, sample(idx))
+            .WillOnce(Return(idx + 0.5));
+        ++idx;
+    }
+
+    for (int count = 0; count < m_num_extra_cols; ++count) {
+        EXPECT_CALL(m_platform_io, sample(idx))
+            .WillOnce(Return(idx + 0.7));
+        ++idx;
+    }
+
+    std::vector<std::string> agent_cols {"col1", "col2"};
+    std::vector<double> agent_vals {88.8, 77.7};
+
+    m_tracer->columns(agent_cols, {});
+    m_tracer->update(agent_vals);
+    m_tracer->flush();
+
+    std::string expected_str = "\n\n\n\n\n\n"
+        "0.5|1|0x00000002|0x00000003|4.5|5.5|6.5|7.5|8.5|9.5|10|11|12.5|13.7|14.7|15.7|88.8|77.7\n";
+    std::istringstream expected(expected_str);
+    std::stringstream result;
+    geopm::CSVBinaryImp::convert(m_file_path, result);
+    check_trace(expected, result);
+}
+
+TEST_F(TracerTest, binary_unsupported_format)
+{
+    m_tracer = geopm::make_unique<TracerImp>(m_start_time, m_path, m_hostname, true,
+                                             m_platform_io, m_platform_topo, m_env_signals,
+                                             true);
+    EXPECT_CALL(m_platform_io, sample(_))
+        .WillRepeatedly(Return(1.0));
+    std::vector<std::string> agent_cols {"col1"};
+    std::vector<double> agent_vals {4.0};
+    auto custom_format = [](double value) {
+        return std::string("custom");
+    };
+    // Agent formats that cannot be stored fall back to a CSV trace
+    m_tracer->columns(agent_cols, {custom_format});
+    m_tracer->update(agent_vals);
+    m_tracer->flush();
+
+    std::string expected_str = "\n\n\n\n\n\n"
+        "1|1|0x00000001|0x00000001|1|1|1|1|1|1|1|1|1|1|1|1|custom\n";
+    std::istringstream expected(expected_str);
+    std::ifstream result(m_file_path);
+    ASSERT_TRUE(result.good()) << strerror(errno);
+    check_trace(expected, result);
+}
+
 /// @todo This is shared with ReporterTest; can be put in common file
 void check_trace(std::istream &expected, std::istream &result)
 {
@@ -4,6 +4,7 @@
  */
 
 #include <memory>
+#include <string>
 
 #include "gtest/gtest.h"
 #include "geopm_test.hpp"
@@ -62,3 +63,68 @@ TEST_F(WaiterTest, wait)
         EXPECT_NEAR(m_period, geopm_time_diff(&time_0, &time_1), m_epsilon);
     }
 }
+
+TEST_F(WaiterTest, strategies)
+{
+    for (const std::string strategy : {"sleep", "monotonic", "hybrid", "timerfd"}) {
+        std::shared_ptr<Waiter> waiter = Waiter::make_unique(m_period, strategy);
+        EXPECT_EQ(m_period, waiter->period());
+        geopm_time_s time_0;
+        geopm_time_s time_1;
+        for (int count = 0; count < 3; ++count) {
+            geopm_time(&time_0);
+            waiter->wait();
+            geopm_time(&time_1);
+            EXPECT_NEAR(m_period, geopm_time_diff(&time_0, &time_1), m_epsilon)
+                << "strategy: " << strategy;
+        }
+    }
+}
+
+TEST_F(WaiterTest, report)
+{
+    std::shared_ptr<Waiter> waiter = Waiter::make_unique(m_period, "sleep");
+    auto report = waiter->report();
+    ASSERT_EQ(10u, report.size());
+    EXPECT_EQ("Wait count", report[0].first);
+    EXPECT_EQ("0", report[0].second);
+    EXPECT_EQ("Wait lateness mean (s)", report[1].first);
+    EXPECT_EQ("0", report[1].second);
+
+    waiter->wait();
+    waiter->wait();
+    report = waiter->report();
+    ASSERT_EQ(10u, report.size());
+    EXPECT_EQ("2", report[0].second);
+    double lateness_max = std::stod(report[2].second);
+    EXPECT_LE(0.0, lateness_max);
+    EXPECT_GT(m_epsilon, lateness_max);
+    int hist_total = 0;
+    for (size_t idx = 3; idx < report.size(); ++idx) {
+        EXPECT_EQ(0u, report[idx].first.find("Wait lateness"));
+        hist_total += std::stoi(report[idx].second);
+    }
+    EXPECT_EQ(2, hist_total);
+
+    // Lateness when the caller overruns the period
+    timespec delay = {0, 300000000};
+    nanosleep(&delay, nullptr);
+    waiter->wait();
+    report = waiter->report();
+    EXPECT_EQ("1", report.back().second);
+    EXPECT_LT(0.1, std::stod(report[2].second));
+}
+
+TEST_F(WaiterTest, sleep_waiter)
+{
+    // SleepWaiter does not keep wait statistics
+    geopm::SleepWaiter waiter(m_period);
+    EXPECT_TRUE(waiter.report().empty());
+    geopm_time_s time_0;
+    geopm_time_s time_1;
+    waiter.reset();
+    geopm_time(&time_0);
+    waiter.wait();
+    geopm_time(&time_1);
+    EXPECT_NEAR(m_period, geopm_time_diff(&time_0, &time_1), m_epsilon);
+}
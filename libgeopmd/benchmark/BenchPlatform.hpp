@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BENCHPLATFORM_HPP_INCLUDE
+#define BENCHPLATFORM_HPP_INCLUDE
+
+#include <map>
+#include <set>
+
+#include "geopm_topo.h"
+#include "geopm/Cpuid.hpp"
+#include "geopm/PlatformTopo.hpp"
+#include "MSRIOGroup.hpp"
+
+// Synthetic topology and CPUID shared by the MSR benchmarks.  CPUs
+// are numbered so that hyper-threads of a core are num_core apart,
+// as on Linux.
+
+class BenchTopo : public geopm::PlatformTopo
+{
+    public:
+        BenchTopo(int num_package, int num_core_per_package, int num_thread_per_core)
+            : m_num_package(num_package)
+            , m_num_core(num_package * num_core_per_package)
+            , m_num_cpu(m_num_core * num_thread_per_core)
+        {
+
+        }
+        int num_domain(int domain_type) const override
+        {
+            int result = 0;
+            switch (domain_type) {
+                case GEOPM_DOMAIN_BOARD:
+                    result = 1;
+                    break;
+                case GEOPM_DOMAIN_PACKAGE:
+                    result = m_num_package;
+                    break;
+                case GEOPM_DOMAIN_CORE:
+                    result = m_num_core;
+                    break;
+                case GEOPM_DOMAIN_CPU:
+                    result = m_num_cpu;
+                    break;
+                default:
+                    break;
+            }
+            return result;
+        }
+        int domain_idx(int domain_type, int cpu_idx) const override
+        {
+            int result = -1;
+            int core_idx = cpu_idx % m_num_core;
+            switch (domain_type) {
+                case GEOPM_DOMAIN_BOARD:
+                    result = 0;
+                    break;
+                case GEOPM_DOMAIN_PACKAGE:
+                    result = core_idx / (m_num_core / m_num_package);
+                    break;
+                case GEOPM_DOMAIN_CORE:
+                    result = core_idx;
+                    break;
+                case GEOPM_DOMAIN_CPU:
+                    result = cpu_idx;
+                    break;
+                default:
+                    break;
+            }
+            return result;
+        }
+        bool is_nested_domain(int inner_domain, int outer_domain) const override
+        {
+            static const std::map<int, int> rank {
+                {GEOPM_DOMAIN_CPU, 0},
+                {GEOPM_DOMAIN_CORE, 1},
+                {GEOPM_DOMAIN_PACKAGE, 2},
+                {GEOPM_DOMAIN_BOARD, 3},
+            };
+            auto inner_it = rank.find(inner_domain);
+            auto outer_it = rank.find(outer_domain);
+            return inner_it != rank.end() && outer_it != rank.end() &&
+                   inner_it->second <= outer_it->second;
+        }
+        std::set<int> domain_nested(int inner_domain, int outer_domain, int outer_idx) const override
+        {
+            std::set<int> result;
+            for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
+                if (domain_idx(outer_domain, cpu_idx) == outer_idx) {
+                    result.insert(domain_idx(inner_domain, cpu_idx));
+                }
+            }
+            return result;
+        }
+    private:
+        const int m_num_package;
+        const int m_num_core;
+        const int m_num_cpu;
+};
+
+class BenchCpuid : public geopm::Cpuid
+{
+    public:
+        int cpuid(void) const override
+        {
+            return geopm::MSRIOGroup::M_CPUID_SKX;
+        }
+        bool is_hwp_supported(void) const override
+        {
+            return false;
+        }
+        double freq_sticker(void) const override
+        {
+            return 2.1e9;
+        }
+        rdt_info_s rdt_info(void) const override
+        {
+            return {};
+        }
+        uint32_t pmc_bit_width(void) const override
+        {
+            return 48;
+        }
+        bool is_tsc_invariant(void) const override
+        {
+            return true;
+        }
+};
+
+#endif
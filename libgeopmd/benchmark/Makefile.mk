@@ -0,0 +1,24 @@
+#  Copyright (c) 2015 - 2024 Intel Corporation
+#  SPDX-License-Identifier: BSD-3-Clause
+#
+
+# Micro-benchmarks for hot paths in the service library.  These are
+# built by "make checkprogs" but are not run by "make check".
+check_PROGRAMS += benchmark/msr_batch_bench \
+                  benchmark/msr_oneshot_bench \
+                  benchmark/time_bench \
+                  benchmark/topo_cache_bench \
+                  # end
+
+benchmark_msr_batch_bench_SOURCES = benchmark/BenchPlatform.hpp \
+                                    benchmark/msr_batch_bench.cpp \
+                                    # end
+benchmark_msr_batch_bench_LDADD = libgeopmd.la
+benchmark_msr_oneshot_bench_SOURCES = benchmark/BenchPlatform.hpp \
+                                      benchmark/msr_oneshot_bench.cpp \
+                                      # end
+benchmark_msr_oneshot_bench_LDADD = libgeopmd.la
+benchmark_time_bench_SOURCES = benchmark/time_bench.cpp
+benchmark_time_bench_LDADD = libgeopmd.la
+benchmark_topo_cache_bench_SOURCES = benchmark/topo_cache_bench.cpp
+benchmark_topo_cache_bench_LDADD = libgeopmd.la
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "geopm_time.h"
+#include "MSRIO.hpp"
+#include "MSRIOGroup.hpp"
+#include "BenchPlatform.hpp"
+
+// Pushes the MSR signals used by the power and frequency agents onto
+// an MSRIOGroup backed by an in-memory MSRIO and reports the number
+// of batch operations in the default and save/restore contexts and
+// the cost of read_batch() plus sample().  The "append" mode adds an
+// operation for every add_read() call; the "intern" mode returns the
+// same index for repeated registers the way MSRIOImp does.
+
+class BenchMSRIO : public geopm::MSRIO
+{
+    public:
+        BenchMSRIO(bool is_intern)
+            : m_is_intern(is_intern)
+            , m_context(1)
+        {
+
+        }
+        uint64_t read_msr(int cpu_idx, uint64_t offset) override
+        {
+            return offset + cpu_idx;
+        }
+        void write_msr(int cpu_idx, uint64_t offset, uint64_t raw_value,
+                       uint64_t write_mask) override
+        {
+
+        }
+        int create_batch_context(void) override
+        {
+            m_context.emplace_back();
+            return m_context.size() - 1;
+        }
+        void reset_batch_context(int batch_ctx) override
+        {
+            m_context.at(batch_ctx) = {};
+        }
+        int add_read(int cpu_idx, uint64_t offset) override
+        {
+            return add_read(cpu_idx, offset, 0);
+        }
+        int add_read(int cpu_idx, uint64_t offset, int batch_ctx) override
+        {
+            context_s &ctx = m_context.at(batch_ctx);
+            int result = ctx.read_op.size();
+            auto key = std::make_pair(cpu_idx, offset);
+            auto it = ctx.read_idx.find(key);
+            if (m_is_intern && it != ctx.read_idx.end()) {
+                result = it->second;
+            }
+            else {
+                ctx.read_idx[key] = result;
+                ctx.read_op.push_back(key);
+                ctx.read_val.push_back(0);
+            }
+            return result;
+        }
+        void read_batch(void) override
+        {
+            read_batch(0);
+        }
+        void read_batch(int batch_ctx) override
+        {
+            context_s &ctx = m_context.at(batch_ctx);
+            for (size_t op_idx = 0; op_idx < ctx.read_op.size(); ++op_idx) {
+                ctx.read_val[op_idx] = read_msr(ctx.read_op[op_idx].first,
+                                                ctx.read_op[op_idx].second);
+            }
+        }
+        int add_write(int cpu_idx, uint64_t offset) override
+        {
+            return 0;
+        }
+        int add_write(int cpu_idx, uint64_t offset, int batch_ctx) override
+        {
+            return 0;
+        }
+        void adjust(int batch_idx, uint64_t value, uint64_t write_mask) override
+        {
+
+        }
+        void adjust(int batch_idx, uint64_t value, uint64_t write_mask,
+                    int batch_ctx) override
+        {
+
+        }
+        uint64_t sample(int batch_idx) const override
+        {
+            return sample(batch_idx, 0);
+        }
+        uint64_t sample(int batch_idx, int batch_ctx) const override
+        {
+            return m_context.at(batch_ctx).read_val[batch_idx];
+        }
+        void write_batch(void) override
+        {
+
+        }
+        void write_batch(int batch_ctx) override
+        {
+
+        }
+        uint64_t system_write_mask(uint64_t offset) override
+        {
+            return ~0ULL;
+        }
+        int num_read_op(int batch_ctx) const
+        {
+            return m_context.at(batch_ctx).read_op.size();
+        }
+    private:
+        struct context_s {
+            std::map<std::pair<int, uint64_t>, int> read_idx;
+            std::vector<std::pair<int, uint64_t> > read_op;
+            std::vector<uint64_t> read_val;
+        };
+        const bool m_is_intern;
+        std::vector<context_s> m_context;
+};
+
+static volatile double g_sink;
+
+static void run(const std::string &mode, const BenchTopo &topo, int num_loop)
+{
+    // Signals are pushed at their native domain; PlatformIO aggregates
+    // them to coarser domains.
+    static const std::vector<std::string> signal_set {
+        "CPU_ENERGY",
+        "DRAM_ENERGY",
+        "CPU_POWER_LIMIT_CONTROL",
+        "CPU_POWER_TIME_WINDOW_CONTROL",
+        "MSR::PKG_POWER_LIMIT#",
+        "MSR::PKG_ENERGY_STATUS#",
+        "CPU_UNCORE_FREQUENCY_STATUS",
+        "CPU_UNCORE_FREQUENCY_MIN_CONTROL",
+        "CPU_UNCORE_FREQUENCY_MAX_CONTROL",
+        "CPU_FREQUENCY_STATUS",
+        "MSR::PERF_STATUS#",
+        "CPU_FREQUENCY_MAX_CONTROL",
+        "CPU_CYCLES_THREAD",
+        "CPU_CYCLES_REFERENCE",
+        "CPU_INSTRUCTIONS_RETIRED",
+        "CPU_TIMESTAMP_COUNTER",
+    };
+    auto msrio = std::make_shared<BenchMSRIO>(mode == "intern");
+    geopm::MSRIOGroup group(topo, msrio, std::make_shared<BenchCpuid>(), nullptr);
+    std::vector<int> sample_idx;
+    for (const auto &signal_name : signal_set) {
+        int domain_type = group.signal_domain_type(signal_name);
+        int num_domain = topo.num_domain(domain_type);
+        for (int domain_idx = 0; domain_idx < num_domain; ++domain_idx) {
+            sample_idx.push_back(group.push_signal(signal_name, domain_type, domain_idx));
+        }
+    }
+    double total = 0.0;
+    geopm_time_s time_0;
+    geopm_time_s time_1;
+    geopm_time(&time_0);
+    for (int loop_idx = 0; loop_idx < num_loop; ++loop_idx) {
+        group.read_batch();
+        for (int idx : sample_idx) {
+            total += group.sample(idx);
+        }
+    }
+    geopm_time(&time_1);
+    double read_time = geopm_time_diff(&time_0, &time_1) / num_loop;
+    std::cout << mode << "," << sample_idx.size() << ","
+              << msrio->num_read_op(0) << "," << msrio->num_read_op(1) << ","
+              << read_time << std::endl;
+    g_sink = total;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 5) {
+        std::cerr << argv[0] << " NUM_PACKAGE NUM_CORE_PER_PACKAGE NUM_THREAD_PER_CORE LOOP_COUNT"
+                  << std::endl;
+        return -1;
+    }
+    BenchTopo topo(std::stoi(argv[1]), std::stoi(argv[2]), std::stoi(argv[3]));
+    int num_loop = std::stoi(argv[4]);
+
+    std::cout << "MODE,NUM_SIGNAL,NUM_READ_OP,NUM_SAVE_OP,READ_SAMPLE_SECONDS" << std::endl;
+    run("append", topo, num_loop);
+    run("intern", topo, num_loop);
+    return 0;
+}
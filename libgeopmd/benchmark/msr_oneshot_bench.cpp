@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <iostream>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "geopm_time.h"
+#include "MSRIO.hpp"
+#include "MSRIOGroup.hpp"
+#include "PlatformIOImp.hpp"
+#include "BenchPlatform.hpp"
+
+// Compares one-shot reads and writes of CPU scoped MSRs at board
+// scope through PlatformIO.  The "serial" mode calls read_signal()
+// and write_control() for each native domain, which is what domain
+// conversion used to do.  The "batch" mode makes a single board
+// domain request so that PlatformIO and MSRIOGroup build one batch.
+// The MSRIO stands in for the msr-safe driver: each read_msr(),
+// write_msr(), read_batch() and write_batch() counts as one system
+// call and spins for the given latency.
+
+class BenchMSRIO : public geopm::MSRIO
+{
+    public:
+        BenchMSRIO(double syscall_latency)
+            : m_syscall_latency(syscall_latency)
+            , m_num_syscall(0)
+            , m_context(1)
+        {
+
+        }
+        uint64_t read_msr(int cpu_idx, uint64_t offset) override
+        {
+            syscall();
+            return value(cpu_idx, offset);
+        }
+        void write_msr(int cpu_idx, uint64_t offset, uint64_t raw_value,
+                       uint64_t write_mask) override
+        {
+            syscall();
+        }
+        int create_batch_context(void) override
+        {
+            m_context.emplace_back();
+            return m_context.size() - 1;
+        }
+        void reset_batch_context(int batch_ctx) override
+        {
+            m_context.at(batch_ctx) = {};
+        }
+        int add_read(int cpu_idx, uint64_t offset) override
+        {
+            return add_read(cpu_idx, offset, 0);
+        }
+        int add_read(int cpu_idx, uint64_t offset, int batch_ctx) override
+        {
+            context_s &ctx = m_context.at(batch_ctx);
+            ctx.read_op.emplace_back(cpu_idx, offset);
+            ctx.read_val.push_back(0);
+            return ctx.read_op.size() - 1;
+        }
+        void read_batch(void) override
+        {
+            read_batch(0);
+        }
+        void read_batch(int batch_ctx) override
+        {
+            context_s &ctx = m_context.at(batch_ctx);
+            if (!ctx.read_op.empty()) {
+                syscall();
+            }
+            for (size_t op_idx = 0; op_idx < ctx.read_op.size(); ++op_idx) {
+                ctx.read_val[op_idx] = value(ctx.read_op[op_idx].first,
+                                             ctx.read_op[op_idx].second);
+            }
+        }
+        int add_write(int cpu_idx, uint64_t offset) override
+        {
+            return add_write(cpu_idx, offset, 0);
+        }
+        int add_write(int cpu_idx, uint64_t offset, int batch_ctx) override
+        {
+            context_s &ctx = m_context.at(batch_ctx);
+            ++ctx.num_write_op;
+            return ctx.num_write_op - 1;
+        }
+        void adjust(int batch_idx, uint64_t value, uint64_t write_mask) override
+        {
+
+        }
+        void adjust(int batch_idx, uint64_t value, uint64_t write_mask,
+                    int batch_ctx) override
+        {
+
+        }
+        uint64_t sample(int batch_idx) const override
+        {
+            return sample(batch_idx, 0);
+        }
+        uint64_t sample(int batch_idx, int batch_ctx) const override
+        {
+            return m_context.at(batch_ctx).read_val[batch_idx];
+        }
+        void write_batch(void) override
+        {
+            write_batch(0);
+        }
+        void write_batch(int batch_ctx) override
+        {
+            if (m_context.at(batch_ctx).num_write_op != 0) {
+                syscall();
+            }
+        }
+        uint64_t system_write_mask(uint64_t offset) override
+        {
+            return ~0ULL;
+        }
+        int num_syscall(void) const
+        {
+            return m_num_syscall;
+        }
+        void reset_num_syscall(void)
+        {
+            m_num_syscall = 0;
+        }
+    private:
+        struct context_s {
+            std::vector<std::pair<int, uint64_t> > read_op;
+            std::vector<uint64_t> read_val;
+            int num_write_op = 0;
+        };
+        static uint64_t value(int cpu_idx, uint64_t offset)
+        {
+            return offset + cpu_idx;
+        }
+        void syscall(void)
+        {
+            ++m_num_syscall;
+            geopm_time_s time_0;
+            geopm_time_s time_1;
+            geopm_time(&time_0);
+            do {
+                geopm_time(&time_1);
+            } while (geopm_time_diff(&time_0, &time_1) < m_syscall_latency);
+        }
+        const double m_syscall_latency;
+        int m_num_syscall;
+        std::vector<context_s> m_context;
+};
+
+static volatile double g_sink;
+
+static void run(const std::string &mode, const BenchTopo &topo,
+                double syscall_latency, int num_loop)
+{
+    static const std::string signal_name = "MSR::PERF_STATUS:FREQ";
+    static const std::string control_name = "CPU_FREQUENCY_MAX_CONTROL";
+    auto msrio = std::make_shared<BenchMSRIO>(syscall_latency);
+    auto group = std::make_shared<geopm::MSRIOGroup>(topo, msrio, std::make_shared<BenchCpuid>(), nullptr);
+    geopm::PlatformIOImp pio({group}, topo, 0);
+    bool is_serial = mode == "serial";
+    int signal_domain = pio.signal_domain_type(signal_name);
+    int control_domain = pio.control_domain_type(control_name);
+    int num_signal_domain = topo.num_domain(signal_domain);
+    int num_control_domain = topo.num_domain(control_domain);
+
+    double total = 0.0;
+    geopm_time_s time_0;
+    geopm_time_s time_1;
+    msrio->reset_num_syscall();
+    geopm_time(&time_0);
+    for (int loop_idx = 0; loop_idx < num_loop; ++loop_idx) {
+        if (is_serial) {
+            for (int domain_idx = 0; domain_idx < num_signal_domain; ++domain_idx) {
+                total += pio.read_signal(signal_name, signal_domain, domain_idx);
+            }
+        }
+        else {
+            total += pio.read_signal(signal_name, GEOPM_DOMAIN_BOARD, 0);
+        }
+    }
+    geopm_time(&time_1);
+    double read_time = geopm_time_diff(&time_0, &time_1) / num_loop;
+    int read_syscall = msrio->num_syscall() / num_loop;
+
+    msrio->reset_num_syscall();
+    geopm_time(&time_0);
+    for (int loop_idx = 0; loop_idx < num_loop; ++loop_idx) {
+        if (is_serial) {
+            for (int domain_idx = 0; domain_idx < num_control_domain; ++domain_idx) {
+                pio.write_control(control_name, control_domain, domain_idx, 2.0e9);
+            }
+        }
+        else {
+            pio.write_control(control_name, GEOPM_DOMAIN_BOARD, 0, 2.0e9);
+        }
+    }
+    geopm_time(&time_1);
+    double write_time = geopm_time_diff(&time_0, &time_1) / num_loop;
+    int write_syscall = msrio->num_syscall() / num_loop;
+
+    std::cout << mode << "," << topo.num_domain(GEOPM_DOMAIN_CPU) << ","
+              << read_syscall << "," << read_time << ","
+              << write_syscall << "," << write_time << std::endl;
+    g_sink = total;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 6) {
+        std::cerr << argv[0] << " NUM_PACKAGE NUM_CORE_PER_PACKAGE NUM_THREAD_PER_CORE SYSCALL_SECONDS LOOP_COUNT"
+                  << std::endl;
+        return -1;
+    }
+    BenchTopo topo(std::stoi(argv[1]), std::stoi(argv[2]), std::stoi(argv[3]));
+    double syscall_latency = std::stod(argv[4]);
+    int num_loop = std::stoi(argv[5]);
+
+    std::cout << "MODE,NUM_CPU,READ_SYSCALL,READ_SECONDS,WRITE_SYSCALL,WRITE_SECONDS" << std::endl;
+    run("serial", topo, syscall_latency, num_loop);
+    run("batch", topo, syscall_latency, num_loop);
+    return 0;
+}
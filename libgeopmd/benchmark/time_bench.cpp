@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <iostream>
+#include <string>
+
+#include "geopm_time.h"
+
+// Measures the cost of a time stamp.  The "clock" mode calls
+// geopm_time(), which is clock_gettime(CLOCK_MONOTONIC_RAW).  The
+// "fast" mode calls geopm_time_fast(), which converts the invariant
+// time stamp counter when the system supports it.
+
+static volatile long g_sink;
+
+static double run(const std::string &mode, int num_loop)
+{
+    bool is_fast = mode == "fast";
+    struct geopm_time_s curr;
+    // The first call calibrates the time stamp counter
+    geopm_time_fast(&curr);
+    geopm_time_s time_0;
+    geopm_time_s time_1;
+    long total = 0;
+    geopm_time(&time_0);
+    for (int loop_idx = 0; loop_idx < num_loop; ++loop_idx) {
+        if (is_fast) {
+            geopm_time_fast(&curr);
+        }
+        else {
+            geopm_time(&curr);
+        }
+        total += curr.t.tv_nsec;
+    }
+    geopm_time(&time_1);
+    g_sink = total;
+    return geopm_time_diff(&time_0, &time_1) / num_loop;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 2) {
+        std::cerr << argv[0] << " LOOP_COUNT" << std::endl;
+        return -1;
+    }
+    int num_loop = std::stoi(argv[1]);
+
+    std::cout << "MODE,SECONDS" << std::endl;
+    std::cout << "clock," << run("clock", num_loop) << std::endl;
+    std::cout << "fast," << run("fast", num_loop) << std::endl;
+    return 0;
+}
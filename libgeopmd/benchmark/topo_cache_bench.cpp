@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <string>
+
+#include "geopm_time.h"
+#include "GPUTopoNull.hpp"
+#include "PlatformTopoImp.hpp"
+
+// Measures the cost of creating the PlatformTopo cache on a cold
+// start.  The "sysfs" mode creates the cache file with
+// PlatformTopoImp::create_cache(), which reads the topology from
+// sysfs.  The "lscpu" mode runs "lscpu -x" through popen() and reads
+// its output, which is what create_cache() did before.
+
+static volatile size_t g_sink;
+
+static double run_sysfs(const std::string &cache_path, int num_loop)
+{
+    geopm::GPUTopoNull gpu_topo;
+    geopm_time_s time_0;
+    geopm_time_s time_1;
+    geopm_time(&time_0);
+    for (int loop_idx = 0; loop_idx < num_loop; ++loop_idx) {
+        unlink(cache_path.c_str());
+        geopm::PlatformTopoImp::create_cache(cache_path, gpu_topo, "");
+    }
+    geopm_time(&time_1);
+    unlink(cache_path.c_str());
+    return geopm_time_diff(&time_0, &time_1) / num_loop;
+}
+
+static double run_lscpu(int num_loop)
+{
+    geopm_time_s time_0;
+    geopm_time_s time_1;
+    geopm_time(&time_0);
+    for (int loop_idx = 0; loop_idx < num_loop; ++loop_idx) {
+        FILE *fid = popen("unset LD_PRELOAD; LC_ALL=C lscpu -x", "r");
+        if (fid == NULL) {
+            return -1.0;
+        }
+        char buffer[4096];
+        size_t num_read = 0;
+        size_t total = 0;
+        while ((num_read = fread(buffer, 1, sizeof(buffer), fid)) != 0) {
+            total += num_read;
+        }
+        if (pclose(fid) != 0) {
+            return -1.0;
+        }
+        g_sink = total;
+    }
+    geopm_time(&time_1);
+    return geopm_time_diff(&time_0, &time_1) / num_loop;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3) {
+        std::cerr << argv[0] << " CACHE_PATH LOOP_COUNT" << std::endl;
+        return -1;
+    }
+    std::string cache_path = argv[1];
+    int num_loop = std::stoi(argv[2]);
+
+    std::cout << "MODE,SECONDS" << std::endl;
+    std::cout << "sysfs," << run_sysfs(cache_path, num_loop) << std::endl;
+    std::cout << "lscpu," << run_lscpu(num_loop) << std::endl;
+    return 0;
+}
@@ -29,6 +29,12 @@ namespace geopm
             virtual double freq_sticker(void) const = 0;
             virtual rdt_info_s rdt_info(void) const = 0;
             virtual uint32_t pmc_bit_width(void) const = 0;
+            /// @brief Check if the time stamp counter runs at a
+            ///        constant rate in all C-states and P-states.
+            ///
+            /// @return True if the counter is invariant, false if
+            ///         it is not or the check is not supported.
+            virtual bool is_tsc_invariant(void) const;
     };
 }
 
@@ -15,6 +15,8 @@
 
 #include "PluginFactory.hpp"
 
+struct geopm_request_s;
+
 namespace geopm
 {
     class GEOPM_PUBLIC IOGroup
@@ -210,6 +212,31 @@ namespace geopm
             ///
             /// @return The name of the IOGroup in all caps.
             virtual std::string name(void) const = 0;
+            /// @brief Read a set of signals from the platform and
+            ///        interpret them into SI units.  Does not modify
+            ///        the values stored by calling read_batch().  The
+            ///        default implementation calls read_signal() for
+            ///        each request; an IOGroup may override this to
+            ///        read all of the signals in one operation.
+            /// @param [in] requests Name, domain type and domain
+            ///        index of each signal.  Each domain type must
+            ///        be the native domain of the signal.
+            /// @return The value in SI units of each requested
+            ///         signal in request order.
+            virtual std::vector<double> read_signals(const std::vector<geopm_request_s> &requests);
+            /// @brief Interpret a set of settings and write them to
+            ///        the platform.  Does not modify the values stored
+            ///        by calling adjust().  The default implementation
+            ///        calls write_control() for each request; an
+            ///        IOGroup may override this to write all of the
+            ///        controls in one operation.
+            /// @param [in] requests Name, domain type and domain
+            ///        index of each control.  Each domain type must
+            ///        be the native domain of the control.
+            /// @param [in] settings Value in SI units of the setting
+            ///        for each request.
+            virtual void write_controls(const std::vector<geopm_request_s> &requests,
+                                        const std::vector<double> &settings);
 
             /// @brief Convert a string to the corresponding m_units_e value
             static m_units_e string_to_units(const std::string &str);
@@ -8,6 +8,7 @@
 
 #include <climits>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -249,6 +250,74 @@ namespace geopm
                                             int &server_pid,
                                             std::string &server_key) = 0;
             virtual void stop_batch_server(int server_pid) = 0;
+            /// @brief Get the time spent by each IOGroup in the most
+            ///        recent call to read_batch().
+            ///
+            /// Latency is only measured when the
+            /// GEOPM_PIO_BATCH_THREADS environment variable is set.
+            /// In that case IOGroups are read concurrently and the
+            /// values overlap in time.  The default implementation
+            /// returns an empty map.
+            ///
+            /// @return Map from IOGroup name to the duration in
+            ///         seconds of the IOGroup's read_batch() call, or
+            ///         an empty map if latency is not measured.
+            virtual std::map<std::string, double> read_batch_latency(void) const;
+            /// @brief Start a batch server that reads all signals
+            ///        every sample_period seconds and publishes them to
+            ///        shared memory.  See BatchServer::make_unique().
+            ///        The default implementation starts a server that
+            ///        reads on request if sample_period is zero, and
+            ///        otherwise throws GEOPM_ERROR_NOT_IMPLEMENTED.
+            virtual void start_batch_server(int client_pid,
+                                            const std::vector<geopm_request_s> &signal_config,
+                                            const std::vector<geopm_request_s> &control_config,
+                                            double sample_period,
+                                            int &server_pid,
+                                            std::string &server_key);
+            /// @brief Sample a contiguous range of signals that have
+            ///        been pushed on to the signal stack.  Equivalent
+            ///        to calling sample() for each index in the range,
+            ///        but the range is only checked once.  The default
+            ///        implementation calls sample() for each index.
+            ///
+            /// @param [in] signal_idx_begin Index of the first signal
+            ///        in the range.
+            ///
+            /// @param [in] num_signal Number of signals in the range.
+            ///
+            /// @param [out] result Array of at least num_signal
+            ///        values that is filled in push order.
+            virtual void sample_range(int signal_idx_begin,
+                                      int num_signal,
+                                      double *result);
+            /// @brief Sample all signals that have been pushed on to
+            ///        the signal stack.
+            ///
+            /// @param [out] result Resized to the number of pushed
+            ///        signals and filled in push order.  The vector
+            ///        is only reallocated if more signals have been
+            ///        pushed since the last call.
+            ///
+            /// The default implementation throws
+            /// GEOPM_ERROR_NOT_IMPLEMENTED because the number of
+            /// pushed signals is not part of this interface.
+            virtual void sample_all(std::vector<double> &result);
+            /// @brief Read a set of signals from the platform and
+            ///        interpret them into SI units.  Requests in the
+            ///        native domain of a signal are grouped by IOGroup
+            ///        so that each IOGroup reads all of its requested
+            ///        signals in one operation.  Does not modify the
+            ///        values stored by calling read_batch().  The
+            ///        default implementation calls read_signal() for
+            ///        each request.
+            ///
+            /// @param [in] requests Name, domain type and domain
+            ///        index of each signal.
+            ///
+            /// @return The value in SI units of each requested signal
+            ///         in request order.
+            virtual std::vector<double> read_signals(const std::vector<geopm_request_s> &requests);
 
             /// @param [in] value Check if the given parameter is a valid value.
             ///
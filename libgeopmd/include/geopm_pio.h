@@ -14,6 +14,8 @@
 extern "C" {
 #endif
 
+struct geopm_request_s;
+
 /// @return the number of signal names that can be indexed with the
 ///         name_idx parameter to the geopm_pio_signal_name()
 ///         function.  Any error in loading the platform will result
@@ -109,6 +111,30 @@ int GEOPM_PUBLIC
     geopm_pio_read_signal(const char *signal_name, int domain_type,
                           int domain_idx, double *result);
 
+/// @brief Immediately read a set of signals from the platform.
+///
+/// @details Requests for signals in their native domain that are
+///          provided by the same IOGroup are read together, so the
+///          IOGroup may access the hardware once for all of them
+///          rather than once per request.  The values stored by
+///          geopm_pio_read_batch() are not modified.
+///
+/// @param [in] num_request The number of elements in the requests
+///        and result arrays.
+///
+/// @param [in] requests Array of geopm_request_s elements, each
+///        naming a signal, domain type and domain index as would be
+///        passed to geopm_pio_read_signal().
+///
+/// @param [out] result Array of at least num_request values that is
+///        filled with the signal values in request order.
+///
+/// @return If an error occurs then negative error code is returned.
+///         Zero is returned upon success.
+int GEOPM_PUBLIC
+    geopm_pio_read_signals(int num_request, const struct geopm_request_s *requests,
+                           double *result);
+
 /// @brief Interpret the setting in SI units associated with
 ///        control_name and write it to the platform.  This value is
 ///        written to the geopm_topo_e domain_type domain indexed by
@@ -236,6 +262,28 @@ int GEOPM_PUBLIC
 int GEOPM_PUBLIC
     geopm_pio_sample(int signal_idx, double *result);
 
+/// @brief Samples the cached values of a contiguous range of signals
+///        that have been pushed via geopm_pio_push_signal() and
+///        writes the values into the result array.
+///
+/// @details The cached values are updated at the time of call to
+///          geopm_pio_read_batch().  The range is checked once and
+///          the values are written with a single call, which avoids
+///          calling geopm_pio_sample() for each pushed signal.
+///
+/// @param [in] signal_idx_begin The signal_idx of the first signal in
+///        the range as returned by geopm_pio_push_signal().
+///
+/// @param [in] num_signal The number of signals in the range.
+///
+/// @param [out] result Array of at least num_signal values that is
+///        filled with the signal values in push order.
+///
+/// @return If an error occurs then negative error code is returned.
+///         Zero is returned upon success.
+int GEOPM_PUBLIC
+    geopm_pio_sample_array(int signal_idx_begin, int num_signal, double *result);
+
 /// @brief Updates cached value for single control that has been
 ///        pushed via geopm_pio_push_control() to the value setting.
 ///
@@ -377,8 +425,6 @@ int GEOPM_PUBLIC
     geopm_pio_signal_info(const char *signal_name, int *aggregation_type,
                           int *format_type, int *behavior_type);
 
-struct geopm_request_s;
-
 /// @brief Creates a batch server with the following signals and
 ///        controls.  It would be an error to create a batch server
 ///        without any signals or controls.
@@ -420,6 +466,27 @@ int GEOPM_PUBLIC
                                  const struct geopm_request_s *control_config,
                                  int *server_pid, int key_size, char *server_key);
 
+/// @brief Creates a batch server that reads all of the signals
+///        periodically.  Identical to geopm_pio_start_batch_server()
+///        except that the server reads all signals every
+///        sample_period seconds and publishes the values with a
+///        timestamp and generation count in the signal shared memory
+///        region.  Clients read the latest published values without
+///        sending a request to the server.
+///
+/// @param [in] sample_period Interval in seconds between samples.  A
+///        value of zero selects reading signals on client request.
+///
+/// @result Zero is returned on success and
+///         a negative error code is returned if any error occurs.
+int GEOPM_PUBLIC
+    geopm_pio_start_batch_server_sampling(int client_pid, int num_signal,
+                                          const struct geopm_request_s *signal_config,
+                                          int num_control,
+                                          const struct geopm_request_s *control_config,
+                                          double sample_period,
+                                          int *server_pid, int key_size, char *server_key);
+
 /// @brief Supports the D-Bus interface for stopping a batch server.
 ///        Call through to BatchServer::stop_batch()
 ///
@@ -34,6 +34,13 @@ enum geopm_metric_stats_e {
     GEOPM_NUM_METRIC_STATS
 };
 
+enum geopm_metric_quantile_e {
+    GEOPM_METRIC_QUANTILE_P50,
+    GEOPM_METRIC_QUANTILE_P90,
+    GEOPM_METRIC_QUANTILE_P99,
+    GEOPM_NUM_METRIC_QUANTILE
+};
+
 struct geopm_metric_stats_s {
     char name[NAME_MAX];
     double stats[GEOPM_NUM_METRIC_STATS];
@@ -47,6 +54,10 @@ struct geopm_report_s {
     struct geopm_metric_stats_s *metric_stats;
 };
 
+struct geopm_metric_quantile_s {
+    double quantile[GEOPM_NUM_METRIC_QUANTILE];
+};
+
 /// @brief Create a stats collector handle
 ///
 /// Provide a list of PlatformIO signal requests and construct a stats collector
@@ -67,6 +78,25 @@ int GEOPM_PUBLIC
     geopm_stats_collector_create(size_t num_requests, const struct geopm_request_s *requests,
                                  struct geopm_stats_collector_s **collector);
 
+/// @brief Enable quantile estimates for one request
+///
+/// Quantile estimates are not gathered by default.  After this call the
+/// samples for the request are also counted in a histogram with bounded
+/// memory and logarithmically spaced buckets.  The estimates of the
+/// median, 90th and 99th percentiles are within 1% of a sampled value.
+/// They are included in the YAML report, and are provided by
+/// geopm_stats_collector_report_quantile().
+///
+/// @param [in] collector Handle created with a call to geopm_stats_collector_create()
+///
+/// @param [in] request_idx Index into the requests array provided to
+///        geopm_stats_collector_create()
+///
+/// @returns 0 upon success, or error code upon failure
+int GEOPM_PUBLIC
+    geopm_stats_collector_enable_quantile(struct geopm_stats_collector_s *collector,
+                                          size_t request_idx);
+
 /// @brief Update a stat collector with new values
 ///
 /// User is expected to call PlatformIO::read_batch() prior to calling this
@@ -124,6 +154,28 @@ int GEOPM_PUBLIC
     geopm_stats_collector_report(const struct geopm_stats_collector_s *collector,
                                  size_t num_requests, struct geopm_report_s *report);
 
+/// @brief Get quantile estimates for each request
+///
+/// The quantiles are kept out of the geopm_report_s structure so that its
+/// layout does not change.  The quantiles array is allocated by the user
+/// with one element for each request provided to
+/// geopm_stats_collector_create(), in the same order.  The elements are
+/// indexed by the geopm_metric_quantile_e enum.  The values are NAN for
+/// requests without quantile estimates enabled by
+/// geopm_stats_collector_enable_quantile().
+///
+/// @param [in] collector Handle created with a call to geopm_stats_collector_create()
+///
+/// @param [in] num_requests Number of elements in the quantiles array
+///
+/// @param [out] quantiles Array of quantile estimates allocated by the user
+///
+/// @returns 0 upon success, or error code upon failure
+int GEOPM_PUBLIC
+    geopm_stats_collector_report_quantile(const struct geopm_stats_collector_s *collector,
+                                          size_t num_requests,
+                                          struct geopm_metric_quantile_s *quantiles);
+
 /// @brief Reset statistics
 ///
 /// Called by user to zero all statistics gathered.  This may be called after a
@@ -7,6 +7,7 @@
 
 #include <errno.h>
 #include <math.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "geopm_public.h"
@@ -27,10 +28,49 @@ static inline double geopm_time_diff(const struct geopm_time_s *begin, const str
 static inline bool geopm_time_comp(const struct geopm_time_s *aa, const struct geopm_time_s *bb);
 static inline void geopm_time_add(const struct geopm_time_s *begin, double elapsed, struct geopm_time_s *end);
 static inline double geopm_time_since(const struct geopm_time_s *begin);
+static inline double geopm_time_fast_since(const struct geopm_time_s *begin);
 
 int GEOPM_PUBLIC
     geopm_time_zero(struct geopm_time_s *zero_time);
 
+/*!
+ * @brief Convert a time stamp counter value into a time.
+ *
+ * The first call checks that the time stamp counter is invariant and
+ * calibrates its rate against the clock used by geopm_time().  The
+ * result can be compared with times from geopm_time().
+ *
+ * @param [in] tsc Value returned by geopm_time_tsc().
+ *
+ * @param [out] time Time corresponding to the counter value.
+ *
+ * @return Zero on success, GEOPM_ERROR_NOT_IMPLEMENTED if the time
+ *         stamp counter is not invariant on this system.
+ */
+int GEOPM_PUBLIC
+    geopm_time_tsc_to_time(uint64_t tsc, struct geopm_time_s *time);
+
+/*!
+ * @brief Read the time stamp counter.
+ *
+ * @return Cycle count, or zero if the architecture does not provide
+ *         a time stamp counter.
+ */
+uint64_t GEOPM_PUBLIC
+    geopm_time_tsc(void);
+
+/*!
+ * @brief Get the current time from the invariant time stamp counter
+ *        if it is available, otherwise from geopm_time().
+ *
+ * The counter rate is calibrated once, so these times drift slowly
+ * away from geopm_time().  Intended for measuring short intervals
+ * where the cost of clock_gettime() is significant, not for time
+ * stamps that are compared with geopm_time() over a long run.
+ */
+int GEOPM_PUBLIC
+    geopm_time_fast(struct geopm_time_s *time);
+
 #include <time.h>
 
 /*!
@@ -115,6 +155,13 @@ static inline double geopm_time_since(const struct geopm_time_s *begin)
     return geopm_time_diff(begin, &curr_time);
 }
 
+static inline double geopm_time_fast_since(const struct geopm_time_s *begin)
+{
+    struct geopm_time_s curr_time;
+    geopm_time_fast(&curr_time);
+    return geopm_time_diff(begin, &curr_time);
+}
+
 #ifdef __cplusplus
 }
 namespace geopm
@@ -11,54 +11,170 @@
 #include <cmath>
 
 #include <algorithm>
-#include <numeric>
+#include <iterator>
 #include <map>
 
 #include "geopm/Exception.hpp"
 
 namespace geopm
 {
-    std::vector<double> nan_filter(const std::vector<double> &operand)
+    // The aggregation kernels below operate on a contiguous range of
+    // operands and skip NAN values in place rather than copying the
+    // operands that are not NAN.  Kernels that reduce the operands
+    // keep M_NUM_LANE independent partial results so that the loop
+    // body has no dependency between iterations and can be
+    // vectorized.
+    static constexpr size_t M_NUM_LANE = 4;
+
+    // Sum of the operands that are not NAN and the number of them
+    static double sum_kernel(const double *operand, size_t num_operand, size_t &num_valid)
     {
-        std::vector<double> result;
-        std::copy_if(operand.begin(), operand.end(), std::back_inserter(result),
-                     [](double x) -> bool { return !std::isnan(x); });
+        double lane_sum[M_NUM_LANE] = {};
+        size_t lane_count[M_NUM_LANE] = {};
+        size_t op_idx = 0;
+        for (; op_idx + M_NUM_LANE <= num_operand; op_idx += M_NUM_LANE) {
+            for (size_t lane = 0; lane < M_NUM_LANE; ++lane) {
+                double value = operand[op_idx + lane];
+                bool is_valid = !std::isnan(value);
+                lane_sum[lane] += is_valid ? value : 0.0;
+                lane_count[lane] += is_valid;
+            }
+        }
+        for (; op_idx < num_operand; ++op_idx) {
+            double value = operand[op_idx];
+            bool is_valid = !std::isnan(value);
+            lane_sum[0] += is_valid ? value : 0.0;
+            lane_count[0] += is_valid;
+        }
+        num_valid = (lane_count[0] + lane_count[1]) + (lane_count[2] + lane_count[3]);
+        return (lane_sum[0] + lane_sum[1]) + (lane_sum[2] + lane_sum[3]);
+    }
+
+    // Sum of the operands and of their squares, skipping NAN
+    static double sum_square_kernel(const double *operand, size_t num_operand,
+                                    double &sum_square, size_t &num_valid)
+    {
+        double lane_sum[M_NUM_LANE] = {};
+        double lane_sum_square[M_NUM_LANE] = {};
+        size_t lane_count[M_NUM_LANE] = {};
+        size_t op_idx = 0;
+        for (; op_idx + M_NUM_LANE <= num_operand; op_idx += M_NUM_LANE) {
+            for (size_t lane = 0; lane < M_NUM_LANE; ++lane) {
+                double value = operand[op_idx + lane];
+                bool is_valid = !std::isnan(value);
+                value = is_valid ? value : 0.0;
+                lane_sum[lane] += value;
+                lane_sum_square[lane] += value * value;
+                lane_count[lane] += is_valid;
+            }
+        }
+        for (; op_idx < num_operand; ++op_idx) {
+            double value = operand[op_idx];
+            bool is_valid = !std::isnan(value);
+            value = is_valid ? value : 0.0;
+            lane_sum[0] += value;
+            lane_sum_square[0] += value * value;
+            lane_count[0] += is_valid;
+        }
+        num_valid = (lane_count[0] + lane_count[1]) + (lane_count[2] + lane_count[3]);
+        sum_square = (lane_sum_square[0] + lane_sum_square[1]) +
+                     (lane_sum_square[2] + lane_sum_square[3]);
+        return (lane_sum[0] + lane_sum[1]) + (lane_sum[2] + lane_sum[3]);
+    }
+
+    // Minimum (or maximum if is_max) of the operands that are not
+    // NAN, or NAN if there are none.  Comparisons with NAN are false
+    // so NAN operands never replace the partial result.
+    static double extreme_kernel(const double *operand, size_t num_operand, bool is_max)
+    {
+        double sign = is_max ? -1.0 : 1.0;
+        double lane_min[M_NUM_LANE];
+        std::fill(lane_min, lane_min + M_NUM_LANE, INFINITY);
+        bool is_valid = false;
+        size_t op_idx = 0;
+        for (; op_idx + M_NUM_LANE <= num_operand; op_idx += M_NUM_LANE) {
+            for (size_t lane = 0; lane < M_NUM_LANE; ++lane) {
+                double value = sign * operand[op_idx + lane];
+                is_valid |= !std::isnan(value);
+                lane_min[lane] = value < lane_min[lane] ? value : lane_min[lane];
+            }
+        }
+        for (; op_idx < num_operand; ++op_idx) {
+            double value = sign * operand[op_idx];
+            is_valid |= !std::isnan(value);
+            lane_min[0] = value < lane_min[0] ? value : lane_min[0];
+        }
+        double result = NAN;
+        if (is_valid) {
+            result = sign * std::min(std::min(lane_min[0], lane_min[1]),
+                                     std::min(lane_min[2], lane_min[3]));
+        }
         return result;
     }
 
-    double Agg::sum(const std::vector<double> &operand)
+    // First operand that is not NAN, or NAN if there are none; on
+    // return is_same is true if all other operands that are not NAN
+    // are equal to it.
+    static double common_kernel(const double *operand, size_t num_operand, bool &is_same)
     {
-        auto filtered = nan_filter(operand);
+        const double *operand_end = operand + num_operand;
+        const double *first = std::find_if(operand, operand_end,
+                                           [](double value) {
+                                               return !std::isnan(value);
+                                           });
         double result = NAN;
-        if (filtered.size()) {
-            result = std::accumulate(filtered.begin(), filtered.end(), 0.0);
+        is_same = true;
+        if (first != operand_end) {
+            result = *first;
+            is_same = std::all_of(first + 1, operand_end,
+                                  [result](double value) {
+                                      return value == result || std::isnan(value);
+                                  });
+        }
+        return result;
+    }
+
+    double Agg::sum(const std::vector<double> &operand)
+    {
+        size_t num_valid = 0;
+        double result = sum_kernel(operand.data(), operand.size(), num_valid);
+        if (num_valid == 0) {
+            result = NAN;
         }
         return result;
     }
 
     double Agg::average(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
-        double result = NAN;
-        if (filtered.size()) {
-            result = Agg::sum(filtered) / filtered.size();
+        size_t num_valid = 0;
+        double result = sum_kernel(operand.data(), operand.size(), num_valid);
+        if (num_valid == 0) {
+            result = NAN;
+        }
+        else {
+            result /= num_valid;
         }
         return result;
     }
 
     double Agg::median(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
+        // Scratch space is reused between calls by each thread
+        thread_local std::vector<double> scratch;
+        scratch.clear();
+        std::copy_if(operand.begin(), operand.end(), std::back_inserter(scratch),
+                     [](double x) -> bool { return !std::isnan(x); });
         double result = NAN;
-        size_t num_op = filtered.size();
+        size_t num_op = scratch.size();
         if (num_op) {
             size_t mid_idx = num_op / 2;
             bool is_even = ((num_op % 2) == 0);
-            std::vector<double> operand_sorted(std::move(filtered));
-            std::sort(operand_sorted.begin(), operand_sorted.end());
-            result = operand_sorted[mid_idx];
+            auto mid_it = scratch.begin() + mid_idx;
+            std::nth_element(scratch.begin(), mid_it, scratch.end());
+            result = *mid_it;
             if (is_even) {
-                result += operand_sorted[mid_idx - 1];
+                // All values before the middle are not greater than it
+                result += *std::max_element(scratch.begin(), mid_it);
                 result /= 2.0;
             }
         }
@@ -67,13 +183,16 @@ namespace geopm
 
     double Agg::integer_bitwise_or(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
         double result = NAN;
-        if (filtered.size()) {
-            int64_t agg_tmp = 0;
-            for (const auto &it : filtered) {
+        int64_t agg_tmp = 0;
+        bool is_valid = false;
+        for (const auto &it : operand) {
+            if (!std::isnan(it)) {
                 agg_tmp |= (int64_t) it;
+                is_valid = true;
             }
+        }
+        if (is_valid) {
             result = (double) agg_tmp;
         }
         return result;
@@ -81,36 +200,41 @@ namespace geopm
 
     double Agg::logical_and(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
         double result = NAN;
-        if (filtered.size()) {
-            result = std::all_of(filtered.begin(), filtered.end(),
-                                 [](double it) {return (it != 0.0);});
+        bool is_valid = false;
+        bool is_false = false;
+        for (const auto &it : operand) {
+            is_valid |= !std::isnan(it);
+            is_false |= (it == 0.0);
+        }
+        if (is_valid) {
+            result = !is_false;
         }
         return result;
     }
 
     double Agg::logical_or(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
         double result = NAN;
-        if (filtered.size()) {
-            result = std::any_of(filtered.begin(), filtered.end(),
-                                 [](double it) {return (it != 0.0);});
+        bool is_valid = false;
+        bool is_true = false;
+        for (const auto &it : operand) {
+            bool is_nan = std::isnan(it);
+            is_valid |= !is_nan;
+            is_true |= (!is_nan && it != 0.0);
+        }
+        if (is_valid) {
+            result = is_true;
         }
         return result;
     }
 
     static double common_value(const std::vector<double> &operand, double no_match)
     {
-        auto filtered = nan_filter(operand);
-        double result = NAN;
-        if (filtered.size() != 0) {
-            result = std::all_of(filtered.cbegin(), filtered.cend(),
-                                [filtered](double x) {
-                                    return x == filtered[0];
-                                }) ?
-                     filtered[0] : no_match;
+        bool is_same = true;
+        double result = common_kernel(operand.data(), operand.size(), is_same);
+        if (!is_same) {
+            result = no_match;
         }
         return result;
     }
@@ -127,41 +251,28 @@ namespace geopm
 
     double Agg::min(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
-        double result = NAN;
-        if (filtered.size()) {
-            result = *std::min_element(filtered.begin(), filtered.end());
-        }
-        return result;
+        return extreme_kernel(operand.data(), operand.size(), false);
     }
 
     double Agg::max(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
-        double result = NAN;
-        if (filtered.size()) {
-            result = *std::max_element(filtered.begin(), filtered.end());
-        }
-        return result;
+        return extreme_kernel(operand.data(), operand.size(), true);
     }
 
     double Agg::stddev(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
+        size_t num_valid = 0;
+        double sum_squares = 0.0;
+        double sum_squared = sum_square_kernel(operand.data(), operand.size(),
+                                               sum_squares, num_valid);
+        sum_squared *= sum_squared;
         double result = NAN;
-        if (filtered.size() > 1) {
-            double sum_squared = Agg::sum(filtered);
-            sum_squared *= sum_squared;
-            std::vector<double> operand_squared(filtered);
-            for (auto &it : operand_squared) {
-                it *= it;
-            }
-            double sum_squares = Agg::sum(operand_squared);
-            double aa = 1.0 / (filtered.size() - 1);
-            double bb = aa / filtered.size();
+        if (num_valid > 1) {
+            double aa = 1.0 / (num_valid - 1);
+            double bb = aa / num_valid;
             result = std::sqrt(aa * sum_squares - bb * sum_squared);
         }
-        else if (filtered.size() == 1) {
+        else if (num_valid == 1) {
             result = 0.0;
         }
         return result;
@@ -179,18 +290,7 @@ namespace geopm
 
     double Agg::expect_same(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
-        double value = NAN;
-        if (filtered.size() > 0) {
-            value = filtered[0];
-        }
-        for (auto vv : filtered) {
-            if (vv != value) {
-                value = NAN;
-                break;
-            }
-        }
-        return value;
+        return common_value(operand, NAN);
     }
 
     std::function<double(const std::vector<double> &)> Agg::name_to_function(const std::string &name)
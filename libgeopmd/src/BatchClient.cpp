@@ -13,6 +13,7 @@
 #include "geopm/Exception.hpp"
 #include "geopm/PlatformIO.hpp"
 #include "BatchServer.hpp"
+#include "BatchSnapshot.hpp"
 #include "BatchStatus.hpp"
 
 
@@ -30,7 +31,7 @@ namespace geopm
     BatchClientImp::BatchClientImp(const std::string &server_key, double timeout,
                                    int num_signal, int num_control)
         : BatchClientImp(num_signal, num_control,
-                         BatchStatus::make_unique_client(server_key),
+                         nullptr,
                          num_signal == 0 ? nullptr :
                             SharedMemory::make_unique_user(
                                 BatchServer::get_signal_shmem_key(
@@ -40,7 +41,32 @@ namespace geopm
                                 BatchServer::get_control_shmem_key(
                                     server_key), timeout))
     {
+        m_server_key = server_key;
+        // A server that samples periodically may be shared by several
+        // clients that only read the snapshot.  Its FIFOs can be
+        // opened by one client, so attach to them only when a message
+        // must be sent.
+        if (m_snapshot == nullptr) {
+            batch_status();
+        }
+    }
 
+    BatchStatus &BatchClientImp::batch_status(void)
+    {
+        if (m_batch_status == nullptr) {
+            // Use the doorbell if the server placed one in shared
+            // memory, otherwise fall back to the named FIFOs.
+            bool is_signal = m_num_signal != 0;
+            size_t data_size = (is_signal ? m_num_signal : m_num_control) * sizeof(double);
+            if (m_snapshot != nullptr) {
+                data_size = BatchSnapshot::region_size(data_size, m_num_signal);
+            }
+            m_batch_status = BatchStatus::make_unique_client(
+                m_server_key,
+                is_signal ? m_signal_shmem : m_control_shmem,
+                data_size);
+        }
+        return *m_batch_status;
     }
 
 
@@ -50,11 +76,17 @@ namespace geopm
                                    std::shared_ptr<SharedMemory> control_shmem)
         : m_num_signal(num_signal)
         , m_num_control(num_control)
+        , m_server_key()
         , m_batch_status(std::move(batch_status))
         , m_signal_shmem(std::move(signal_shmem))
         , m_control_shmem(std::move(control_shmem))
     {
-
+        size_t data_size = m_num_signal * sizeof(double);
+        if (m_signal_shmem != nullptr &&
+            BatchSnapshot::is_present(*m_signal_shmem, data_size)) {
+            m_snapshot = std::make_shared<BatchSnapshot>(
+                m_signal_shmem, data_size, m_num_signal, 0.0, false);
+        }
     }
 
     std::vector<double> BatchClientImp::read_batch(void)
@@ -62,9 +94,15 @@ namespace geopm
         if (m_num_signal == 0) {
             return {};
         }
+        if (m_snapshot != nullptr) {
+            std::vector<double> result;
+            geopm_time_s sample_time;
+            m_snapshot->read(result, sample_time);
+            return result;
+        }
         try {
-            m_batch_status->send_message(BatchStatus::M_MESSAGE_READ);
-            m_batch_status->receive_message(BatchStatus::M_MESSAGE_CONTINUE);
+            batch_status().send_message(BatchStatus::M_MESSAGE_READ);
+            batch_status().receive_message(BatchStatus::M_MESSAGE_CONTINUE);
         }
         catch (const Exception &ex) {
             throw Exception("BatchClient::" + std::string(__func__) + " The server is unresponsive",
@@ -87,8 +125,8 @@ namespace geopm
         double *buffer = (double *)m_control_shmem->pointer();
         std::copy(settings.begin(), settings.end(), buffer);
         try {
-            m_batch_status->send_message(BatchStatus::M_MESSAGE_WRITE);
-            m_batch_status->receive_message(BatchStatus::M_MESSAGE_CONTINUE);
+            batch_status().send_message(BatchStatus::M_MESSAGE_WRITE);
+            batch_status().receive_message(BatchStatus::M_MESSAGE_CONTINUE);
         }
         catch (const Exception &ex) {
             throw Exception("BatchClient::" + std::string(__func__) + " The server is unresponsive",
@@ -102,8 +140,8 @@ namespace geopm
         // the client side until the server has completed the
         // request. This is even true for the request to quit.
         try {
-            m_batch_status->send_message(BatchStatus::M_MESSAGE_QUIT);
-            m_batch_status->receive_message(BatchStatus::M_MESSAGE_QUIT);
+            batch_status().send_message(BatchStatus::M_MESSAGE_QUIT);
+            batch_status().receive_message(BatchStatus::M_MESSAGE_QUIT);
         }
         catch (const Exception &ex) {
             throw Exception("BatchClient::" + std::string(__func__) + " The server is unresponsive",
@@ -7,6 +7,7 @@
 #define BATCHCLIENT_HPP_INCLUDE
 
 #include <memory>
+#include <string>
 #include <vector>
 #include <signal.h>
 
@@ -16,6 +17,7 @@ namespace geopm
 {
     class SharedMemory;
     class BatchStatus;
+    class BatchSnapshot;
 
     /// @brief Interface that will attach to a batch server.  The batch server
     ///        that it connects to is typically created through a call to the
@@ -56,7 +58,9 @@ namespace geopm
             ///
             /// Command is issued to batch server to read all pushed signal
             /// values.  All of the values read by the batch server are
-            /// returned.
+            /// returned.  If the batch server was started with a sample
+            /// period, no command is issued and the values most recently
+            /// published by the server are returned.
             ///
             /// @return A vector containing all values read by batch server
             ///
@@ -90,11 +94,17 @@ namespace geopm
             void write_batch(std::vector<double> settings) override;
             void stop_batch(void) override;
         private:
+            /// @brief Get the message channel to the server, attaching
+            ///        to it on first use if it was deferred.
+            BatchStatus &batch_status(void);
+
             int m_num_signal;
             int m_num_control;
+            std::string m_server_key;
             std::shared_ptr<BatchStatus> m_batch_status;
             std::shared_ptr<SharedMemory> m_signal_shmem;
             std::shared_ptr<SharedMemory> m_control_shmem;
+            std::shared_ptr<BatchSnapshot> m_snapshot;
     };
 }
 
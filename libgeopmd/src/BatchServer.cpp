@@ -5,6 +5,8 @@
 
 #include "BatchServer.hpp"
 
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <cerrno>
 #include <sstream>
@@ -20,6 +22,7 @@
 #include "geopm/SharedMemory.hpp"
 #include "geopm/Helper.hpp"
 #include "geopm/PlatformIO.hpp"
+#include "BatchSnapshot.hpp"
 #include "BatchStatus.hpp"
 #include "POSIXSignal.hpp"
 #include "geopm_debug.hpp"
@@ -65,6 +68,16 @@ namespace geopm
                                                   control_config);
     }
 
+    std::unique_ptr<BatchServer>
+    BatchServer::make_unique(int client_pid,
+                             const std::vector<geopm_request_s> &signal_config,
+                             const std::vector<geopm_request_s> &control_config,
+                             double sample_period)
+    {
+        return geopm::make_unique<BatchServerImp>(client_pid, signal_config,
+                                                  control_config, sample_period);
+    }
+
     std::string BatchServer::get_signal_shmem_key(
         const std::string &server_key)
     {
@@ -81,8 +94,19 @@ namespace geopm
         int client_pid,
         const std::vector<geopm_request_s> &signal_config,
         const std::vector<geopm_request_s> &control_config)
+        : BatchServerImp(client_pid, signal_config, control_config, 0.0)
+    {
+
+    }
+
+    BatchServerImp::BatchServerImp(
+        int client_pid,
+        const std::vector<geopm_request_s> &signal_config,
+        const std::vector<geopm_request_s> &control_config,
+        double sample_period)
         : BatchServerImp(client_pid, signal_config, control_config, "", "",
-                         platform_io(), nullptr, nullptr, nullptr, nullptr, 0)
+                         platform_io(), nullptr, nullptr, nullptr, nullptr, 0,
+                         sample_period)
     {
         // Fork the server when calling real constructor.
         auto setup = [this]() {
@@ -122,6 +146,28 @@ namespace geopm
         std::shared_ptr<SharedMemory> signal_shmem,
         std::shared_ptr<SharedMemory> control_shmem,
         int server_pid)
+        : BatchServerImp(client_pid, signal_config, control_config,
+                         signal_shmem_key, control_shmem_key, pio,
+                         std::move(batch_status), std::move(posix_signal),
+                         std::move(signal_shmem), std::move(control_shmem),
+                         server_pid, 0.0)
+    {
+
+    }
+
+    BatchServerImp::BatchServerImp(
+        int client_pid,
+        const std::vector<geopm_request_s> &signal_config,
+        const std::vector<geopm_request_s> &control_config,
+        const std::string &signal_shmem_key,
+        const std::string &control_shmem_key,
+        PlatformIO &pio,
+        std::shared_ptr<BatchStatus> batch_status,
+        std::shared_ptr<POSIXSignal> posix_signal,
+        std::shared_ptr<SharedMemory> signal_shmem,
+        std::shared_ptr<SharedMemory> control_shmem,
+        int server_pid,
+        double sample_period)
         : m_client_pid(client_pid)
         , m_server_key(std::to_string(m_client_pid))
         , m_signal_config(signal_config)
@@ -136,6 +182,9 @@ namespace geopm
         , m_pio(pio)
         , m_signal_shmem(std::move(signal_shmem))
         , m_control_shmem(std::move(control_shmem))
+        , m_is_doorbell(batch_status == nullptr &&
+                        (signal_config.size() != 0 || control_config.size() != 0) &&
+                        std::getenv("GEOPM_DISABLE_BATCH_DOORBELL") == nullptr)
         , m_batch_status(batch_status != nullptr ?
                          std::move(batch_status) :
                          BatchStatus::make_unique_server(m_client_pid, m_server_key))
@@ -146,8 +195,20 @@ namespace geopm
         , m_is_active(true)
         , m_is_client_attached(false)
         , m_is_client_waiting(false)
+        , m_sample_period(signal_config.empty() ? 0.0 : sample_period)
+        , m_is_sampler_stopped(true)
     {
-
+        if (sample_period < 0.0 || std::isnan(sample_period)) {
+            throw Exception("BatchServerImp: Sample period must not be negative: " +
+                            std::to_string(sample_period),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (m_sample_period != 0.0 && m_signal_shmem != nullptr) {
+            // Snapshot follows the signal values in the provided region
+            m_snapshot = std::make_shared<BatchSnapshot>(
+                m_signal_shmem, m_signal_config.size() * sizeof(double),
+                m_signal_config.size(), m_sample_period, true);
+        }
     }
 
     BatchServerImp::~BatchServerImp()
@@ -216,7 +277,9 @@ namespace geopm
             }
         }
         if (!m_is_client_attached) {
-            if (m_signal_shmem != nullptr) {
+            // When sampling periodically other clients may attach to
+            // the signal region, so it is removed when the server ends.
+            if (m_signal_shmem != nullptr && m_snapshot == nullptr) {
                 m_signal_shmem->unlink();
             }
 
@@ -244,13 +307,30 @@ namespace geopm
         }
     }
 
+    void BatchServerImp::accept_doorbell(void)
+    {
+        // The reply is sent on the FIFO; all later messages use the
+        // doorbell.  A continue message declines the request.
+        m_is_client_waiting = true;
+        if (m_doorbell_status != nullptr) {
+            write_message(BatchStatus::M_MESSAGE_DOORBELL);
+            m_batch_status = m_doorbell_status;
+        }
+        else {
+            write_message(BatchStatus::M_MESSAGE_CONTINUE);
+        }
+    }
+
     void BatchServerImp::run_batch(void)
     {
         push_requests();
         try {
+            start_sampler();
             event_loop();
+            stop_sampler();
         }
         catch (const Exception &ex) {
+            stop_sampler();
             if (m_is_client_waiting) {
                 std::cerr << "Warning: <geopm>: " << __FILE__ << ":" << __LINE__
                           << " Batch server was terminated while client was waiting: sending client quit message\n";
@@ -290,6 +370,10 @@ namespace geopm
                 case BatchStatus::M_MESSAGE_TERMINATE:
                     out_message = BatchStatus::M_MESSAGE_TERMINATE;
                     break;
+                case BatchStatus::M_MESSAGE_DOORBELL:
+                    // Reply is sent by accept_doorbell()
+                    accept_doorbell();
+                    continue;
                 default:
                     throw Exception("BatchServerImp::run_batch(): Received unknown response from client: " +
                                     std::to_string(in_message), GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
@@ -302,6 +386,71 @@ namespace geopm
         }
     }
 
+    void BatchServerImp::start_sampler(void)
+    {
+        if (m_snapshot == nullptr) {
+            return;
+        }
+        // Publish the first sample before accepting requests
+        read_and_update();
+        m_is_sampler_stopped = false;
+        // Only the event loop thread may be interrupted by SIGTERM
+        sigset_t block_set;
+        sigset_t orig_set;
+        sigemptyset(&block_set);
+        sigaddset(&block_set, SIGTERM);
+        int err = pthread_sigmask(SIG_BLOCK, &block_set, &orig_set);
+        if (err == 0) {
+            m_sampler_thread = std::thread(&BatchServerImp::sampler_loop, this);
+            err = pthread_sigmask(SIG_SETMASK, &orig_set, nullptr);
+        }
+        if (err != 0) {
+            throw Exception("BatchServerImp::start_sampler(): System call failed: pthread_sigmask(3)",
+                            err, __FILE__, __LINE__);
+        }
+    }
+
+    void BatchServerImp::stop_sampler(void)
+    {
+        if (m_sampler_thread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(m_sampler_mutex);
+                m_is_sampler_stopped = true;
+            }
+            m_sampler_cv.notify_all();
+            m_sampler_thread.join();
+        }
+        if (m_snapshot != nullptr && m_signal_shmem != nullptr) {
+            m_signal_shmem->unlink();
+        }
+    }
+
+    void BatchServerImp::sampler_loop(void)
+    {
+        auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(m_sample_period));
+        auto deadline = std::chrono::steady_clock::now() + period;
+        std::unique_lock<std::mutex> lock(m_sampler_mutex);
+        while (!m_sampler_cv.wait_until(lock, deadline,
+                                        [this]() { return m_is_sampler_stopped; })) {
+            lock.unlock();
+            try {
+                read_and_update();
+            }
+            catch (const Exception &ex) {
+                std::cerr << "Warning: <geopm>: " << __FILE__ << ":" << __LINE__
+                          << " Batch server failed to sample signals: " << ex.what() << "\n";
+            }
+            lock.lock();
+            deadline += period;
+            auto now = std::chrono::steady_clock::now();
+            if (deadline < now) {
+                // Skip samples that were missed rather than bursting
+                deadline = now + period;
+            }
+        }
+    }
+
     bool BatchServerImp::is_active(void)
     {
         if (g_sigchld_count != 0) {
@@ -344,13 +493,19 @@ namespace geopm
             return;
         }
 
+        std::lock_guard<std::mutex> lock(m_pio_mutex);
         m_pio.read_batch();
+        geopm_time_s sample_time;
+        geopm_time(&sample_time);
         double *shmem_buffer = (double *)m_signal_shmem->pointer();
         int buffer_idx = 0;
         for (const auto &handle : m_signal_handle) {
             shmem_buffer[buffer_idx] = m_pio.sample(handle);
             ++buffer_idx;
         }
+        if (m_snapshot != nullptr) {
+            m_snapshot->publish(shmem_buffer, sample_time);
+        }
     }
 
     void BatchServerImp::update_and_write(void)
@@ -359,6 +514,7 @@ namespace geopm
             return;
         }
 
+        std::lock_guard<std::mutex> lock(m_pio_mutex);
         double *shmem_buffer = (double *)m_control_shmem->pointer();
         int buffer_idx = 0;
         for (const auto &handle : m_control_handle) {
@@ -371,8 +527,22 @@ namespace geopm
     void BatchServerImp::create_shmem(void)
     {
         // Create shared memory regions
-        size_t signal_size  = m_signal_config.size()  * sizeof(double);
-        size_t control_size = m_control_config.size() * sizeof(double);
+        size_t signal_data_size  = m_signal_config.size()  * sizeof(double);
+        size_t control_data_size = m_control_config.size() * sizeof(double);
+        size_t signal_size  = signal_data_size;
+        size_t control_size = control_data_size;
+        if (m_sample_period != 0.0) {
+            signal_size = BatchSnapshot::region_size(signal_data_size,
+                                                     m_signal_config.size());
+        }
+        // The doorbell follows the values in the first region created
+        size_t doorbell_data_size = signal_size;
+        if (m_is_doorbell && signal_size != 0) {
+            signal_size = BatchStatusDoorbell::region_size(doorbell_data_size);
+        }
+        else if (m_is_doorbell) {
+            control_size = BatchStatusDoorbell::region_size(control_data_size);
+        }
         int uid = pid_to_uid(m_client_pid);
         int gid = pid_to_gid(m_client_pid);
         if (signal_size != 0) {
@@ -380,6 +550,11 @@ namespace geopm
                 m_signal_shmem_key, signal_size);
             // Requires a chown if server is different user than client
             m_signal_shmem->chown(uid, gid);
+            if (m_sample_period != 0.0) {
+                m_snapshot = std::make_shared<BatchSnapshot>(
+                    m_signal_shmem, signal_data_size, m_signal_config.size(),
+                    m_sample_period, true);
+            }
         }
         if (control_size != 0) {
             m_control_shmem = SharedMemory::make_unique_owner_secure(
@@ -387,6 +562,13 @@ namespace geopm
             // Requires a chown if server is different user than client
             m_control_shmem->chown(uid, gid);
         }
+        if (m_is_doorbell) {
+            bool is_signal = signal_data_size != 0;
+            m_doorbell_status = std::make_shared<BatchStatusDoorbell>(
+                is_signal ? m_signal_shmem : m_control_shmem,
+                is_signal ? doorbell_data_size : control_data_size,
+                true, m_client_pid, BatchStatusDoorbell::spin_count_env());
+        }
     }
 
     void BatchServerImp::child_register_handler(void)
@@ -6,7 +6,10 @@
 #ifndef BATCHSERVER_HPP_INCLUDE
 #define BATCHSERVER_HPP_INCLUDE
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <string>
 #include <functional>
@@ -20,6 +23,7 @@ namespace geopm
     class PlatformIO;
     class SharedMemory;
     class BatchStatus;
+    class BatchSnapshot;
     class POSIXSignal;
 
     class BatchServer
@@ -68,6 +72,31 @@ namespace geopm
             static std::unique_ptr<BatchServer> make_unique(int client_pid,
                                                             const std::vector<geopm_request_s> &signal_config,
                                                             const std::vector<geopm_request_s> &control_config);
+            /// @brief Start a batch server that samples the signals
+            ///        periodically rather than on client request.
+            ///
+            /// The server reads all signals every sample_period
+            /// seconds and publishes them in the signal shared memory
+            /// region under a sequence lock with a timestamp and
+            /// generation counter.  Clients read the latest values
+            /// from shared memory without sending a message to the
+            /// server, so any number of clients may read them.
+            /// Controls are written on client request as with the
+            /// other factory method.
+            ///
+            /// @param [in] client_pid The Unix process ID of the
+            ///        client process that is initiating the batch
+            ///        server.
+            /// @param [in] signal_config A vector of requests for
+            ///        signals to be sampled.
+            /// @param [in] control_config Avector of requests for
+            ///        controls to be adjusted.
+            /// @param [in] sample_period Interval in seconds between
+            ///        samples, or zero to sample on client request.
+            static std::unique_ptr<BatchServer> make_unique(int client_pid,
+                                                            const std::vector<geopm_request_s> &signal_config,
+                                                            const std::vector<geopm_request_s> &control_config,
+                                                            double sample_period);
             /// @return The shm key to use for the signal shared memory
             ///         region.
             static std::string get_signal_shmem_key(
@@ -104,6 +133,10 @@ namespace geopm
             BatchServerImp(int client_pid,
                            const std::vector<geopm_request_s> &signal_config,
                            const std::vector<geopm_request_s> &control_config);
+            BatchServerImp(int client_pid,
+                           const std::vector<geopm_request_s> &signal_config,
+                           const std::vector<geopm_request_s> &control_config,
+                           double sample_period);
             BatchServerImp(int client_pid,
                            const std::vector<geopm_request_s> &signal_config,
                            const std::vector<geopm_request_s> &control_config,
@@ -115,6 +148,18 @@ namespace geopm
                            std::shared_ptr<SharedMemory> signal_shmem,
                            std::shared_ptr<SharedMemory> control_shmem,
                            int server_pid);
+            BatchServerImp(int client_pid,
+                           const std::vector<geopm_request_s> &signal_config,
+                           const std::vector<geopm_request_s> &control_config,
+                           const std::string &signal_shmem_key,
+                           const std::string &control_shmem_key,
+                           PlatformIO &pio,
+                           std::shared_ptr<BatchStatus> batch_status,
+                           std::shared_ptr<POSIXSignal> posix_signal,
+                           std::shared_ptr<SharedMemory> signal_shmem,
+                           std::shared_ptr<SharedMemory> control_shmem,
+                           int server_pid,
+                           double sample_period);
             BatchServerImp(const BatchServerImp &other) = delete;
             BatchServerImp &operator=(const BatchServerImp &other) = delete;
             virtual ~BatchServerImp();
@@ -139,7 +184,11 @@ namespace geopm
             void check_return(int ret, const std::string &func_name) const;
             char read_message(void);
             void write_message(char message);
+            void accept_doorbell(void);
             void event_loop(void);
+            void start_sampler(void);
+            void stop_sampler(void);
+            void sampler_loop(void);
 
             const int m_client_pid;
             const std::string m_server_key;
@@ -150,7 +199,13 @@ namespace geopm
             PlatformIO &m_pio;
             std::shared_ptr<SharedMemory> m_signal_shmem;
             std::shared_ptr<SharedMemory> m_control_shmem;
+            /// @brief True if the server offers a doorbell in shared
+            ///        memory in addition to the FIFOs
+            bool m_is_doorbell;
             std::shared_ptr<BatchStatus> m_batch_status;
+            /// @brief Doorbell channel that replaces m_batch_status
+            ///        once the client requests it
+            std::shared_ptr<BatchStatus> m_doorbell_status;
             std::shared_ptr<POSIXSignal> m_posix_signal;
             int m_server_pid;
             bool m_is_active;
@@ -162,6 +217,18 @@ namespace geopm
             /// @brief Stores the PlatformIO batch handles for all pushed
             ///        controls
             std::vector<int> m_control_handle;
+            /// @brief Interval between samples published by the
+            ///        server, or zero if signals are read on request
+            const double m_sample_period;
+            /// @brief Published signal values if sampling periodically
+            std::shared_ptr<BatchSnapshot> m_snapshot;
+            /// @brief Serializes PlatformIO access between the sampler
+            ///        thread and the event loop
+            std::mutex m_pio_mutex;
+            std::mutex m_sampler_mutex;
+            std::condition_variable m_sampler_cv;
+            bool m_is_sampler_stopped;
+            std::thread m_sampler_thread;
     };
 }
 
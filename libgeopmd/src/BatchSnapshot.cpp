@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "BatchSnapshot.hpp"
+
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include "geopm/Exception.hpp"
+#include "geopm/SharedMemory.hpp"
+
+namespace geopm
+{
+    BatchSnapshot::BatchSnapshot(std::shared_ptr<SharedMemory> shmem,
+                                 size_t data_size,
+                                 int num_signal,
+                                 double sample_period,
+                                 bool is_server)
+        : m_shmem(std::move(shmem))
+        , m_header(nullptr)
+        , m_values(nullptr)
+        , m_num_signal(num_signal)
+    {
+        if (m_shmem == nullptr ||
+            m_shmem->size() < region_size(data_size, num_signal)) {
+            throw Exception("BatchSnapshot: Shared memory region is too small for snapshot",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        char *snapshot_ptr = (char *)m_shmem->pointer() + snapshot_offset(data_size);
+        if (is_server) {
+            if (!(sample_period > 0.0)) {
+                throw Exception("BatchSnapshot: Sample period must be positive",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            m_header = new (snapshot_ptr) m_header_s {};
+            m_header->num_signal = num_signal;
+            m_header->sample_period = sample_period;
+            m_header->sequence.store(0);
+            m_header->generation = 0;
+            m_header->magic = M_MAGIC;
+        }
+        else {
+            if (!is_present(*m_shmem, data_size)) {
+                throw Exception("BatchSnapshot: Shared memory region does not contain a snapshot",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            m_header = reinterpret_cast<m_header_s *>(snapshot_ptr);
+            if (m_header->num_signal != num_signal) {
+                throw Exception("BatchSnapshot: Number of signals does not match server: " +
+                                std::to_string(m_header->num_signal),
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
+        m_values = reinterpret_cast<double *>(snapshot_ptr + sizeof(m_header_s));
+    }
+
+    void BatchSnapshot::publish(const double *values, const geopm_time_s &time)
+    {
+        // An odd sequence number marks an update in progress
+        uint64_t sequence = m_header->sequence.load(std::memory_order_relaxed);
+        m_header->sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(m_values, values, m_num_signal * sizeof(double));
+        m_header->time = time;
+        ++(m_header->generation);
+        m_header->sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    uint64_t BatchSnapshot::read(std::vector<double> &values, geopm_time_s &time) const
+    {
+        values.resize(m_num_signal);
+        uint64_t generation = 0;
+        geopm_time_s wait_begin {{0, 0}};
+        bool is_waiting = false;
+        while (true) {
+            uint64_t sequence = m_header->sequence.load(std::memory_order_acquire);
+            if ((sequence & 1ULL) == 0) {
+                std::memcpy(values.data(), m_values, m_num_signal * sizeof(double));
+                time = m_header->time;
+                generation = m_header->generation;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sequence == m_header->sequence.load(std::memory_order_relaxed)) {
+                    if (generation != 0) {
+                        break;
+                    }
+                    // Nothing has been published yet
+                    if (!is_waiting) {
+                        geopm_time(&wait_begin);
+                        is_waiting = true;
+                    }
+                    else if (geopm_time_since(&wait_begin) > M_FIRST_SAMPLE_TIMEOUT) {
+                        throw Exception("BatchSnapshot::read(): Timed out waiting for first sample",
+                                        GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+                    }
+                }
+            }
+            std::this_thread::yield();
+        }
+        return generation;
+    }
+
+    double BatchSnapshot::sample_period(void) const
+    {
+        return m_header->sample_period;
+    }
+
+    size_t BatchSnapshot::snapshot_offset(size_t data_size)
+    {
+        size_t align = sizeof(m_header_s);
+        return ((data_size + align - 1) / align) * align;
+    }
+
+    size_t BatchSnapshot::region_size(size_t data_size, int num_signal)
+    {
+        return snapshot_offset(data_size) + sizeof(m_header_s) +
+               num_signal * sizeof(double);
+    }
+
+    bool BatchSnapshot::is_present(const SharedMemory &shmem, size_t data_size)
+    {
+        if (shmem.size() < snapshot_offset(data_size) + sizeof(m_header_s)) {
+            return false;
+        }
+        const m_header_s *header = reinterpret_cast<const m_header_s *>(
+            (const char *)shmem.pointer() + snapshot_offset(data_size));
+        return header->magic == M_MAGIC &&
+               shmem.size() >= region_size(data_size, header->num_signal);
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BATCHSNAPSHOT_HPP_INCLUDE
+#define BATCHSNAPSHOT_HPP_INCLUDE
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "geopm_time.h"
+
+namespace geopm
+{
+    class SharedMemory;
+
+    /// @brief Copy of all batch server signal values stored in shared
+    ///        memory and protected by a sequence lock.
+    ///
+    /// A batch server that samples on its own schedule publishes each
+    /// set of values with a timestamp and a generation counter.  Any
+    /// number of clients may read the latest set of values without
+    /// communicating with the server.  The snapshot is placed in the
+    /// signal shared memory region after the signal values, aligned
+    /// to a cache line.
+    class BatchSnapshot
+    {
+        public:
+            /// @brief Attach to or create a snapshot.
+            ///
+            /// @param shmem [in] Shared memory region holding the
+            ///        snapshot.
+            /// @param data_size [in] Number of bytes that precede the
+            ///        snapshot in the region.
+            /// @param num_signal [in] Number of signal values.
+            /// @param sample_period [in] Interval in seconds between
+            ///        samples published by the server.  Only used if
+            ///        is_server is true.
+            /// @param is_server [in] If true the snapshot is
+            ///        initialized, otherwise it must have been
+            ///        initialized by a server with num_signal values.
+            BatchSnapshot(std::shared_ptr<SharedMemory> shmem,
+                          size_t data_size,
+                          int num_signal,
+                          double sample_period,
+                          bool is_server);
+            BatchSnapshot(const BatchSnapshot &other) = delete;
+            BatchSnapshot &operator=(const BatchSnapshot &other) = delete;
+            virtual ~BatchSnapshot() = default;
+            /// @brief Publish a new set of signal values.  Only one
+            ///        process may publish.
+            ///
+            /// @param values [in] Array of num_signal values.
+            /// @param time [in] Time when the values were read.
+            void publish(const double *values, const geopm_time_s &time);
+            /// @brief Copy the latest published values.
+            ///
+            /// Waits for the first set of values to be published if
+            /// none have been yet.
+            ///
+            /// @param values [out] Resized to num_signal and filled
+            ///        with the latest values.
+            /// @param time [out] Time when the values were read.
+            /// @return Generation of the values: one for the first
+            ///         published set and incremented by one for each
+            ///         subsequent set.
+            uint64_t read(std::vector<double> &values, geopm_time_s &time) const;
+            /// @brief Sampling interval in seconds used by the server.
+            double sample_period(void) const;
+            /// @brief Number of bytes to allocate for a snapshot of
+            ///        num_signal values that follows data_size bytes.
+            static size_t region_size(size_t data_size, int num_signal);
+            /// @brief Returns true if the shared memory region holds
+            ///        an initialized snapshot after data_size bytes.
+            static bool is_present(const SharedMemory &shmem, size_t data_size);
+        private:
+            static constexpr uint32_t M_MAGIC = 0x67656273; // "gebs"
+            static constexpr double M_FIRST_SAMPLE_TIMEOUT = 5.0;
+
+            struct m_header_s {
+                uint32_t magic;
+                int32_t num_signal;
+                double sample_period;
+                std::atomic<uint64_t> sequence;
+                uint64_t generation;
+                geopm_time_s time;
+                char padding[16];
+            };
+            static_assert(sizeof(m_header_s) == 64, "Snapshot header must fill one cache line");
+            static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                          "Snapshot requires lock free atomics to be shared between processes");
+
+            static size_t snapshot_offset(size_t data_size);
+
+            std::shared_ptr<SharedMemory> m_shmem;
+            m_header_s *m_header;
+            double *m_values;
+            int m_num_signal;
+    };
+}
+
+#endif
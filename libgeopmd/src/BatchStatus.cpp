@@ -9,13 +9,21 @@
 
 #include "geopm/Exception.hpp"
 #include "geopm/Helper.hpp"
+#include "geopm/SharedMemory.hpp"
 
 #include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <new>
 #include <sstream>
 #include <unistd.h>
+#include <signal.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <fcntl.h>
+#include <linux/futex.h>
+#include <time.h>
 
 namespace geopm
 {
@@ -38,6 +46,42 @@ namespace geopm
         return geopm::make_unique<BatchStatusClient>(server_key);
     }
 
+    std::unique_ptr<BatchStatus>
+    BatchStatus::make_unique_client(const std::string &server_key,
+                                    std::shared_ptr<SharedMemory> shmem,
+                                    size_t data_size)
+    {
+        return negotiate_client(geopm::make_unique<BatchStatusClient>(server_key),
+                                std::move(shmem), data_size);
+    }
+
+    std::unique_ptr<BatchStatus>
+    BatchStatus::negotiate_client(std::unique_ptr<BatchStatus> fifo_status,
+                                  std::shared_ptr<SharedMemory> shmem,
+                                  size_t data_size)
+    {
+        if (shmem == nullptr ||
+            std::getenv("GEOPM_DISABLE_BATCH_DOORBELL") != nullptr ||
+            !BatchStatusDoorbell::is_present(*shmem, data_size)) {
+            return fifo_status;
+        }
+        fifo_status->send_message(M_MESSAGE_DOORBELL);
+        char reply = fifo_status->receive_message();
+        if (reply == M_MESSAGE_DOORBELL) {
+            return geopm::make_unique<BatchStatusDoorbell>(
+                shmem, data_size, false, 0, BatchStatusDoorbell::spin_count_env());
+        }
+        if (reply != M_MESSAGE_CONTINUE) {
+            std::ostringstream error_message;
+            error_message << "BatchStatus::negotiate_client(): "
+                          << "Unexpected reply to doorbell request: \""
+                          << reply << "\"";
+            throw Exception(error_message.str(), GEOPM_ERROR_RUNTIME,
+                            __FILE__, __LINE__);
+        }
+        return fifo_status;
+    }
+
     /***********************************
      * Members of class BatchStatusImp *
      ***********************************/
@@ -190,4 +234,175 @@ namespace geopm
             check_return(m_write_fd, "open(2)");
         }
     }
+
+    /****************************************
+     * Members of class BatchStatusDoorbell *
+     ****************************************/
+
+    BatchStatusDoorbell::BatchStatusDoorbell(std::shared_ptr<SharedMemory> shmem,
+                                             size_t data_size,
+                                             bool is_server,
+                                             int client_pid,
+                                             int spin_count)
+        : m_shmem(std::move(shmem))
+        , m_doorbell(nullptr)
+        , m_send_word(nullptr)
+        , m_receive_word(nullptr)
+        , m_other_pid(0)
+        , m_spin_count(spin_count)
+        , m_send_sequence(0)
+        , m_receive_sequence(0)
+    {
+        if (m_shmem == nullptr ||
+            m_shmem->size() < region_size(data_size)) {
+            throw Exception("BatchStatusDoorbell: Shared memory region is too small for doorbell",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        void *doorbell_ptr = (char *)m_shmem->pointer() + doorbell_offset(data_size);
+        if (is_server) {
+            m_doorbell = new (doorbell_ptr) m_doorbell_s {};
+            m_doorbell->server_pid = getpid();
+            m_doorbell->client_pid = client_pid;
+            m_doorbell->to_server.store(0);
+            m_doorbell->to_client.store(0);
+            m_doorbell->magic = M_MAGIC;
+            m_send_word = &m_doorbell->to_client;
+            m_receive_word = &m_doorbell->to_server;
+            m_other_pid = client_pid;
+        }
+        else {
+            if (!is_present(*m_shmem, data_size)) {
+                throw Exception("BatchStatusDoorbell: Shared memory region does not contain a doorbell",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            m_doorbell = static_cast<m_doorbell_s *>(doorbell_ptr);
+            m_send_word = &m_doorbell->to_server;
+            m_receive_word = &m_doorbell->to_client;
+            m_other_pid = m_doorbell->server_pid;
+        }
+        m_send_sequence = m_send_word->load() & ~(M_MESSAGE_MASK | M_SLEEP_BIT);
+        m_receive_sequence = m_receive_word->load() & ~(M_MESSAGE_MASK | M_SLEEP_BIT);
+    }
+
+    void BatchStatusDoorbell::send_message(char msg)
+    {
+        m_send_sequence += M_SEQUENCE_INC;
+        uint32_t word = m_send_sequence | ((uint32_t)(unsigned char)msg);
+        uint32_t old_word = m_send_word->exchange(word);
+        if (old_word & M_SLEEP_BIT) {
+            long ret = syscall(SYS_futex, m_send_word, FUTEX_WAKE, 1,
+                               nullptr, nullptr, 0);
+            if (ret == -1) {
+                throw Exception("BatchStatusDoorbell: System call failed: futex(2)",
+                                errno ? errno : GEOPM_ERROR_RUNTIME,
+                                __FILE__, __LINE__);
+            }
+        }
+    }
+
+    char BatchStatusDoorbell::receive_message(void)
+    {
+        const uint32_t seq_mask = ~(M_MESSAGE_MASK | M_SLEEP_BIT);
+        struct timespec timeout = {(time_t)M_WAIT_TIMEOUT,
+                                   (long)(std::fmod(M_WAIT_TIMEOUT, 1.0) * 1e9)};
+        int spin_idx = 0;
+        uint32_t word = m_receive_word->load();
+        while ((word & seq_mask) == m_receive_sequence) {
+            if (spin_idx < m_spin_count) {
+                ++spin_idx;
+                word = m_receive_word->load();
+                continue;
+            }
+            if ((word & M_SLEEP_BIT) == 0) {
+                // Tell the sender to wake us; retry if a message
+                // arrived in the meantime.
+                if (!m_receive_word->compare_exchange_strong(word, word | M_SLEEP_BIT)) {
+                    continue;
+                }
+                word |= M_SLEEP_BIT;
+            }
+            long ret = syscall(SYS_futex, m_receive_word, FUTEX_WAIT, word,
+                               &timeout, nullptr, 0);
+            if (ret == -1) {
+                int err = errno;
+                if (err == ETIMEDOUT) {
+                    if (!is_other_alive()) {
+                        return '\0';
+                    }
+                }
+                else if (err != EAGAIN) {
+                    // EINTR is reported to the caller so that
+                    // termination signals are handled as with a FIFO.
+                    throw Exception("BatchStatusDoorbell: System call failed: futex(2)",
+                                    err ? err : GEOPM_ERROR_RUNTIME,
+                                    __FILE__, __LINE__);
+                }
+            }
+            word = m_receive_word->load();
+        }
+        m_receive_sequence = word & seq_mask;
+        return (char)(word & M_MESSAGE_MASK);
+    }
+
+    void BatchStatusDoorbell::receive_message(char expect)
+    {
+        char actual = receive_message();
+        if (actual != expect) {
+            std::ostringstream error_message;
+            error_message << "BatchStatusDoorbell::receive_message(): "
+                          << "Expected message: \"" << expect
+                          << "\" but received \"" <<   actual << "\"";
+            throw Exception(error_message.str(), GEOPM_ERROR_RUNTIME,
+                            __FILE__, __LINE__);
+        }
+    }
+
+    size_t BatchStatusDoorbell::doorbell_offset(size_t data_size)
+    {
+        size_t align = alignof(m_doorbell_s) > 64 ? alignof(m_doorbell_s) : 64;
+        return ((data_size + align - 1) / align) * align;
+    }
+
+    size_t BatchStatusDoorbell::region_size(size_t data_size)
+    {
+        return doorbell_offset(data_size) + sizeof(m_doorbell_s);
+    }
+
+    bool BatchStatusDoorbell::is_present(const SharedMemory &shmem, size_t data_size)
+    {
+        if (shmem.size() < region_size(data_size)) {
+            return false;
+        }
+        const m_doorbell_s *doorbell = reinterpret_cast<const m_doorbell_s *>(
+            (const char *)shmem.pointer() + doorbell_offset(data_size));
+        return doorbell->magic == M_MAGIC;
+    }
+
+    int BatchStatusDoorbell::spin_count_env(void)
+    {
+        int result = 0;
+        std::string spin_str = get_env("GEOPM_BATCH_SPIN_COUNT");
+        if (!spin_str.empty()) {
+            try {
+                result = std::stoi(spin_str);
+            }
+            catch (const std::exception &) {
+                result = -1;
+            }
+            if (result < 0) {
+                throw Exception("BatchStatusDoorbell: GEOPM_BATCH_SPIN_COUNT must be a non-negative integer: " +
+                                spin_str, GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
+        return result;
+    }
+
+    bool BatchStatusDoorbell::is_other_alive(void) const
+    {
+        // The server typically runs as a different user than the
+        // client, so EPERM also means the process exists.
+        return m_other_pid <= 0 ||
+               kill(m_other_pid, 0) == 0 ||
+               errno != ESRCH;
+    }
 }
@@ -6,6 +6,9 @@
 #ifndef BATCHSTATUS_HPP_INCLUDE
 #define BATCHSTATUS_HPP_INCLUDE
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <unordered_map>
@@ -14,6 +17,8 @@
 
 namespace geopm
 {
+    class SharedMemory;
+
     class BatchStatus
     {
         public:
@@ -22,6 +27,7 @@ namespace geopm
             static constexpr char M_MESSAGE_CONTINUE = 'c';
             static constexpr char M_MESSAGE_QUIT = 'q';
             static constexpr char M_MESSAGE_TERMINATE = 't';
+            static constexpr char M_MESSAGE_DOORBELL = 'd';
 
             BatchStatus() = default;
             virtual ~BatchStatus() = default;
@@ -30,6 +36,42 @@ namespace geopm
                 const std::string &server_key);
             static std::unique_ptr<BatchStatus> make_unique_client(
                 const std::string &server_key);
+            /// @brief Create the client side of the message channel
+            ///        and negotiate the protocol with the server.
+            ///
+            /// Calls negotiate_client() with a named FIFO client.
+            ///
+            /// @param server_key [in] Key used to create the server.
+            /// @param shmem [in] The first shared memory region
+            ///        created by the server: the signal region if
+            ///        there are any signals, otherwise the control
+            ///        region.  May be nullptr.
+            /// @param data_size [in] Number of bytes of signal or
+            ///        control values in the shmem region.
+            static std::unique_ptr<BatchStatus> make_unique_client(
+                const std::string &server_key,
+                std::shared_ptr<SharedMemory> shmem,
+                size_t data_size);
+            /// @brief Request the doorbell from the server over the
+            ///        named FIFO channel.
+            ///
+            /// If the server placed a doorbell after the data in the
+            /// shared memory region and GEOPM_DISABLE_BATCH_DOORBELL
+            /// is not set, the M_MESSAGE_DOORBELL message is sent.
+            /// If the server confirms with the same message, a
+            /// BatchStatusDoorbell is returned.  Otherwise the FIFO
+            /// channel is returned.
+            ///
+            /// @param fifo_status [in] Client end of the named FIFO
+            ///        channel.
+            /// @param shmem [in] Shared memory region that may hold
+            ///        the doorbell.  May be nullptr.
+            /// @param data_size [in] Number of bytes of signal or
+            ///        control values in the shmem region.
+            static std::unique_ptr<BatchStatus> negotiate_client(
+                std::unique_ptr<BatchStatus> fifo_status,
+                std::shared_ptr<SharedMemory> shmem,
+                size_t data_size);
 
             /// @brief Send an integer to the other process
             ///
@@ -108,6 +150,91 @@ namespace geopm
             std::string m_read_fifo_path;
             std::string m_write_fifo_path;
     };
+
+    /// @brief Message channel that uses futex based doorbells stored
+    ///        in a shared memory region rather than named FIFOs.
+    ///
+    /// The doorbell is placed in the shared memory region after the
+    /// signal or control values, aligned to a cache line.  Each
+    /// direction of communication uses one 32-bit word that holds the
+    /// last message character, a sequence number, and a flag that is
+    /// set when the receiver is sleeping in futex(2).  A sender only
+    /// makes a system call when the receiver is asleep.  A receiver
+    /// polls the word for a bounded number of iterations before
+    /// sleeping.  While asleep the receiver periodically checks that
+    /// the other process is still alive and reports the message
+    /// '\0' if it is not, as a FIFO reports end of file.
+    class BatchStatusDoorbell : public BatchStatus
+    {
+        public:
+            /// @brief Construct one end of the channel.
+            ///
+            /// @param shmem [in] Shared memory region containing the
+            ///        doorbell.
+            /// @param data_size [in] Number of bytes used by signal or
+            ///        control values at the start of the region.
+            /// @param is_server [in] If true the doorbell is
+            ///        initialized and this object acts as the server,
+            ///        otherwise the doorbell must already have been
+            ///        initialized by a server.
+            /// @param client_pid [in] Process ID of the client, only
+            ///        used by the server.
+            /// @param spin_count [in] Number of times to poll for a
+            ///        message before sleeping.
+            BatchStatusDoorbell(std::shared_ptr<SharedMemory> shmem,
+                                size_t data_size,
+                                bool is_server,
+                                int client_pid,
+                                int spin_count);
+            BatchStatusDoorbell(const BatchStatusDoorbell &other) = delete;
+            BatchStatusDoorbell &operator=(const BatchStatusDoorbell &other) = delete;
+            virtual ~BatchStatusDoorbell() = default;
+            void send_message(char msg) override;
+            char receive_message(void) override;
+            void receive_message(char expect) override;
+
+            /// @brief Number of bytes to allocate for a shared memory
+            ///        region holding data_size bytes of values and a
+            ///        doorbell.
+            static size_t region_size(size_t data_size);
+            /// @brief Returns true if the shared memory region holds
+            ///        an initialized doorbell after data_size bytes.
+            static bool is_present(const SharedMemory &shmem, size_t data_size);
+            /// @brief Number of polling iterations configured through
+            ///        the GEOPM_BATCH_SPIN_COUNT environment variable.
+            static int spin_count_env(void);
+        private:
+            static constexpr uint32_t M_MAGIC = 0x67656462; // "gedb"
+            static constexpr uint32_t M_MESSAGE_MASK = 0xFF;
+            static constexpr uint32_t M_SLEEP_BIT = 0x100;
+            static constexpr uint32_t M_SEQUENCE_INC = 0x200;
+            static constexpr double M_WAIT_TIMEOUT = 1.0;
+
+            struct m_doorbell_s {
+                uint32_t magic;
+                int32_t server_pid;
+                int32_t client_pid;
+                char padding0[52];
+                std::atomic<uint32_t> to_server;
+                char padding1[60];
+                std::atomic<uint32_t> to_client;
+                char padding2[60];
+            };
+            static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                          "Doorbell requires lock free atomics to be shared between processes");
+
+            static size_t doorbell_offset(size_t data_size);
+            bool is_other_alive(void) const;
+
+            std::shared_ptr<SharedMemory> m_shmem;
+            m_doorbell_s *m_doorbell;
+            std::atomic<uint32_t> *m_send_word;
+            std::atomic<uint32_t> *m_receive_word;
+            int m_other_pid;
+            const int m_spin_count;
+            uint32_t m_send_sequence;
+            uint32_t m_receive_sequence;
+    };
 }
 
 #endif
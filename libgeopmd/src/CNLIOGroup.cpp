@@ -5,12 +5,14 @@
 
 #include "CNLIOGroup.hpp"
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <cerrno>
 #include <cmath>
 #include <cstring>
-#include <fstream>
 #include <functional>
-#include <iterator>
 #include <limits>
 
 #include "geopm/Agg.hpp"
@@ -19,112 +21,113 @@
 #include "geopm/PlatformTopo.hpp"
 
 
+
 namespace geopm
 {
     static const std::string FRESHNESS_FILE_NAME("freshness");
     static const std::string RAW_SCAN_HZ_FILE_NAME("raw_scan_hz");
 
-    static std::function<double()> get_formatted_file_reader(const std::string &path,
-                                                             const std::string &units)
-    {
-        return std::bind(read_double_from_file, path, units);
-    }
-
     CNLIOGroup::CNLIOGroup()
         : CNLIOGroup("/sys/cray/pm_counters")
     {
     }
 
     CNLIOGroup::CNLIOGroup(const std::string &cpu_info_path)
-        : m_signal_available({{"CNL::BOARD_POWER", {
+        : CNLIOGroup(cpu_info_path, nullptr)
+    {
+    }
+
+    CNLIOGroup::CNLIOGroup(const std::string &cpu_info_path,
+                           std::shared_ptr<IOUring> batch_reader)
+        : m_freshness_file_idx(-1)
+        , m_is_batch_read(false)
+        , m_last_freshness(NAN)
+        , m_time_zero(geopm::time_zero())
+        , m_initial_freshness(NAN)
+        , m_sample_rate(NAN)
+        , m_batch_reader(std::move(batch_reader))
+    {
+        m_sample_rate = read_double_from_file(
+            cpu_info_path + "/" + RAW_SCAN_HZ_FILE_NAME, "");
+        if (m_sample_rate <= 0) {
+            throw Exception("CNLIOGroup::CNLIOGroup(): Unexpected sample frequency " +
+                                std::to_string(m_sample_rate),
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        m_freshness_file_idx = open_file(cpu_info_path + "/" + FRESHNESS_FILE_NAME, "");
+        m_initial_freshness = read_file_value(m_freshness_file_idx);
+
+        auto identity = [](double value) { return value; };
+        m_signal_available = {{"CNL::BOARD_POWER", {
                                    "Point in time power",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/power", "W"),
-                                   false,
-                                   NAN,
+                                   open_file(cpu_info_path + "/power", "W"),
+                                   identity,
                                    M_UNITS_WATTS,
                                    IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE}},
                               {"CNL::BOARD_ENERGY", {
                                    "Accumulated energy",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/energy", "J"),
-                                   false,
-                                   NAN,
+                                   open_file(cpu_info_path + "/energy", "J"),
+                                   identity,
                                    M_UNITS_JOULES,
                                    IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE}},
                               {"CNL::MEMORY_POWER", {
                                    "Point in time memory power",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/memory_power", "W"),
-                                   false,
-                                   NAN,
+                                   open_file(cpu_info_path + "/memory_power", "W"),
+                                   identity,
                                    M_UNITS_WATTS,
                                    IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE}},
                               {"CNL::MEMORY_ENERGY", {
                                    "Accumulated memory energy",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/memory_energy", "J"),
-                                   false,
-                                   NAN,
+                                   open_file(cpu_info_path + "/memory_energy", "J"),
+                                   identity,
                                    M_UNITS_JOULES,
                                    IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE}},
                               {"CNL::BOARD_POWER_CPU", {
                                    "Point in time CPU power",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/cpu_power", "W"),
-                                   false,
-                                   NAN,
+                                   open_file(cpu_info_path + "/cpu_power", "W"),
+                                   identity,
                                    M_UNITS_WATTS,
                                    IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE}},
                               {"CNL::BOARD_ENERGY_CPU", {
                                    "Accumulated CPU energy",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/cpu_energy", "J"),
-                                   false,
-                                   NAN,
+                                   open_file(cpu_info_path + "/cpu_energy", "J"),
+                                   identity,
                                    M_UNITS_JOULES,
                                    IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE}},
                               {"CNL::SAMPLE_RATE", {
                                    "Sample frequency",
                                    Agg::expect_same,
                                    string_format_integer,
-                                   std::bind(&CNLIOGroup::m_sample_rate, this),
-                                   false,
-                                   NAN,
+                                   -1,
+                                   [this](double) { return m_sample_rate; },
                                    M_UNITS_HERTZ,
                                    IOGroup::M_SIGNAL_BEHAVIOR_CONSTANT}},
                               {"CNL::SAMPLE_ELAPSED_TIME", {
                                    "Time that the sample was reported, in seconds since this agent initialized",
                                    Agg::max,
                                    string_format_double,
-                                   std::bind(&CNLIOGroup::read_time, this, cpu_info_path + "/" + FRESHNESS_FILE_NAME),
-                                   false,
-                                   NAN,
+                                   m_freshness_file_idx,
+                                   [this](double freshness) { return read_time(freshness); },
                                    M_UNITS_SECONDS,
                                    IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE}},
-                             })
-        , m_time_zero(geopm::time_zero())
-    {
-        m_sample_rate = read_double_from_file(
-            cpu_info_path + "/" + RAW_SCAN_HZ_FILE_NAME, "");
-        if (m_sample_rate <= 0) {
-            throw Exception("CNLIOGroup::CNLIOGroup(): Unexpected sample frequency " +
-                                std::to_string(m_sample_rate),
-                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
-        }
-        m_initial_freshness =
-            read_double_from_file(cpu_info_path + "/" + FRESHNESS_FILE_NAME, "");
+                             };
 
-        for (const auto &signal : m_signal_available) {
-            // Attempt to call each of the read functions so we can fail
+        for (int file_idx = 0; file_idx < (int)m_file.size(); ++file_idx) {
+            // Attempt to read each of the files so we can fail
             // construction of this IOGroup if it isn't supported.
-            signal.second.m_read_function();
+            read_file_value(file_idx);
         }
 
         register_signal_alias("BOARD_POWER", "CNL::BOARD_POWER");
@@ -178,9 +181,39 @@ namespace geopm
                             "not valid for CNLIOGroup",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        else if (m_is_batch_read) {
+            throw Exception("CNLIOGroup::push_signal(): cannot push signal after call to read_batch().",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
 
-        m_signal_available[signal_name].m_do_read = true;
-        return std::distance(m_signal_available.begin(), m_signal_available.find(signal_name));
+        auto pushed_it = std::find_if(m_pushed_info_signal.begin(),
+                                      m_pushed_info_signal.end(),
+        [signal_name] (const m_pushed_info_s &info) {
+            return info.name == signal_name;
+        });
+        int signal_idx = -1;
+        if (pushed_it != m_pushed_info_signal.end()) {
+            // This has already been pushed. Return the same index as before.
+            signal_idx = std::distance(m_pushed_info_signal.begin(), pushed_it);
+        }
+        else {
+            const auto &info = m_signal_available.at(signal_name);
+            m_pushed_info_signal.push_back(m_pushed_info_s {
+                    signal_name,
+                    info.m_file_idx,
+                    info.m_convert,
+                    NAN,
+                });
+            signal_idx = m_pushed_info_signal.size() - 1;
+            // Aliases share a file; the freshness file is always read
+            if (info.m_file_idx != -1 &&
+                info.m_file_idx != m_freshness_file_idx &&
+                std::find(m_batch_file_idx.begin(), m_batch_file_idx.end(),
+                          info.m_file_idx) == m_batch_file_idx.end()) {
+                m_batch_file_idx.push_back(info.m_file_idx);
+            }
+        }
+        return signal_idx;
     }
 
     int CNLIOGroup::push_control(const std::string &control_name,
@@ -192,36 +225,55 @@ namespace geopm
 
     void CNLIOGroup::read_batch(void)
     {
-        for (auto &signal : m_signal_available) {
-            if (signal.second.m_do_read) {
-                signal.second.m_value = signal.second.m_read_function();
+        m_is_batch_read = true;
+        if (m_pushed_info_signal.empty()) {
+            return;
+        }
+        // The counters are updated at the rate given by raw_scan_hz,
+        // typically slower than the control loop.  Only read and
+        // parse them when the freshness counter has changed.  If the
+        // counters are updated after freshness is read, the next call
+        // reads them again, so values lag by at most one update.
+        double freshness = read_file_value(m_freshness_file_idx);
+        if (freshness == m_last_freshness) {
+            return;
+        }
+        if (!m_batch_file_idx.empty()) {
+            if (!m_batch) {
+                if (!m_batch_reader) {
+                    m_batch_reader = IOUring::make_unique(m_batch_file_idx.size());
+                }
+                std::vector<int> files;
+                std::vector<IOUring::batch_op_s> ops;
+                for (int file_idx : m_batch_file_idx) {
+                    auto &file = m_file[file_idx];
+                    ops.push_back({true, (int)files.size(),
+                                   file.buf.data(), M_IO_BUFFER_SIZE - 1, 0});
+                    files.push_back(file.fd.get());
+                }
+                m_batch = m_batch_reader->make_batch(files, ops);
+            }
+            m_batch->submit();
+            for (size_t op_idx = 0; op_idx < m_batch_file_idx.size(); ++op_idx) {
+                parse_file(m_file[m_batch_file_idx[op_idx]], m_batch->result(op_idx));
             }
         }
+        for (auto &info : m_pushed_info_signal) {
+            info.value = info.convert(info.file_idx == -1 ? NAN : m_file[info.file_idx].value);
+        }
+        m_last_freshness = freshness;
     }
 
     void CNLIOGroup::write_batch(void) {}
 
     double CNLIOGroup::sample(int batch_idx)
     {
-        double result = NAN;
-        auto res_it = m_signal_available.begin();
-        if (batch_idx >= 0 && batch_idx < static_cast<int>(m_signal_available.size())) {
-            std::advance(res_it, batch_idx);
-            if(res_it->second.m_do_read) {
-                result = res_it->second.m_value;
-            }
-            else if (!res_it->second.m_do_read) {
-                throw Exception("CNLIOGroup::sample(): batch_idx " +
-                                std::to_string(batch_idx) + " has not been pushed",
-                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-            }
-        }
-        else {
+        if (batch_idx < 0 || batch_idx >= static_cast<int>(m_pushed_info_signal.size())) {
             throw Exception("CNLIOGroup::sample(): batch_idx " + std::to_string(batch_idx) +
                             "not valid for CNLIOGroup",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        return result;
+        return m_pushed_info_signal[batch_idx].value;
     }
 
     void CNLIOGroup::adjust(int batch_idx, double setting)
@@ -243,7 +295,8 @@ namespace geopm
                             "not valid for CNLIOGroup",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        return m_signal_available.find(signal_name)->second.m_read_function();
+        const auto &info = m_signal_available.find(signal_name)->second;
+        return info.m_convert(info.m_file_idx == -1 ? NAN : read_file_value(info.m_file_idx));
     }
 
     void CNLIOGroup::write_control(const std::string &control_name,
@@ -353,12 +406,57 @@ namespace geopm
         return geopm::make_unique<CNLIOGroup>();
     }
 
-    double CNLIOGroup::read_time(const std::string &freshness_path) const
+    double CNLIOGroup::read_time(double freshness) const
     {
-        auto freshness = read_double_from_file(freshness_path, "");
         return (freshness - m_initial_freshness) / m_sample_rate;
     }
 
+    int CNLIOGroup::open_file(const std::string &path, const std::string &units)
+    {
+        UniqueFd fd = open(path.c_str(), O_RDONLY);
+        if (fd.get() == -1) {
+            throw Exception("CNLIOGroup::open_file(): Failed to open " + path,
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        m_file.push_back(m_file_s {
+                std::move(fd),
+                path,
+                units,
+                {},
+                NAN,
+            });
+        return m_file.size() - 1;
+    }
+
+    double CNLIOGroup::read_file_value(int file_idx)
+    {
+        auto &file = m_file[file_idx];
+        int read_bytes = pread(file.fd.get(), file.buf.data(), file.buf.size() - 1, 0);
+        return parse_file(file, read_bytes < 0 ? -errno : read_bytes);
+    }
+
+    double CNLIOGroup::parse_file(m_file_s &file, int read_bytes)
+    {
+        if (read_bytes < 0) {
+            throw Exception("CNLIOGroup::parse_file(): Failed to read " + file.path,
+                            -read_bytes, __FILE__, __LINE__);
+        }
+        if (read_bytes == 0) {
+            throw Exception("CNLIOGroup::parse_file(): Empty file " + file.path,
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        file.buf[read_bytes] = '\0';
+        // Files may be padded with null characters
+        size_t length = strlen(file.buf.data());
+        if (length >= file.buf.size() - 1) {
+            throw Exception("CNLIOGroup::parse_file(): Truncated read of " + file.path,
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        file.value = read_double_from_string(std::string(file.buf.data(), length),
+                                             file.units, file.path);
+        return file.value;
+    }
+
     void CNLIOGroup::register_signal_alias(const std::string &alias_name,
                                            const std::string &signal_name)
     {
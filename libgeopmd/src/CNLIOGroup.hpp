@@ -5,11 +5,16 @@
 #ifndef CNLIOGROUP_HPP_INCLUDE
 #define CNLIOGROUP_HPP_INCLUDE
 
+#include <array>
 #include <functional>
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "geopm/IOGroup.hpp"
 #include "geopm_time.h"
+#include "IOUring.hpp"
+#include "UniqueFd.hpp"
 
 namespace geopm
 {
@@ -17,11 +22,18 @@ namespace geopm
     ///
     /// @details The CNLIOGroup provides board-level energy counters from Compute Node Linux
     ///          as signals.  These values are obtained through the proc(5)
+    ///
+    ///          The counter files are kept open and the pushed signals are read
+    ///          together through an IOUring.  The counters are only read and
+    ///          parsed by read_batch() when the freshness counter shows that
+    ///          they were updated since the last call.
     class CNLIOGroup : public IOGroup
     {
         public:
             CNLIOGroup();
             CNLIOGroup(const std::string &pm_counters_path);
+            CNLIOGroup(const std::string &pm_counters_path,
+                       std::shared_ptr<IOUring> batch_reader);
             virtual ~CNLIOGroup() = default;
             /// @return the list of signal names provided by this IOGroup.
             std::set<std::string> signal_names(void) const override;
@@ -140,23 +152,57 @@ namespace geopm
         private:
             void register_signal_alias(const std::string &alias_name, const std::string &signal_name);
 
+            static constexpr size_t M_IO_BUFFER_SIZE = 128;
+            /// An open file in the pm_counters directory
+            struct m_file_s {
+                UniqueFd fd;
+                std::string path;
+                std::string units;
+                std::array<char, M_IO_BUFFER_SIZE> buf;
+                /// Value parsed by the last read
+                double value;
+            };
             struct m_signal_info_s {
                 std::string m_description;
                 std::function<double(const std::vector<double> &)> m_agg_function;
                 std::function<std::string(double)> m_format_function;
-                std::function<double()> m_read_function;
-                bool m_do_read;
-                double m_value;
+                /// Index into m_file, or -1 if the signal is not
+                /// read from a file
+                int m_file_idx;
+                /// Converts the value of the file into the signal
+                std::function<double(double)> m_convert;
                 int m_units;
                 int m_behavior;
             };
-            std::map<std::string, m_signal_info_s> m_signal_available;
+            struct m_pushed_info_s {
+                std::string name;
+                int file_idx;
+                std::function<double(double)> convert;
+                double value;
+            };
 
-            double read_time(const std::string &freshness_path) const;
+            int open_file(const std::string &path, const std::string &units);
+            /// Parse the contents of a file after a read that
+            /// returned read_bytes
+            double parse_file(m_file_s &file, int read_bytes);
+            /// Read and parse a file without the IOUring
+            double read_file_value(int file_idx);
+            double read_time(double freshness) const;
 
+            std::vector<m_file_s> m_file;
+            std::map<std::string, m_signal_info_s> m_signal_available;
+            std::vector<m_pushed_info_s> m_pushed_info_signal;
+            int m_freshness_file_idx;
+            /// Files other than freshness read by read_batch()
+            std::vector<int> m_batch_file_idx;
+            /// Whether read_batch() has been called at least once
+            bool m_is_batch_read;
+            double m_last_freshness;
             geopm_time_s m_time_zero;
             double m_initial_freshness;
             double m_sample_rate;
+            std::shared_ptr<IOUring> m_batch_reader;
+            std::unique_ptr<IOUringBatch> m_batch;
     };
 }
 
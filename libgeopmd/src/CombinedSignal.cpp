@@ -30,4 +30,10 @@ namespace geopm
     {
         return m_agg_function(values);
     }
+
+    std::vector<double> &CombinedSignal::operand_buffer(size_t num_operand)
+    {
+        m_operand_buffer.resize(num_operand);
+        return m_operand_buffer;
+    }
 }
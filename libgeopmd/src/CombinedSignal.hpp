@@ -25,7 +25,17 @@ namespace geopm
             /// @brief Sample all required signals and aggregate
             ///        values to produce the combined signal.
             virtual double sample(const std::vector<double> &values);
+            /// @brief Storage for the operand values that persists
+            ///        between calls to sample() so that it can be
+            ///        filled without allocating memory each time.
+            ///
+            /// @param [in] num_operand Number of operands.
+            ///
+            /// @return Reference to the buffer resized to num_operand.
+            std::vector<double> &operand_buffer(size_t num_operand);
             std::function<double(const std::vector<double> &)> m_agg_function;
+        private:
+            std::vector<double> m_operand_buffer;
     };
 }
 
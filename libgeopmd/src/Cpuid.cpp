@@ -22,6 +22,7 @@ namespace geopm
             double freq_sticker(void) const override;
             rdt_info_s rdt_info(void) const override;
             uint32_t pmc_bit_width(void) const override;
+            bool is_tsc_invariant(void) const override;
     };
 
     std::unique_ptr<Cpuid> Cpuid::make_unique(void)
@@ -135,6 +136,18 @@ namespace geopm
 
         return result;
     }
+
+    bool CpuidImp::is_tsc_invariant(void) const
+    {
+        uint32_t leaf = 0x80000007; //advanced power management
+        uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+        const uint32_t invariant_tsc_mask = 0x100;
+        bool result = false;
+        if (__get_cpuid(leaf, &eax, &ebx, &ecx, &edx)) {
+            result = (bool)((edx & invariant_tsc_mask) >> 8);
+        }
+        return result;
+    }
 }
 
 #else
@@ -191,3 +204,11 @@ namespace geopm
 }
 
 #endif
+
+namespace geopm
+{
+    bool Cpuid::is_tsc_invariant(void) const
+    {
+        return false;
+    }
+}
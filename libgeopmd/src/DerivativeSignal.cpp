@@ -9,6 +9,8 @@
 #include <cmath>
 #include <unistd.h>
 
+#include <algorithm>
+
 #include "geopm/Helper.hpp"
 #include "geopm_debug.hpp"
 
@@ -31,17 +33,33 @@ namespace geopm
         : m_time_sig(std::move(time_sig))
         , m_y_sig(std::move(y_sig))
         , M_NUM_SAMPLE_HISTORY(num_sample_history)
-        , m_history(M_NUM_SAMPLE_HISTORY)
-        , m_derivative_num_fit(0)
+        , m_fit(M_NUM_SAMPLE_HISTORY)
         , m_is_batch_ready(false)
         , m_sleep_time(sleep_time)
         , m_last_result(NAN)
         , m_nan_replace(nan_replace)
+        , m_read_fit(M_NUM_SAMPLE_HISTORY)
+        , m_read_last_result(NAN)
     {
         GEOPM_DEBUG_ASSERT(m_time_sig && m_y_sig,
                            "Signal pointers for time_sig and y_sig cannot be null.");
     }
 
+    DerivativeSignal::m_fit_s::m_fit_s(int num_sample_history)
+        : history(num_sample_history)
+        , reference({0.0, 0.0})
+        , reference_seq(0)
+        , num_insert(0)
+        , num_valid(0)
+        , num_nan(0)
+        , sum_time(0.0)
+        , sum_sample(0.0)
+        , sum_time_sample(0.0)
+        , sum_time_time(0.0)
+    {
+
+    }
+
     void DerivativeSignal::setup_batch(void)
     {
         if (!m_is_batch_ready) {
@@ -51,39 +69,86 @@ namespace geopm
         }
     }
 
-    double DerivativeSignal::compute_next(CircularBuffer<m_sample_s> &history,
-                                          int &num_fit,
+    void DerivativeSignal::update_sums(m_fit_s &fit, const m_sample_s &value,
+                                       int sign)
+    {
+        if (std::isnan(value.time) || std::isnan(value.sample)) {
+            fit.num_nan += sign;
+        }
+        else {
+            double dt = value.time - fit.reference.time;
+            double sig = value.sample - fit.reference.sample;
+            fit.num_valid += sign;
+            fit.sum_time += sign * dt;
+            fit.sum_sample += sign * sig;
+            fit.sum_time_sample += sign * dt * sig;
+            fit.sum_time_time += sign * dt * dt;
+        }
+    }
+
+    void DerivativeSignal::rebuild_sums(m_fit_s &fit)
+    {
+        int buf_size = fit.history.size();
+        fit.num_valid = 0;
+        fit.num_nan = 0;
+        fit.sum_time = 0.0;
+        fit.sum_sample = 0.0;
+        fit.sum_time_sample = 0.0;
+        fit.sum_time_time = 0.0;
+        // The newest sample stays in the window the longest, so it
+        // makes the reference that needs to be replaced least often.
+        for (int buf_off = buf_size - 1; buf_off >= 0; --buf_off) {
+            const m_sample_s &value = fit.history.value(buf_off);
+            if (!std::isnan(value.time) && !std::isnan(value.sample)) {
+                fit.reference = value;
+                fit.reference_seq = fit.num_insert - buf_size + buf_off;
+                break;
+            }
+        }
+        for (int buf_off = 0; buf_off < buf_size; ++buf_off) {
+            update_sums(fit, fit.history.value(buf_off), 1);
+        }
+    }
+
+    double DerivativeSignal::compute_next(m_fit_s &fit,
                                           double time, double signal,
                                           double nan_replace)
     {
+        m_sample_s value = {time, signal};
+        bool is_reference_dropped = false;
+        // Remove the sample that will be dropped from the window
+        if (fit.history.size() == fit.history.capacity()) {
+            update_sums(fit, fit.history.value(0), -1);
+            is_reference_dropped = (fit.num_insert - fit.history.capacity() ==
+                                    fit.reference_seq);
+        }
         // insert time and signal
-        history.insert({time, signal});
-        if (num_fit < history.capacity()) {
-            ++num_fit;
+        fit.history.insert(value);
+        ++fit.num_insert;
+        if (is_reference_dropped) {
+            rebuild_sums(fit);
+        }
+        else {
+            if (fit.num_valid == 0 &&
+                !std::isnan(time) && !std::isnan(signal)) {
+                fit.reference = value;
+                fit.reference_seq = fit.num_insert - 1;
+                fit.sum_time = 0.0;
+                fit.sum_sample = 0.0;
+                fit.sum_time_sample = 0.0;
+                fit.sum_time_time = 0.0;
+            }
+            update_sums(fit, value, 1);
         }
 
         // Least squares linear regression to approximate the
         // derivative with noisy data.
         double result = NAN;
-        if (num_fit >= 2) {
-            size_t buf_size = history.size();
-            double A = 0.0, B = 0.0, C = 0.0, D = 0.0;
+        int num_fit = fit.history.size();
+        if (num_fit >= 2 && fit.num_nan == 0) {
             double E = 1.0 / num_fit;
-            double time_0 = history.value(buf_size - num_fit).time;
-            const double sig_0 = history.value(buf_size - num_fit).sample;
-            for (size_t buf_off = buf_size - num_fit;
-                 buf_off < buf_size; ++buf_off) {
-                double tt = history.value(buf_off).time;
-                double dt = tt - time_0;
-                double sig = history.value(buf_off).sample - sig_0;
-                A += dt * sig;
-                B += dt;
-                C += sig;
-                D += dt * dt;
-            }
-
-            double ssxx = D - B * B * E;
-            double ssxy = A - B * C * E;
+            double ssxx = fit.sum_time_time - fit.sum_time * fit.sum_time * E;
+            double ssxy = fit.sum_time_sample - fit.sum_time * fit.sum_sample * E;
             if (ssxx != 0) {
                 result = ssxy / ssxx;
             }
@@ -102,30 +167,57 @@ namespace geopm
         }
         bool is_sampled = m_time_sig->is_sampled();
         double time = m_time_sig->sample();
-        size_t history_size = m_history.size();
+        size_t history_size = m_fit.history.size();
         // Check if this is the first call ever to sample() (history_size == 0)
         // Or check if this is the first call to sample() since the last call to read_batch()
         if (history_size == 0ULL || ! is_sampled) {
             double signal = m_y_sig->sample();
-            m_last_result = compute_next(m_history, m_derivative_num_fit, time, signal, m_nan_replace);
+            m_last_result = compute_next(m_fit, time, signal, m_nan_replace);
         }
         return m_last_result;
     }
 
     double DerivativeSignal::read(void) const
     {
-        double result = NAN;
-        CircularBuffer<m_sample_s> temp_history(M_NUM_SAMPLE_HISTORY);
-        int num_fit = 0;
-        for (int ii = 0; ii < M_NUM_SAMPLE_HISTORY; ++ii) {
-            double signal = m_y_sig->read();
-            double time = m_time_sig->read();
-            result = compute_next(temp_history, num_fit, time, signal, m_nan_replace);
-            if (ii < M_NUM_SAMPLE_HISTORY - 1) {
-                usleep(m_sleep_time * 1e6);
+        double time = m_time_sig->read();
+        int history_size = m_read_fit.history.size();
+        if (history_size != 0) {
+            m_sample_s newest = m_read_fit.history.value(history_size - 1);
+            double elapsed = time - newest.time;
+            if (elapsed < m_sleep_time) {
+                // Window was updated recently
+                return m_read_last_result;
+            }
+            if (!(elapsed <= M_NUM_SAMPLE_HISTORY * m_sleep_time)) {
+                // Window is stale, start over from the newest cached
+                // sample.  The new sample is more than a window later,
+                // so the fit already spans enough time without
+                // sampling again.
+                m_read_fit = m_fit_s(M_NUM_SAMPLE_HISTORY);
+                if (!std::isnan(newest.time) && !std::isnan(newest.sample)) {
+                    compute_next(m_read_fit, newest.time, newest.sample, m_nan_replace);
+                }
             }
         }
-        return result;
+        double signal = m_y_sig->read();
+        m_read_last_result = compute_next(m_read_fit, time, signal, m_nan_replace);
+        // The first window is filled until it spans as much time as
+        // the full window of sleeps did, so that the fit is not
+        // dominated by the update interval of the underlying counter.
+        int num_fit_min = std::min(2, M_NUM_SAMPLE_HISTORY);
+        double span_min = (M_NUM_SAMPLE_HISTORY - 1) * m_sleep_time;
+        int num_fit = m_read_fit.history.size();
+        while (num_fit < num_fit_min ||
+               (num_fit < M_NUM_SAMPLE_HISTORY &&
+                m_read_fit.history.value(num_fit - 1).time -
+                m_read_fit.history.value(0).time < span_min)) {
+            usleep(m_sleep_time * 1e6);
+            time = m_time_sig->read();
+            signal = m_y_sig->read();
+            m_read_last_result = compute_next(m_read_fit, time, signal, m_nan_replace);
+            num_fit = m_read_fit.history.size();
+        }
+        return m_read_last_result;
     }
 
 }
@@ -6,6 +6,7 @@
 #ifndef DERIVATIVESIGNAL_HPP_INCLUDE
 #define DERIVATIVESIGNAL_HPP_INCLUDE
 
+#include <cstdint>
 #include <memory>
 
 #include "Signal.hpp"
@@ -28,6 +29,20 @@ namespace geopm
             virtual ~DerivativeSignal() = default;
             void setup_batch(void) override;
             double sample(void) override;
+            /// @brief Read the signals once and return the
+            ///        derivative over a window of recent reads.
+            ///
+            /// Reads made within the sleep time of the newest sample
+            /// in the window return the cached result.  If the window
+            /// has not been updated for longer than its duration, a
+            /// new window starts from the newest cached sample, and
+            /// the result is the average rate of change since that
+            /// sample.  Only the first read, which has no cached
+            /// sample, sleeps: it blocks until the window spans one
+            /// less than the number of history samples times the
+            /// sleep time, because a fit over a shorter span is much
+            /// noisier for counters that update about once per
+            /// millisecond, like RAPL energy.
             double read(void) const override;
         private:
             struct m_sample_s {
@@ -35,23 +50,48 @@ namespace geopm
                 double sample;
             };
 
+            /// Window of samples used for the least squares fit
+            /// along with running sums over the samples in the
+            /// window.  The sums are offset by a reference sample
+            /// from the window to limit round off error.
+            struct m_fit_s {
+                m_fit_s(int num_sample_history);
+                CircularBuffer<m_sample_s> history;
+                m_sample_s reference;
+                uint64_t reference_seq;
+                uint64_t num_insert;
+                int num_valid;
+                int num_nan;
+                double sum_time;
+                double sum_sample;
+                double sum_time_sample;
+                double sum_time_time;
+            };
+
             /// Update the history buffer and compute the new derivative.
             /// The read() and sample() methods have separate history.
-            static double compute_next(CircularBuffer<m_sample_s> &history,
-                                       int &num_fit,
+            static double compute_next(m_fit_s &fit,
                                        double time, double signal,
                                        double nan_replace);
+            /// Add (sign = 1) or remove (sign = -1) a sample from the
+            /// running sums.
+            static void update_sums(m_fit_s &fit, const m_sample_s &value,
+                                    int sign);
+            /// Recompute the running sums over the window with the
+            /// newest valid sample as the reference.
+            static void rebuild_sums(m_fit_s &fit);
 
             std::shared_ptr<Signal> m_time_sig;
             std::shared_ptr<Signal> m_y_sig;
 
             const int M_NUM_SAMPLE_HISTORY;
-            CircularBuffer<m_sample_s> m_history;
-            int m_derivative_num_fit;
+            m_fit_s m_fit;
             bool m_is_batch_ready;
             double m_sleep_time;
             double m_last_result;
             double m_nan_replace;
+            mutable m_fit_s m_read_fit;
+            mutable double m_read_last_result;
     };
 }
 
@@ -57,9 +57,15 @@ namespace geopm
     }
 
     double read_double_from_file(const std::string &path, const std::string &expected_units)
+    {
+        return read_double_from_string(read_file(path), expected_units, path);
+    }
+
+    double read_double_from_string(const std::string &file_contents,
+                                   const std::string &expected_units,
+                                   const std::string &path)
     {
         const std::string separators(" \t\n\0", 4);
-        auto file_contents = read_file(path);
         size_t value_length = 0;
         auto value = std::stod(file_contents, &value_length);
         auto units_offset = file_contents.find_first_not_of(separators, value_length);
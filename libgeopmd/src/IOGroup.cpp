@@ -11,6 +11,7 @@
 
 #include "geopm/IOGroup.hpp"
 
+#include "geopm/PlatformIO.hpp"
 #include "geopm_plugin.hpp"
 #include "MSRIOGroup.hpp"
 #include "CpuinfoIOGroup.hpp"
@@ -193,6 +194,29 @@ namespace geopm
     }
 
 
+    std::vector<double> IOGroup::read_signals(const std::vector<geopm_request_s> &requests)
+    {
+        std::vector<double> result;
+        result.reserve(requests.size());
+        for (const auto &req : requests) {
+            result.push_back(read_signal(req.name, req.domain_type, req.domain_idx));
+        }
+        return result;
+    }
+
+    void IOGroup::write_controls(const std::vector<geopm_request_s> &requests,
+                                 const std::vector<double> &settings)
+    {
+        if (requests.size() != settings.size()) {
+            throw Exception("IOGroup::write_controls(): number of settings does not match number of requests",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (size_t req_idx = 0; req_idx < requests.size(); ++req_idx) {
+            const auto &req = requests[req_idx];
+            write_control(req.name, req.domain_type, req.domain_idx, settings[req_idx]);
+        }
+    }
+
     std::function<std::string(double)> IOGroup::format_function(const std::string &signal_name) const
     {
 #ifdef GEOPM_DEBUG
@@ -7,6 +7,8 @@
 
 #include <cstdlib>
 
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
 #include "IOUringFallback.hpp"
 
 #include <iostream>
@@ -16,6 +18,72 @@
 
 namespace geopm
 {
+    /// @brief IOUringBatch that queues each operation on an IOUring
+    ///        at every submission.  Result storage is allocated once
+    ///        when the batch is created.
+    class IOUringQueueBatch : public IOUringBatch
+    {
+        public:
+            IOUringQueueBatch(IOUring &uring,
+                              const std::vector<int> &files,
+                              const std::vector<IOUring::batch_op_s> &ops);
+            virtual ~IOUringQueueBatch() = default;
+            void submit(void) override;
+            int result(int op_idx) const override;
+        private:
+            IOUring &m_uring;
+            std::vector<int> m_files;
+            std::vector<IOUring::batch_op_s> m_ops;
+            std::vector<std::shared_ptr<int> > m_result;
+    };
+
+    IOUringQueueBatch::IOUringQueueBatch(IOUring &uring,
+                                         const std::vector<int> &files,
+                                         const std::vector<IOUring::batch_op_s> &ops)
+        : m_uring(uring)
+        , m_files(files)
+        , m_ops(ops)
+        , m_result(ops.size())
+    {
+        for (const auto &op : m_ops) {
+            if (op.file_idx < 0 || (size_t)op.file_idx >= m_files.size()) {
+                throw Exception("IOUringQueueBatch: file index out of range: " +
+                                std::to_string(op.file_idx),
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
+        for (auto &ret : m_result) {
+            ret = std::make_shared<int>(0);
+        }
+    }
+
+    void IOUringQueueBatch::submit(void)
+    {
+        for (size_t op_idx = 0; op_idx < m_ops.size(); ++op_idx) {
+            const auto &op = m_ops[op_idx];
+            if (op.is_read) {
+                m_uring.prep_read(m_result[op_idx], m_files[op.file_idx],
+                                  op.buf, op.nbytes, op.offset);
+            }
+            else {
+                m_uring.prep_write(m_result[op_idx], m_files[op.file_idx],
+                                   op.buf, op.nbytes, op.offset);
+            }
+        }
+        m_uring.submit();
+    }
+
+    int IOUringQueueBatch::result(int op_idx) const
+    {
+        return *m_result.at(op_idx);
+    }
+
+    std::unique_ptr<IOUringBatch> IOUring::make_batch(const std::vector<int> &files,
+                                                      const std::vector<batch_op_s> &ops)
+    {
+        return geopm::make_unique<IOUringQueueBatch>(*this, files, ops);
+    }
+
 #ifdef GEOPM_HAS_IO_URING
     static void emit_missing_support_warning()
     {
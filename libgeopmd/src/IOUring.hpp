@@ -11,12 +11,56 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace geopm
 {
+    /// @brief A fixed set of read and write operations that is built
+    ///        once and submitted repeatedly.
+    ///
+    /// Objects are created by IOUring::make_batch().  The files and
+    /// buffers referenced by the operations must remain valid for the
+    /// life of the object, and the object must not outlive the IOUring
+    /// that created it.
+    class IOUringBatch
+    {
+        public:
+            IOUringBatch() = default;
+            virtual ~IOUringBatch() = default;
+            /// @brief Submit every operation in the batch and wait for
+            ///        all of them to complete.  Throws if there are
+            ///        errors interacting with the completion queue.
+            ///        Failures of individual operations are reported
+            ///        by result() and do not cause this function to
+            ///        throw.
+            virtual void submit(void) = 0;
+            /// @brief Get the return value of an operation from the
+            ///        last call to submit().
+            /// @param op_idx Index of the operation in the vector
+            ///        passed to IOUring::make_batch().
+            /// @return Non-negative number of bytes transferred, or
+            ///         -errno on failure.
+            virtual int result(int op_idx) const = 0;
+    };
+
     class IOUring
     {
         public:
+            /// @brief Description of one operation in a prepared batch.
+            struct batch_op_s {
+                /// @brief True for a pread, false for a pwrite.
+                bool is_read;
+                /// @brief Index of the file in the files vector passed
+                ///        to make_batch().
+                int file_idx;
+                /// @brief Source or destination of the data.
+                void *buf;
+                /// @brief Number of bytes to transfer.
+                unsigned nbytes;
+                /// @brief Offset within the file.
+                off_t offset;
+            };
+
             /// @brief Create and initialize an IO uring.
             IOUring() = default;
 
@@ -57,6 +101,23 @@ namespace geopm
             virtual void prep_write(std::shared_ptr<int> ret, int fd,
                                     const void *buf, unsigned nbytes, off_t offset) = 0;
 
+            /// @brief Prepare a batch of operations that can be
+            ///        submitted many times without being described
+            ///        again.
+            ///
+            /// Implementations may register the files and buffers with
+            /// the kernel so that later submissions avoid per-operation
+            /// file lookups.  The default implementation queues each
+            /// operation with prep_read() or prep_write() on every
+            /// submission, reusing preallocated result storage.
+            ///
+            /// @param files  Open file descriptors referenced by the
+            ///               operations through batch_op_s::file_idx.
+            /// @param ops  Operations to perform in each submission.
+            /// @return Batch object that performs the operations.
+            virtual std::unique_ptr<IOUringBatch> make_batch(const std::vector<int> &files,
+                                                             const std::vector<batch_op_s> &ops);
+
             /// @brief Create an object that supports an io_uring-like interface. The
             ///        created object uses io_uring if supported, otherwise uses
             ///        individual read/write operations.
@@ -6,6 +6,7 @@
 
 #include <unistd.h>
 
+#include "geopm/Exception.hpp"
 #include "geopm/Helper.hpp"
 
 #include <utility>
@@ -55,8 +56,46 @@ namespace geopm
         m_operations.emplace_back(ret, std::bind(pwrite, fd, buf, nbytes, offset));
     }
 
+    std::unique_ptr<IOUringBatch> IOUringFallback::make_batch(const std::vector<int> &files,
+                                                              const std::vector<batch_op_s> &ops)
+    {
+        return geopm::make_unique<IOUringFallbackBatch>(files, ops);
+    }
+
     std::unique_ptr<IOUring> IOUringFallback::make_unique(unsigned entries)
     {
         return geopm::make_unique<IOUringFallback>(entries);
     }
+
+    IOUringFallbackBatch::IOUringFallbackBatch(const std::vector<int> &files,
+                                               const std::vector<IOUring::batch_op_s> &ops)
+        : m_ops()
+        , m_result(ops.size(), 0)
+    {
+        m_ops.reserve(ops.size());
+        for (const auto &op : ops) {
+            if (op.file_idx < 0 || (size_t)op.file_idx >= files.size()) {
+                throw Exception("IOUringFallbackBatch: file index out of range: " +
+                                std::to_string(op.file_idx),
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            m_ops.push_back({op.is_read, files[op.file_idx], op.buf, op.nbytes, op.offset});
+        }
+    }
+
+    void IOUringFallbackBatch::submit(void)
+    {
+        for (size_t op_idx = 0; op_idx < m_ops.size(); ++op_idx) {
+            const auto &op = m_ops[op_idx];
+            int ret = op.is_read ?
+                      pread(op.fd, op.buf, op.nbytes, op.offset) :
+                      pwrite(op.fd, op.buf, op.nbytes, op.offset);
+            m_result[op_idx] = ret < 0 ? -errno : ret;
+        }
+    }
+
+    int IOUringFallbackBatch::result(int op_idx) const
+    {
+        return m_result.at(op_idx);
+    }
 }
@@ -30,6 +30,9 @@ namespace geopm
             void prep_write(std::shared_ptr<int> ret, int fd,
                             const void *buf, unsigned nbytes, off_t offset) override;
 
+            std::unique_ptr<IOUringBatch> make_batch(const std::vector<int> &files,
+                                                     const std::vector<batch_op_s> &ops) override;
+
             /// @brief Create a fallback implementation of IOUring that uses non-batched
             ///        IO operations, in case we cannot use IO uring or liburing.
             /// @param entries The expected maximum number of batched operations.
@@ -40,5 +43,27 @@ namespace geopm
             using FutureOperation = std::pair<std::shared_ptr<int>, std::function<int()> >;
             std::vector<FutureOperation> m_operations;
     };
+
+    /// @brief Prepared batch that performs each operation with a
+    ///        direct pread() or pwrite() call.
+    class IOUringFallbackBatch final : public IOUringBatch
+    {
+        public:
+            IOUringFallbackBatch(const std::vector<int> &files,
+                                 const std::vector<IOUring::batch_op_s> &ops);
+            virtual ~IOUringFallbackBatch() = default;
+            void submit(void) override;
+            int result(int op_idx) const override;
+        private:
+            struct m_op_s {
+                bool is_read;
+                int fd;
+                void *buf;
+                unsigned nbytes;
+                off_t offset;
+            };
+            std::vector<m_op_s> m_ops;
+            std::vector<int> m_result;
+    };
 }
 #endif // IOURINGFALLBACK_HPP_INCLUDE
@@ -9,6 +9,8 @@
 #include "geopm/Exception.hpp"
 #include "geopm/Helper.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <liburing.h>
 
@@ -17,6 +19,7 @@ namespace geopm
     IOUringImp::IOUringImp(unsigned entries)
         : m_ring()
         , m_result_destinations()
+        , m_registration(nullptr)
     {
         int ret = io_uring_queue_init(entries, &m_ring, 0);
         if (ret < 0) {
@@ -101,6 +104,177 @@ namespace geopm
         set_sqe_return_destination(sqe, std::move(ret));
     }
 
+    struct iovec IOUringImp::buffer_span(const std::vector<batch_op_s> &ops)
+    {
+        struct iovec result = {nullptr, 0};
+        if (!ops.empty()) {
+            char *begin = static_cast<char *>(ops[0].buf);
+            char *end = begin + ops[0].nbytes;
+            for (const auto &op : ops) {
+                begin = std::min(begin, static_cast<char *>(op.buf));
+                end = std::max(end, static_cast<char *>(op.buf) + op.nbytes);
+            }
+            result = {begin, (size_t)(end - begin)};
+        }
+        return result;
+    }
+
+    void IOUringImp::unregister(void)
+    {
+        if (m_registration && m_registration->is_file_registered) {
+            io_uring_unregister_files(&m_ring);
+        }
+        if (m_registration && m_registration->is_buffer_registered) {
+            io_uring_unregister_buffers(&m_ring);
+        }
+        m_registration = nullptr;
+    }
+
+    std::unique_ptr<IOUringBatch> IOUringImp::make_batch(const std::vector<int> &files,
+                                                         const std::vector<batch_op_s> &ops)
+    {
+        struct iovec span = buffer_span(ops);
+        // The registration can be shared only while another batch
+        // holds it: after its batches are released the registered
+        // pages may no longer back the same addresses.
+        bool is_shared = m_registration &&
+                         m_registration.use_count() > 1 &&
+                         m_registration->files == files &&
+                         m_registration->buffer.iov_base == span.iov_base &&
+                         m_registration->buffer.iov_len == span.iov_len;
+        if (!is_shared) {
+            unregister();
+            auto registration = std::make_shared<registration_s>();
+            registration->files = files;
+            registration->is_file_registered =
+                !files.empty() &&
+                io_uring_register_files(&m_ring, files.data(), files.size()) == 0;
+            registration->buffer = span;
+            registration->is_buffer_registered =
+                span.iov_len != 0 &&
+                io_uring_register_buffers(&m_ring, &span, 1) == 0;
+            m_registration = registration;
+        }
+        return geopm::make_unique<IOUringImpBatch>(m_ring, m_registration, files, ops);
+    }
+
+    IOUringImpBatch::IOUringImpBatch(struct io_uring &ring,
+                                     const std::shared_ptr<const IOUringImp::registration_s> &ring_registration,
+                                     const std::vector<int> &files,
+                                     const std::vector<IOUring::batch_op_s> &ops)
+        : m_ring(ring)
+        , m_ring_registration(ring_registration)
+        , m_registration(ring_registration)
+        , m_files(files)
+        , m_ops(ops)
+        , m_sqe(ops.size())
+        , m_result(ops.size(), 0)
+    {
+        for (const auto &op : m_ops) {
+            if (op.file_idx < 0 || (size_t)op.file_idx >= m_files.size()) {
+                throw Exception("IOUringImpBatch: file index out of range: " +
+                                std::to_string(op.file_idx),
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
+        prepare();
+    }
+
+    void IOUringImpBatch::prepare(void)
+    {
+        if (m_registration != m_ring_registration) {
+            // A later batch replaced the registration of the ring
+            m_registration = nullptr;
+        }
+        bool is_file = is_fixed_file();
+        bool is_buffer = is_fixed_buffer();
+        for (size_t op_idx = 0; op_idx < m_ops.size(); ++op_idx) {
+            const auto &op = m_ops[op_idx];
+            struct io_uring_sqe *sqe = &m_sqe[op_idx];
+            std::memset(sqe, 0, sizeof(*sqe));
+            int fd = is_file ? op.file_idx : m_files[op.file_idx];
+            if (is_buffer && op.is_read) {
+                io_uring_prep_read_fixed(sqe, fd, op.buf, op.nbytes, op.offset, 0);
+            }
+            else if (is_buffer) {
+                io_uring_prep_write_fixed(sqe, fd, op.buf, op.nbytes, op.offset, 0);
+            }
+            else if (op.is_read) {
+                io_uring_prep_read(sqe, fd, op.buf, op.nbytes, op.offset);
+            }
+            else {
+                io_uring_prep_write(sqe, fd, op.buf, op.nbytes, op.offset);
+            }
+            if (is_file) {
+                sqe->flags |= IOSQE_FIXED_FILE;
+            }
+            sqe->user_data = op_idx;
+        }
+    }
+
+    bool IOUringImpBatch::is_fixed_file(void) const
+    {
+        return m_registration &&
+               m_registration == m_ring_registration &&
+               m_registration->is_file_registered;
+    }
+
+    bool IOUringImpBatch::is_fixed_buffer(void) const
+    {
+        return m_registration &&
+               m_registration == m_ring_registration &&
+               m_registration->is_buffer_registered;
+    }
+
+    void IOUringImpBatch::submit(void)
+    {
+        if (m_registration && m_registration != m_ring_registration) {
+            prepare();
+        }
+        // The ring may be smaller than the batch, so queue as many
+        // entries as fit, drain their completions, and repeat.
+        size_t num_op = m_sqe.size();
+        size_t op_idx = 0;
+        while (op_idx < num_op) {
+            int num_queued = 0;
+            struct io_uring_sqe *sqe = nullptr;
+            while (op_idx < num_op &&
+                   (sqe = io_uring_get_sqe(&m_ring)) != nullptr) {
+                *sqe = m_sqe[op_idx];
+                ++op_idx;
+                ++num_queued;
+            }
+            if (num_queued == 0) {
+                throw Exception("IOUringImpBatch::submit(): No submission queue entries available",
+                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            int num_submitted = 0;
+            while (num_submitted < num_queued) {
+                int ret = io_uring_submit(&m_ring);
+                if (ret < 0) {
+                    throw Exception("IOUringImpBatch::submit(): Failed to submit to IO uring",
+                                    -ret, __FILE__, __LINE__);
+                }
+                num_submitted += ret;
+            }
+            for (int complete_idx = 0; complete_idx < num_queued; ++complete_idx) {
+                struct io_uring_cqe *cqe = nullptr;
+                int ret = io_uring_wait_cqe(&m_ring, &cqe);
+                if (ret < 0) {
+                    throw Exception("Failed to get a completion event from IO uring",
+                                    -ret, __FILE__, __LINE__);
+                }
+                m_result[cqe->user_data] = cqe->res;
+                io_uring_cqe_seen(&m_ring, cqe);
+            }
+        }
+    }
+
+    int IOUringImpBatch::result(int op_idx) const
+    {
+        return m_result.at(op_idx);
+    }
+
     bool IOUringImp::is_supported()
     {
 #ifdef GEOPM_IO_URING_HAS_FREE
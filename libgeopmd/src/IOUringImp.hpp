@@ -36,6 +36,20 @@ namespace geopm
             void prep_write(std::shared_ptr<int> ret, int fd,
                             const void *buf, unsigned nbytes, off_t offset) override;
 
+            /// @brief Prepare a batch of operations on this ring.
+            ///
+            /// Registers the files with the ring, and the contiguous
+            /// span of memory covering all operation buffers as a
+            /// single fixed buffer, so that the batch submits
+            /// fixed-file, fixed-buffer operations.  A ring holds one
+            /// registration: it is shared with live batches that use
+            /// the same files and span, and otherwise replaced.
+            /// Batches that lose the registration submit regular read
+            /// and write operations, as do all batches if registration
+            /// fails.
+            std::unique_ptr<IOUringBatch> make_batch(const std::vector<int> &files,
+                                                     const std::vector<batch_op_s> &ops) override;
+
             /// @brief Return whether this implementation of IOUring is supported.
             static bool is_supported();
 
@@ -43,6 +57,15 @@ namespace geopm
             /// @param entries  Maximum number of queue operations to contain
             ///                 within a single batch submission.
             static std::unique_ptr<IOUring> make_unique(unsigned entries);
+
+            /// @brief Files and buffer registered with a ring on
+            ///        behalf of the batches that hold this object.
+            struct registration_s {
+                std::vector<int> files;
+                bool is_file_registered;
+                struct iovec buffer;
+                bool is_buffer_registered;
+            };
         protected:
             struct io_uring_sqe *get_sqe_or_throw();
             void set_sqe_return_destination(
@@ -50,8 +73,59 @@ namespace geopm
                 std::shared_ptr<int> destination);
 
         private:
+            static struct iovec buffer_span(const std::vector<batch_op_s> &ops);
+            void unregister(void);
+
             struct io_uring m_ring;
             std::vector<std::shared_ptr<int> > m_result_destinations;
+            std::shared_ptr<const registration_s> m_registration;
+    };
+
+    /// @brief Prepared batch that copies precomputed submission queue
+    ///        entries into an io_uring.
+    class IOUringImpBatch final : public IOUringBatch
+    {
+        public:
+            /// @param ring  Initialized ring that outlives this object.
+            ///        No other submissions may be pending on the ring
+            ///        when submit() is called.
+            /// @param ring_registration  Registration currently held
+            ///        by the ring, owned by the IOUringImp that
+            ///        outlives this object.
+            /// @param files  File descriptors referenced by the ops.
+            /// @param ops  Operations to perform in each submission.
+            ///        If the registration registered files, they are
+            ///        the same files in the same order, and if it
+            ///        registered a buffer, all op buffers are within
+            ///        it as buffer index zero.
+            IOUringImpBatch(struct io_uring &ring,
+                            const std::shared_ptr<const IOUringImp::registration_s> &ring_registration,
+                            const std::vector<int> &files,
+                            const std::vector<IOUring::batch_op_s> &ops);
+            virtual ~IOUringImpBatch() = default;
+            IOUringImpBatch(const IOUringImpBatch &other) = delete;
+            IOUringImpBatch &operator=(const IOUringImpBatch &other) = delete;
+            void submit(void) override;
+            int result(int op_idx) const override;
+            /// @brief Whether the next submit() uses the registered
+            ///        files.
+            bool is_fixed_file(void) const;
+            /// @brief Whether the next submit() uses the registered
+            ///        buffer.
+            bool is_fixed_buffer(void) const;
+        private:
+            /// @brief Fill the submission queue entries for the
+            ///        registration held, or regular entries if the
+            ///        ring registration has since been replaced.
+            void prepare(void);
+
+            struct io_uring &m_ring;
+            const std::shared_ptr<const IOUringImp::registration_s> &m_ring_registration;
+            std::shared_ptr<const IOUringImp::registration_s> m_registration;
+            std::vector<int> m_files;
+            std::vector<IOUring::batch_op_s> m_ops;
+            std::vector<struct io_uring_sqe> m_sqe;
+            std::vector<int> m_result;
     };
 }
 #endif // IOURINGIMP_HPP_INCLUDE
@@ -36,6 +36,14 @@ namespace geopm
             void setup_batch(void) override;
             void adjust(double value) override;
             void write(double value) override;
+            /// @brief Add a write of the setting to a batch context
+            ///        of the MSRIO other than the one used by
+            ///        setup_batch().  The setting is written by the
+            ///        next call to MSRIO::write_batch() for the
+            ///        context.
+            /// @param [in] value Setting in SI units.
+            /// @param [in] batch_ctx Batch context index.
+            void adjust(double value, int batch_ctx);
             void save(void) override;
             void restore(void) override;
             void add_save_restore_context(int);
@@ -105,9 +105,19 @@ namespace geopm
     }
 
     double MSRFieldSignal::read(void) const
+    {
+        return convert(m_raw_msr->read());
+    }
+
+    std::shared_ptr<Signal> MSRFieldSignal::raw_msr(void) const
+    {
+        return m_raw_msr;
+    }
+
+    double MSRFieldSignal::convert(double raw_value) const
     {
         uint64_t last_field = 0;
         int num_overflow = 0;
-        return convert_raw_value(m_raw_msr->read(), last_field, num_overflow);
+        return convert_raw_value(raw_value, last_field, num_overflow);
     }
 }
@@ -35,6 +35,14 @@ namespace geopm
             void setup_batch(void) override;
             double sample(void) override;
             double read(void) const override;
+            /// @brief Underlying signal that provides the raw MSR
+            ///        value.
+            std::shared_ptr<Signal> raw_msr(void) const;
+            /// @brief Convert a raw MSR value into the field value
+            ///        the same way as read().
+            /// @param [in] raw_value Raw MSR value as returned by
+            ///        the read() method of the raw MSR signal.
+            double convert(double raw_value) const;
         private:
             double convert_raw_value(double val,
                                      uint64_t &last_field,
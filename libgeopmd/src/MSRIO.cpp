@@ -55,6 +55,8 @@ namespace geopm
 
     MSRIOImp::~MSRIOImp()
     {
+        // Prepared batches refer to the IO rings, release them first
+        m_batch_context.clear();
         close_all();
     }
 
@@ -159,6 +161,13 @@ namespace geopm
         return ctx;
     }
 
+    void MSRIOImp::reset_batch_context(int batch_ctx)
+    {
+        // Replacing the context also releases the prepared IO ring
+        // batches which refer to the old operation arrays
+        m_batch_context.at(batch_ctx) = m_batch_context_s(m_num_cpu);
+    }
+
     int MSRIOImp::add_write(int cpu_idx, uint64_t offset)
     {
         return add_write(cpu_idx, offset, 0);
@@ -166,6 +175,10 @@ namespace geopm
 
     int MSRIOImp::add_write(int cpu_idx, uint64_t offset, int batch_ctx)
     {
+        if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
+            throw Exception("MSRIOImp::add_write(): cpu_idx out of range: " + std::to_string(cpu_idx),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
         m_batch_context_s &ctx = m_batch_context.at(batch_ctx);
         int result = -1;
         auto &context = ctx.m_write_batch_idx_map.at(cpu_idx);
@@ -230,19 +243,31 @@ namespace geopm
 
     int MSRIOImp::add_read(int cpu_idx, uint64_t offset, int batch_ctx)
     {
-        /// @todo return same index for repeated calls with same inputs.
-        m_msr_batch_op_s rd {
-            .cpu = (uint16_t)cpu_idx,
-            .isrdmsr = 1,
-            .err = 0,
-            .msr = (uint32_t)offset,
-            .msrdata = 0,
-            .wmask = 0
-        };
+        if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
+            throw Exception("MSRIOImp::add_read(): cpu_idx out of range: " + std::to_string(cpu_idx),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
         m_batch_context_s &ctx = m_batch_context.at(batch_ctx);
-        int idx = ctx.m_read_batch_op.size();
-        ctx.m_read_batch_op.push_back(rd);
-        return idx;
+        int result = -1;
+        auto &context = ctx.m_read_batch_idx_map.at(cpu_idx);
+        auto batch_it = context.find(offset);
+        if (batch_it == context.end()) {
+            result = ctx.m_read_batch_op.size();
+            m_msr_batch_op_s rd {
+                .cpu = (uint16_t)cpu_idx,
+                .isrdmsr = 1,
+                .err = 0,
+                .msr = (uint32_t)offset,
+                .msrdata = 0,
+                .wmask = 0
+            };
+            ctx.m_read_batch_op.push_back(rd);
+            context[offset] = result;
+        }
+        else {
+            result = batch_it->second;
+        }
+        return result;
     }
 
     uint64_t MSRIOImp::sample(int batch_idx) const
@@ -341,34 +366,46 @@ namespace geopm
         if (!m_batch_reader) {
             m_batch_reader = IOUring::make_unique(read_batch.numops);
         }
-        msr_batch_io(*m_batch_reader, read_batch);
+        msr_batch_io(*m_batch_reader, m_batch_context.at(batch_ctx).m_read_prepared,
+                     read_batch, true);
     }
 
     void MSRIOImp::msr_batch_io(IOUring &batcher,
-                                struct m_msr_batch_array_s &batch)
-    {
-        std::vector<std::shared_ptr<int> > return_values;
-        return_values.reserve(batch.numops);
-
-        for (uint32_t batch_idx = 0; batch_idx != batch.numops; ++batch_idx) {
-            return_values.emplace_back(new int(0));
-            auto& batch_op = batch.ops[batch_idx];
-            if (batch_op.isrdmsr) {
-                batcher.prep_read(return_values.back(), msr_desc(batch_op.cpu),
-                                  &batch_op.msrdata, sizeof(batch_op.msrdata),
-                                  batch_op.msr);
-            }
-            else {
-                batcher.prep_write(return_values.back(), msr_desc(batch_op.cpu),
-                                   &batch_op.msrdata, sizeof(batch_op.msrdata),
-                                   batch_op.msr);
+                                struct m_prepared_batch_s &prepared,
+                                struct m_msr_batch_array_s &batch,
+                                bool is_read)
+    {
+        // Describe the operations to the IO ring once, and again only
+        // if operations were added to the batch since it was prepared.
+        if (!prepared.batch ||
+            prepared.ops != batch.ops ||
+            prepared.numops != batch.numops) {
+            std::vector<int> files(m_file_desc.begin(), m_file_desc.begin() + m_num_cpu);
+            std::vector<IOUring::batch_op_s> uring_ops;
+            uring_ops.reserve(batch.numops);
+            for (uint32_t batch_idx = 0; batch_idx != batch.numops; ++batch_idx) {
+                auto &batch_op = batch.ops[batch_idx];
+                if (batch_op.cpu >= m_num_cpu) {
+                    throw Exception("MSRIOImp::msr_batch_io(): cpu_idx=" + std::to_string(batch_op.cpu) +
+                                    " out of range, num_cpu=" + std::to_string(m_num_cpu),
+                                    GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                }
+                uring_ops.push_back({is_read, batch_op.cpu,
+                                     &batch_op.msrdata, sizeof(batch_op.msrdata),
+                                     (off_t)batch_op.msr});
             }
+            // Release the old batch first so that the ring may
+            // register the files and buffers again for the new one
+            prepared.batch.reset();
+            prepared.batch = batcher.make_batch(files, uring_ops);
+            prepared.ops = batch.ops;
+            prepared.numops = batch.numops;
         }
 
-        batcher.submit();
+        prepared.batch->submit();
 
         for (uint32_t batch_idx = 0; batch_idx != batch.numops; ++batch_idx) {
-            ssize_t successful_bytes = *return_values[batch_idx];
+            ssize_t successful_bytes = prepared.batch->result(batch_idx);
             auto& batch_op = batch.ops[batch_idx];
             if (successful_bytes != sizeof(batch_op.msrdata)) {
                 std::ostringstream err_str;
@@ -376,7 +413,7 @@ namespace geopm
                         << std::hex << batch_op.msr
                         << " system error: "
                         << ((successful_bytes < 0) ? strerror(-successful_bytes) : "none");
-                throw Exception(err_str.str(), batch_op.isrdmsr
+                throw Exception(err_str.str(), is_read
                                 ? GEOPM_ERROR_MSR_READ : GEOPM_ERROR_MSR_WRITE,
                                 __FILE__, __LINE__);
             }
@@ -402,12 +439,12 @@ namespace geopm
         }
 
         // Read existing MSR values
-        msr_batch_io(*m_batch_writer, write_batch);
+        msr_batch_io(*m_batch_writer, m_batch_context.at(batch_ctx).m_rmw_read_prepared,
+                     write_batch, true);
 
         // Modify with write mask
         int op_idx = 0;
         for (auto &op_it : write_batch_op) {
-            op_it.isrdmsr = 0;
             op_it.msrdata &= ~write_mask[op_idx];
             op_it.msrdata |= write_val[op_idx];
             GEOPM_DEBUG_ASSERT((~op_it.wmask & write_mask[op_idx]) == 0ULL,
@@ -417,10 +454,8 @@ namespace geopm
         }
 
         // Write back the modified MSRs
-        msr_batch_io(*m_batch_writer, write_batch);
-        for (auto &op_it : write_batch_op) {
-            op_it.isrdmsr = 1;
-        }
+        msr_batch_io(*m_batch_writer, m_batch_context.at(batch_ctx).m_rmw_write_prepared,
+                     write_batch, false);
     }
 
     void MSRIOImp::read_batch(void)
@@ -50,6 +50,13 @@ namespace geopm
             /// @return The context index that can be passed to future batch
             ///         methods to refer to the added context.
             virtual int create_batch_context(void) = 0;
+            /// @brief Remove all read and write operations from a
+            ///        batch context so that it can be reused for a
+            ///        different set of MSRs.  Indices returned by
+            ///        add_read() and add_write() for the context prior
+            ///        to the reset are no longer valid.
+            /// @param [in] batch_ctx batch context index to reset.
+            virtual void reset_batch_context(int batch_ctx) = 0;
             /// @brief Extend the set of MSRs for batch read with a single offset.
             ///        Note: uses the default batch context.
             /// @param [in] cpu_idx logical Linux CPU index to read from when
@@ -57,6 +64,8 @@ namespace geopm
             /// @param [in] offset MSR offset to be read when
             ///        read_batch() is called.
             /// @return The logical index that will be passed to sample().
+            ///         Repeated calls with the same cpu_idx and offset
+            ///         return the same index.
             virtual int add_read(int cpu_idx, uint64_t offset) = 0;
             /// @brief Extend the set of MSRs for batch read with a single offset.
             /// @param [in] cpu_idx logical Linux CPU index to read from when
@@ -65,6 +74,8 @@ namespace geopm
             ///        read_batch() is called.
             /// @param [in] batch_ctx batch context index where the read will be added.
             /// @return The logical index that will be passed to sample().
+            ///         Repeated calls with the same cpu_idx and offset
+            ///         within a batch context return the same index.
             virtual int add_read(int cpu_idx, uint64_t offset, int batch_ctx) = 0;
             /// @brief Batch read a set of MSRs configured by a
             ///        previous call to the batch_config() method.
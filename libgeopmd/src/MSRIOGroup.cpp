@@ -156,6 +156,7 @@ namespace geopm
         : m_platform_topo(topo)
         , m_msrio(std::move(msrio))
         , m_save_restore_ctx(m_msrio->create_batch_context())
+        , m_oneshot_ctx(-1)
         , m_cpuid(std::move(cpuid))
         , m_is_active(false)
         , m_is_read(false)
@@ -933,6 +934,142 @@ namespace geopm
         control->write(setting);
     }
 
+    std::vector<double> MSRIOGroup::read_signals(const std::vector<geopm_request_s> &requests)
+    {
+        std::vector<double> result(requests.size(), NAN);
+        // Signals that are fields of a single MSR are added to a
+        // one-shot batch context so that all of the MSRs are read
+        // with one batch operation.  Other signals are read
+        // individually.
+        int batch_ctx = oneshot_batch_context();
+        std::vector<int> batch_req_idx;
+        std::vector<int> batch_idx;
+        std::vector<std::shared_ptr<RawMSRSignal> > batch_raw;
+        std::vector<std::shared_ptr<MSRFieldSignal> > batch_field;
+        for (int req_idx = 0; req_idx < (int)requests.size(); ++req_idx) {
+            const geopm_request_s &req = requests[req_idx];
+            if (!is_valid_signal(req.name)) {
+                throw Exception("MSRIOGroup::read_signals(): signal name \"" +
+                                std::string(req.name) + "\" not found",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (req.domain_type != signal_domain_type(req.name)) {
+                throw Exception("MSRIOGroup::read_signals(): domain_type requested does not match the domain of the signal (" + std::string(req.name) + ").",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (req.domain_idx < 0 || req.domain_idx >= m_platform_topo.num_domain(req.domain_type)) {
+                throw Exception("MSRIOGroup::read_signals(): domain_idx out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            std::shared_ptr<Signal> signal = m_signal_available.at(req.name).signals[req.domain_idx];
+            auto field = std::dynamic_pointer_cast<MSRFieldSignal>(signal);
+            auto raw = std::dynamic_pointer_cast<RawMSRSignal>(field ? field->raw_msr() : signal);
+            if (raw) {
+                batch_req_idx.push_back(req_idx);
+                batch_idx.push_back(raw->add_read(batch_ctx));
+                batch_raw.push_back(raw);
+                batch_field.push_back(field);
+            }
+            else {
+                result[req_idx] = signal->read();
+            }
+        }
+        if (!batch_req_idx.empty()) {
+            m_msrio->read_batch(batch_ctx);
+            for (size_t op_idx = 0; op_idx < batch_req_idx.size(); ++op_idx) {
+                double value = batch_raw[op_idx]->sample(batch_idx[op_idx], batch_ctx);
+                if (batch_field[op_idx]) {
+                    value = batch_field[op_idx]->convert(value);
+                }
+                result[batch_req_idx[op_idx]] = value;
+            }
+        }
+        return result;
+    }
+
+    void MSRIOGroup::write_controls(const std::vector<geopm_request_s> &requests,
+                                    const std::vector<double> &settings)
+    {
+        if (requests.size() != settings.size()) {
+            throw Exception("MSRIOGroup::write_controls(): number of settings does not match number of requests",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        int batch_ctx = oneshot_batch_context();
+        bool is_batched = false;
+        for (size_t req_idx = 0; req_idx < requests.size(); ++req_idx) {
+            const geopm_request_s &req = requests[req_idx];
+            check_control(req.name);
+
+            if (!is_valid_control(req.name)) {
+                throw Exception("MSRIOGroup::write_controls(): control name \"" +
+                                std::string(req.name) + "\" not found",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (req.domain_type != control_domain_type(req.name)) {
+                throw Exception("MSRIOGroup::write_controls(): domain_type does not match the domain of the control.",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (req.domain_idx < 0 || req.domain_idx >= m_platform_topo.num_domain(req.domain_type)) {
+                throw Exception("MSRIOGroup::write_controls(): domain_idx out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+
+            std::string control_name(req.name);
+            if (control_name == "CPU_POWER_LIMIT_CONTROL") {
+                is_batched |= adjust_oneshot("MSR::PKG_POWER_LIMIT:PL1_LIMIT_ENABLE",
+                                             req.domain_idx, 1.0, batch_ctx);
+            }
+            else if (control_name == "BOARD_POWER_LIMIT_CONTROL") {
+                is_batched |= adjust_oneshot("MSR::PLATFORM_POWER_LIMIT:PL1_LIMIT_ENABLE",
+                                             req.domain_idx, 1.0, batch_ctx);
+            }
+            is_batched |= adjust_oneshot(control_name, req.domain_idx,
+                                         settings[req_idx], batch_ctx);
+        }
+        if (is_batched) {
+            m_msrio->write_batch(batch_ctx);
+        }
+    }
+
+    int MSRIOGroup::oneshot_batch_context(void)
+    {
+        if (m_oneshot_ctx == -1) {
+            m_oneshot_ctx = m_msrio->create_batch_context();
+        }
+        else {
+            m_msrio->reset_batch_context(m_oneshot_ctx);
+        }
+        return m_oneshot_ctx;
+    }
+
+    bool MSRIOGroup::adjust_oneshot(const std::string &control_name, int domain_idx,
+                                    double setting, int batch_ctx)
+    {
+        std::shared_ptr<Control> control = m_control_available.at(control_name).controls[domain_idx];
+        std::vector<std::shared_ptr<MSRFieldControl> > field_controls;
+        auto domain_control = std::dynamic_pointer_cast<DomainControl>(control);
+        if (domain_control) {
+            for (const auto &cpu_control : domain_control->controls()) {
+                auto field_control = std::dynamic_pointer_cast<MSRFieldControl>(cpu_control);
+                if (!field_control) {
+                    field_controls.clear();
+                    break;
+                }
+                field_controls.push_back(field_control);
+            }
+        }
+        bool result = !field_controls.empty();
+        if (result) {
+            for (const auto &field_control : field_controls) {
+                field_control->adjust(setting, batch_ctx);
+            }
+        }
+        else {
+            control->write(setting);
+        }
+        return result;
+    }
+
     void MSRIOGroup::save_control(void)
     {
         for (auto &ctl : m_control_available) {
@@ -1491,6 +1628,15 @@ namespace geopm
                                   "in \"" + msr_name + ":" + field_name + "\"");
     }
 
+    std::shared_ptr<Signal> MSRIOGroup::raw_msr_signal(int cpu_idx, uint64_t msr_offset)
+    {
+        std::shared_ptr<Signal> &result = m_raw_msr_signal[std::make_pair(cpu_idx, msr_offset)];
+        if (result == nullptr) {
+            result = std::make_shared<RawMSRSignal>(m_msrio, cpu_idx, msr_offset);
+        }
+        return result;
+    }
+
     void MSRIOGroup::add_raw_msr_signal(const std::string &msr_name, int domain_type,
                                         uint64_t msr_offset)
     {
@@ -1508,9 +1654,7 @@ namespace geopm
             std::set<int> cpus = m_platform_topo.domain_nested(GEOPM_DOMAIN_CPU,
                                                                domain_type, domain_idx);
             int cpu_idx = *(cpus.begin());
-            std::shared_ptr<Signal> raw_msr =
-                std::make_shared<RawMSRSignal>(m_msrio, cpu_idx, msr_offset);
-            result.push_back(raw_msr);
+            result.push_back(raw_msr_signal(cpu_idx, msr_offset));
         }
         m_signal_available[raw_msr_signal_name] = {
             .signals = result,
@@ -80,6 +80,9 @@ namespace geopm
                                int domain_type,
                                int domain_idx,
                                double setting) override;
+            std::vector<double> read_signals(const std::vector<geopm_request_s> &requests) override;
+            void write_controls(const std::vector<geopm_request_s> &requests,
+                                const std::vector<double> &settings) override;
             void save_control(void) override;
             void restore_control(void) override;
             std::function<double(const std::vector<double> &)> agg_function(const std::string &signal_name) const override;
@@ -173,6 +176,18 @@ namespace geopm
             void check_control(const std::string &control_name);
 
             void check_control_pwrite(void);
+            /// @brief Get an empty batch context of the MSRIO used by
+            ///        read_signals() and write_controls().  The
+            ///        context is created on first use and reset on
+            ///        each later use.
+            int oneshot_batch_context(void);
+            /// @brief Add the write of a control to a batch context
+            ///        if all of the MSR fields it modifies can be
+            ///        batched, otherwise write the control.
+            /// @return True if the write was added to the batch
+            ///         context.
+            bool adjust_oneshot(const std::string &control_name, int domain_idx,
+                                double setting, int batch_ctx);
 
             /// @brief Check control lock and error if locked
             void check_control_lock(const std::string &lock_name, const std::string &error);
@@ -191,6 +206,9 @@ namespace geopm
             static bool json_check_is_valid_domain(const json11::Json &domain);
             static bool json_check_is_integer(const json11::Json &num);
             static bool json_check_is_valid_aggregation(const json11::Json &obj);
+            // Get the raw signal for an MSR on a CPU, shared by all
+            // signals that read the same register
+            std::shared_ptr<Signal> raw_msr_signal(int cpu_idx, uint64_t msr_offset);
             // Add raw MSR as an available signal
             void add_raw_msr_signal(const std::string &msr_name, int domain_type, uint64_t msr_offset);
             // Add a bitfield of an MSR as an available signal
@@ -211,6 +229,7 @@ namespace geopm
             const PlatformTopo &m_platform_topo;
             std::shared_ptr<MSRIO> m_msrio;
             int m_save_restore_ctx;
+            int m_oneshot_ctx;
             std::shared_ptr<Cpuid> m_cpuid;
             bool m_is_active;
             bool m_is_read;
@@ -244,6 +263,8 @@ namespace geopm
                 std::function<std::string(double)> format_function;
             };
             std::map<std::string, signal_info> m_signal_available;
+            // Raw MSR signals keyed by CPU index and MSR offset
+            std::map<std::pair<int, uint64_t>, std::shared_ptr<Signal> > m_raw_msr_signal;
 
             struct control_info
             {
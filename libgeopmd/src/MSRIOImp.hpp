@@ -34,6 +34,7 @@ namespace geopm
                            uint64_t raw_value,
                            uint64_t write_mask) override;
             int create_batch_context(void) override;
+            void reset_batch_context(int batch_ctx) override;
             int add_read(int cpu_idx, uint64_t offset) override;
             int add_read(int cpu_idx, uint64_t offset, int batch_ctx) override;
             void read_batch() override;
@@ -62,6 +63,15 @@ namespace geopm
                 struct m_msr_batch_op_s *ops;  /// @brief In: Array[numops] of operations
             };
 
+            /// @brief IOUring batch prepared from a batch array, with
+            ///        the array state it was prepared from so that it
+            ///        can be rebuilt when operations are added.
+            struct m_prepared_batch_s {
+                std::unique_ptr<IOUringBatch> batch;
+                const struct m_msr_batch_op_s *ops;
+                uint32_t numops;
+            };
+
             struct m_batch_context_s {
                 m_batch_context_s(int num_cpu)
                     : m_is_batch_read(false)
@@ -71,6 +81,9 @@ namespace geopm
                     , m_write_batch_op(0)
                     , m_read_batch_idx_map(num_cpu)
                     , m_write_batch_idx_map(num_cpu)
+                    , m_read_prepared({nullptr, nullptr, 0})
+                    , m_rmw_read_prepared({nullptr, nullptr, 0})
+                    , m_rmw_write_prepared({nullptr, nullptr, 0})
                 {}
 
                 bool m_is_batch_read;
@@ -82,6 +95,9 @@ namespace geopm
                 std::vector<std::map<uint64_t, int> > m_write_batch_idx_map;
                 std::vector<uint64_t> m_write_val;
                 std::vector<uint64_t> m_write_mask;
+                struct m_prepared_batch_s m_read_prepared;
+                struct m_prepared_batch_s m_rmw_read_prepared;
+                struct m_prepared_batch_s m_rmw_write_prepared;
             };
 
             void open_all(void);
@@ -95,7 +111,10 @@ namespace geopm
             void msr_ioctl(struct m_msr_batch_array_s &batch);
             void msr_ioctl_read(struct m_batch_context_s &ctx);
             void msr_ioctl_write(struct m_batch_context_s &ctx);
-            void msr_batch_io(IOUring &batcher, struct m_msr_batch_array_s &batch);
+            void msr_batch_io(IOUring &batcher,
+                              struct m_prepared_batch_s &prepared,
+                              struct m_msr_batch_array_s &batch,
+                              bool is_read);
             void msr_read_files(int batch_ctx);
             void msr_rmw_files(int batch_ctx);
 
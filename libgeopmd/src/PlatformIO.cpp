@@ -21,10 +21,12 @@
 #include "geopm/PlatformTopo.hpp"
 
 #include "geopm_pio.h"
+#include "geopm_time.h"
 #include "BatchServer.hpp"
 #include "CombinedControl.hpp"
 #include "CombinedSignal.hpp"
 #include "ServiceIOGroup.hpp"
+#include "WorkerPool.hpp"
 
 namespace geopm
 {
@@ -230,11 +232,21 @@ namespace geopm
 
     PlatformIOImp::PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
                                  const PlatformTopo &topo)
+        : PlatformIOImp(std::move(iogroup_list), topo, num_batch_thread_env())
+    {
+
+    }
+
+    PlatformIOImp::PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
+                                 const PlatformTopo &topo,
+                                 int num_batch_thread)
         : m_is_signal_active(false)
         , m_is_control_active(false)
         , m_platform_topo(topo)
         , m_iogroup_list(std::move(iogroup_list))
         , m_do_restore(false)
+        , m_worker_pool(num_batch_thread > 0 ?
+                        geopm::make_unique<WorkerPool>(num_batch_thread) : nullptr)
     {
         if (m_iogroup_list.empty()) {
             for (const auto &it : IOGroup::iogroup_names()) {
@@ -255,6 +267,27 @@ namespace geopm
         }
     }
 
+    PlatformIOImp::~PlatformIOImp() = default;
+
+    int PlatformIOImp::num_batch_thread_env(void)
+    {
+        int result = 0;
+        std::string env_str = get_env("GEOPM_PIO_BATCH_THREADS");
+        if (!env_str.empty()) {
+            try {
+                result = std::stoi(env_str);
+            }
+            catch (const std::exception &) {
+                result = -1;
+            }
+            if (result < 0) {
+                throw Exception("PlatformIOImp: GEOPM_PIO_BATCH_THREADS must be a non-negative integer: " +
+                                env_str, GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
+        return result;
+    }
+
     void PlatformIOImp::register_iogroup(std::shared_ptr<IOGroup> iogroup)
     {
         if (m_do_restore) {
@@ -671,13 +704,43 @@ namespace geopm
         return result;
     }
 
+    void PlatformIOImp::sample_range(int signal_idx_begin,
+                                     int num_signal,
+                                     double *result)
+    {
+        if (signal_idx_begin < 0 || num_signal < 0 ||
+            signal_idx_begin + num_signal > num_signal_pushed()) {
+            throw Exception("PlatformIOImp::sample_range(): signal_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (!m_is_signal_active) {
+            throw Exception("PlatformIOImp::sample_range(): read_batch() not called prior to call to sample_range()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        for (int offset = 0; offset < num_signal; ++offset) {
+            auto &group_idx_pair = m_active_signal[signal_idx_begin + offset];
+            if (group_idx_pair.first) {
+                result[offset] = group_idx_pair.first->sample(group_idx_pair.second);
+            }
+            else {
+                result[offset] = sample_combined(group_idx_pair.second);
+            }
+        }
+    }
+
+    void PlatformIOImp::sample_all(std::vector<double> &result)
+    {
+        result.resize(num_signal_pushed());
+        sample_range(0, result.size(), result.data());
+    }
+
     double PlatformIOImp::sample_combined(int signal_idx)
     {
         double result = NAN;
         auto &op_obj_pair = m_combined_signal.at(signal_idx);
         std::vector<int> &operand_idx = op_obj_pair.first;
         auto &signal = op_obj_pair.second;
-        std::vector<double> operands(operand_idx.size());
+        std::vector<double> &operands = signal->operand_buffer(operand_idx.size());
         for (size_t ii = 0; ii < operands.size(); ++ii) {
             operands[ii] = sample(operand_idx[ii]);
         }
@@ -719,19 +782,70 @@ namespace geopm
 
     void PlatformIOImp::read_batch(void)
     {
-        for (auto &it : m_iogroup_list) {
-            it->read_batch();
-        }
+        batch_iogroup(true);
         m_is_signal_active = true;
     }
 
     void PlatformIOImp::write_batch(void)
     {
-        for (auto &it : m_iogroup_list) {
-            it->write_batch();
+        batch_iogroup(false);
+    }
+
+    void PlatformIOImp::batch_iogroup(bool is_read)
+    {
+        if (m_batch_iogroup.size() != m_iogroup_list.size()) {
+            // IOGroups are only ever appended to the list
+            m_batch_iogroup.assign(m_iogroup_list.begin(), m_iogroup_list.end());
+            m_read_batch_latency.resize(m_batch_iogroup.size(), 0.0);
+        }
+        if (m_worker_pool == nullptr) {
+            for (auto &group : m_batch_iogroup) {
+                if (is_read) {
+                    group->read_batch();
+                }
+                else {
+                    group->write_batch();
+                }
+            }
+            return;
+        }
+        // Latency is only measured when a worker pool is configured
+        // so that the default serial path does not read the clock
+        auto task = [this, is_read](int group_idx) {
+            IOGroup &group = *m_batch_iogroup[group_idx];
+            if (is_read) {
+                geopm_time_s begin;
+                geopm_time(&begin);
+                group.read_batch();
+                m_read_batch_latency[group_idx] = geopm_time_since(&begin);
+            }
+            else {
+                group.write_batch();
+            }
+        };
+        int num_group = m_batch_iogroup.size();
+        if (num_group > 1) {
+            m_worker_pool->run(num_group, task);
+        }
+        else {
+            for (int group_idx = 0; group_idx < num_group; ++group_idx) {
+                task(group_idx);
+            }
         }
     }
 
+    std::map<std::string, double> PlatformIOImp::read_batch_latency(void) const
+    {
+        std::map<std::string, double> result;
+        if (m_worker_pool == nullptr) {
+            return result;
+        }
+        for (size_t group_idx = 0; group_idx < m_read_batch_latency.size(); ++group_idx) {
+            result[m_batch_iogroup[group_idx]->name()] += m_read_batch_latency[group_idx];
+        }
+        return result;
+    }
+
     double PlatformIOImp::read_signal(const std::string &signal_name,
                                       int domain_type,
                                       int domain_idx)
@@ -785,6 +899,94 @@ namespace geopm
         return result;
     }
 
+    geopm_request_s PlatformIOImp::make_request(const std::string &name,
+                                                int domain_type,
+                                                int domain_idx)
+    {
+        if (name.size() >= NAME_MAX) {
+            throw Exception("PlatformIOImp::make_request(): name is too long: \"" + name + "\"",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        geopm_request_s result {domain_type, domain_idx, {}};
+        name.copy(result.name, NAME_MAX - 1);
+        return result;
+    }
+
+    std::vector<double> PlatformIOImp::read_signals(const std::vector<geopm_request_s> &requests)
+    {
+        std::vector<double> result(requests.size(), NAN);
+        // Requests for a signal in its native domain are grouped by
+        // the IOGroup that provides it so that each IOGroup can read
+        // all of its requests in one operation.  All other requests
+        // go through read_signal() for domain conversion.
+        std::vector<std::pair<std::shared_ptr<IOGroup>, std::vector<int> > > group_request;
+        std::vector<int> other_request;
+        for (int req_idx = 0; req_idx < (int)requests.size(); ++req_idx) {
+            const geopm_request_s &req = requests[req_idx];
+            if (req.domain_type < 0 || req.domain_type >= GEOPM_NUM_DOMAIN) {
+                throw Exception("PlatformIOImp::read_signals(): domain_type is out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (req.domain_idx < 0 || req.domain_idx >= m_platform_topo.num_domain(req.domain_type)) {
+                throw Exception("PlatformIOImp::read_signals(): domain_idx is out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            auto iogroups = find_signal_iogroup(req.name);
+            if (iogroups.empty()) {
+                throw Exception("PlatformIOImp::read_signals(): signal name \"" +
+                                std::string(req.name) + "\" not found",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (iogroups[0]->signal_domain_type(req.name) == req.domain_type) {
+                auto group_it = std::find_if(group_request.begin(), group_request.end(),
+                                             [&iogroups](const auto &group_request_pair) {
+                                                 return group_request_pair.first == iogroups[0];
+                                             });
+                if (group_it == group_request.end()) {
+                    group_it = group_request.emplace(group_request.end(),
+                                                     iogroups[0], std::vector<int>{});
+                }
+                group_it->second.push_back(req_idx);
+            }
+            else {
+                other_request.push_back(req_idx);
+            }
+        }
+        for (const auto &group_request_pair : group_request) {
+            const auto &req_idx_list = group_request_pair.second;
+            std::vector<geopm_request_s> group_requests;
+            group_requests.reserve(req_idx_list.size());
+            for (int req_idx : req_idx_list) {
+                group_requests.push_back(requests[req_idx]);
+            }
+            std::vector<double> group_result;
+            try {
+                group_result = group_request_pair.first->read_signals(group_requests);
+            }
+            catch (const geopm::Exception &ex) {
+                // Fall back to reading each request individually,
+                // which will try any other IOGroup that provides the
+                // signal and report the errors if all of them fail.
+                group_result.clear();
+            }
+            if (group_result.size() == req_idx_list.size()) {
+                for (size_t group_idx = 0; group_idx < req_idx_list.size(); ++group_idx) {
+                    result[req_idx_list[group_idx]] = group_result[group_idx];
+                }
+            }
+            else {
+                for (int req_idx : req_idx_list) {
+                    other_request.push_back(req_idx);
+                }
+            }
+        }
+        for (int req_idx : other_request) {
+            const geopm_request_s &req = requests[req_idx];
+            result[req_idx] = read_signal(req.name, req.domain_type, req.domain_idx);
+        }
+        return result;
+    }
+
     double PlatformIOImp::read_signal_convert_domain(const std::string &signal_name,
                                                      int domain_type,
                                                      int domain_idx)
@@ -794,11 +996,14 @@ namespace geopm
         if (m_platform_topo.is_nested_domain(base_domain_type, domain_type)) {
             std::set<int> base_domain_idx = m_platform_topo.domain_nested(base_domain_type,
                                                                           domain_type, domain_idx);
-            std::vector<double> values;
+            // Read all of the nested domains with one request to the
+            // IOGroup so that it may access them in a single batch
+            std::vector<geopm_request_s> requests;
+            requests.reserve(base_domain_idx.size());
             for (auto idx : base_domain_idx) {
-                values.push_back(read_signal(signal_name, base_domain_type, idx));
+                requests.push_back(make_request(signal_name, base_domain_type, idx));
             }
-            result = agg_function(signal_name)(values);
+            result = agg_function(signal_name)(read_signals(requests));
         }
         else {
             throw Exception("PlatformIOImp::read_signal(): domain " + std::to_string(domain_type) +
@@ -872,8 +1077,30 @@ namespace geopm
                 !is_control_adjust_same(control_name)) {
                 setting /= base_domain_idx.size();
             }
+            // Write all of the nested domains with one request to the
+            // IOGroup so that it may access them in a single batch.
+            // If that fails, write each domain individually to allow
+            // fallback to other IOGroups that provide the control.
+            std::vector<geopm_request_s> requests;
+            requests.reserve(base_domain_idx.size());
             for (auto idx : base_domain_idx) {
-                write_control(control_name, base_domain_type, idx, setting);
+                requests.push_back(make_request(control_name, base_domain_type, idx));
+            }
+            bool is_write_complete = false;
+            auto iogroups = find_control_iogroup(control_name);
+            if (!iogroups.empty()) {
+                try {
+                    iogroups[0]->write_controls(requests, std::vector<double>(requests.size(), setting));
+                    is_write_complete = true;
+                }
+                catch (const geopm::Exception &ex) {
+                    // Errors are reported by write_control() below
+                }
+            }
+            if (!is_write_complete) {
+                for (auto idx : base_domain_idx) {
+                    write_control(control_name, base_domain_type, idx, setting);
+                }
             }
         }
         else {
@@ -995,13 +1222,25 @@ namespace geopm
                                            const std::vector<geopm_request_s> &control_config,
                                            int &server_pid,
                                            std::string &server_key)
+    {
+        start_batch_server(client_pid, signal_config, control_config, 0.0,
+                           server_pid, server_key);
+    }
+
+    void PlatformIOImp::start_batch_server(int client_pid,
+                                           const std::vector<geopm_request_s> &signal_config,
+                                           const std::vector<geopm_request_s> &control_config,
+                                           double sample_period,
+                                           int &server_pid,
+                                           std::string &server_key)
     {
         if (signal_config.empty() && control_config.empty()) {
             throw Exception("PlatformIOImp::start_batch_server(): Requested a batch server, but no signals or controls were specified",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
         std::shared_ptr<BatchServer> batch_server =
-            BatchServer::make_unique(client_pid, signal_config, control_config);
+            BatchServer::make_unique(client_pid, signal_config, control_config,
+                                     sample_period);
         server_pid = batch_server->server_pid();
         server_key = batch_server->server_key();
         if (m_batch_server.find(server_pid) != m_batch_server.end()) {
@@ -1027,6 +1266,51 @@ namespace geopm
         m_batch_server.erase(it);
     }
 
+    std::map<std::string, double> PlatformIO::read_batch_latency(void) const
+    {
+        return {};
+    }
+
+    void PlatformIO::start_batch_server(int client_pid,
+                                        const std::vector<geopm_request_s> &signal_config,
+                                        const std::vector<geopm_request_s> &control_config,
+                                        double sample_period,
+                                        int &server_pid,
+                                        std::string &server_key)
+    {
+        if (sample_period != 0.0) {
+            throw Exception("PlatformIO::start_batch_server(): Sampling batch server is not supported by this PlatformIO",
+                            GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
+        }
+        start_batch_server(client_pid, signal_config, control_config,
+                           server_pid, server_key);
+    }
+
+    void PlatformIO::sample_range(int signal_idx_begin,
+                                  int num_signal,
+                                  double *result)
+    {
+        for (int idx = 0; idx < num_signal; ++idx) {
+            result[idx] = sample(signal_idx_begin + idx);
+        }
+    }
+
+    void PlatformIO::sample_all(std::vector<double> &result)
+    {
+        throw Exception("PlatformIO::sample_all(): Not supported by this PlatformIO, use sample_range()",
+                        GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
+    }
+
+    std::vector<double> PlatformIO::read_signals(const std::vector<geopm_request_s> &requests)
+    {
+        std::vector<double> result;
+        result.reserve(requests.size());
+        for (const auto &req : requests) {
+            result.push_back(read_signal(req.name, req.domain_type, req.domain_idx));
+        }
+        return result;
+    }
+
     bool PlatformIO::is_valid_value(double value)
     {
         return !std::isnan(value);
@@ -1162,6 +1446,26 @@ extern "C" {
         return err;
     }
 
+    int geopm_pio_read_signals(int num_request, const struct geopm_request_s *requests,
+                               double *result)
+    {
+        int err = 0;
+        try {
+            if (num_request < 0) {
+                throw geopm::Exception("geopm_pio_read_signals(): num_request is negative",
+                                       GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            std::vector<geopm_request_s> request_vec(requests, requests + num_request);
+            std::vector<double> result_vec = geopm::platform_io().read_signals(request_vec);
+            std::copy(result_vec.begin(), result_vec.end(), result);
+        }
+        catch (...) {
+            err = geopm::exception_handler(std::current_exception());
+            err = err < 0 ? err : GEOPM_ERROR_RUNTIME;
+        }
+        return err;
+    }
+
     int geopm_pio_write_control(const char *control_name, int domain_type,
                                 int domain_idx, double setting)
     {
@@ -1215,6 +1519,19 @@ extern "C" {
         return err;
     }
 
+    int geopm_pio_sample_array(int signal_idx_begin, int num_signal, double *result)
+    {
+        int err = 0;
+        try {
+            geopm::platform_io().sample_range(signal_idx_begin, num_signal, result);
+        }
+        catch (...) {
+            err = geopm::exception_handler(std::current_exception());
+            err = err < 0 ? err : GEOPM_ERROR_RUNTIME;
+        }
+        return err;
+    }
+
     int geopm_pio_adjust(int control_idx, double setting)
     {
         int err = 0;
@@ -1375,6 +1692,23 @@ extern "C" {
                                      int *server_pid,
                                      int key_size,
                                      char *server_key)
+    {
+        return geopm_pio_start_batch_server_sampling(client_pid,
+                                                     num_signal, signal_config,
+                                                     num_control, control_config,
+                                                     0.0, server_pid,
+                                                     key_size, server_key);
+    }
+
+    int geopm_pio_start_batch_server_sampling(int client_pid,
+                                              int num_signal,
+                                              const struct geopm_request_s *signal_config,
+                                              int num_control,
+                                              const struct geopm_request_s *control_config,
+                                              double sample_period,
+                                              int *server_pid,
+                                              int key_size,
+                                              char *server_key)
     {
         int err = 0;
         try {
@@ -1394,6 +1728,7 @@ extern "C" {
             geopm::platform_io().start_batch_server(client_pid,
                                                     signal_config_vec,
                                                     control_config_vec,
+                                                    sample_period,
                                                     *server_pid,
                                                     server_key_str);
             strncpy(server_key, server_key_str.c_str(), key_size);
@@ -20,6 +20,7 @@ namespace geopm
     class CombinedControl;
     class PlatformTopo;
     class BatchServer;
+    class WorkerPool;
 
     class PlatformIOImp : public PlatformIO
     {
@@ -27,9 +28,16 @@ namespace geopm
             PlatformIOImp();
             PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
                           const PlatformTopo &topo);
+            /// @param [in] num_batch_thread Number of worker threads
+            ///        used to call IOGroup read_batch() and
+            ///        write_batch() concurrently.  If zero, IOGroups
+            ///        are called serially by the calling thread.
+            PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
+                          const PlatformTopo &topo,
+                          int num_batch_thread);
             PlatformIOImp(const PlatformIOImp &other) = delete;
             PlatformIOImp &operator=(const PlatformIOImp &other) = delete;
-            virtual ~PlatformIOImp() = default;
+            virtual ~PlatformIOImp();
             void register_iogroup(std::shared_ptr<IOGroup> iogroup) override;
             std::set<std::string> signal_names(void) const override;
             std::set<std::string> control_names(void) const override;
@@ -42,12 +50,18 @@ namespace geopm
                              int domain_type,
                              int domain_idx) override;
             double sample(int signal_idx) override;
+            void sample_range(int signal_idx_begin,
+                              int num_signal,
+                              double *result) override;
+            void sample_all(std::vector<double> &result) override;
             void adjust(int control_idx, double setting) override;
             void read_batch(void) override;
             void write_batch(void) override;
+            std::map<std::string, double> read_batch_latency(void) const override;
             double read_signal(const std::string &signal_name,
                                int domain_type,
                                int domain_idx) override;
+            std::vector<double> read_signals(const std::vector<geopm_request_s> &requests) override;
             void write_control(const std::string &control_name,
                                int domain_type,
                                int domain_idx,
@@ -66,6 +80,12 @@ namespace geopm
                                     const std::vector<geopm_request_s> &control_config,
                                     int &server_pid,
                                     std::string &server_key) override;
+            void start_batch_server(int client_pid,
+                                    const std::vector<geopm_request_s> &signal_config,
+                                    const std::vector<geopm_request_s> &control_config,
+                                    double sample_period,
+                                    int &server_pid,
+                                    std::string &server_key) override;
             void stop_batch_server(int server_pid) override;
 
             int num_signal_pushed(void) const;  // Used for testing only
@@ -120,6 +140,11 @@ namespace geopm
                                               int domain_type,
                                               int domain_idx,
                                               double setting);
+            /// @brief Build a request for a signal or control in
+            ///        one domain.
+            static geopm_request_s make_request(const std::string &name,
+                                                int domain_type,
+                                                int domain_idx);
             /// @brief Sample a combined signal using the saved function and operands.
             double sample_combined(int signal_idx);
             void adjust_combined(int control_idx, double setting);
@@ -132,6 +157,13 @@ namespace geopm
             ///        setting will be divided by the number of subdomains
             ///        before being applied.
             bool is_control_adjust_same(const std::string &control_name) const;
+            /// @brief Call read_batch() or write_batch() on every
+            ///        IOGroup, concurrently if a worker pool is
+            ///        configured.
+            void batch_iogroup(bool is_read);
+            /// @brief Number of batch worker threads requested by the
+            ///        GEOPM_PIO_BATCH_THREADS environment variable.
+            static int num_batch_thread_env(void);
             bool m_is_signal_active;
             bool m_is_control_active;
             const PlatformTopo &m_platform_topo;
@@ -147,6 +179,9 @@ namespace geopm
             bool m_do_restore;
             std::map<int, std::shared_ptr<BatchServer> > m_batch_server;
             std::set<std::string> m_pushed_signal_names;
+            std::unique_ptr<WorkerPool> m_worker_pool;
+            std::vector<std::shared_ptr<IOGroup> > m_batch_iogroup;
+            std::vector<double> m_read_batch_latency;
             static const std::map<const std::string, const std::string> m_signal_descriptions;
             static const std::map<const std::string, const std::string> m_control_descriptions;
     };
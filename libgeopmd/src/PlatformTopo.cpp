@@ -6,7 +6,6 @@
 
 #include "PlatformTopoImp.hpp"
 
-#include <signal.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/sysinfo.h>
@@ -15,13 +14,16 @@
 #include <string.h>
 #include <errno.h>
 #include <limits.h>
-#include <stdio.h>
 
+#include <algorithm>
 #include <map>
 #include <fstream>
+#include <iomanip>
 #include <sstream>
+#include <set>
 #include <string>
 #include <stdexcept>
+#include <vector>
 
 #include "geopm_sched.h"
 #include "geopm_time.h"
@@ -39,38 +41,41 @@ int geopm_read_cpuid(void)
     return cpuid_obj->cpuid();
 }
 
-static volatile unsigned g_is_popen_complete = 0;
-static struct sigaction g_popen_complete_signal_action;
-
-static void geopm_topo_popen_complete(int signum)
+// Parse a Linux CPU list, e.g. "0-3,8-11", into a set of CPU indices
+static std::set<int> geopm_topo_parse_cpu_list(const std::string &cpu_list)
 {
-    if (signum == SIGCHLD) {
-        g_is_popen_complete = 1;
+    std::set<int> result;
+    size_t end_pos = cpu_list.find_last_not_of(" \t\n");
+    if (end_pos == std::string::npos) {
+        return result;
+    }
+    for (const auto &range : geopm::string_split(cpu_list.substr(0, end_pos + 1), ",")) {
+        size_t dash_pos = range.find('-');
+        int first_cpu = std::stoi(range.substr(0, dash_pos));
+        int last_cpu = dash_pos == std::string::npos ?
+                       first_cpu : std::stoi(range.substr(dash_pos + 1));
+        for (int cpu_idx = first_cpu; cpu_idx <= last_cpu; ++cpu_idx) {
+            result.insert(cpu_idx);
+        }
     }
+    return result;
 }
 
-static int geopm_topo_popen(const char *cmd, FILE **fid)
+// Format a set of CPU indices as a hexadecimal mask in the format
+// printed by "lscpu -x" with CPU 0 in the least significant bit
+static std::string geopm_topo_cpu_mask(const std::set<int> &cpu_set)
 {
-    int err = 0;
-    *fid = NULL;
-
-    struct sigaction save_action;
-    g_popen_complete_signal_action.sa_handler = geopm_topo_popen_complete;
-    sigemptyset(&g_popen_complete_signal_action.sa_mask);
-    g_popen_complete_signal_action.sa_flags = 0;
-    err = sigaction(SIGCHLD, &g_popen_complete_signal_action, &save_action);
-    if (!err) {
-        *fid = popen(cmd, "r");
-        while (*fid && !g_is_popen_complete) {
-
-        }
-        g_is_popen_complete = 0;
-        sigaction(SIGCHLD, &save_action, NULL);
-        if (*fid == NULL) {
-            err = errno ? errno : GEOPM_ERROR_RUNTIME;
-        }
+    static const char HEX_DIGIT[] = "0123456789abcdef";
+    int num_nibble = cpu_set.empty() ? 1 : *cpu_set.rbegin() / 4 + 1;
+    std::vector<int> nibble(num_nibble, 0);
+    for (int cpu_idx : cpu_set) {
+        nibble[num_nibble - 1 - cpu_idx / 4] |= 1 << (cpu_idx % 4);
+    }
+    std::string result = "0x";
+    for (int value : nibble) {
+        result += HEX_DIGIT[value];
     }
-    return err;
+    return result;
 }
 
 namespace geopm
@@ -112,7 +117,16 @@ namespace geopm
 
     PlatformTopoImp::PlatformTopoImp(const std::string &test_cache_file_name,
                                      std::shared_ptr<ServiceProxy> service_proxy)
+        : PlatformTopoImp(test_cache_file_name, std::move(service_proxy), "")
+    {
+
+    }
+
+    PlatformTopoImp::PlatformTopoImp(const std::string &test_cache_file_name,
+                                     std::shared_ptr<ServiceProxy> service_proxy,
+                                     const std::string &test_root_path)
         : M_TEST_CACHE_FILE_NAME(test_cache_file_name)
+        , M_TEST_ROOT_PATH(test_root_path)
         , m_service_proxy(std::move(service_proxy))
     {
         std::map<std::string, std::string> lscpu_map;
@@ -439,6 +453,12 @@ namespace geopm
     }
 
     void PlatformTopoImp::create_cache(const std::string &cache_file_name, const GPUTopo &gtopo)
+    {
+        create_cache(cache_file_name, gtopo, "");
+    }
+
+    void PlatformTopoImp::create_cache(const std::string &cache_file_name, const GPUTopo &gtopo,
+                                       const std::string &root_path)
     {
         // If cache file is not present, or is too old, create it
         bool is_file_ok = false;
@@ -466,19 +486,20 @@ namespace geopm
             }
             close(tmp_fd);
 
-            std::ostringstream cmd;
-            cmd << "unset LD_PRELOAD; LC_ALL=C lscpu -x >> " << tmp_path << ";";
-
-            FILE *pid;
-            int err = geopm_topo_popen(cmd.str().c_str(), &pid);
-            if (err) {
+            std::string topo_str;
+            try {
+                topo_str = read_system_topo(root_path);
+            }
+            catch (...) {
                 unlink(tmp_path);
-                throw Exception("PlatformTopo::create_cache(): Could not popen lscpu command: ",
-                                err, __FILE__, __LINE__);
+                throw;
             }
-            if (pclose(pid)) {
+            std::ofstream topo_stream(tmp_path);
+            topo_stream << topo_str;
+            topo_stream.close();
+            if (!topo_stream.good()) {
                 unlink(tmp_path);
-                throw Exception("PlatformTopo::create_cache(): Could not pclose lscpu command: ",
+                throw Exception("PlatformTopo::create_cache(): Could not write temp file: ",
                                 errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
             }
             if (gtopo.num_gpu() != 0) {
@@ -503,7 +524,7 @@ namespace geopm
                 }
                 cache_stream.close();
             }
-            err = rename(tmp_path, cache_file_name.c_str());
+            int err = rename(tmp_path, cache_file_name.c_str());
             if (err) {
                 unlink(tmp_path);
                 throw Exception("PlatformTopo::create_cache(): Could not rename tmp_path: ",
@@ -512,6 +533,126 @@ namespace geopm
         }
     }
 
+    std::string PlatformTopoImp::read_system_topo(const std::string &root_path)
+    {
+        const std::string cpu_dir = root_path + "/sys/devices/system/cpu";
+        const std::string node_dir = root_path + "/sys/devices/system/node";
+        std::set<int> online_cpus;
+        std::set<int> present_cpus;
+        // Count the online threads of each core in each package.  A
+        // core is identified by its die and core IDs because core IDs
+        // repeat across the dies of a multi-die package.
+        std::map<int, std::map<std::pair<int, int>, int> > package_core_threads;
+        try {
+            online_cpus = geopm_topo_parse_cpu_list(geopm::read_file(cpu_dir + "/online"));
+            present_cpus = geopm_topo_parse_cpu_list(geopm::read_file(cpu_dir + "/present"));
+            for (int cpu_idx : online_cpus) {
+                std::string topo_dir = cpu_dir + "/cpu" + std::to_string(cpu_idx) + "/topology";
+                int package_id = std::stoi(geopm::read_file(topo_dir + "/physical_package_id"));
+                int core_id = std::stoi(geopm::read_file(topo_dir + "/core_id"));
+                int die_id = 0;
+                try {
+                    die_id = std::stoi(geopm::read_file(topo_dir + "/die_id"));
+                }
+                catch (const Exception &ex) {
+                    // Kernels before Linux 5.2 do not provide die_id
+                }
+                ++package_core_threads[package_id][{die_id, core_id}];
+            }
+        }
+        catch (const std::logic_error &ex) {
+            throw Exception("PlatformTopoImp::read_system_topo(): Unable to parse CPU topology from " +
+                            cpu_dir + ": " + ex.what(),
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        if (online_cpus.empty()) {
+            throw Exception("PlatformTopoImp::read_system_topo(): No online CPUs found in " + cpu_dir,
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        int core_per_package = 0;
+        int thread_per_core = 0;
+        for (const auto &package_it : package_core_threads) {
+            core_per_package = std::max(core_per_package, (int)package_it.second.size());
+            for (const auto &core_it : package_it.second) {
+                thread_per_core = std::max(thread_per_core, core_it.second);
+            }
+        }
+
+        // NUMA nodes are optional: kernels built without NUMA
+        // support do not provide the node directory
+        std::map<int, std::set<int> > numa_cpus;
+        std::vector<std::string> node_files;
+        try {
+            node_files = geopm::list_directory_files(node_dir);
+        }
+        catch (const Exception &ex) {
+            // All CPUs are assigned to one memory domain by parse_lscpu_numa()
+        }
+        for (const auto &file_name : node_files) {
+            if (geopm::string_begins_with(file_name, "node") &&
+                file_name.size() > 4 &&
+                file_name.find_first_not_of("0123456789", 4) == std::string::npos) {
+                int node_idx = std::stoi(file_name.substr(4));
+                numa_cpus[node_idx] = geopm_topo_parse_cpu_list(
+                    geopm::read_file(node_dir + "/" + file_name + "/cpulist"));
+            }
+        }
+
+        // Identify the processor from the first entry in cpuinfo
+        static const std::vector<std::pair<std::string, std::string> > cpuinfo_keys {
+            {"vendor_id", "Vendor ID"},
+            {"cpu family", "CPU family"},
+            {"model", "Model"},
+            {"model name", "Model name"},
+            {"stepping", "Stepping"},
+        };
+        std::map<std::string, std::string> cpuinfo_map;
+        std::string cpuinfo_str;
+        try {
+            cpuinfo_str = geopm::read_file(root_path + "/proc/cpuinfo");
+        }
+        catch (const Exception &ex) {
+            // Processor identification is informational only
+        }
+        std::istringstream cpuinfo_stream(cpuinfo_str);
+        std::string line;
+        while (std::getline(cpuinfo_stream, line) && !line.empty()) {
+            size_t colon_pos = line.find(':');
+            if (colon_pos != std::string::npos) {
+                std::string key = line.substr(0, line.find_last_not_of(" \t", colon_pos - 1) + 1);
+                size_t value_pos = line.find_first_not_of(" \t", colon_pos + 1);
+                cpuinfo_map.emplace(key, value_pos == std::string::npos ?
+                                         "" : line.substr(value_pos));
+            }
+        }
+
+        // Format the results the same way as "lscpu -x" so that
+        // existing caches and the parser remain compatible
+        std::ostringstream result;
+        auto print = [&result](const std::string &key, const std::string &value) {
+            result << std::left << std::setw(23) << key + ":" << value << "\n";
+        };
+        print("CPU(s)", std::to_string(present_cpus.size()));
+        print("On-line CPU(s) mask", geopm_topo_cpu_mask(online_cpus));
+        print("Thread(s) per core", std::to_string(thread_per_core));
+        print("Core(s) per socket", std::to_string(core_per_package));
+        print("Socket(s)", std::to_string(package_core_threads.size()));
+        if (!numa_cpus.empty()) {
+            print("NUMA node(s)", std::to_string(numa_cpus.size()));
+        }
+        for (const auto &key_it : cpuinfo_keys) {
+            auto value_it = cpuinfo_map.find(key_it.first);
+            if (value_it != cpuinfo_map.end()) {
+                print(key_it.second, value_it->second);
+            }
+        }
+        for (const auto &node_it : numa_cpus) {
+            print("NUMA node" + std::to_string(node_it.first) + " CPU(s)",
+                  geopm_topo_cpu_mask(node_it.second));
+        }
+        return result.str();
+    }
+
     void PlatformTopoImp::parse_lscpu(const std::map<std::string, std::string> &lscpu_map,
                                       int &num_package,
                                       int &core_per_package,
@@ -698,7 +839,7 @@ namespace geopm
         // Early return for mocked file in test case
         if (M_TEST_CACHE_FILE_NAME.size()) {
             auto mock_topo = std::make_unique<GPUTopoNull>();
-            create_cache(M_TEST_CACHE_FILE_NAME, *mock_topo);
+            create_cache(M_TEST_CACHE_FILE_NAME, *mock_topo, M_TEST_ROOT_PATH);
             return geopm::read_file(M_TEST_CACHE_FILE_NAME);
         }
         // In all other cases create a cache in /tmp
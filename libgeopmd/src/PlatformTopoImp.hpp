@@ -23,6 +23,12 @@ namespace geopm
             PlatformTopoImp();
             PlatformTopoImp(const std::string &test_cache_file_name,
                             std::shared_ptr<ServiceProxy> service_proxy);
+            /// @param [in] test_root_path Directory that replaces
+            ///        "/" when reading the topology from /sys and
+            ///        /proc to create the test cache file.
+            PlatformTopoImp(const std::string &test_cache_file_name,
+                            std::shared_ptr<ServiceProxy> service_proxy,
+                            const std::string &test_root_path);
             virtual ~PlatformTopoImp() = default;
             int num_domain(int domain_type) const override;
             int domain_idx(int domain_type,
@@ -32,6 +38,17 @@ namespace geopm
             static void create_cache();
             static void create_cache(const std::string &cache_file_name);
             static void create_cache(const std::string &cache_file_name, const GPUTopo &gtopo);
+            static void create_cache(const std::string &cache_file_name, const GPUTopo &gtopo,
+                                     const std::string &root_path);
+            /// @brief Read the CPU and NUMA topology from sysfs and
+            ///        the processor identification from
+            ///        /proc/cpuinfo.
+            /// @param [in] root_path Directory that replaces "/" in
+            ///        the paths that are read, empty for the running
+            ///        system.
+            /// @return Topology formatted like the output of
+            ///         "lscpu -x".
+            static std::string read_system_topo(const std::string &root_path);
         private:
             static const std::string M_CACHE_FILE_NAME;
             static const std::string M_SERVICE_CACHE_FILE_NAME;
@@ -52,6 +69,7 @@ namespace geopm
             static std::string gpu_short_name(int domain_type);
             static std::unique_ptr<ServiceProxy> try_service_proxy(void);
             const std::string M_TEST_CACHE_FILE_NAME;
+            const std::string M_TEST_ROOT_PATH;
             int m_num_package;
             int m_core_per_package;
             int m_thread_per_core;
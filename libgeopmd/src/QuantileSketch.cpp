@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "QuantileSketch.hpp"
+
+#include <cmath>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <string>
+
+#include "geopm/Exception.hpp"
+
+namespace geopm
+{
+    QuantileSketch::QuantileSketch()
+        : QuantileSketch(M_DEFAULT_RELATIVE_ACCURACY, M_DEFAULT_MAX_BUCKET)
+    {
+
+    }
+
+    QuantileSketch::QuantileSketch(double relative_accuracy, int max_bucket)
+        : M_RELATIVE_ACCURACY(relative_accuracy)
+        , M_MAX_BUCKET(max_bucket)
+        , M_GAMMA((1.0 + relative_accuracy) / (1.0 - relative_accuracy))
+        , M_LOG_GAMMA(std::log(M_GAMMA))
+        , M_MIN_MAGNITUDE(1.0e-12)
+        , m_zero_count(0)
+        , m_count(0)
+    {
+        if (!(relative_accuracy > 0.0 && relative_accuracy < 1.0)) {
+            throw Exception("QuantileSketch::QuantileSketch(): relative_accuracy must be in the range (0, 1): " +
+                            std::to_string(relative_accuracy),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (max_bucket < 2) {
+            throw Exception("QuantileSketch::QuantileSketch(): max_bucket must be at least 2: " +
+                            std::to_string(max_bucket),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    int QuantileSketch::bucket_index(double magnitude) const
+    {
+        // Infinite values are counted in the bucket for the largest
+        // finite value
+        magnitude = std::min(magnitude, std::numeric_limits<double>::max());
+        return (int)std::ceil(std::log(magnitude) / M_LOG_GAMMA);
+    }
+
+    double QuantileSketch::bucket_value(int index) const
+    {
+        // Value in the bucket (gamma^(index-1), gamma^index] with
+        // the smallest bound on relative error
+        return 2.0 * std::pow(M_GAMMA, index) / (M_GAMMA + 1.0);
+    }
+
+    void QuantileSketch::insert(double value)
+    {
+        if (std::isnan(value)) {
+            return;
+        }
+        if (value > M_MIN_MAGNITUDE) {
+            ++m_positive[bucket_index(value)];
+        }
+        else if (value < -M_MIN_MAGNITUDE) {
+            ++m_negative[bucket_index(-value)];
+        }
+        else {
+            ++m_zero_count;
+        }
+        ++m_count;
+        collapse();
+    }
+
+    void QuantileSketch::merge(const QuantileSketch &other)
+    {
+        if (other.M_RELATIVE_ACCURACY != M_RELATIVE_ACCURACY) {
+            throw Exception("QuantileSketch::merge(): relative accuracy of sketches does not match",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (const auto &it : other.m_positive) {
+            m_positive[it.first] += it.second;
+        }
+        for (const auto &it : other.m_negative) {
+            m_negative[it.first] += it.second;
+        }
+        m_zero_count += other.m_zero_count;
+        m_count += other.m_count;
+        collapse();
+    }
+
+    void QuantileSketch::collapse(void)
+    {
+        // Fold the buckets closest to zero into their neighbor until
+        // the number of buckets is within the limit.  Negative
+        // buckets are collapsed first so that the positive buckets
+        // keep their accuracy.
+        while (num_bucket() > M_MAX_BUCKET) {
+            auto &store = m_negative.size() > 1 ? m_negative : m_positive;
+            auto lowest = store.begin();
+            auto next = std::next(lowest);
+            next->second += lowest->second;
+            store.erase(lowest);
+        }
+    }
+
+    uint64_t QuantileSketch::count(void) const
+    {
+        return m_count;
+    }
+
+    double QuantileSketch::quantile(double quantile) const
+    {
+        if (!(quantile >= 0.0 && quantile <= 1.0)) {
+            throw Exception("QuantileSketch::quantile(): quantile must be in the range [0, 1]: " +
+                            std::to_string(quantile),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        double result = NAN;
+        if (m_count != 0) {
+            // Zero based rank of the value for the quantile
+            uint64_t rank = (uint64_t)(quantile * (m_count - 1));
+            uint64_t total = 0;
+            bool is_found = false;
+            // Negative values starting from the most negative
+            for (auto it = m_negative.rbegin();
+                 !is_found && it != m_negative.rend(); ++it) {
+                total += it->second;
+                if (total > rank) {
+                    result = -bucket_value(it->first);
+                    is_found = true;
+                }
+            }
+            if (!is_found) {
+                total += m_zero_count;
+                if (total > rank) {
+                    result = 0.0;
+                    is_found = true;
+                }
+            }
+            for (auto it = m_positive.begin();
+                 !is_found && it != m_positive.end(); ++it) {
+                total += it->second;
+                if (total > rank) {
+                    result = bucket_value(it->first);
+                    is_found = true;
+                }
+            }
+        }
+        return result;
+    }
+
+    double QuantileSketch::relative_accuracy(void) const
+    {
+        return M_RELATIVE_ACCURACY;
+    }
+
+    int QuantileSketch::num_bucket(void) const
+    {
+        return m_positive.size() + m_negative.size();
+    }
+
+    void QuantileSketch::reset(void)
+    {
+        m_positive.clear();
+        m_negative.clear();
+        m_zero_count = 0;
+        m_count = 0;
+    }
+}
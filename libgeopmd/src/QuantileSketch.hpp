@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef QUANTILESKETCH_HPP_INCLUDE
+#define QUANTILESKETCH_HPP_INCLUDE
+
+#include <cstdint>
+#include <map>
+
+namespace geopm
+{
+    /// @brief Streaming estimate of quantiles with bounded memory
+    ///
+    /// Values are counted in histogram buckets whose bounds grow
+    /// geometrically, so any quantile estimate is within the relative
+    /// accuracy of a value that was inserted.  Positive and negative
+    /// values are counted in separate sets of buckets, and values
+    /// close to zero are counted together.  If the number of buckets
+    /// exceeds the maximum, the buckets for the values closest to
+    /// zero are collapsed, so the estimates for the upper quantiles
+    /// of positive values keep their accuracy.  Two sketches with the
+    /// same relative accuracy can be merged without losing accuracy.
+    class QuantileSketch
+    {
+        public:
+            /// @brief Construct with the default relative accuracy
+            ///        and maximum number of buckets
+            QuantileSketch();
+            /// @brief Construct an empty sketch
+            ///
+            /// @param [in] relative_accuracy Bound on the relative
+            ///        error of quantile estimates, in the range (0, 1).
+            ///
+            /// @param [in] max_bucket Maximum number of buckets stored.
+            QuantileSketch(double relative_accuracy, int max_bucket);
+            virtual ~QuantileSketch() = default;
+            /// @brief Count a value in the sketch, NAN is ignored
+            ///
+            /// @param [in] value Value to be counted.
+            void insert(double value);
+            /// @brief Add the counts from another sketch
+            ///
+            /// @param [in] other Sketch with the same relative accuracy.
+            void merge(const QuantileSketch &other);
+            /// @brief Number of values counted
+            ///
+            /// @return Number of values inserted since construction
+            ///         or last reset(), including merged counts.
+            uint64_t count(void) const;
+            /// @brief Estimate a quantile of the values counted
+            ///
+            /// @param [in] quantile Value in the range [0, 1], e.g.
+            ///        0.99 for the 99th percentile.
+            ///
+            /// @return Estimate of the quantile, or NAN if no values
+            ///         were counted.
+            double quantile(double quantile) const;
+            /// @brief Relative accuracy of the estimates
+            ///
+            /// @return Relative accuracy specified at construction.
+            double relative_accuracy(void) const;
+            /// @brief Number of buckets currently in use
+            ///
+            /// @return Number of buckets, never greater than the
+            ///         maximum specified at construction.
+            int num_bucket(void) const;
+            /// @brief Clear all counts
+            void reset(void);
+            static constexpr double M_DEFAULT_RELATIVE_ACCURACY = 0.01;
+            static constexpr int M_DEFAULT_MAX_BUCKET = 2048;
+        private:
+            int bucket_index(double magnitude) const;
+            double bucket_value(int index) const;
+            void collapse(void);
+            const double M_RELATIVE_ACCURACY;
+            const int M_MAX_BUCKET;
+            const double M_GAMMA;
+            const double M_LOG_GAMMA;
+            const double M_MIN_MAGNITUDE;
+            // Map from bucket index to count for the magnitude of
+            // positive and negative values.
+            std::map<int, uint64_t> m_positive;
+            std::map<int, uint64_t> m_negative;
+            uint64_t m_zero_count;
+            uint64_t m_count;
+    };
+}
+
+#endif
@@ -50,6 +50,16 @@ namespace geopm
         return geopm_field_to_signal(m_msrio->sample(m_data_idx));
     }
 
+    int RawMSRSignal::add_read(int batch_ctx) const
+    {
+        return m_msrio->add_read(m_cpu, m_offset, batch_ctx);
+    }
+
+    double RawMSRSignal::sample(int batch_idx, int batch_ctx) const
+    {
+        return geopm_field_to_signal(m_msrio->sample(batch_idx, batch_ctx));
+    }
+
     double RawMSRSignal::read(void) const
     {
         GEOPM_DEBUG_ASSERT(m_msrio != nullptr, "no valid MSRIO object.");
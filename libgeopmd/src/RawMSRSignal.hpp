@@ -31,6 +31,17 @@ namespace geopm
             void setup_batch(void) override;
             double sample(void) override;
             double read(void) const override;
+            /// @brief Add the MSR to a batch context of the MSRIO
+            ///        other than the one used by setup_batch().
+            /// @param [in] batch_ctx Batch context index.
+            /// @return Index to pass to sample(int, int) after the
+            ///         context has been read.
+            int add_read(int batch_ctx) const;
+            /// @brief Get the value of the MSR from a batch context
+            ///        of the MSRIO.
+            /// @param [in] batch_idx Index returned by add_read().
+            /// @param [in] batch_ctx Batch context index.
+            double sample(int batch_idx, int batch_ctx) const;
         private:
             /// MSRIO object shared by all MSR signals in the same
             /// batch.  This object should outlive all other data in
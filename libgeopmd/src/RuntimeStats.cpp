@@ -8,6 +8,7 @@
 #include <cmath>
 
 #include "geopm/Exception.hpp"
+#include "QuantileSketch.hpp"
 
 namespace geopm
 {
@@ -15,10 +16,13 @@ namespace geopm
     RuntimeStats::RuntimeStats(const std::vector<std::string> &metric_names)
         : m_metric_names(metric_names)
         , m_metric_stats(m_metric_names.size())
+        , m_metric_sketch(m_metric_names.size())
     {
         reset();
     }
 
+    RuntimeStats::~RuntimeStats() = default;
+
     int RuntimeStats::num_metric(void) const
     {
         return m_metric_names.size();
@@ -114,6 +118,64 @@ namespace geopm
         return result;
     }
 
+    void RuntimeStats::enable_quantile(int metric_idx)
+    {
+        check_index(metric_idx, __func__, __LINE__);
+        if (m_metric_sketch[metric_idx] == nullptr) {
+            m_metric_sketch[metric_idx] = std::make_unique<QuantileSketch>();
+        }
+    }
+
+    bool RuntimeStats::is_quantile_enabled(int metric_idx) const
+    {
+        check_index(metric_idx, __func__, __LINE__);
+        return m_metric_sketch[metric_idx] != nullptr;
+    }
+
+    double RuntimeStats::quantile(int metric_idx, double quantile) const
+    {
+        check_index(metric_idx, __func__, __LINE__);
+        double result = NAN;
+        if (m_metric_sketch[metric_idx] != nullptr) {
+            result = m_metric_sketch[metric_idx]->quantile(quantile);
+        }
+        return result;
+    }
+
+    void RuntimeStats::merge(const RuntimeStats &other)
+    {
+        if (other.m_metric_names != m_metric_names) {
+            throw Exception("RuntimeStats::merge(): metric names do not match",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        size_t num_metric = m_metric_names.size();
+        for (size_t metric_idx = 0; metric_idx < num_metric; ++metric_idx) {
+            stats_s &curr = m_metric_stats[metric_idx];
+            const stats_s &next = other.m_metric_stats[metric_idx];
+            if (next.count != 0) {
+                if (curr.count == 0) {
+                    curr.first = next.first;
+                    curr.min = next.min;
+                    curr.max = next.max;
+                }
+                curr.last = next.last;
+                if (curr.min > next.min) {
+                    curr.min = next.min;
+                }
+                if (curr.max < next.max) {
+                    curr.max = next.max;
+                }
+                curr.count += next.count;
+                curr.m_1 += next.m_1;
+                curr.m_2 += next.m_2;
+            }
+            if (other.m_metric_sketch[metric_idx] != nullptr) {
+                enable_quantile(metric_idx);
+                m_metric_sketch[metric_idx]->merge(*other.m_metric_sketch[metric_idx]);
+            }
+        }
+    }
+
     void RuntimeStats::reset(void)
     {
         for (auto &it : m_metric_stats) {
@@ -121,6 +183,11 @@ namespace geopm
             it.m_1 = 0.0;
             it.m_2 = 0.0;
         }
+        for (auto &it : m_metric_sketch) {
+            if (it != nullptr) {
+                it->reset();
+            }
+        }
     }
 
     void RuntimeStats::update(const std::vector<double> &sample)
@@ -130,6 +197,7 @@ namespace geopm
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
         auto moments_it = m_metric_stats.begin();
+        auto sketch_it = m_metric_sketch.begin();
         for (const auto &ss : sample) {
             if (!std::isnan(ss)) {
                 moments_it->count += 1;
@@ -149,8 +217,12 @@ namespace geopm
                 moments_it->m_1 += mm;
                 mm *= ss;
                 moments_it->m_2 += mm;
+                if (*sketch_it != nullptr) {
+                    (*sketch_it)->insert(ss);
+                }
             }
             ++moments_it;
+            ++sketch_it;
         }
     }
 }
@@ -9,9 +9,12 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <memory>
 
 namespace geopm
 {
+    class QuantileSketch;
+
     /// @brief Class that aggregates statistics without buffered data
     class RuntimeStats
     {
@@ -19,8 +22,8 @@ namespace geopm
             RuntimeStats() = delete;
             /// @brief Constructor that records the names of all metrics
             RuntimeStats(const std::vector<std::string> &metric_names);
-            /// @brief Default virtual destructor
-            virtual ~RuntimeStats() = default;
+            /// @brief Virtual destructor
+            virtual ~RuntimeStats();
             /// @brief Number of metrics aggregated
             ///
             /// @return The number of metrics specified at construction
@@ -81,6 +84,47 @@ namespace geopm
             ///
             /// @return Standard deviation estimate of metric
             double std(int metric_idx) const;
+            /// @brief Enable quantile estimates for one metric
+            ///
+            /// The values sampled for the metric after this call are
+            /// counted in a QuantileSketch with bounded memory.
+            /// Calling more than once for a metric has no effect.
+            ///
+            /// @param [in] metric_idx Index of the metric as specified at
+            ///             construction
+            void enable_quantile(int metric_idx);
+            /// @brief Check if quantile estimates are enabled
+            ///
+            /// @param [in] metric_idx Index of the metric as specified at
+            ///             construction
+            ///
+            /// @return True if enable_quantile() was called for the
+            ///         metric
+            bool is_quantile_enabled(int metric_idx) const;
+            /// @brief Estimate of a quantile
+            ///
+            /// @param [in] metric_idx Index of the metric as specified at
+            ///             construction
+            ///
+            /// @param [in] quantile Value in the range [0, 1], e.g.
+            ///             0.99 for the 99th percentile
+            ///
+            /// @return Quantile estimate of metric, or NAN if quantile
+            ///         estimates are not enabled for the metric
+            double quantile(int metric_idx, double quantile) const;
+            /// @brief Combine the statistics gathered by another object
+            ///
+            /// Used to aggregate statistics gathered separately, e.g.
+            /// on several hosts.  The other object must have the same
+            /// metric names.  Quantile estimates are enabled for each
+            /// metric that has them enabled in either object.  The
+            /// first value is kept from this object unless it has no
+            /// samples, and the last value is taken from the other
+            /// object if it has samples.
+            ///
+            /// @param [in] other Statistics to be combined with this
+            ///             object
+            void merge(const RuntimeStats &other);
             /// @brief Reset all aggregated statistics
             void reset(void);
             /// @brief Update statistics with new sample
@@ -104,6 +148,7 @@ namespace geopm
             };
             const std::vector<std::string> m_metric_names;
             std::vector<stats_s> m_metric_stats;
+            std::vector<std::unique_ptr<QuantileSketch> > m_metric_sketch;
     };
 }
 
@@ -69,6 +69,12 @@ namespace geopm
         return m_metric_names;
     }
 
+    void StatsCollectorImp::enable_quantile(int request_idx)
+    {
+        m_is_cached = false;
+        m_stats->enable_quantile(request_idx);
+    }
+
     void StatsCollectorImp::update(void)
     {
         m_is_cached = false;
@@ -147,8 +153,10 @@ namespace geopm
             },
             m_metric_names,
             std::vector<std::array<double, GEOPM_NUM_METRIC_STATS> > {},
+            std::vector<std::array<double, GEOPM_NUM_METRIC_QUANTILE> > {},
         };
         result.metric_stats.reserve(m_metric_names.size());
+        result.metric_quantile.reserve(m_metric_names.size());
         size_t num_metric = m_metric_names.size();
         for (size_t metric_idx = 0; metric_idx < num_metric; ++metric_idx) {
             result.metric_stats.push_back(std::array<double, GEOPM_NUM_METRIC_STATS> {
@@ -160,6 +168,11 @@ namespace geopm
                 m_stats->mean(metric_idx),
                 m_stats->std(metric_idx),
             });
+            result.metric_quantile.push_back(std::array<double, GEOPM_NUM_METRIC_QUANTILE> {
+                m_stats->quantile(metric_idx, 0.50),
+                m_stats->quantile(metric_idx, 0.90),
+                m_stats->quantile(metric_idx, 0.99),
+            });
         }
         return result;
     }
@@ -185,6 +198,11 @@ namespace geopm
             result << "    " << "max: " << m_stats->max(metric_idx) << "\n";
             result << "    " << "mean: " << m_stats->mean(metric_idx) << "\n";
             result << "    " << "std: " << m_stats->std(metric_idx) << "\n";
+            if (m_stats->is_quantile_enabled(metric_idx)) {
+                result << "    " << "p50: " << m_stats->quantile(metric_idx, 0.50) << "\n";
+                result << "    " << "p90: " << m_stats->quantile(metric_idx, 0.90) << "\n";
+                result << "    " << "p99: " << m_stats->quantile(metric_idx, 0.99) << "\n";
+            }
             ++metric_idx;
         }
         return result.str();
@@ -223,6 +241,20 @@ int geopm_stats_collector_create(size_t num_requests, const struct geopm_request
     return err;
 }
 
+int geopm_stats_collector_enable_quantile(struct geopm_stats_collector_s *collector,
+                                          size_t request_idx)
+{
+    int err = 0;
+    try {
+        geopm::StatsCollector *collector_cpp = reinterpret_cast<geopm::StatsCollector *>(collector);
+        collector_cpp->enable_quantile(request_idx);
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception());
+    }
+    return err;
+}
+
 int geopm_stats_collector_update(struct geopm_stats_collector_s *collector)
 {
     int err = 0;
@@ -323,6 +355,29 @@ int geopm_stats_collector_report(const struct geopm_stats_collector_s *collector
     return err;
 }
 
+int geopm_stats_collector_report_quantile(const struct geopm_stats_collector_s *collector,
+                                          size_t num_requests,
+                                          struct geopm_metric_quantile_s *quantiles)
+{
+    int err = 0;
+    try {
+        const geopm::StatsCollector *collector_cpp = reinterpret_cast<const geopm::StatsCollector *>(collector);
+        geopm::StatsCollector::report_s report_cpp = collector_cpp->report_struct();
+        if (report_cpp.metric_quantile.size() > num_requests) {
+            throw geopm::Exception("geopm_stats_collector_report_quantile(): Quantile memory allocation is insufficient, num_request provided: " +
+                                   std::to_string(num_requests) + " required: " + std::to_string(report_cpp.metric_quantile.size()),
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (size_t metric_idx = 0; metric_idx < report_cpp.metric_quantile.size(); ++metric_idx) {
+            memcpy(quantiles[metric_idx].quantile, report_cpp.metric_quantile[metric_idx].data(), sizeof(double) * GEOPM_NUM_METRIC_QUANTILE);
+        }
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception());
+    }
+    return err;
+}
+
 
 int geopm_stats_collector_reset(struct geopm_stats_collector_s *collector)
 {
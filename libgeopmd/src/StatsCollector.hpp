@@ -28,6 +28,7 @@ namespace geopm
                 std::array<double, GEOPM_NUM_SAMPLE_STATS> sample_stats;
                 std::vector<std::string> metric_names;
                 std::vector<std::array<double, GEOPM_NUM_METRIC_STATS> > metric_stats;
+                std::vector<std::array<double, GEOPM_NUM_METRIC_QUANTILE> > metric_quantile;
             };
 
             /// @brief Factory access method
@@ -44,6 +45,15 @@ namespace geopm
             StatsCollector() = default;
             /// @brief Default destructor
             virtual ~StatsCollector() = default;
+            /// @brief Enable quantile estimates for one request
+            ///
+            /// Samples of the signal are also counted in a bounded
+            /// memory histogram, and the report includes the median,
+            /// 90th and 99th percentile estimates for the signal.
+            ///
+            /// @param [in] request_idx Index into the requests
+            ///             provided at construction
+            virtual void enable_quantile(int request_idx) = 0;
             /// @brief Sample PlatformIO and update all tracked signals
             virtual void update(void) = 0;
             /// @brief Generate a YAML report of statistics
@@ -96,6 +106,7 @@ namespace geopm
             StatsCollectorImp(const std::vector<geopm_request_s> &requests, PlatformIO &pio);
             /// @brief Default destructor
             ~StatsCollectorImp() = default;
+            void enable_quantile(int request_idx) override;
             void update(void) override;
             std::string report_yaml(void) const override;
             void reset(void) override;
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "TimeTSC.hpp"
+
+#include <cmath>
+#include <limits>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "geopm/Cpuid.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+
+namespace geopm
+{
+    TimeTSC::TimeTSC()
+        : TimeTSC(*Cpuid::make_unique(),
+                  "/sys/devices/system/clocksource/clocksource0/current_clocksource",
+                  M_CALIBRATE_DURATION)
+    {
+
+    }
+
+    TimeTSC::TimeTSC(const Cpuid &cpuid,
+                     const std::string &clocksource_path,
+                     double calibrate_duration)
+        : m_is_enabled(false)
+        , m_tsc_ref(0)
+        , m_time_ref{{0, 0}}
+        , m_nsec_per_tick(NAN)
+    {
+        if (geopm_time_tsc() != 0 &&
+            cpuid.is_tsc_invariant() &&
+            is_clocksource_tsc(clocksource_path)) {
+            uint64_t tsc_begin;
+            struct geopm_time_s time_begin;
+            sample(tsc_begin, time_begin);
+            do {
+                sample(m_tsc_ref, m_time_ref);
+            } while (geopm_time_diff(&time_begin, &m_time_ref) < calibrate_duration);
+            if (m_tsc_ref > tsc_begin) {
+                m_nsec_per_tick = 1E9 * geopm_time_diff(&time_begin, &m_time_ref) /
+                                  (m_tsc_ref - tsc_begin);
+                m_is_enabled = true;
+            }
+        }
+    }
+
+    TimeTSC &TimeTSC::time_tsc(void)
+    {
+        static TimeTSC instance;
+        return instance;
+    }
+
+    bool TimeTSC::is_clocksource_tsc(const std::string &clocksource_path)
+    {
+        // Do not use the counter if the kernel has found it to be
+        // unreliable, e.g. not synchronized across packages
+        bool result = false;
+        try {
+            result = string_begins_with(read_file(clocksource_path), "tsc");
+        }
+        catch (const Exception &) {
+
+        }
+        return result;
+    }
+
+    void TimeTSC::sample(uint64_t &tsc, struct geopm_time_s &time)
+    {
+        // Pair the clock with the middle of the shortest of several
+        // counter intervals around the call to geopm_time()
+        uint64_t window = std::numeric_limits<uint64_t>::max();
+        for (int sample_idx = 0; sample_idx < M_NUM_SAMPLE; ++sample_idx) {
+            struct geopm_time_s curr_time;
+            uint64_t tsc_before = geopm_time_tsc();
+            geopm_time(&curr_time);
+            uint64_t tsc_after = geopm_time_tsc();
+            if (tsc_after - tsc_before < window) {
+                window = tsc_after - tsc_before;
+                tsc = tsc_before + window / 2;
+                time = curr_time;
+            }
+        }
+    }
+
+    bool TimeTSC::is_enabled(void) const
+    {
+        return m_is_enabled;
+    }
+
+    struct geopm_time_s TimeTSC::time(uint64_t tsc) const
+    {
+        // Counter values read before the reference are negative offsets
+        int64_t delta_tick = (int64_t)tsc - (int64_t)m_tsc_ref;
+        int64_t nsec = m_time_ref.t.tv_nsec + (int64_t)(delta_tick * m_nsec_per_tick);
+        int64_t sec = nsec / 1000000000;
+        nsec -= sec * 1000000000;
+        if (nsec < 0) {
+            nsec += 1000000000;
+            --sec;
+        }
+        struct geopm_time_s result = m_time_ref;
+        result.t.tv_sec += sec;
+        result.t.tv_nsec = nsec;
+        return result;
+    }
+
+    double TimeTSC::frequency(void) const
+    {
+        return 1E9 / m_nsec_per_tick;
+    }
+}
+
+extern "C"
+{
+    int geopm_time_tsc_to_time(uint64_t tsc, struct geopm_time_s *time)
+    {
+        const geopm::TimeTSC &time_tsc = geopm::TimeTSC::time_tsc();
+        if (!time_tsc.is_enabled()) {
+            return GEOPM_ERROR_NOT_IMPLEMENTED;
+        }
+        *time = time_tsc.time(tsc);
+        return 0;
+    }
+
+    uint64_t geopm_time_tsc(void)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    int geopm_time_fast(struct geopm_time_s *time)
+    {
+        int err = geopm_time_tsc_to_time(geopm_time_tsc(), time);
+        if (err) {
+            err = geopm_time(time);
+        }
+        return err;
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TIMETSC_HPP_INCLUDE
+#define TIMETSC_HPP_INCLUDE
+
+#include <cstdint>
+#include <string>
+
+#include "geopm_time.h"
+
+namespace geopm
+{
+    class Cpuid;
+
+    /// @brief Converts time stamp counter values into times that can
+    ///        be compared with geopm_time().
+    ///
+    /// The counter is used only if it is invariant and the kernel
+    /// also uses it as the clock source.  The rate is calibrated once
+    /// at construction by reading the counter and geopm_time() at
+    /// the start and end of a short interval.
+    class TimeTSC
+    {
+        public:
+            /// @brief Calibrate the counter of the current system.
+            TimeTSC();
+            /// @brief Constructor used for testing
+            ///
+            /// @param [in] cpuid Used to check if the counter is
+            ///        invariant.
+            ///
+            /// @param [in] clocksource_path Path to the sysfs file with
+            ///        the name of the kernel clock source.
+            ///
+            /// @param [in] calibrate_duration Length of the
+            ///        calibration interval in seconds.
+            TimeTSC(const Cpuid &cpuid,
+                    const std::string &clocksource_path,
+                    double calibrate_duration);
+            virtual ~TimeTSC() = default;
+            static TimeTSC &time_tsc(void);
+            /// @brief Check if the counter can be used.
+            ///
+            /// @return True if the counter is invariant and was
+            ///         calibrated.
+            bool is_enabled(void) const;
+            /// @brief Convert a counter value into a time.
+            ///
+            /// @param [in] tsc Value returned by geopm_time_tsc().
+            ///
+            /// @return Time corresponding to the counter value, only
+            ///         valid if is_enabled() is true.
+            struct geopm_time_s time(uint64_t tsc) const;
+            /// @brief Rate of the counter.
+            ///
+            /// @return Counter ticks per second, or NAN if not
+            ///         enabled.
+            double frequency(void) const;
+        private:
+            static bool is_clocksource_tsc(const std::string &clocksource_path);
+            static void sample(uint64_t &tsc, struct geopm_time_s &time);
+            static constexpr int M_NUM_SAMPLE = 5;
+            static constexpr double M_CALIBRATE_DURATION = 0.01;
+            bool m_is_enabled;
+            uint64_t m_tsc_ref;
+            struct geopm_time_s m_time_ref;
+            double m_nsec_per_tick;
+    };
+}
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "WorkerPool.hpp"
+
+#include "geopm/Exception.hpp"
+
+namespace geopm
+{
+    WorkerPool::WorkerPool(int num_thread)
+        : m_task(nullptr)
+        , m_num_task(0)
+        , m_next_task(0)
+        , m_num_complete(0)
+        , m_generation(0)
+        , m_is_shutdown(false)
+    {
+        if (num_thread < 0) {
+            throw Exception("WorkerPool: number of threads must be non-negative",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (int thread_idx = 0; thread_idx < num_thread; ++thread_idx) {
+            m_thread.emplace_back(&WorkerPool::worker, this);
+        }
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_is_shutdown = true;
+        }
+        m_start_cv.notify_all();
+        for (auto &thread : m_thread) {
+            thread.join();
+        }
+    }
+
+    int WorkerPool::num_thread(void) const
+    {
+        return m_thread.size();
+    }
+
+    void WorkerPool::run(int num_task, const std::function<void(int)> &task)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_num_task = num_task;
+        m_next_task = 0;
+        m_num_complete = 0;
+        m_error = nullptr;
+        ++m_generation;
+        lock.unlock();
+        m_start_cv.notify_all();
+        work();
+        lock.lock();
+        m_done_cv.wait(lock, [this]() {
+            return m_num_complete == m_num_task;
+        });
+        m_task = nullptr;
+        if (m_error) {
+            std::exception_ptr error = m_error;
+            m_error = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    void WorkerPool::worker(void)
+    {
+        unsigned generation = 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_start_cv.wait(lock, [this, generation]() {
+                return m_is_shutdown || m_generation != generation;
+            });
+            if (m_is_shutdown) {
+                break;
+            }
+            generation = m_generation;
+            lock.unlock();
+            work();
+            lock.lock();
+        }
+    }
+
+    void WorkerPool::work(void)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (m_task != nullptr && m_next_task < m_num_task) {
+            int task_idx = m_next_task;
+            ++m_next_task;
+            const std::function<void(int)> &task = *m_task;
+            lock.unlock();
+            std::exception_ptr error = nullptr;
+            try {
+                task(task_idx);
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+            if (error && !m_error) {
+                m_error = error;
+            }
+            ++m_num_complete;
+            if (m_num_complete == m_num_task) {
+                m_done_cv.notify_all();
+            }
+        }
+    }
+}
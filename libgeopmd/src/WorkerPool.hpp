@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef WORKERPOOL_HPP_INCLUDE
+#define WORKERPOOL_HPP_INCLUDE
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace geopm
+{
+    /// @brief A small set of persistent threads that execute a batch
+    ///        of independent tasks.
+    ///
+    /// The thread calling run() participates in the work, so a pool
+    /// created with N threads executes up to N + 1 tasks at once.
+    /// Threads are created once in the constructor and are idle
+    /// between calls to run().
+    class WorkerPool
+    {
+        public:
+            /// @brief Start the worker threads.
+            ///
+            /// @param [in] num_thread Number of threads to create in
+            ///        addition to the caller of run().
+            WorkerPool(int num_thread);
+            WorkerPool(const WorkerPool &other) = delete;
+            WorkerPool &operator=(const WorkerPool &other) = delete;
+            /// @brief Stop and join all worker threads.
+            virtual ~WorkerPool();
+            /// @brief Execute task(idx) for every idx in the range
+            ///        [0, num_task) and wait for all tasks to
+            ///        complete.
+            ///
+            /// If any task throws, the first exception observed is
+            ///        rethrown after all tasks have completed.
+            ///
+            /// @param [in] num_task Number of tasks to execute.
+            ///
+            /// @param [in] task Function to execute with the index of
+            ///        each task.
+            void run(int num_task, const std::function<void(int)> &task);
+            /// @brief Number of worker threads in the pool.
+            int num_thread(void) const;
+        private:
+            void worker(void);
+            void work(void);
+            std::mutex m_mutex;
+            std::condition_variable m_start_cv;
+            std::condition_variable m_done_cv;
+            std::vector<std::thread> m_thread;
+            const std::function<void(int)> *m_task;
+            int m_num_task;
+            int m_next_task;
+            int m_num_complete;
+            unsigned m_generation;
+            bool m_is_shutdown;
+            std::exception_ptr m_error;
+    };
+}
+
+#endif
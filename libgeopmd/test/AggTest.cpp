@@ -5,6 +5,13 @@
 
 #include "geopm_test.hpp"
 
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <random>
+
 #include "geopm/Agg.hpp"
 #include "geopm_hash.h"
 #include "geopm_hint.h"
@@ -12,6 +19,138 @@
 
 using geopm::Agg;
 
+// Reference implementations that copy the operands that are not NAN
+// before aggregating them, used to check the in place kernels.
+namespace
+{
+    std::vector<double> ref_filter(const std::vector<double> &operand)
+    {
+        std::vector<double> result;
+        std::copy_if(operand.begin(), operand.end(), std::back_inserter(result),
+                     [](double x) -> bool { return !std::isnan(x); });
+        return result;
+    }
+
+    double ref_sum(const std::vector<double> &operand)
+    {
+        auto filtered = ref_filter(operand);
+        return filtered.empty() ? NAN :
+               std::accumulate(filtered.begin(), filtered.end(), 0.0);
+    }
+
+    double ref_average(const std::vector<double> &operand)
+    {
+        auto filtered = ref_filter(operand);
+        return filtered.empty() ? NAN : ref_sum(filtered) / filtered.size();
+    }
+
+    double ref_median(const std::vector<double> &operand)
+    {
+        auto filtered = ref_filter(operand);
+        double result = NAN;
+        size_t num_op = filtered.size();
+        if (num_op) {
+            std::sort(filtered.begin(), filtered.end());
+            result = filtered[num_op / 2];
+            if ((num_op % 2) == 0) {
+                result = (result + filtered[num_op / 2 - 1]) / 2.0;
+            }
+        }
+        return result;
+    }
+
+    double ref_integer_bitwise_or(const std::vector<double> &operand)
+    {
+        auto filtered = ref_filter(operand);
+        double result = NAN;
+        if (filtered.size()) {
+            int64_t agg_tmp = 0;
+            for (const auto &it : filtered) {
+                agg_tmp |= (int64_t)it;
+            }
+            result = (double)agg_tmp;
+        }
+        return result;
+    }
+
+    double ref_logical_and(const std::vector<double> &operand)
+    {
+        auto filtered = ref_filter(operand);
+        return filtered.empty() ? NAN :
+               std::all_of(filtered.begin(), filtered.end(),
+                           [](double it) {return (it != 0.0);});
+    }
+
+    double ref_logical_or(const std::vector<double> &operand)
+    {
+        auto filtered = ref_filter(operand);
+        return filtered.empty() ? NAN :
+               std::any_of(filtered.begin(), filtered.end(),
+                           [](double it) {return (it != 0.0);});
+    }
+
+    double ref_common(const std::vector<double> &operand, double no_match)
+    {
+        auto filtered = ref_filter(operand);
+        double result = NAN;
+        if (filtered.size()) {
+            result = std::all_of(filtered.begin(), filtered.end(),
+                                 [filtered](double x) {
+                                     return x == filtered[0];
+                                 }) ? filtered[0] : no_match;
+        }
+        return result;
+    }
+
+    double ref_min(const std::vector<double> &operand)
+    {
+        auto filtered = ref_filter(operand);
+        return filtered.empty() ? NAN :
+               *std::min_element(filtered.begin(), filtered.end());
+    }
+
+    double ref_max(const std::vector<double> &operand)
+    {
+        auto filtered = ref_filter(operand);
+        return filtered.empty() ? NAN :
+               *std::max_element(filtered.begin(), filtered.end());
+    }
+
+    double ref_stddev(const std::vector<double> &operand)
+    {
+        auto filtered = ref_filter(operand);
+        double result = NAN;
+        if (filtered.size() > 1) {
+            double sum_squared = ref_sum(filtered);
+            sum_squared *= sum_squared;
+            double sum_squares = 0.0;
+            for (const auto &it : filtered) {
+                sum_squares += it * it;
+            }
+            double aa = 1.0 / (filtered.size() - 1);
+            double bb = aa / filtered.size();
+            result = std::sqrt(aa * sum_squares - bb * sum_squared);
+        }
+        else if (filtered.size() == 1) {
+            result = 0.0;
+        }
+        return result;
+    }
+
+    void expect_same_result(double expect, double actual, double tolerance)
+    {
+        if (std::isnan(expect)) {
+            EXPECT_TRUE(std::isnan(actual));
+        }
+        else if (tolerance == 0.0) {
+            EXPECT_EQ(expect, actual);
+        }
+        else {
+            EXPECT_NEAR(expect, actual, tolerance * std::max(1.0, std::fabs(expect)));
+        }
+    }
+}
+
 TEST(AggTest, agg_function)
 {
     // NAN values will be ignored
@@ -95,3 +234,46 @@ TEST(AggTest, function_strings)
     GEOPM_EXPECT_THROW_MESSAGE(Agg::name_to_function("invalid"), GEOPM_ERROR_INVALID,
                                "unknown aggregation function");
 }
+
+TEST(AggTest, reference_equivalence)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> real_dist(-1.0e3, 1.0e3);
+    std::uniform_int_distribution<int> int_dist(0, 3);
+    for (double nan_fraction : {0.0, 0.3, 1.0}) {
+        std::bernoulli_distribution nan_dist(nan_fraction);
+        for (size_t num_operand = 0; num_operand < 70; ++num_operand) {
+            std::vector<double> real_data(num_operand);
+            std::vector<double> int_data(num_operand);
+            for (size_t op_idx = 0; op_idx < num_operand; ++op_idx) {
+                bool is_nan = nan_dist(generator);
+                real_data[op_idx] = is_nan ? NAN : real_dist(generator);
+                int_data[op_idx] = is_nan ? NAN : int_dist(generator);
+            }
+            // Kernels accumulate in a different order than the reference
+            expect_same_result(ref_sum(real_data), Agg::sum(real_data), 1e-12);
+            expect_same_result(ref_average(real_data), Agg::average(real_data), 1e-12);
+            expect_same_result(ref_stddev(real_data), Agg::stddev(real_data), 1e-9);
+            expect_same_result(ref_median(real_data), Agg::median(real_data), 0.0);
+            expect_same_result(ref_median(int_data), Agg::median(int_data), 0.0);
+            expect_same_result(ref_min(real_data), Agg::min(real_data), 0.0);
+            expect_same_result(ref_max(real_data), Agg::max(real_data), 0.0);
+            expect_same_result(ref_integer_bitwise_or(int_data),
+                               Agg::integer_bitwise_or(int_data), 0.0);
+            expect_same_result(ref_logical_and(int_data), Agg::logical_and(int_data), 0.0);
+            expect_same_result(ref_logical_or(int_data), Agg::logical_or(int_data), 0.0);
+            expect_same_result(ref_common(int_data, GEOPM_REGION_HASH_UNMARKED),
+                               Agg::region_hash(int_data), 0.0);
+            expect_same_result(ref_common(int_data, GEOPM_REGION_HINT_UNKNOWN),
+                               Agg::region_hint(int_data), 0.0);
+            expect_same_result(ref_common(int_data, NAN),
+                               Agg::expect_same(int_data), 0.0);
+            std::vector<double> same_data(num_operand, 3.0);
+            if (num_operand) {
+                same_data[num_operand / 2] = NAN;
+            }
+            expect_same_result(ref_common(same_data, NAN),
+                               Agg::expect_same(same_data), 0.0);
+        }
+    }
+}
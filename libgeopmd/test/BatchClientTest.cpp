@@ -7,6 +7,7 @@
 #include <cerrno>
 
 #include "BatchClient.hpp"
+#include "BatchSnapshot.hpp"
 #include "BatchStatus.hpp"
 #include "MockBatchStatus.hpp"
 #include "MockSharedMemory.hpp"
@@ -122,6 +123,28 @@ TEST_F(BatchClientTest, write_batch_empty)
     m_batch_client_empty->write_batch(settings);
 }
 
+TEST_F(BatchClientTest, read_batch_snapshot)
+{
+    size_t data_size = 2 * sizeof(double);
+    auto signal_shmem = std::make_shared<MockSharedMemory>(
+        geopm::BatchSnapshot::region_size(data_size, 2));
+    geopm::BatchSnapshot server_snapshot(signal_shmem, data_size, 2, 0.01, true);
+    std::vector<double> expected = {1.5, 2.5};
+    geopm_time_s time;
+    geopm_time(&time);
+    server_snapshot.publish(expected.data(), time);
+    BatchClientImp batch_client(2, 1, m_batch_status, signal_shmem, m_control_shmem);
+    // Published values are read without messaging the server
+    EXPECT_CALL(*m_batch_status, send_message(_))
+        .Times(0);
+    EXPECT_CALL(*m_batch_status, receive_message(_))
+        .Times(0);
+    EXPECT_EQ(expected, batch_client.read_batch());
+    expected = {3.5, 4.5};
+    server_snapshot.publish(expected.data(), time);
+    EXPECT_EQ(expected, batch_client.read_batch());
+}
+
 TEST_F(BatchClientTest, create_but_timeout)
 {
     GEOPM_EXPECT_THROW_MESSAGE(
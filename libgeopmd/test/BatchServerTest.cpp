@@ -4,7 +4,9 @@
  */
 
 
+#include "BatchClient.hpp"
 #include "BatchServer.hpp"
+#include "BatchSnapshot.hpp"
 #include "BatchStatus.hpp"
 #include "MockBatchStatus.hpp"
 #include "MockPlatformIO.hpp"
@@ -25,8 +27,11 @@
 #include <string>
 #include <sstream>
 #include <iostream>
+#include <thread>
 
+using testing::AtLeast;
 using testing::InSequence;
+using testing::Invoke;
 using testing::Return;
 using testing::Throw;
 using testing::_;
@@ -46,6 +51,7 @@ class BatchServerTest : public ::testing::Test
         int fork_other(std::function<void(int, int)> child_process_func,
                        std::function<void(int, int)> parent_process_func,
                        bool child_is_server);
+        void run_default_server(bool is_doorbell_client);
         std::shared_ptr<MockPlatformIO> m_pio_ptr;
         std::shared_ptr<MockBatchStatus> m_batch_status;
         std::shared_ptr<MockPOSIXSignal> m_posix_signal;
@@ -299,6 +305,61 @@ TEST_F(BatchServerTest, run_batch_read)
     EXPECT_EQ(result[1], data_ptr[1]);
 }
 
+/**
+ * @test Check BatchServerImp::run_batch() with a sample period.
+ *       The server samples the signals and publishes them to the
+ *       snapshot in shared memory without any read request from the
+ *       client.  The client then asks the server to quit.
+ */
+TEST_F(BatchServerTest, run_batch_sampling)
+{
+    size_t data_size = m_signal_config.size() * sizeof(double);
+    auto signal_shmem = std::make_shared<MockSharedMemory>(
+        geopm::BatchSnapshot::region_size(data_size, m_signal_config.size()));
+    auto batch_server = std::make_shared<BatchServerImp>(
+        m_client_pid, m_signal_config, m_control_config, "", "",
+        *m_pio_ptr, m_batch_status, m_posix_signal,
+        signal_shmem, m_control_shmem, m_server_pid, 0.001);
+    geopm::BatchSnapshot client_snapshot(signal_shmem, data_size,
+                                         m_signal_config.size(), 0.0, false);
+    EXPECT_EQ(0.001, client_snapshot.sample_period());
+
+    EXPECT_CALL(*m_pio_ptr, push_signal(_, _, _))
+        .WillOnce(Return(0))
+        .WillOnce(Return(1));
+    EXPECT_CALL(*m_pio_ptr, push_control(_, _, _))
+        .WillOnce(Return(0));
+    EXPECT_CALL(*m_pio_ptr, read_batch())
+        .Times(AtLeast(2));
+    EXPECT_CALL(*m_pio_ptr, sample(0))
+        .WillRepeatedly(Return(240.042));
+    EXPECT_CALL(*m_pio_ptr, sample(1))
+        .WillRepeatedly(Return(250.052));
+    std::vector<double> result;
+    geopm_time_s time;
+    uint64_t generation = 0;
+    // Wait for the free running sampler to publish before quitting
+    EXPECT_CALL(*m_batch_status, receive_message())
+        .WillOnce(Invoke([&]() {
+            do {
+                generation = client_snapshot.read(result, time);
+            } while (generation < 2);
+            return BatchStatus::M_MESSAGE_QUIT;
+        }));
+    EXPECT_CALL(*m_batch_status,
+                send_message(BatchStatus::M_MESSAGE_QUIT))
+        .Times(1);
+
+    batch_server->run_batch();
+
+    EXPECT_LE(2ULL, generation);
+    std::vector<double> expect = {240.042, 250.052};
+    EXPECT_EQ(expect, result);
+    EXPECT_CALL(*m_posix_signal,
+                sig_queue(m_server_pid, SIGTERM, BatchStatus::M_MESSAGE_TERMINATE));
+    batch_server.reset();
+}
+
 /**
  * @test Check BatchServerImp::run_batch() when there are no signals and you try to read.
  *       First the control requests are populated.
@@ -694,6 +755,207 @@ TEST_F(BatchServerTest, create_shmem)
     EXPECT_EQ(0, unlink(m_shmem_prefix_control.c_str()));
 }
 
+/**
+ * @test Check that a server created without an injected BatchStatus
+ *       places a doorbell after the signal values.
+ */
+TEST_F(BatchServerTest, create_shmem_doorbell)
+{
+    if (getenv("GEOPM_DISABLE_BATCH_DOORBELL") != nullptr) {
+        return;
+    }
+    auto batch_server = std::make_shared<BatchServerImp>(
+        getpid(),
+        m_signal_config,
+        m_control_config,
+        m_shmem_prefix_signal,
+        m_shmem_prefix_control,
+        *m_pio_ptr,
+        nullptr,
+        m_posix_signal,
+        nullptr,
+        nullptr,
+        m_server_pid);
+    batch_server->create_shmem();
+
+    size_t signal_data_size = m_signal_config.size() * sizeof(double);
+    struct stat data;
+    ASSERT_EQ(0, stat(m_shmem_prefix_signal.c_str(), &data));
+    EXPECT_EQ(geopm::BatchStatusDoorbell::region_size(signal_data_size) +
+              geopm::hardware_destructive_interference_size,
+              (size_t)data.st_size);
+    ASSERT_EQ(0, stat(m_shmem_prefix_control.c_str(), &data));
+    EXPECT_EQ(m_control_config.size() * sizeof(double) +
+              geopm::hardware_destructive_interference_size,
+              (size_t)data.st_size);
+
+    EXPECT_CALL(*m_posix_signal,
+                sig_queue(m_server_pid, SIGTERM, BatchStatus::M_MESSAGE_TERMINATE));
+    batch_server.reset();
+}
+
+void BatchServerTest::run_default_server(bool is_doorbell_client)
+{
+    std::vector<double> result = {240.042, 250.052};
+    int idx = 0;
+    for (const auto &request : m_signal_config) {
+        EXPECT_CALL(*m_pio_ptr, push_signal(request.name, request.domain_type,
+                                            request.domain_idx))
+            .WillOnce(Return(idx));
+        EXPECT_CALL(*m_pio_ptr, sample(idx))
+            .WillOnce(Return(result[idx]));
+        ++idx;
+    }
+    EXPECT_CALL(*m_pio_ptr, push_control(_, _, _))
+        .WillOnce(Return(0));
+    EXPECT_CALL(*m_pio_ptr, read_batch())
+        .Times(1);
+
+    auto batch_server = std::make_shared<BatchServerImp>(
+        getpid(),
+        m_signal_config,
+        m_control_config,
+        m_shmem_prefix_signal,
+        m_shmem_prefix_control,
+        *m_pio_ptr,
+        nullptr,
+        m_posix_signal,
+        nullptr,
+        nullptr,
+        m_server_pid);
+    batch_server->create_shmem();
+    size_t signal_data_size = m_signal_config.size() * sizeof(double);
+    std::shared_ptr<geopm::SharedMemory> client_shmem =
+        geopm::SharedMemory::make_unique_user(m_shmem_prefix_signal, 1);
+
+    std::string server_error;
+    std::thread server_thread([batch_server, &server_error]() {
+        try {
+            batch_server->run_batch();
+        }
+        catch (const std::exception &ex) {
+            server_error = ex.what();
+        }
+    });
+    std::unique_ptr<BatchStatus> client_status;
+    if (is_doorbell_client) {
+        client_status = BatchStatus::make_unique_client(
+            batch_server->server_key(), client_shmem, signal_data_size);
+        EXPECT_NE(nullptr, dynamic_cast<geopm::BatchStatusDoorbell *>(client_status.get()));
+    }
+    else {
+        // Clients that predate the doorbell only use the FIFOs
+        client_status = BatchStatus::make_unique_client(batch_server->server_key());
+    }
+    client_status->send_message(BatchStatus::M_MESSAGE_READ);
+    client_status->receive_message(BatchStatus::M_MESSAGE_CONTINUE);
+    double *data_ptr = (double *)(client_shmem->pointer());
+    EXPECT_EQ(result[0], data_ptr[0]);
+    EXPECT_EQ(result[1], data_ptr[1]);
+    client_status->send_message(BatchStatus::M_MESSAGE_QUIT);
+    client_status->receive_message(BatchStatus::M_MESSAGE_QUIT);
+    server_thread.join();
+    EXPECT_EQ("", server_error);
+
+    EXPECT_CALL(*m_posix_signal,
+                sig_queue(m_server_pid, SIGTERM, BatchStatus::M_MESSAGE_TERMINATE));
+    batch_server.reset();
+}
+
+/**
+ * @test Check that a client that requests the doorbell from a server
+ *       created without an injected BatchStatus switches to the
+ *       doorbell after the server confirms the request on the FIFO.
+ */
+TEST_F(BatchServerTest, run_batch_doorbell_client)
+{
+    if (getenv("GEOPM_DISABLE_BATCH_DOORBELL") != nullptr) {
+        GTEST_SKIP() << "Doorbell disabled in test environment";
+    }
+    if (access("/run/geopm", W_OK) != 0) {
+        GTEST_SKIP() << "Requires write access to /run/geopm for FIFOs";
+    }
+    run_default_server(true);
+}
+
+/**
+ * @test Check that a client that only uses the FIFO protocol is
+ *       served by a server that offers the doorbell.
+ */
+TEST_F(BatchServerTest, run_batch_fifo_client)
+{
+    if (access("/run/geopm", W_OK) != 0) {
+        GTEST_SKIP() << "Requires write access to /run/geopm for FIFOs";
+    }
+    run_default_server(false);
+}
+
+/**
+ * @test Check that several clients can attach to a server that samples
+ *       periodically.  Clients that only read the snapshot do not
+ *       open the FIFOs, so the FIFOs remain available to the client
+ *       that asks the server to quit.
+ */
+TEST_F(BatchServerTest, run_batch_sampling_two_clients)
+{
+    if (access("/run/geopm", W_OK) != 0) {
+        GTEST_SKIP() << "Requires write access to /run/geopm for FIFOs";
+    }
+    EXPECT_CALL(*m_pio_ptr, push_signal(_, _, _))
+        .WillOnce(Return(0))
+        .WillOnce(Return(1));
+    EXPECT_CALL(*m_pio_ptr, read_batch())
+        .Times(AtLeast(1));
+    EXPECT_CALL(*m_pio_ptr, sample(0))
+        .WillRepeatedly(Return(240.042));
+    EXPECT_CALL(*m_pio_ptr, sample(1))
+        .WillRepeatedly(Return(250.052));
+
+    auto batch_server = std::make_shared<BatchServerImp>(
+        getpid(),
+        m_signal_config,
+        std::vector<geopm_request_s>{},
+        "",
+        "",
+        *m_pio_ptr,
+        nullptr,
+        m_posix_signal,
+        nullptr,
+        nullptr,
+        m_server_pid,
+        0.001);
+    batch_server->create_shmem();
+
+    std::string server_error;
+    std::thread server_thread([batch_server, &server_error]() {
+        try {
+            batch_server->run_batch();
+        }
+        catch (const std::exception &ex) {
+            server_error = ex.what();
+        }
+    });
+    int num_signal = m_signal_config.size();
+    auto first_client = geopm::BatchClient::make_unique(
+        batch_server->server_key(), 1.0, num_signal, 0);
+    std::unique_ptr<geopm::BatchClient> second_client;
+    EXPECT_NO_THROW(second_client = geopm::BatchClient::make_unique(
+        batch_server->server_key(), 1.0, num_signal, 0));
+    std::vector<double> expect = {240.042, 250.052};
+    EXPECT_EQ(expect, first_client->read_batch());
+    if (second_client != nullptr) {
+        EXPECT_EQ(expect, second_client->read_batch());
+    }
+    second_client.reset();
+    first_client->stop_batch();
+    server_thread.join();
+    EXPECT_EQ("", server_error);
+
+    EXPECT_CALL(*m_posix_signal,
+                sig_queue(m_server_pid, SIGTERM, BatchStatus::M_MESSAGE_TERMINATE));
+    batch_server.reset();
+}
+
 /**
  * @test Check forking the batch server process.
  *       Check that the setup() function is called prior to the run() function.
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "BatchSnapshot.hpp"
+
+#include <atomic>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "geopm_test.hpp"
+#include "MockSharedMemory.hpp"
+
+using geopm::BatchSnapshot;
+
+class BatchSnapshotTest : public ::testing::Test
+{
+    protected:
+        void SetUp(void);
+        const int M_NUM_SIGNAL = 5;
+        size_t m_data_size;
+        std::shared_ptr<MockSharedMemory> m_shmem;
+};
+
+void BatchSnapshotTest::SetUp(void)
+{
+    m_data_size = M_NUM_SIGNAL * sizeof(double);
+    m_shmem = std::make_shared<MockSharedMemory>(
+        BatchSnapshot::region_size(m_data_size, M_NUM_SIGNAL));
+}
+
+TEST_F(BatchSnapshotTest, publish_read)
+{
+    EXPECT_FALSE(BatchSnapshot::is_present(*m_shmem, m_data_size));
+    BatchSnapshot server(m_shmem, m_data_size, M_NUM_SIGNAL, 0.005, true);
+    EXPECT_TRUE(BatchSnapshot::is_present(*m_shmem, m_data_size));
+    BatchSnapshot client(m_shmem, m_data_size, M_NUM_SIGNAL, 0.0, false);
+    EXPECT_EQ(0.005, client.sample_period());
+
+    std::vector<double> values {1.0, 2.0, 3.0, 4.0, 5.0};
+    geopm_time_s time {{10, 20}};
+    server.publish(values.data(), time);
+    std::vector<double> result;
+    geopm_time_s result_time {{0, 0}};
+    EXPECT_EQ(1ULL, client.read(result, result_time));
+    EXPECT_EQ(values, result);
+    EXPECT_EQ(10, result_time.t.tv_sec);
+    EXPECT_EQ(20, result_time.t.tv_nsec);
+
+    values[4] = 6.0;
+    server.publish(values.data(), time);
+    EXPECT_EQ(2ULL, client.read(result, result_time));
+    EXPECT_EQ(values, result);
+
+    // Values before the snapshot are not modified
+    const double *data = (const double *)m_shmem->pointer();
+    for (int idx = 0; idx < M_NUM_SIGNAL; ++idx) {
+        EXPECT_EQ(0.0, data[idx]);
+    }
+}
+
+TEST_F(BatchSnapshotTest, errors)
+{
+    auto small_shmem = std::make_shared<MockSharedMemory>(m_data_size);
+    EXPECT_FALSE(BatchSnapshot::is_present(*small_shmem, m_data_size));
+    GEOPM_EXPECT_THROW_MESSAGE(BatchSnapshot(small_shmem, m_data_size, M_NUM_SIGNAL, 0.005, true),
+                               GEOPM_ERROR_INVALID, "too small for snapshot");
+    GEOPM_EXPECT_THROW_MESSAGE(BatchSnapshot(m_shmem, m_data_size, M_NUM_SIGNAL, 0.0, true),
+                               GEOPM_ERROR_INVALID, "Sample period must be positive");
+    GEOPM_EXPECT_THROW_MESSAGE(BatchSnapshot(m_shmem, m_data_size, M_NUM_SIGNAL, 0.0, false),
+                               GEOPM_ERROR_INVALID, "does not contain a snapshot");
+    BatchSnapshot server(m_shmem, m_data_size, M_NUM_SIGNAL, 0.005, true);
+    GEOPM_EXPECT_THROW_MESSAGE(BatchSnapshot(m_shmem, m_data_size, M_NUM_SIGNAL - 1, 0.0, false),
+                               GEOPM_ERROR_INVALID, "Number of signals does not match server");
+}
+
+TEST_F(BatchSnapshotTest, concurrent_read)
+{
+    BatchSnapshot server(m_shmem, m_data_size, M_NUM_SIGNAL, 0.005, true);
+    BatchSnapshot client(m_shmem, m_data_size, M_NUM_SIGNAL, 0.0, false);
+    const int num_publish = 100000;
+    std::thread writer([&server, num_publish, this]() {
+        std::vector<double> values(M_NUM_SIGNAL);
+        geopm_time_s time {{0, 0}};
+        for (int gen = 1; gen <= num_publish; ++gen) {
+            std::fill(values.begin(), values.end(), (double)gen);
+            time.t.tv_nsec = gen;
+            server.publish(values.data(), time);
+        }
+    });
+    // Every read must observe a set of values from a single publish
+    std::vector<double> result;
+    geopm_time_s time;
+    uint64_t last_gen = 0;
+    while (last_gen < (uint64_t)num_publish) {
+        uint64_t gen = client.read(result, time);
+        ASSERT_GE(gen, last_gen);
+        for (const auto &val : result) {
+            ASSERT_EQ((double)gen, val);
+        }
+        ASSERT_EQ((long)gen, time.t.tv_nsec);
+        last_gen = gen;
+    }
+    writer.join();
+}
@@ -10,14 +10,17 @@
 
 #include "gtest/gtest.h"
 #include "geopm_test.hpp"
+#include "MockSharedMemory.hpp"
 
 #include <functional>
+#include <thread>
 #include <unistd.h>
 #include <cerrno>
 #include <sys/wait.h>
 
 using geopm::BatchStatus;
 using geopm::BatchStatusImp;
+using geopm::BatchStatusDoorbell;
 
 class BatchStatusTest : public ::testing::Test
 {
@@ -242,3 +245,79 @@ TEST_F(BatchStatusTest, bad_client_key)
     );
     waitpid(server_pid, nullptr, 0);  // reap child process
 }
+
+TEST_F(BatchStatusTest, doorbell_negotiate)
+{
+    size_t data_size = 3 * sizeof(double);
+    // No doorbell in the region: the FIFO is used without a request
+    auto fifo_shmem = std::make_shared<MockSharedMemory>(data_size);
+    auto client_status = BatchStatus::negotiate_client(make_test_client(), fifo_shmem, data_size);
+    EXPECT_NE(nullptr, dynamic_cast<geopm::BatchStatusClient *>(client_status.get()));
+    client_status = BatchStatus::negotiate_client(make_test_client(), nullptr, 0);
+    EXPECT_NE(nullptr, dynamic_cast<geopm::BatchStatusClient *>(client_status.get()));
+
+    auto shmem = std::make_shared<MockSharedMemory>(BatchStatusDoorbell::region_size(data_size));
+    EXPECT_FALSE(BatchStatusDoorbell::is_present(*shmem, data_size));
+    GEOPM_EXPECT_THROW_MESSAGE(BatchStatusDoorbell(shmem, data_size, false, 0, 0),
+                               GEOPM_ERROR_INVALID, "does not contain a doorbell");
+    GEOPM_EXPECT_THROW_MESSAGE(BatchStatusDoorbell(fifo_shmem, data_size, true, getpid(), 0),
+                               GEOPM_ERROR_INVALID, "too small for doorbell");
+    BatchStatusDoorbell server_status(shmem, data_size, true, getpid(), 0);
+    EXPECT_TRUE(BatchStatusDoorbell::is_present(*shmem, data_size));
+
+    // Client disabled the doorbell: no request is made
+    setenv("GEOPM_DISABLE_BATCH_DOORBELL", "1", 1);
+    client_status = BatchStatus::negotiate_client(make_test_client(), shmem, data_size);
+    EXPECT_NE(nullptr, dynamic_cast<geopm::BatchStatusClient *>(client_status.get()));
+    unsetenv("GEOPM_DISABLE_BATCH_DOORBELL");
+
+    // Server confirms or declines the request on the FIFO
+    int client_pid = getpid();
+    for (char reply : {BatchStatus::M_MESSAGE_DOORBELL, BatchStatus::M_MESSAGE_CONTINUE}) {
+        int server_pid = fork_other([this, client_pid, reply](int write_pipe_fd) {
+            auto fifo_server = this->make_test_server(client_pid);
+            char unique_char = '!';
+            (void)!write(write_pipe_fd, &unique_char, sizeof(unique_char));
+            fifo_server->receive_message(BatchStatus::M_MESSAGE_DOORBELL);
+            fifo_server->send_message(reply);
+        });
+        client_status = BatchStatus::negotiate_client(make_test_client(), shmem, data_size);
+        if (reply == BatchStatus::M_MESSAGE_DOORBELL) {
+            EXPECT_NE(nullptr, dynamic_cast<BatchStatusDoorbell *>(client_status.get()));
+        }
+        else {
+            EXPECT_NE(nullptr, dynamic_cast<geopm::BatchStatusClient *>(client_status.get()));
+        }
+        client_status.reset();
+        waitpid(server_pid, nullptr, 0);  // reap child process
+    }
+}
+
+TEST_F(BatchStatusTest, doorbell_round_trip)
+{
+    size_t data_size = sizeof(double);
+    for (int spin_count : {0, 1000}) {
+        auto shmem = std::make_shared<MockSharedMemory>(BatchStatusDoorbell::region_size(data_size));
+        BatchStatusDoorbell server_status(shmem, data_size, true, getpid(), spin_count);
+        BatchStatusDoorbell client_status(shmem, data_size, false, 0, spin_count);
+        int num_round = 1000;
+        std::thread server_thread([&server_status, num_round]() {
+            for (int round = 0; round < num_round; ++round) {
+                char msg = server_status.receive_message();
+                EXPECT_EQ(round % 2 ? BatchStatus::M_MESSAGE_WRITE : BatchStatus::M_MESSAGE_READ, msg);
+                server_status.send_message(BatchStatus::M_MESSAGE_CONTINUE);
+            }
+            server_status.receive_message(BatchStatus::M_MESSAGE_QUIT);
+            server_status.send_message(BatchStatus::M_MESSAGE_QUIT);
+        });
+        for (int round = 0; round < num_round; ++round) {
+            client_status.send_message(round % 2 ? BatchStatus::M_MESSAGE_WRITE : BatchStatus::M_MESSAGE_READ);
+            client_status.receive_message(BatchStatus::M_MESSAGE_CONTINUE);
+        }
+        client_status.send_message(BatchStatus::M_MESSAGE_QUIT);
+        GEOPM_EXPECT_THROW_MESSAGE(client_status.receive_message(BatchStatus::M_MESSAGE_CONTINUE),
+                                   GEOPM_ERROR_RUNTIME,
+                                   "BatchStatusDoorbell::receive_message(): Expected message:");
+        server_thread.join();
+    }
+}
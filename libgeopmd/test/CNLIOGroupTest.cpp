@@ -111,12 +111,49 @@ TEST_F(CNLIOGroupTest, push_signal)
 
     // Can read an updated value without recreating the IOGroup
     std::ofstream(m_power_path) << "100 W\n";
+    std::ofstream(m_freshness_path) << "1\n";
     cnl.read_batch();
     power = cnl.sample(idx);
     EXPECT_DOUBLE_EQ(100, power);
 
     // cannot push to wrong domain
     EXPECT_THROW(cnl.push_signal("CNL::BOARD_POWER", GEOPM_DOMAIN_PACKAGE, 0), Exception);
+    // cannot push after read_batch()
+    GEOPM_EXPECT_THROW_MESSAGE(cnl.push_signal("CNL::BOARD_ENERGY", GEOPM_DOMAIN_BOARD, 0),
+                               GEOPM_ERROR_INVALID, "cannot push signal after call to read_batch()");
+    EXPECT_THROW(cnl.sample(idx + 1), Exception);
+}
+
+TEST_F(CNLIOGroupTest, read_batch_freshness)
+{
+    CNLIOGroup cnl(m_test_dir);
+    int power_idx = cnl.push_signal("CNL::BOARD_POWER", GEOPM_DOMAIN_BOARD, 0);
+    int alias_idx = cnl.push_signal("BOARD_POWER", GEOPM_DOMAIN_BOARD, 0);
+    int energy_idx = cnl.push_signal("CNL::BOARD_ENERGY", GEOPM_DOMAIN_BOARD, 0);
+    int time_idx = cnl.push_signal("CNL::SAMPLE_ELAPSED_TIME", GEOPM_DOMAIN_BOARD, 0);
+    int rate_idx = cnl.push_signal("CNL::SAMPLE_RATE", GEOPM_DOMAIN_BOARD, 0);
+    EXPECT_EQ(power_idx, cnl.push_signal("CNL::BOARD_POWER", GEOPM_DOMAIN_BOARD, 0));
+    cnl.read_batch();
+    EXPECT_DOUBLE_EQ(85, cnl.sample(power_idx));
+    EXPECT_DOUBLE_EQ(85, cnl.sample(alias_idx));
+    EXPECT_DOUBLE_EQ(598732067, cnl.sample(energy_idx));
+    EXPECT_DOUBLE_EQ(0.0, cnl.sample(time_idx));
+    EXPECT_DOUBLE_EQ(10, cnl.sample(rate_idx));
+
+    // Counters are not read again until freshness changes
+    std::ofstream(m_power_path) << "90 W\n";
+    std::ofstream(m_energy_path) << "598732076 J\n";
+    cnl.read_batch();
+    EXPECT_DOUBLE_EQ(85, cnl.sample(power_idx));
+    EXPECT_DOUBLE_EQ(598732067, cnl.sample(energy_idx));
+
+    std::ofstream(m_freshness_path) << "5\n";
+    cnl.read_batch();
+    EXPECT_DOUBLE_EQ(90, cnl.sample(power_idx));
+    EXPECT_DOUBLE_EQ(90, cnl.sample(alias_idx));
+    EXPECT_DOUBLE_EQ(598732076, cnl.sample(energy_idx));
+    EXPECT_DOUBLE_EQ(0.5, cnl.sample(time_idx));
+    EXPECT_DOUBLE_EQ(10, cnl.sample(rate_idx));
 }
 
 TEST_F(CNLIOGroupTest, parse_power)
@@ -36,3 +36,18 @@ TEST(CombinedSignalTest, sample_max)
     result = comb_signal.sample(values);
     EXPECT_DOUBLE_EQ(18, result);
 }
+
+TEST(CombinedSignalTest, operand_buffer)
+{
+    CombinedSignal comb_signal;
+    std::vector<double> &values = comb_signal.operand_buffer(3);
+    EXPECT_EQ(3u, values.size());
+    values = {1.0, 2.0, 3.0};
+    EXPECT_DOUBLE_EQ(6.0, comb_signal.sample(values));
+    const double *data = values.data();
+    std::vector<double> &values_again = comb_signal.operand_buffer(2);
+    EXPECT_EQ(&values, &values_again);
+    EXPECT_EQ(data, values_again.data());
+    EXPECT_EQ(2u, values_again.size());
+    EXPECT_DOUBLE_EQ(3.0, comb_signal.sample(values_again));
+}
@@ -3,7 +3,10 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <cmath>
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -71,12 +74,12 @@ void DerivativeSignalTest::SetUp(void)
 TEST_F(DerivativeSignalTest, read_flat)
 {
     size_t ii = 0;
-    EXPECT_CALL(*m_time_sig, read()).Times(m_num_history_sample)
+    EXPECT_CALL(*m_time_sig, read()).Times(2)
         .WillRepeatedly(InvokeWithoutArgs([&ii]() {
                     ++ii;
                     return ii;
                 }));
-    EXPECT_CALL(*m_y_sig, read()).Times(m_num_history_sample)
+    EXPECT_CALL(*m_y_sig, read()).Times(2)
         .WillRepeatedly(Return(7.7));
     double result = m_sig->read();
     EXPECT_NEAR(m_exp_slope_0, result, 0.0001);
@@ -86,12 +89,12 @@ TEST_F(DerivativeSignalTest, read_slope_1)
 {
     size_t ii = 0;
     double val = 2.5;
-    EXPECT_CALL(*m_time_sig, read()).Times(m_num_history_sample)
+    EXPECT_CALL(*m_time_sig, read()).Times(2)
         .WillRepeatedly(InvokeWithoutArgs([&ii]() {
                     ++ii;
                     return ii;
                 }));
-    EXPECT_CALL(*m_y_sig, read()).Times(m_num_history_sample)
+    EXPECT_CALL(*m_y_sig, read()).Times(2)
         .WillRepeatedly(InvokeWithoutArgs([&val]() {
                     val += 1.0;;
                     return val;
@@ -102,6 +105,7 @@ TEST_F(DerivativeSignalTest, read_slope_1)
 
 TEST_F(DerivativeSignalTest, read_nan)
 {
+    // Time does not advance, so the whole window is sampled
     EXPECT_CALL(*m_time_sig, read()).Times(m_num_history_sample)
         .WillRepeatedly(Return(2));
     EXPECT_CALL(*m_y_sig, read()).Times(m_num_history_sample)
@@ -111,6 +115,128 @@ TEST_F(DerivativeSignalTest, read_nan)
     EXPECT_EQ(m_nan_replace, result);
 }
 
+TEST_F(DerivativeSignalTest, read_window)
+{
+    // Reads spaced by more than the sleep time extend the window
+    // without sleeping
+    double time = 0.0;
+    double val = 0.0;
+    EXPECT_CALL(*m_y_sig, read())
+        .WillRepeatedly(InvokeWithoutArgs([&val]() {
+                    return val;
+                }));
+    // First read samples until the window spans the full history
+    EXPECT_CALL(*m_time_sig, read()).Times(m_num_history_sample)
+        .WillRepeatedly(InvokeWithoutArgs([&time, this]() {
+                    time += m_sleep_time;
+                    return time;
+                }));
+    EXPECT_CALL(*m_y_sig, read()).Times(m_num_history_sample);
+    double result = m_sig->read();
+    EXPECT_EQ(0.0, result);
+    testing::Mock::VerifyAndClearExpectations(m_time_sig.get());
+    testing::Mock::VerifyAndClearExpectations(m_y_sig.get());
+
+    EXPECT_CALL(*m_time_sig, read())
+        .WillRepeatedly(InvokeWithoutArgs([&time]() {
+                    return time;
+                }));
+    EXPECT_CALL(*m_y_sig, read())
+        .WillRepeatedly(InvokeWithoutArgs([&val]() {
+                    return val;
+                }));
+    // Each read afterwards samples once
+    for (int ii = 0; ii < 2 * m_num_history_sample; ++ii) {
+        time += m_sleep_time;
+        val += 3.0 * m_sleep_time;
+        result = m_sig->read();
+    }
+    EXPECT_NEAR(3.0, result, 0.0001);
+    testing::Mock::VerifyAndClearExpectations(m_time_sig.get());
+    testing::Mock::VerifyAndClearExpectations(m_y_sig.get());
+
+    // Read within the sleep time returns the cached result
+    EXPECT_CALL(*m_time_sig, read()).WillOnce(Return(time + 0.5 * m_sleep_time));
+    EXPECT_CALL(*m_y_sig, read()).Times(0);
+    result = m_sig->read();
+    EXPECT_NEAR(3.0, result, 0.0001);
+    testing::Mock::VerifyAndClearExpectations(m_time_sig.get());
+    testing::Mock::VerifyAndClearExpectations(m_y_sig.get());
+
+    // Read after the window has gone stale starts a new window from
+    // the newest cached sample and samples only once
+    double stale_time = time + 2 * m_num_history_sample * m_sleep_time;
+    double stale_val = val + 5.0 * (stale_time - time);
+    EXPECT_CALL(*m_time_sig, read()).WillOnce(Return(stale_time));
+    EXPECT_CALL(*m_y_sig, read()).WillOnce(Return(stale_val));
+    result = m_sig->read();
+    EXPECT_NEAR(5.0, result, 0.0001);
+    testing::Mock::VerifyAndClearExpectations(m_time_sig.get());
+    testing::Mock::VerifyAndClearExpectations(m_y_sig.get());
+
+    // Reads continue to extend the new window
+    time = stale_time + m_sleep_time;
+    val = stale_val + 5.0 * m_sleep_time;
+    EXPECT_CALL(*m_time_sig, read()).WillOnce(Return(time));
+    EXPECT_CALL(*m_y_sig, read()).WillOnce(Return(val));
+    result = m_sig->read();
+    EXPECT_NEAR(5.0, result, 0.0001);
+}
+
+TEST_F(DerivativeSignalTest, read_stale_nan)
+{
+    // A stale window whose newest sample is invalid is filled again
+    double time = 0.0;
+    double val = 0.0;
+    EXPECT_CALL(*m_time_sig, read()).Times(m_num_history_sample)
+        .WillRepeatedly(InvokeWithoutArgs([&time, this]() {
+                    time += m_sleep_time;
+                    return time;
+                }));
+    EXPECT_CALL(*m_y_sig, read()).Times(m_num_history_sample)
+        .WillRepeatedly(Return(NAN));
+    EXPECT_TRUE(std::isnan(m_sig->read()));
+    testing::Mock::VerifyAndClearExpectations(m_time_sig.get());
+    testing::Mock::VerifyAndClearExpectations(m_y_sig.get());
+
+    time += 2 * m_num_history_sample * m_sleep_time;
+    EXPECT_CALL(*m_time_sig, read()).Times(m_num_history_sample)
+        .WillRepeatedly(InvokeWithoutArgs([&time, this]() {
+                    time += m_sleep_time;
+                    return time;
+                }));
+    EXPECT_CALL(*m_y_sig, read()).Times(m_num_history_sample)
+        .WillRepeatedly(InvokeWithoutArgs([&val, this]() {
+                    val += 2.0 * m_sleep_time;
+                    return val;
+                }));
+    EXPECT_NEAR(2.0, m_sig->read(), 0.0001);
+}
+
+TEST_F(DerivativeSignalTest, read_min_span)
+{
+    // Samples two sleep times apart span the history of 8 samples
+    // separated by the sleep time after 5 reads.  Time is read
+    // before the signal for each sample.
+    testing::InSequence sequence;
+    double time = 0.0;
+    double val = 0.0;
+    for (int ii = 0; ii < 5; ++ii) {
+        EXPECT_CALL(*m_time_sig, read())
+            .WillOnce(InvokeWithoutArgs([&time, this]() {
+                        time += 2 * m_sleep_time;
+                        return time;
+                    }));
+        EXPECT_CALL(*m_y_sig, read())
+            .WillOnce(InvokeWithoutArgs([&val, this]() {
+                        val += 4.0 * m_sleep_time;
+                        return val;
+                    }));
+    }
+    double result = m_sig->read();
+    EXPECT_NEAR(2.0, result, 0.0001);
+}
+
 TEST_F(DerivativeSignalTest, read_batch_nan)
 {
     EXPECT_CALL(*m_time_sig, setup_batch());
@@ -229,3 +355,51 @@ TEST_F(DerivativeSignalTest, errors)
                                "setup_batch() must be called before sample()");
 
 }
+
+TEST_F(DerivativeSignalTest, read_batch_window)
+{
+    // Compare the running fit against a direct least squares fit of
+    // the most recent samples
+    EXPECT_CALL(*m_time_sig, setup_batch());
+    EXPECT_CALL(*m_y_sig, setup_batch());
+    m_sig->setup_batch();
+
+    std::vector<double> time_values;
+    std::vector<double> sample_values;
+    for (int ii = 0; ii < 10 * m_num_history_sample; ++ii) {
+        double time = 1.0e3 + 0.005 * ii;
+        double value = 1.0e6 + 20.0 * time + ((ii * 7) % 5);
+        if (ii == 3 * m_num_history_sample) {
+            value = NAN;
+        }
+        time_values.push_back(time);
+        sample_values.push_back(value);
+
+        EXPECT_CALL(*m_time_sig, is_sampled()).WillOnce(Return(false));
+        EXPECT_CALL(*m_time_sig, sample()).WillOnce(Return(time));
+        EXPECT_CALL(*m_y_sig, sample()).WillOnce(Return(value));
+        double result = m_sig->sample();
+
+        int num_fit = std::min(ii + 1, m_num_history_sample);
+        int begin = ii + 1 - num_fit;
+        bool is_nan = false;
+        double sum_x = 0.0, sum_y = 0.0, sum_xy = 0.0, sum_xx = 0.0;
+        for (int jj = begin; jj <= ii; ++jj) {
+            double xx = time_values[jj] - time_values[begin];
+            double yy = sample_values[jj] - sample_values[begin];
+            is_nan |= std::isnan(yy);
+            sum_x += xx;
+            sum_y += yy;
+            sum_xy += xx * yy;
+            sum_xx += xx * xx;
+        }
+        if (num_fit < 2 || is_nan) {
+            EXPECT_TRUE(std::isnan(result)) << "ii = " << ii;
+        }
+        else {
+            double expect = (sum_xy - sum_x * sum_y / num_fit) /
+                            (sum_xx - sum_x * sum_x / num_fit);
+            EXPECT_NEAR(expect, result, 1.0e-6 * std::fabs(expect)) << "ii = " << ii;
+        }
+    }
+}
@@ -8,8 +8,12 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <unistd.h>
 
 #include "IOUringFallback.hpp"
+#ifdef GEOPM_HAS_IO_URING
+#include "IOUringImp.hpp"
+#endif
 #include "geopm_test.hpp"
 
 #include "gtest/gtest.h"
@@ -23,6 +27,7 @@ class IOUringTest : public ::testing::TestWithParam<std::shared_ptr<IOUring> >
     protected:
         void test_reads(const std::string &context, std::shared_ptr<IOUring> io);
         void test_writes(const std::string &context, std::shared_ptr<IOUring> io);
+        void test_prepared(const std::string &context, std::shared_ptr<IOUring> io);
 };
 
 void IOUringTest::test_reads(const std::string &context, std::shared_ptr<IOUring> io)
@@ -70,6 +75,43 @@ void IOUringTest::test_writes(const std::string &context, std::shared_ptr<IOUrin
     EXPECT_EQ(-EBADF, *read_only_errno) << context;
 }
 
+void IOUringTest::test_prepared(const std::string &context, std::shared_ptr<IOUring> io)
+{
+    int zero_write_fd = open("/dev/zero", O_WRONLY);
+    ASSERT_GT(zero_write_fd, -1) << context << ": Failed to open /dev/zero for writing";
+    int zero_read_fd = open("/dev/zero", O_RDONLY);
+    ASSERT_GT(zero_read_fd, -1) << context << ": Failed to open /dev/zero for reading";
+    int null_write_fd = open("/dev/null", O_WRONLY);
+    ASSERT_GT(null_write_fd, -1) << context << ": Failed to open /dev/null for writing";
+    std::vector<int> files {zero_write_fd, zero_read_fd, null_write_fd};
+    // Operations share one contiguous buffer
+    std::vector<int> buf {10, 10, 10};
+    std::vector<IOUring::batch_op_s> ops {
+        {true, 0, &buf[0], sizeof(int), 0},
+        {true, 1, &buf[1], sizeof(int), 0},
+        {false, 2, &buf[2], sizeof(int), 0},
+    };
+    auto batch = io->make_batch(files, ops);
+    // Submitting again must repeat the same operations
+    for (int repeat = 0; repeat < 2; ++repeat) {
+        buf = {10, 10, 10};
+        batch->submit();
+        EXPECT_EQ(-EBADF, batch->result(0)) << context;
+        EXPECT_EQ(static_cast<int>(sizeof(int)), batch->result(1)) << context;
+        EXPECT_EQ(static_cast<int>(sizeof(int)), batch->result(2)) << context;
+        EXPECT_EQ(10, buf[0]) << context;
+        EXPECT_EQ(0, buf[1]) << context;
+        EXPECT_EQ(10, buf[2]) << context;
+    }
+
+    ops.push_back({true, 3, &buf[0], sizeof(int), 0});
+    GEOPM_EXPECT_THROW_MESSAGE(io->make_batch(files, ops),
+                               GEOPM_ERROR_INVALID, "file index out of range");
+    close(null_write_fd);
+    close(zero_read_fd);
+    close(zero_write_fd);
+}
+
 TEST_F(IOUringTest, batch_read)
 {
     // If GEOPM is built without IO uring, these are both the same test.
@@ -83,3 +125,87 @@ TEST_F(IOUringTest, batch_write)
     test_writes("uring", geopm::IOUring::make_unique(2));
     test_writes("fallback", geopm::IOUringFallback::make_unique(2));
 }
+
+TEST_F(IOUringTest, prepared_batch)
+{
+    // Rings smaller than the batch are submitted in several passes.
+    test_prepared("uring", geopm::IOUring::make_unique(1));
+    test_prepared("fallback", geopm::IOUringFallback::make_unique(1));
+}
+
+#ifdef GEOPM_HAS_IO_URING
+TEST_F(IOUringTest, prepared_batch_registration)
+{
+    if (!geopm::IOUringImp::is_supported()) {
+        GTEST_SKIP() << "IO uring is not supported by the kernel";
+    }
+    using geopm::IOUringImpBatch;
+    geopm::IOUringImp io(4);
+    int zero_read_fd = open("/dev/zero", O_RDONLY);
+    ASSERT_GT(zero_read_fd, -1) << "Failed to open /dev/zero for reading";
+    int null_write_fd = open("/dev/null", O_WRONLY);
+    ASSERT_GT(null_write_fd, -1) << "Failed to open /dev/null for writing";
+
+    std::vector<int> files {zero_read_fd, null_write_fd};
+    std::vector<int> buf(2, 10);
+    std::vector<IOUring::batch_op_s> ops {
+        {true, 0, &buf[0], sizeof(int), 0},
+        {false, 1, &buf[1], sizeof(int), 0},
+    };
+    auto read_batch = io.make_batch(files, ops);
+    auto read_imp = dynamic_cast<IOUringImpBatch *>(read_batch.get());
+    ASSERT_NE(nullptr, read_imp);
+    EXPECT_TRUE(read_imp->is_fixed_file());
+    EXPECT_TRUE(read_imp->is_fixed_buffer());
+    // A second batch over the same files and buffers shares the
+    // registration
+    auto write_batch = io.make_batch(files, ops);
+    auto write_imp = dynamic_cast<IOUringImpBatch *>(write_batch.get());
+    ASSERT_NE(nullptr, write_imp);
+    EXPECT_TRUE(read_imp->is_fixed_buffer());
+    EXPECT_TRUE(write_imp->is_fixed_buffer());
+
+    // Rebuilding over new buffers and reordered files registers them
+    // again, and the earlier batches fall back to regular operations
+    std::vector<int> rebuilt_files {null_write_fd, zero_read_fd};
+    std::vector<int> rebuilt_buf(4, 10);
+    std::vector<IOUring::batch_op_s> rebuilt_ops {
+        {false, 0, &rebuilt_buf[0], sizeof(int), 0},
+        {true, 1, &rebuilt_buf[3], sizeof(int), 0},
+    };
+    auto rebuilt_batch = io.make_batch(rebuilt_files, rebuilt_ops);
+    auto rebuilt_imp = dynamic_cast<IOUringImpBatch *>(rebuilt_batch.get());
+    ASSERT_NE(nullptr, rebuilt_imp);
+    EXPECT_TRUE(rebuilt_imp->is_fixed_file());
+    EXPECT_TRUE(rebuilt_imp->is_fixed_buffer());
+    EXPECT_FALSE(read_imp->is_fixed_file());
+    EXPECT_FALSE(read_imp->is_fixed_buffer());
+    EXPECT_FALSE(write_imp->is_fixed_buffer());
+
+    rebuilt_batch->submit();
+    EXPECT_EQ(static_cast<int>(sizeof(int)), rebuilt_batch->result(0));
+    EXPECT_EQ(static_cast<int>(sizeof(int)), rebuilt_batch->result(1));
+    EXPECT_EQ(0, rebuilt_buf[3]);
+    read_batch->submit();
+    EXPECT_EQ(static_cast<int>(sizeof(int)), read_batch->result(0));
+    EXPECT_EQ(static_cast<int>(sizeof(int)), read_batch->result(1));
+    EXPECT_EQ(0, buf[0]);
+
+    // Once every batch is released, a batch over the same addresses
+    // registers them again rather than trusting the old registration
+    read_batch.reset();
+    write_batch.reset();
+    rebuilt_batch.reset();
+    auto again_batch = io.make_batch(rebuilt_files, rebuilt_ops);
+    auto again_imp = dynamic_cast<IOUringImpBatch *>(again_batch.get());
+    ASSERT_NE(nullptr, again_imp);
+    EXPECT_TRUE(again_imp->is_fixed_file());
+    EXPECT_TRUE(again_imp->is_fixed_buffer());
+    rebuilt_buf[3] = 10;
+    again_batch->submit();
+    EXPECT_EQ(0, rebuilt_buf[3]);
+
+    close(null_write_fd);
+    close(zero_read_fd);
+}
+#endif
@@ -27,6 +27,7 @@
 #include "geopm_hash.h"
 #include "geopm_field.h"
 #include "geopm/Helper.hpp"
+#include "geopm/PlatformIO.hpp"
 #include "geopm/PlatformTopo.hpp"
 #include "MSRIOImp.hpp"
 #include "MSR.hpp"
@@ -568,6 +569,46 @@ TEST_F(MSRIOGroupTest, read_signal_energy)
     EXPECT_NEAR(50, result, 0.0001);
 }
 
+TEST_F(MSRIOGroupTest, read_signals)
+{
+    uint64_t perf_status_offset = 0x198;
+    uint64_t inst_ret_offset = 0x309;
+    int batch_ctx = 0;
+    std::vector<geopm_request_s> requests {
+        {GEOPM_DOMAIN_CPU, 0, "MSR::PERF_STATUS:FREQ"},
+        {GEOPM_DOMAIN_CPU, 0, "MSR::FIXED_CTR0:INST_RETIRED_ANY"},
+        {GEOPM_DOMAIN_CPU, 1, "MSR::FIXED_CTR0:INST_RETIRED_ANY"},
+    };
+    // All of the MSRs are read with one batch operation
+    EXPECT_CALL(*m_msrio, read_msr(_, _)).Times(0);
+    EXPECT_CALL(*m_msrio, add_read(0, perf_status_offset, batch_ctx))
+        .WillOnce(Return(0));
+    EXPECT_CALL(*m_msrio, add_read(0, inst_ret_offset, batch_ctx))
+        .WillOnce(Return(1));
+    EXPECT_CALL(*m_msrio, add_read(1, inst_ret_offset, batch_ctx))
+        .WillOnce(Return(2));
+    EXPECT_CALL(*m_msrio, read_batch(batch_ctx)).Times(1);
+    EXPECT_CALL(*m_msrio, sample(0, batch_ctx)).WillOnce(Return(0xB00));
+    EXPECT_CALL(*m_msrio, sample(1, batch_ctx)).WillOnce(Return(1234));
+    EXPECT_CALL(*m_msrio, sample(2, batch_ctx)).WillOnce(Return(5678));
+    std::vector<double> expected {1.1e9, 1234, 5678};
+    EXPECT_EQ(expected, m_msrio_group->read_signals(requests));
+
+    // The batch context is reused by each later call
+    EXPECT_CALL(*m_msrio, reset_batch_context(batch_ctx)).Times(2);
+    requests.resize(1);
+    EXPECT_CALL(*m_msrio, add_read(0, perf_status_offset, batch_ctx))
+        .WillOnce(Return(0));
+    EXPECT_CALL(*m_msrio, read_batch(batch_ctx)).Times(1);
+    EXPECT_CALL(*m_msrio, sample(0, batch_ctx)).WillOnce(Return(0xC00));
+    expected = {1.2e9};
+    EXPECT_EQ(expected, m_msrio_group->read_signals(requests));
+
+    requests[0].domain_type = GEOPM_DOMAIN_PACKAGE;
+    GEOPM_EXPECT_THROW_MESSAGE(m_msrio_group->read_signals(requests),
+                               GEOPM_ERROR_INVALID, "domain_type requested does not match");
+}
+
 TEST_F(MSRIOGroupTest, read_signal_counter)
 {
     uint64_t tsc_offset = 0x10;
@@ -1058,6 +1099,41 @@ TEST_F(MSRIOGroupTest, write_control)
 
 }
 
+TEST_F(MSRIOGroupTest, write_controls)
+{
+    uint64_t perf_ctl_offset = 0x199;
+    uint64_t perf_ctl_mask = 0xFF00;
+    int batch_ctx = 0;
+    std::vector<geopm_request_s> requests {
+        {GEOPM_DOMAIN_CORE, 0, "MSR::PERF_CTL:FREQ"},
+        {GEOPM_DOMAIN_CORE, 1, "MSR::PERF_CTL:FREQ"},
+    };
+    std::vector<double> settings {3e9, 2e9};
+    // All CPUs on both cores are written with one batch operation
+    EXPECT_CALL(*m_msrio, write_msr(_, _, _, _)).Times(0);
+    std::vector<int> core_0_cpu {0, 4, 8, 12};
+    std::vector<int> core_1_cpu {1, 5, 9, 13};
+    int batch_idx = 0;
+    for (int cpu : core_0_cpu) {
+        EXPECT_CALL(*m_msrio, add_write(cpu, perf_ctl_offset, batch_ctx))
+            .WillOnce(Return(batch_idx));
+        EXPECT_CALL(*m_msrio, adjust(batch_idx, 0x1E00ULL, perf_ctl_mask, batch_ctx));
+        ++batch_idx;
+    }
+    for (int cpu : core_1_cpu) {
+        EXPECT_CALL(*m_msrio, add_write(cpu, perf_ctl_offset, batch_ctx))
+            .WillOnce(Return(batch_idx));
+        EXPECT_CALL(*m_msrio, adjust(batch_idx, 0x1400ULL, perf_ctl_mask, batch_ctx));
+        ++batch_idx;
+    }
+    EXPECT_CALL(*m_msrio, write_batch(batch_ctx)).Times(1);
+    m_msrio_group->write_controls(requests, settings);
+
+    settings.pop_back();
+    GEOPM_EXPECT_THROW_MESSAGE(m_msrio_group->write_controls(requests, settings),
+                               GEOPM_ERROR_INVALID, "number of settings does not match");
+}
+
 TEST_F(MSRIOGroupTest, allowlist)
 {
     std::vector<std::string> config_env_vars = {
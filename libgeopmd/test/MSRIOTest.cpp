@@ -811,6 +811,79 @@ TEST_F(MSRIOTest, read_batch)
     }
 }
 
+TEST_F(MSRIOTest, read_batch_dedup)
+{
+    uint64_t offset = 0xd28;
+    std::string word = "software";
+    int sec_batch_ctx = m_msrio->create_batch_context();
+    int idx0 = m_msrio->add_read(0, offset);
+    int idx1 = m_msrio->add_read(1, offset);
+    int idx2 = m_msrio->add_read(0, 0x520);
+    // repeated reads of the same register share a batch entry
+    EXPECT_EQ(idx0, m_msrio->add_read(0, offset));
+    EXPECT_EQ(idx0, m_msrio->add_read(0, offset, 0));
+    EXPECT_EQ(idx1, m_msrio->add_read(1, offset));
+    EXPECT_EQ(idx2, m_msrio->add_read(0, 0x520));
+    EXPECT_NE(idx0, idx1);
+    EXPECT_NE(idx0, idx2);
+    // other batch contexts are interned independently
+    EXPECT_EQ(0, m_msrio->add_read(1, offset, sec_batch_ctx));
+    EXPECT_EQ(0, m_msrio->add_read(1, offset, sec_batch_ctx));
+    GEOPM_EXPECT_THROW_MESSAGE(m_msrio->add_read(m_num_cpu, offset), GEOPM_ERROR_INVALID,
+                               "out of range");
+
+    auto read_word = [&word](std::shared_ptr<int> ret, int, void *buf,
+                             unsigned nbytes, off_t) {
+        word.copy((char *)buf, nbytes);
+        *ret = nbytes;
+    };
+    // one operation per unique (cpu, offset) pair
+    EXPECT_CALL(*m_batch_io, prep_read(_, _, _, _, _)).Times(3).WillRepeatedly(
+            Invoke(read_word));
+    EXPECT_CALL(*m_batch_io, submit()).Times(1);
+    m_msrio->read_batch();
+    uint64_t expected;
+    memcpy(&expected, word.data(), 8);
+    EXPECT_EQ(expected, m_msrio->sample(idx0));
+    EXPECT_EQ(expected, m_msrio->sample(idx1));
+}
+
+TEST_F(MSRIOTest, reset_batch_context)
+{
+    std::string word0 = "software";
+    std::string word1 = "engineer";
+    int sec_batch_ctx = m_msrio->create_batch_context();
+    EXPECT_EQ(0, m_msrio->add_read(0, 0xd28, sec_batch_ctx));
+    EXPECT_EQ(1, m_msrio->add_read(1, 0xd28, sec_batch_ctx));
+
+    auto read_word = [&word0, &word1](std::shared_ptr<int> ret, int, void *buf,
+                                      unsigned nbytes, off_t offset) {
+        if (offset == 0xd28) {
+            word0.copy((char *)buf, nbytes);
+        }
+        else {
+            word1.copy((char *)buf, nbytes);
+        }
+        *ret = nbytes;
+    };
+    EXPECT_CALL(*m_batch_io, prep_read(_, _, _, _, 0xd28)).Times(2).WillRepeatedly(
+            Invoke(read_word));
+    EXPECT_CALL(*m_batch_io, prep_read(_, _, _, _, 0x520)).Times(1).WillRepeatedly(
+            Invoke(read_word));
+    EXPECT_CALL(*m_batch_io, submit()).Times(2);
+    m_msrio->read_batch(sec_batch_ctx);
+
+    // After a reset the context holds only the operations added since
+    m_msrio->reset_batch_context(sec_batch_ctx);
+    EXPECT_EQ(0, m_msrio->add_read(2, 0x520, sec_batch_ctx));
+    GEOPM_EXPECT_THROW_MESSAGE(m_msrio->sample(0, sec_batch_ctx), GEOPM_ERROR_INVALID,
+                               "cannot call sample() before read_batch()");
+    m_msrio->read_batch(sec_batch_ctx);
+    uint64_t expected;
+    memcpy(&expected, word1.data(), 8);
+    EXPECT_EQ(expected, m_msrio->sample(0, sec_batch_ctx));
+}
+
 TEST_F(MSRIOTest, write_batch)
 {
     std::vector<int> cpu_idx;
@@ -26,6 +26,7 @@ test_geopm_test_SOURCES = test/GPUTopoNullTest.cpp \
                           test/AggTest.cpp \
                           test/BatchClientTest.cpp \
                           test/BatchServerTest.cpp \
+                          test/BatchSnapshotTest.cpp \
                           test/BatchStatusTest.cpp \
                           test/CircularBufferTest.cpp \
                           test/CNLIOGroupTest.cpp \
@@ -88,7 +89,9 @@ test_geopm_test_SOURCES = test/GPUTopoNullTest.cpp \
                           test/POSIXSignalTest.cpp \
                           test/PlatformIOTest.cpp \
                           test/PlatformTopoTest.cpp \
+                          test/QuantileSketchTest.cpp \
                           test/RawMSRSignalTest.cpp \
+                          test/RuntimeStatsTest.cpp \
                           test/SharedMemoryTest.cpp \
                           test/SaveControlTest.cpp \
                           test/SecurePathTest.cpp \
@@ -101,7 +104,9 @@ test_geopm_test_SOURCES = test/GPUTopoNullTest.cpp \
                           test/StatsCollectorTest.cpp \
                           test/SysfsIOGroupTest.cpp \
                           test/TimeIOGroupTest.cpp \
+                          test/TimeTSCTest.cpp \
                           test/UniqueFdTest.cpp \
+                          test/WorkerPoolTest.cpp \
                           # end
 
 test_geopm_test_LDADD = libgeopmd.la
@@ -18,6 +18,7 @@ class MockCpuid : public geopm::Cpuid {
         MOCK_METHOD(double, freq_sticker, (), (override, const));
         MOCK_METHOD(Cpuid::rdt_info_s, rdt_info, (), (override, const));
         MOCK_METHOD(uint32_t, pmc_bit_width, (), (override, const));
+        MOCK_METHOD(bool, is_tsc_invariant, (), (override, const));
 };
 
 #endif
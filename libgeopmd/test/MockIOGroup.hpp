@@ -9,6 +9,7 @@
 #include "gmock/gmock.h"
 
 #include "geopm/IOGroup.hpp"
+#include "geopm/PlatformIO.hpp"
 
 class MockIOGroup : public geopm::IOGroup
 {
@@ -36,10 +37,17 @@ class MockIOGroup : public geopm::IOGroup
         MOCK_METHOD(double, read_signal,
                     (const std::string &signal_name, int domain_type, int domain_idx),
                     (override));
+        MOCK_METHOD(std::vector<double>, read_signals,
+                    (const std::vector<geopm_request_s> &requests),
+                    (override));
         MOCK_METHOD(void, write_control,
                     (const std::string &control_name, int domain_type,
                      int domain_idx, double setting),
                     (override));
+        MOCK_METHOD(void, write_controls,
+                    (const std::vector<geopm_request_s> &requests,
+                     const std::vector<double> &settings),
+                    (override));
         MOCK_METHOD(void, save_control, (), (override));
         MOCK_METHOD(void, restore_control, (), (override));
         MOCK_METHOD(void, save_control, (const std::string &save_dir), (override));
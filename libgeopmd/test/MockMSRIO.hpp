@@ -18,6 +18,7 @@ class MockMSRIO : public geopm::MSRIO
                     (int cpu_idx, uint64_t offset, uint64_t raw_value, uint64_t write_mask),
                     (override));
         MOCK_METHOD(int, create_batch_context, (), (override));
+        MOCK_METHOD(void, reset_batch_context, (int batch_ctx), (override));
         MOCK_METHOD(int, add_read, (int cpu_idx, uint64_t offset), (override));
         MOCK_METHOD(int, add_read, (int cpu_idx, uint64_t offset, int batch_ctx), (override));
         MOCK_METHOD(void, read_batch, (), (override));
@@ -29,12 +29,20 @@ class MockPlatformIO : public geopm::PlatformIO
                     (const std::string &control_name, int domain_type, int domain_idx),
                     (override));
         MOCK_METHOD(double, sample, (int signal_idx), (override));
+        MOCK_METHOD(void, sample_range,
+                    (int signal_idx_begin, int num_signal, double *result),
+                    (override));
+        MOCK_METHOD(void, sample_all, (std::vector<double> &result), (override));
         MOCK_METHOD(void, adjust, (int control_idx, double setting), (override));
         MOCK_METHOD(void, read_batch, (), (override));
         MOCK_METHOD(void, write_batch, (), (override));
+        MOCK_METHOD((std::map<std::string, double>), read_batch_latency, (),
+                    (const, override));
         MOCK_METHOD(double, read_signal,
                     (const std::string &signal_name, int domain_type, int domain_idx),
                     (override));
+        MOCK_METHOD(std::vector<double>, read_signals,
+                    (const std::vector<geopm_request_s> &requests), (override));
         MOCK_METHOD(void, write_control,
                     (const std::string &control_name, int domain_type,
                      int domain_idx, double setting),
@@ -59,6 +67,12 @@ class MockPlatformIO : public geopm::PlatformIO
                      const std::vector<geopm_request_s> &control_config,
                      int &server_pid,
                      std::string &server_key), (override));
+        MOCK_METHOD(void, start_batch_server,
+                    (int client_pid,
+                     const std::vector<geopm_request_s> &signal_config,
+                     const std::vector<geopm_request_s> &control_config,
+                     double sample_period, int &server_pid,
+                     std::string &server_key), (override));
         MOCK_METHOD(void, stop_batch_server, (int server_pid), (override));
 
 };
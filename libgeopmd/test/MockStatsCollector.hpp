@@ -16,6 +16,7 @@ class MockStatsCollector : public geopm::StatsCollector
     public:
         MockStatsCollector() = default;
         virtual ~MockStatsCollector() = default;
+        MOCK_METHOD(void, enable_quantile, (int request_idx), (override));
         MOCK_METHOD(void, update, (), (override));
         MOCK_METHOD(std::string, report_yaml, (), (const, override));
         MOCK_METHOD(void, reset, (), (override));
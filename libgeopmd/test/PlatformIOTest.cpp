@@ -40,6 +40,7 @@ using ::testing::AtMost;
 using ::testing::Throw;
 using ::testing::Not;
 using ::testing::IsEmpty;
+using ::testing::SizeIs;
 
 class PlatformIOTestMockIOGroup : public MockIOGroup
 {
@@ -54,6 +55,19 @@ class PlatformIOTestMockIOGroup : public MockIOGroup
             //  registered plugins
             EXPECT_CALL(*this, is_valid_signal(_)).Times(AtLeast(0));
             EXPECT_CALL(*this, is_valid_control(_)).Times(AtLeast(0));
+            // Use the IOGroup implementations of the multiple request
+            // methods which call read_signal() and write_control()
+            ON_CALL(*this, read_signals(_))
+                .WillByDefault([this](const std::vector<geopm_request_s> &requests) {
+                    return IOGroup::read_signals(requests);
+                });
+            ON_CALL(*this, write_controls(_, _))
+                .WillByDefault([this](const std::vector<geopm_request_s> &requests,
+                                      const std::vector<double> &settings) {
+                    IOGroup::write_controls(requests, settings);
+                });
+            EXPECT_CALL(*this, read_signals(_)).Times(AtLeast(0));
+            EXPECT_CALL(*this, write_controls(_, _)).Times(AtLeast(0));
         }
 
         // Set up mock behavior for the IOGroup to provide a set of signals for specific domains
@@ -473,6 +487,119 @@ TEST_F(PlatformIOTest, sample)
     GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample(10), GEOPM_ERROR_INVALID, "signal_idx out of range");
 }
 
+TEST_F(PlatformIOTest, sample_range)
+{
+    EXPECT_CALL(*m_control_iogroup, signal_domain_type("FREQ")).Times(AtLeast(1));
+    EXPECT_CALL(*m_control_iogroup, push_signal("FREQ", _, _));
+    EXPECT_CALL(*m_time_iogroup, signal_domain_type("TIME")).Times(AtLeast(1));
+    EXPECT_CALL(*m_time_iogroup, push_signal("TIME", _, _));
+    int freq_idx = m_platio->push_signal("FREQ", GEOPM_DOMAIN_CPU, 0);
+    int time_idx = m_platio->push_signal("TIME", GEOPM_DOMAIN_BOARD, 0);
+    ASSERT_EQ(0, freq_idx);
+    ASSERT_EQ(1, time_idx);
+
+    std::vector<double> result(2, NAN);
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_range(0, 2, result.data()),
+                               GEOPM_ERROR_RUNTIME, "read_batch() not called");
+
+    for (auto iog : m_iogroup_ptr) {
+        EXPECT_CALL(*iog, read_batch());
+    }
+    m_platio->read_batch();
+
+    EXPECT_CALL(*m_control_iogroup, sample(0))
+        .WillOnce(Return(2e9))
+        .WillOnce(Return(3e9));
+    EXPECT_CALL(*m_time_iogroup, sample(0))
+        .WillOnce(Return(1.0))
+        .WillOnce(Return(4.0));
+    m_platio->sample_range(0, 2, result.data());
+    EXPECT_DOUBLE_EQ(2e9, result[0]);
+    EXPECT_DOUBLE_EQ(1.0, result[1]);
+
+    std::vector<double> all_result;
+    m_platio->sample_all(all_result);
+    ASSERT_EQ(2ULL, all_result.size());
+    EXPECT_DOUBLE_EQ(3e9, all_result[0]);
+    EXPECT_DOUBLE_EQ(4.0, all_result[1]);
+
+    m_platio->sample_range(1, 0, result.data());
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_range(-1, 1, result.data()),
+                               GEOPM_ERROR_INVALID, "signal_idx out of range");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_range(1, 2, result.data()),
+                               GEOPM_ERROR_INVALID, "signal_idx out of range");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_range(0, -1, result.data()),
+                               GEOPM_ERROR_INVALID, "signal_idx out of range");
+}
+
+TEST_F(PlatformIOTest, read_batch_threaded)
+{
+    std::list<std::shared_ptr<IOGroup> > iogroup_list;
+    for (auto ptr : m_iogroup_ptr) {
+        iogroup_list.emplace_back(ptr);
+    }
+    PlatformIOImp platio(iogroup_list, *m_topo, 2);
+    for (auto iog : m_iogroup_ptr) {
+        EXPECT_CALL(*iog, read_batch()).Times(3);
+        EXPECT_CALL(*iog, write_batch()).Times(1);
+    }
+    for (int repeat = 0; repeat < 3; ++repeat) {
+        platio.read_batch();
+    }
+    platio.write_batch();
+    std::map<std::string, double> latency = platio.read_batch_latency();
+    ASSERT_EQ(m_iogroup_ptr.size(), latency.size());
+    for (auto iog : m_iogroup_ptr) {
+        auto it = latency.find(iog->name());
+        ASSERT_NE(latency.end(), it);
+        EXPECT_LE(0.0, it->second);
+    }
+}
+
+TEST_F(PlatformIOTest, read_batch_threaded_error)
+{
+    std::list<std::shared_ptr<IOGroup> > iogroup_list;
+    for (auto ptr : m_iogroup_ptr) {
+        iogroup_list.emplace_back(ptr);
+    }
+    PlatformIOImp platio(iogroup_list, *m_topo, 2);
+    for (auto iog : m_iogroup_ptr) {
+        if (iog != m_control_iogroup) {
+            EXPECT_CALL(*iog, read_batch());
+        }
+    }
+    EXPECT_CALL(*m_control_iogroup, read_batch())
+        .WillOnce(Throw(geopm::Exception("read failed", GEOPM_ERROR_RUNTIME,
+                                         __FILE__, __LINE__)));
+    GEOPM_EXPECT_THROW_MESSAGE(platio.read_batch(), GEOPM_ERROR_RUNTIME, "read failed");
+}
+
+TEST_F(PlatformIOTest, read_batch_latency_serial)
+{
+    for (auto iog : m_iogroup_ptr) {
+        EXPECT_CALL(*iog, read_batch());
+    }
+    m_platio->read_batch();
+    EXPECT_TRUE(m_platio->read_batch_latency().empty());
+}
+
+TEST_F(PlatformIOTest, batch_thread_env)
+{
+    std::list<std::shared_ptr<IOGroup> > iogroup_list;
+    for (auto ptr : m_iogroup_ptr) {
+        iogroup_list.emplace_back(ptr);
+    }
+    setenv("GEOPM_PIO_BATCH_THREADS", "two", 1);
+    GEOPM_EXPECT_THROW_MESSAGE(PlatformIOImp platio(iogroup_list, *m_topo),
+                               GEOPM_ERROR_INVALID, "GEOPM_PIO_BATCH_THREADS must be a non-negative integer");
+    setenv("GEOPM_PIO_BATCH_THREADS", "-1", 1);
+    GEOPM_EXPECT_THROW_MESSAGE(PlatformIOImp platio(iogroup_list, *m_topo),
+                               GEOPM_ERROR_INVALID, "GEOPM_PIO_BATCH_THREADS must be a non-negative integer");
+    setenv("GEOPM_PIO_BATCH_THREADS", "0", 1);
+    EXPECT_NO_THROW(PlatformIOImp platio(iogroup_list, *m_topo));
+    unsetenv("GEOPM_PIO_BATCH_THREADS");
+}
+
 TEST_F(PlatformIOTest, sample_not_active)
 {
     /*EXPECT_CALL(*m_control_iogroup, control_domain_type("FREQ")).Times(2);
@@ -684,6 +811,69 @@ TEST_F(PlatformIOTest, read_signal_iogroup_fallback)
     EXPECT_DOUBLE_EQ(5e9, freq);
 }
 
+static geopm_request_s make_request(const std::string &name, int domain_type, int domain_idx)
+{
+    geopm_request_s result {domain_type, domain_idx, {}};
+    name.copy(result.name, NAME_MAX - 1);
+    return result;
+}
+
+TEST_F(PlatformIOTest, read_signals)
+{
+    std::vector<geopm_request_s> requests {
+        make_request("FREQ", GEOPM_DOMAIN_CPU, 0),
+        make_request("TIME", GEOPM_DOMAIN_BOARD, 0),
+        make_request("POWER", GEOPM_DOMAIN_CPU, 1),
+    };
+    EXPECT_CALL(*m_control_iogroup, signal_domain_type(_)).Times(AtLeast(1));
+    EXPECT_CALL(*m_time_iogroup, signal_domain_type("TIME")).Times(AtLeast(1));
+    // Requests for the same IOGroup are read together
+    EXPECT_CALL(*m_control_iogroup, read_signals(SizeIs(2)))
+        .WillOnce([](const std::vector<geopm_request_s> &group_requests) {
+            EXPECT_STREQ("FREQ", group_requests[0].name);
+            EXPECT_EQ(0, group_requests[0].domain_idx);
+            EXPECT_STREQ("POWER", group_requests[1].name);
+            EXPECT_EQ(1, group_requests[1].domain_idx);
+            return std::vector<double> {2e9, 100.0};
+        });
+    EXPECT_CALL(*m_time_iogroup, read_signals(SizeIs(1)))
+        .WillOnce(Return(std::vector<double> {3.0}));
+    EXPECT_CALL(*m_control_iogroup, read_signal(_, _, _)).Times(0);
+    EXPECT_CALL(*m_time_iogroup, read_signal(_, _, _)).Times(0);
+
+    std::vector<double> result = m_platio->read_signals(requests);
+    ASSERT_EQ(3ULL, result.size());
+    EXPECT_DOUBLE_EQ(2e9, result[0]);
+    EXPECT_DOUBLE_EQ(3.0, result[1]);
+    EXPECT_DOUBLE_EQ(100.0, result[2]);
+
+    EXPECT_TRUE(m_platio->read_signals({}).empty());
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->read_signals({make_request("INVALID", GEOPM_DOMAIN_CPU, 0)}),
+                               GEOPM_ERROR_INVALID, "signal name \"INVALID\" not found");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->read_signals({make_request("FREQ", GEOPM_NUM_DOMAIN, 0)}),
+                               GEOPM_ERROR_INVALID, "domain_type is out of range");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->read_signals({make_request("FREQ", GEOPM_DOMAIN_CPU, 100)}),
+                               GEOPM_ERROR_INVALID, "domain_idx is out of range");
+}
+
+TEST_F(PlatformIOTest, read_signals_fallback)
+{
+    // If the batched read fails, each request is read with
+    // read_signal() which falls back to the next IOGroup
+    EXPECT_CALL(*m_override_iogroup, signal_domain_type("TEMP")).Times(AtLeast(1));
+    EXPECT_CALL(*m_override_iogroup, read_signals(SizeIs(1)))
+        .WillOnce(Throw(geopm::Exception("injected exception", GEOPM_ERROR_RUNTIME, __FILE__, __LINE__)));
+    EXPECT_CALL(*m_override_iogroup, read_signal("TEMP", GEOPM_DOMAIN_BOARD, 0))
+        .WillOnce(Throw(geopm::Exception("injected exception", GEOPM_ERROR_RUNTIME, __FILE__, __LINE__)));
+    EXPECT_CALL(*m_fallback_iogroup, signal_domain_type("TEMP")).Times(AtLeast(1));
+    EXPECT_CALL(*m_fallback_iogroup, read_signal("TEMP", GEOPM_DOMAIN_BOARD, 0))
+        .WillOnce(Return(50.0));
+
+    std::vector<double> result = m_platio->read_signals({make_request("TEMP", GEOPM_DOMAIN_BOARD, 0)});
+    ASSERT_EQ(1ULL, result.size());
+    EXPECT_DOUBLE_EQ(50.0, result[0]);
+}
+
 TEST_F(PlatformIOTest, write_control)
 {
     // write_control will not affect pushed controls
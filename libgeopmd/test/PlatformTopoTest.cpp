@@ -11,12 +11,16 @@
 #include <sys/stat.h>
 
 #include <fstream>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
 #include "geopm/Helper.hpp"
+#include "GPUTopoNull.hpp"
 #include "MockGPUTopo.hpp"
 #include "MockServiceProxy.hpp"
 #include "PlatformTopoImp.hpp"
@@ -35,16 +39,91 @@ using testing::Not;
 using testing::StartsWith;
 using testing::_;
 
+class TopoFakeDirManager
+{
+    public:
+        TopoFakeDirManager(std::string base_path_template)
+        {
+            if (mkdtemp(&base_path_template[0]) == nullptr) {
+                throw std::runtime_error("Could not create a temporary directory at " + base_path_template);
+            }
+            m_base_dir_path = std::string(base_path_template);
+            m_created_dirs.push_back(m_base_dir_path);
+        }
+
+        ~TopoFakeDirManager()
+        {
+            for (const auto &file_path : m_created_files) {
+                unlink(file_path.c_str());
+            }
+            // Clean up directories we created in reverse order so
+            // any attempted directory removals are on empty directories
+            for (auto it = m_created_dirs.rbegin(); it != m_created_dirs.rend(); ++it) {
+                rmdir(it->c_str());
+            }
+        }
+
+        /// Write a file relative to the root, creating any missing
+        /// parent directories.
+        void write_file(const std::string &rel_path, const std::string &contents)
+        {
+            std::string path = m_base_dir_path;
+            auto path_parts = geopm::string_split(rel_path, "/");
+            for (size_t part_idx = 0; part_idx + 1 < path_parts.size(); ++part_idx) {
+                path += "/" + path_parts[part_idx];
+                if (mkdir(path.c_str(), 0755) == 0) {
+                    m_created_dirs.push_back(path);
+                }
+                else if (errno != EEXIST) {
+                    throw std::runtime_error("Could not create directory at " + path);
+                }
+            }
+            path += "/" + path_parts.back();
+            geopm::write_file(path, contents);
+            m_created_files.push_back(path);
+        }
+
+        /// Add the topology files of one CPU to sysfs.
+        void write_cpu(int cpu_idx, int package_id, int core_id)
+        {
+            std::string topo_dir = "sys/devices/system/cpu/cpu" + std::to_string(cpu_idx) + "/topology/";
+            write_file(topo_dir + "physical_package_id", std::to_string(package_id) + "\n");
+            write_file(topo_dir + "core_id", std::to_string(core_id) + "\n");
+        }
+
+        /// Add the topology files of one CPU on a multi-die package
+        /// to sysfs.
+        void write_cpu(int cpu_idx, int package_id, int die_id, int core_id)
+        {
+            write_cpu(cpu_idx, package_id, core_id);
+            std::string topo_dir = "sys/devices/system/cpu/cpu" + std::to_string(cpu_idx) + "/topology/";
+            write_file(topo_dir + "die_id", std::to_string(die_id) + "\n");
+        }
+
+        std::string get_root_dir() const
+        {
+            return m_base_dir_path;
+        }
+
+    private:
+        std::vector<std::string> m_created_dirs;
+        std::vector<std::string> m_created_files;
+        std::string m_base_dir_path;
+};
+
 class PlatformTopoTest : public :: testing :: Test
 {
     protected:
         void SetUp();
         void TearDown();
         void write_lscpu(const std::string &lscpu_str);
-        void spoof_lscpu(void);
+        /// Create a fake root directory with the sysfs and procfs
+        /// files for the topology described by m_hsw_lscpu_str.
+        void spoof_hsw_root(void);
         void check_bdx_domain_idx(std::string file_name, std::shared_ptr<ServiceProxy> service_proxy);
-        std::string m_path_env_save;
         std::string m_lscpu_file_name;
+        std::unique_ptr<TopoFakeDirManager> m_fake_root;
+        std::string m_hsw_sysfs_str;
         std::string m_hsw_lscpu_str;
         std::string m_knl_lscpu_str;
         std::string m_bdx_lscpu_str;
@@ -59,53 +138,44 @@ class PlatformTopoTest : public :: testing :: Test
         bool m_do_unlink;
 };
 
-void PlatformTopoTest::spoof_lscpu(void)
+void PlatformTopoTest::spoof_hsw_root(void)
 {
-    // Create script that wraps lscpu
-    std::string lscpu_script = "#!/bin/bash\n"
-                               "if [ ! -z \"$PLATFORM_TOPO_TEST_LSCPU_ERROR\" ]; then\n"
-                               "    exit -1;\n"
-                               "else\n"
-                               "    echo 'Architecture:          x86_64'\n"
-                               "    echo 'CPU op-mode(s):        32-bit, 64-bit'\n"
-                               "    echo 'Byte Order:            Little Endian'\n"
-                               "    echo 'CPU(s):                2'\n"
-                               "    echo 'On-line CPU(s) mask:   0x3'\n"
-                               "    echo 'Thread(s) per core:    1'\n"
-                               "    echo 'Core(s) per socket:    2'\n"
-                               "    echo 'Socket(s):             1'\n"
-                               "    echo 'NUMA node(s):          1'\n"
-                               "    echo 'Vendor ID:             GenuineIntel'\n"
-                               "    echo 'CPU family:            6'\n"
-                               "    echo 'Model:                 61'\n"
-                               "    echo 'Model name:            Intel(R) Core(TM) i7-5650U CPU @ 2.20GHz'\n"
-                               "    echo 'Stepping:              4'\n"
-                               "    echo 'CPU MHz:               2200.000'\n"
-                               "    echo 'BogoMIPS:              4400.00'\n"
-                               "    echo 'Hypervisor vendor:     KVM'\n"
-                               "    echo 'Virtualization type:   full'\n"
-                               "    echo 'L1d cache:             32K'\n"
-                               "    echo 'L1i cache:             32K'\n"
-                               "    echo 'L2 cache:              256K'\n"
-                               "    echo 'L3 cache:              4096K'\n"
-                               "    echo 'NUMA node0 CPU(s):     0x3'\n"
-                               "fi\n";
-    std::ofstream script_stream("lscpu");
-    script_stream << lscpu_script;
-    script_stream.close();
-    chmod("lscpu", S_IRWXU|S_IRWXG|S_IROTH|S_IXOTH);
-
-    // Put CWD in the front of PATH
-    std::string path_env(":" + m_path_env_save);
-    setenv("PATH", path_env.c_str(), 1);
+    m_fake_root = std::make_unique<TopoFakeDirManager>("/tmp/PlatformTopoTest-root-XXXXXX");
+    m_fake_root->write_file("sys/devices/system/cpu/online", "0-1\n");
+    m_fake_root->write_file("sys/devices/system/cpu/present", "0-1\n");
+    m_fake_root->write_cpu(0, 0, 0);
+    m_fake_root->write_cpu(1, 0, 1);
+    m_fake_root->write_file("sys/devices/system/node/node0/cpulist", "0-1\n");
+    m_fake_root->write_file("sys/devices/system/node/online", "0\n");
+    std::string cpuinfo_entry =
+        "vendor_id\t: GenuineIntel\n"
+        "cpu family\t: 6\n"
+        "model\t\t: 61\n"
+        "model name\t: Intel(R) Core(TM) i7-5650U CPU @ 2.20GHz\n"
+        "stepping\t: 4\n"
+        "cpu MHz\t\t: 2200.000\n";
+    m_fake_root->write_file("proc/cpuinfo",
+                            "processor\t: 0\n" + cpuinfo_entry + "\n" +
+                            "processor\t: 1\n" + cpuinfo_entry + "\n");
 }
 
 
 void PlatformTopoTest::SetUp()
 {
-    const char *path_cstr = getenv("PATH");
-    m_path_env_save = path_cstr ? path_cstr : "";
     m_lscpu_file_name = "PlatformTopoTest-lscpu";
+    m_hsw_sysfs_str =
+        "CPU(s):                2\n"
+        "On-line CPU(s) mask:   0x3\n"
+        "Thread(s) per core:    1\n"
+        "Core(s) per socket:    2\n"
+        "Socket(s):             1\n"
+        "NUMA node(s):          1\n"
+        "Vendor ID:             GenuineIntel\n"
+        "CPU family:            6\n"
+        "Model:                 61\n"
+        "Model name:            Intel(R) Core(TM) i7-5650U CPU @ 2.20GHz\n"
+        "Stepping:              4\n"
+        "NUMA node0 CPU(s):     0x3\n";
     m_hsw_lscpu_str =
         "Architecture:          x86_64\n"
         "CPU op-mode(s):        32-bit, 64-bit\n"
@@ -341,9 +411,7 @@ void PlatformTopoTest::TearDown()
     if (m_do_unlink) {
         unlink(m_lscpu_file_name.c_str());
     }
-    (void)unlink("lscpu");
-    (void)setenv("PATH", m_path_env_save.c_str(), 1);
-    unsetenv("PLATFORM_TOPO_TEST_LSCPU_ERROR");
+    m_fake_root.reset();
 }
 
 void PlatformTopoTest::write_lscpu(const std::string &lscpu_str)
@@ -902,32 +970,27 @@ TEST_F(PlatformTopoTest, create_cache)
         .WillOnce(Return(std::set<int>{137,139,141,143,145,147,149,151,153,155,157,159,161,163,165,167,169}))
         .WillOnce(Return(std::set<int>{170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202}))
         .WillOnce(Return(std::set<int>{171,173,175,177,179,181,183,185,187,189,191,193,195,197,199,201,203}));
-    spoof_lscpu();
+    spoof_hsw_root();
+    std::string root_path = m_fake_root->get_root_dir();
+    std::string missing_root_path = root_path + "/missing";
+    geopm::GPUTopoNull gpu_topo_null;
 
-    // Test case: no lscpu error, file does not exist
-    setenv("PLATFORM_TOPO_TEST_LSCPU_ERROR", "", 1);
+    // Test case: system topology is readable, file does not exist
+    PlatformTopoImp::create_cache(cache_file_path, *gpu_topo, root_path);
 
-    PlatformTopoImp::create_cache(cache_file_path, *gpu_topo);
+    std::string cache_str = geopm::read_file(cache_file_path);
+    ASSERT_TRUE(geopm::string_begins_with(cache_str, m_hsw_sysfs_str));
+    EXPECT_NE(std::string::npos, cache_str.find("\nGPU chip11 CPU(s): 171,173,"));
 
-    std::ifstream cache_stream(cache_file_path);
-    std::string cache_line;
-    getline(cache_stream, cache_line);
-    ASSERT_TRUE(geopm::string_begins_with(cache_line, "Architecture:"));
-    cache_stream.close();
+    // Test case: file exist, system topology should not be read,
+    // but if it is it will error.
+    PlatformTopoImp::create_cache(cache_file_path, gpu_topo_null, missing_root_path);
+    EXPECT_EQ(cache_str, geopm::read_file(cache_file_path));
 
-    // Test case: file exist, lscpu should not be called, but if it
-    // does it will error.
-    setenv("PLATFORM_TOPO_TEST_LSCPU_ERROR", "1", 1);
-    PlatformTopoImp::create_cache(cache_file_path);
-
-    cache_stream.open(cache_file_path);
-    getline(cache_stream, cache_line);
-    ASSERT_TRUE(geopm::string_begins_with(cache_line, "Architecture:"));
-    cache_stream.close();
-
-    // Test case: file does not exist and lscpu returns an error code.
+    // Test case: file does not exist and system topology is not readable.
     unlink(cache_file_path.c_str());
-    EXPECT_THROW(PlatformTopoImp::create_cache(cache_file_path), geopm::Exception);
+    EXPECT_THROW(PlatformTopoImp::create_cache(cache_file_path, gpu_topo_null, missing_root_path),
+                 geopm::Exception);
     for (const auto &file_path : geopm::list_directory_files("./")) {
         EXPECT_THAT(file_path, Not(StartsWith(cache_file_path)))
             << "PlatformTopoImp::create_cache leaked a temporary file";
@@ -940,7 +1003,6 @@ TEST_F(PlatformTopoTest, create_cache)
 
 TEST_F(PlatformTopoTest, call_c_wrappers)
 {
-    spoof_lscpu();
     // negative test num_domain()
     ASSERT_GT(0, geopm_topo_num_domain(GEOPM_NUM_DOMAIN));
     // simple test for num_domain()
@@ -985,7 +1047,7 @@ TEST_F(PlatformTopoTest, call_c_wrappers)
 
 TEST_F(PlatformTopoTest, check_file_too_old)
 {
-    spoof_lscpu();
+    spoof_hsw_root();
     write_lscpu(m_hsw_lscpu_str);
 
     struct sysinfo si;
@@ -1004,7 +1066,7 @@ TEST_F(PlatformTopoTest, check_file_too_old)
     stat(m_lscpu_file_name.c_str(), &file_stat);
     ASSERT_EQ(old_time, file_stat.st_mtime);
 
-    PlatformTopoImp topo(m_lscpu_file_name, nullptr);
+    PlatformTopoImp topo(m_lscpu_file_name, nullptr, m_fake_root->get_root_dir());
 
     // Verify the cache was regenerated because it was too old
     stat(m_lscpu_file_name.c_str(), &file_stat);
@@ -1012,12 +1074,12 @@ TEST_F(PlatformTopoTest, check_file_too_old)
 
     // Verify the new file contents
     std::string new_file_contents = geopm::read_file(m_lscpu_file_name);
-    ASSERT_EQ(m_hsw_lscpu_str, new_file_contents);
+    ASSERT_EQ(m_hsw_sysfs_str, new_file_contents);
 }
 
 TEST_F(PlatformTopoTest, check_file_bad_perms)
 {
-    spoof_lscpu();
+    spoof_hsw_root();
     write_lscpu(m_hsw_lscpu_str);
 
     // Override the permissions to a known bad state: 0o644
@@ -1030,7 +1092,7 @@ TEST_F(PlatformTopoTest, check_file_bad_perms)
     mode_t actual_perms = file_stat.st_mode & ~S_IFMT;
     ASSERT_EQ(bad_perms, actual_perms);
 
-    PlatformTopoImp topo(m_lscpu_file_name, nullptr);
+    PlatformTopoImp topo(m_lscpu_file_name, nullptr, m_fake_root->get_root_dir());
 
     // Verify that the cache was regenerated because it had the wrong permissions
     stat(m_lscpu_file_name.c_str(), &file_stat);
@@ -1040,5 +1102,78 @@ TEST_F(PlatformTopoTest, check_file_bad_perms)
 
     // Verify the new file contents
     std::string new_file_contents = geopm::read_file(m_lscpu_file_name);
-    ASSERT_EQ(m_hsw_lscpu_str, new_file_contents);
+    ASSERT_EQ(m_hsw_sysfs_str, new_file_contents);
+}
+
+TEST_F(PlatformTopoTest, read_system_topo)
+{
+    // 2 packages with 2 cores of 2 threads each; core IDs are not
+    // contiguous within a package as on many server processors.
+    TopoFakeDirManager fake_root("/tmp/PlatformTopoTest-root-XXXXXX");
+    fake_root.write_file("sys/devices/system/cpu/online", "0-7\n");
+    fake_root.write_file("sys/devices/system/cpu/present", "0-7\n");
+    std::vector<int> core_id {0, 4, 0, 4};
+    for (int cpu_idx = 0; cpu_idx < 8; ++cpu_idx) {
+        int core_idx = cpu_idx % 4;
+        fake_root.write_cpu(cpu_idx, core_idx / 2, core_id[core_idx]);
+    }
+    fake_root.write_file("sys/devices/system/node/node0/cpulist", "0-1,4-5\n");
+    fake_root.write_file("sys/devices/system/node/node1/cpulist", "2-3,6-7\n");
+    fake_root.write_file("sys/devices/system/node/online", "0-1\n");
+    fake_root.write_file("sys/devices/system/node/possible", "0-1\n");
+
+    // No cpuinfo file
+    std::string expected =
+        "CPU(s):                8\n"
+        "On-line CPU(s) mask:   0xff\n"
+        "Thread(s) per core:    2\n"
+        "Core(s) per socket:    2\n"
+        "Socket(s):             2\n"
+        "NUMA node(s):          2\n"
+        "NUMA node0 CPU(s):     0x33\n"
+        "NUMA node1 CPU(s):     0xcc\n";
+    EXPECT_EQ(expected, PlatformTopoImp::read_system_topo(fake_root.get_root_dir()));
+
+    write_lscpu("");
+    // Set the file time before boot so that the cache is regenerated
+    struct utimbuf file_times = {0, 0};
+    utime(m_lscpu_file_name.c_str(), &file_times);
+    PlatformTopoImp topo(m_lscpu_file_name, nullptr, fake_root.get_root_dir());
+    EXPECT_EQ(2, topo.num_domain(GEOPM_DOMAIN_PACKAGE));
+    EXPECT_EQ(4, topo.num_domain(GEOPM_DOMAIN_CORE));
+    EXPECT_EQ(8, topo.num_domain(GEOPM_DOMAIN_CPU));
+    EXPECT_EQ(2, topo.num_domain(GEOPM_DOMAIN_MEMORY));
+    EXPECT_EQ(std::set<int>({2, 3, 6, 7}),
+              topo.domain_nested(GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_PACKAGE, 1));
+    EXPECT_EQ(std::set<int>({2, 3, 6, 7}),
+              topo.domain_nested(GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_MEMORY, 1));
+
+    // A CPU without topology files is an error
+    fake_root.write_file("sys/devices/system/cpu/online", "0-8\n");
+    GEOPM_EXPECT_THROW_MESSAGE(PlatformTopoImp::read_system_topo(fake_root.get_root_dir()),
+                               ENOENT, "cpu8/topology/physical_package_id");
+    fake_root.write_file("sys/devices/system/cpu/online", "\n");
+    GEOPM_EXPECT_THROW_MESSAGE(PlatformTopoImp::read_system_topo(fake_root.get_root_dir()),
+                               GEOPM_ERROR_RUNTIME, "No online CPUs found");
+}
+
+TEST_F(PlatformTopoTest, read_system_topo_multi_die)
+{
+    // 1 package with 2 dies of 2 cores with 2 threads each; both dies
+    // use core IDs 0 and 1.
+    TopoFakeDirManager fake_root("/tmp/PlatformTopoTest-root-XXXXXX");
+    fake_root.write_file("sys/devices/system/cpu/online", "0-7\n");
+    fake_root.write_file("sys/devices/system/cpu/present", "0-7\n");
+    for (int cpu_idx = 0; cpu_idx < 8; ++cpu_idx) {
+        int core_idx = cpu_idx % 4;
+        fake_root.write_cpu(cpu_idx, 0, core_idx / 2, core_idx % 2);
+    }
+
+    std::string expected =
+        "CPU(s):                8\n"
+        "On-line CPU(s) mask:   0xff\n"
+        "Thread(s) per core:    2\n"
+        "Core(s) per socket:    4\n"
+        "Socket(s):             1\n";
+    EXPECT_EQ(expected, PlatformTopoImp::read_system_topo(fake_root.get_root_dir()));
 }
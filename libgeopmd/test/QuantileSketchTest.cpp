@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cmath>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "QuantileSketch.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm_test.hpp"
+
+using geopm::QuantileSketch;
+
+class QuantileSketchTest : public ::testing::Test
+{
+    protected:
+        void SetUp(void);
+        double exact_quantile(double quantile) const;
+        std::vector<double> m_values;
+};
+
+void QuantileSketchTest::SetUp(void)
+{
+    std::mt19937 generator(13);
+    std::lognormal_distribution<double> latency_dist(-7.0, 1.5);
+    for (int idx = 0; idx < 10000; ++idx) {
+        m_values.push_back(latency_dist(generator));
+    }
+}
+
+double QuantileSketchTest::exact_quantile(double quantile) const
+{
+    std::vector<double> sorted(m_values);
+    std::sort(sorted.begin(), sorted.end());
+    return sorted[(size_t)(quantile * (sorted.size() - 1))];
+}
+
+TEST_F(QuantileSketchTest, empty)
+{
+    QuantileSketch sketch;
+    EXPECT_EQ(0ULL, sketch.count());
+    EXPECT_EQ(0, sketch.num_bucket());
+    EXPECT_TRUE(std::isnan(sketch.quantile(0.5)));
+    sketch.insert(NAN);
+    EXPECT_EQ(0ULL, sketch.count());
+    EXPECT_TRUE(std::isnan(sketch.quantile(0.5)));
+}
+
+TEST_F(QuantileSketchTest, relative_accuracy)
+{
+    QuantileSketch sketch;
+    for (auto value : m_values) {
+        sketch.insert(value);
+    }
+    EXPECT_EQ(m_values.size(), sketch.count());
+    for (double qq : {0.0, 0.25, 0.5, 0.9, 0.99, 0.999, 1.0}) {
+        double expect = exact_quantile(qq);
+        EXPECT_NEAR(expect, sketch.quantile(qq),
+                    sketch.relative_accuracy() * expect) << "quantile = " << qq;
+    }
+}
+
+TEST_F(QuantileSketchTest, signed_values)
+{
+    QuantileSketch sketch;
+    for (double value : {-100.0, -10.0, 0.0, 0.0, 10.0, 100.0, 1000.0}) {
+        sketch.insert(value);
+    }
+    EXPECT_NEAR(-100.0, sketch.quantile(0.0), 1.0);
+    EXPECT_NEAR(-10.0, sketch.quantile(1.0 / 6), 0.1);
+    EXPECT_EQ(0.0, sketch.quantile(0.5));
+    EXPECT_NEAR(100.0, sketch.quantile(5.0 / 6), 1.0);
+    EXPECT_NEAR(1000.0, sketch.quantile(1.0), 10.0);
+    sketch.reset();
+    EXPECT_EQ(0ULL, sketch.count());
+    EXPECT_TRUE(std::isnan(sketch.quantile(0.5)));
+}
+
+TEST_F(QuantileSketchTest, merge)
+{
+    QuantileSketch sketch_all;
+    QuantileSketch sketch_even;
+    QuantileSketch sketch_odd;
+    for (size_t idx = 0; idx < m_values.size(); ++idx) {
+        sketch_all.insert(m_values[idx]);
+        if (idx % 2 == 0) {
+            sketch_even.insert(m_values[idx]);
+        }
+        else {
+            sketch_odd.insert(m_values[idx]);
+        }
+    }
+    sketch_even.merge(sketch_odd);
+    EXPECT_EQ(sketch_all.count(), sketch_even.count());
+    EXPECT_EQ(sketch_all.num_bucket(), sketch_even.num_bucket());
+    for (double qq : {0.0, 0.5, 0.9, 0.99, 1.0}) {
+        EXPECT_EQ(sketch_all.quantile(qq), sketch_even.quantile(qq));
+    }
+    QuantileSketch sketch_coarse(0.05, 100);
+    GEOPM_EXPECT_THROW_MESSAGE(sketch_even.merge(sketch_coarse), GEOPM_ERROR_INVALID,
+                               "relative accuracy of sketches does not match");
+}
+
+TEST_F(QuantileSketchTest, bounded_buckets)
+{
+    int max_bucket = 64;
+    QuantileSketch sketch(0.01, max_bucket);
+    for (auto value : m_values) {
+        sketch.insert(value);
+    }
+    EXPECT_EQ(max_bucket, sketch.num_bucket());
+    EXPECT_EQ(m_values.size(), sketch.count());
+    // Collapsed buckets hold the smallest values, upper quantiles
+    // keep their accuracy
+    for (double qq : {0.99, 1.0}) {
+        double expect = exact_quantile(qq);
+        EXPECT_NEAR(expect, sketch.quantile(qq), 0.01 * expect);
+    }
+}
+
+TEST_F(QuantileSketchTest, errors)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(QuantileSketch(0.0, 100), GEOPM_ERROR_INVALID,
+                               "relative_accuracy must be in the range");
+    GEOPM_EXPECT_THROW_MESSAGE(QuantileSketch(1.0, 100), GEOPM_ERROR_INVALID,
+                               "relative_accuracy must be in the range");
+    GEOPM_EXPECT_THROW_MESSAGE(QuantileSketch(0.01, 1), GEOPM_ERROR_INVALID,
+                               "max_bucket must be at least 2");
+    QuantileSketch sketch;
+    GEOPM_EXPECT_THROW_MESSAGE(sketch.quantile(1.5), GEOPM_ERROR_INVALID,
+                               "quantile must be in the range");
+    GEOPM_EXPECT_THROW_MESSAGE(sketch.quantile(NAN), GEOPM_ERROR_INVALID,
+                               "quantile must be in the range");
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "RuntimeStats.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm_test.hpp"
+
+using geopm::RuntimeStats;
+
+TEST(RuntimeStatsTest, quantile)
+{
+    RuntimeStats stats({"power", "energy"});
+    stats.enable_quantile(0);
+    stats.enable_quantile(0);
+    EXPECT_TRUE(stats.is_quantile_enabled(0));
+    EXPECT_FALSE(stats.is_quantile_enabled(1));
+    EXPECT_TRUE(std::isnan(stats.quantile(0, 0.5)));
+    for (int idx = 1; idx <= 100; ++idx) {
+        stats.update({(double)idx, (double)idx});
+    }
+    stats.update({NAN, NAN});
+    EXPECT_EQ(100ULL, stats.count(0));
+    EXPECT_NEAR(50.0, stats.quantile(0, 0.5), 0.5);
+    EXPECT_NEAR(99.0, stats.quantile(0, 0.99), 1.0);
+    EXPECT_TRUE(std::isnan(stats.quantile(1, 0.5)));
+    stats.reset();
+    EXPECT_TRUE(stats.is_quantile_enabled(0));
+    EXPECT_TRUE(std::isnan(stats.quantile(0, 0.5)));
+    GEOPM_EXPECT_THROW_MESSAGE(stats.enable_quantile(2), GEOPM_ERROR_INVALID,
+                               "metric_idx out of range");
+}
+
+TEST(RuntimeStatsTest, merge)
+{
+    std::vector<std::string> names = {"power", "energy"};
+    RuntimeStats stats_a(names);
+    RuntimeStats stats_b(names);
+    RuntimeStats stats_all(names);
+    stats_b.enable_quantile(1);
+    stats_all.enable_quantile(1);
+    for (int idx = 0; idx < 10; ++idx) {
+        std::vector<double> sample = {1.0 * idx, 10.0 * idx};
+        stats_all.update(sample);
+        if (idx < 4) {
+            stats_a.update(sample);
+        }
+        else {
+            stats_b.update(sample);
+        }
+    }
+    // Metric without samples in this object
+    stats_b.update({NAN, 100.0});
+    stats_all.update({NAN, 100.0});
+    stats_a.merge(stats_b);
+    EXPECT_TRUE(stats_a.is_quantile_enabled(1));
+    for (int metric_idx = 0; metric_idx < 2; ++metric_idx) {
+        EXPECT_EQ(stats_all.count(metric_idx), stats_a.count(metric_idx));
+        EXPECT_EQ(stats_all.first(metric_idx), stats_a.first(metric_idx));
+        EXPECT_EQ(stats_all.last(metric_idx), stats_a.last(metric_idx));
+        EXPECT_EQ(stats_all.min(metric_idx), stats_a.min(metric_idx));
+        EXPECT_EQ(stats_all.max(metric_idx), stats_a.max(metric_idx));
+        EXPECT_DOUBLE_EQ(stats_all.mean(metric_idx), stats_a.mean(metric_idx));
+        EXPECT_DOUBLE_EQ(stats_all.std(metric_idx), stats_a.std(metric_idx));
+    }
+    // Samples in stats_a before quantiles were enabled are not counted
+    EXPECT_EQ(stats_b.quantile(1, 0.5), stats_a.quantile(1, 0.5));
+
+    RuntimeStats stats_empty(names);
+    stats_empty.merge(stats_all);
+    EXPECT_EQ(stats_all.first(0), stats_empty.first(0));
+    EXPECT_EQ(stats_all.min(1), stats_empty.min(1));
+    EXPECT_EQ(stats_all.quantile(1, 0.9), stats_empty.quantile(1, 0.9));
+
+    RuntimeStats stats_other({"power"});
+    GEOPM_EXPECT_THROW_MESSAGE(stats_a.merge(stats_other), GEOPM_ERROR_INVALID,
+                               "metric names do not match");
+}
@@ -186,12 +186,90 @@ TEST_F(StatsCollectorTest, time_report)
     EXPECT_EQ(1.0, report_struct.metric_stats[0][GEOPM_METRIC_MAX]);
     EXPECT_EQ(0.5, report_struct.metric_stats[0][GEOPM_METRIC_MEAN]);
     EXPECT_NEAR(1e-8, std::sqrt(2) / 2, report_struct.metric_stats[0][GEOPM_METRIC_STD]);
+    // Quantiles were not enabled
+    ASSERT_EQ(1ULL, report_struct.metric_quantile.size());
+    EXPECT_TRUE(std::isnan(report_struct.metric_quantile[0][GEOPM_METRIC_QUANTILE_P50]));
+    EXPECT_TRUE(std::isnan(report_struct.metric_quantile[0][GEOPM_METRIC_QUANTILE_P90]));
+    EXPECT_TRUE(std::isnan(report_struct.metric_quantile[0][GEOPM_METRIC_QUANTILE_P99]));
+    EXPECT_EQ(std::string::npos, report.find("p50:"));
     for (size_t stat_idx = 0; stat_idx != GEOPM_NUM_METRIC_STATS; ++stat_idx) {
-        EXPECT_EQ(report_struct.metric_stats[0][stat_idx], report_struct_c.metric_stats[0].stats[stat_idx]);
+        if (std::isnan(report_struct.metric_stats[0][stat_idx])) {
+            EXPECT_TRUE(std::isnan(report_struct_c.metric_stats[0].stats[stat_idx]));
+        }
+        else {
+            EXPECT_EQ(report_struct.metric_stats[0][stat_idx], report_struct_c.metric_stats[0].stats[stat_idx]);
+        }
     }
     free(report_struct_c.metric_stats);
 }
 
+/// @brief Report quantile estimates for one of two requests
+TEST_F(StatsCollectorTest, quantile_report)
+{
+    int time_idx = 0;
+    int power_idx = 1;
+    int energy_idx = 2;
+    EXPECT_CALL(*m_pio_mock, push_signal("TIME", 0, 0))
+        .WillOnce(Return(time_idx));
+    EXPECT_CALL(*m_pio_mock, push_signal("POWER", 0, 0))
+        .WillOnce(Return(power_idx));
+    EXPECT_CALL(*m_pio_mock, push_signal("ENERGY", 0, 0))
+        .WillOnce(Return(energy_idx));
+    EXPECT_CALL(*m_pio_mock, read_signal("TIME", 0, 0))
+        .WillOnce(Return(0.0));
+    double time = 0.0;
+    double power = 0.0;
+    EXPECT_CALL(*m_pio_mock, sample(time_idx))
+        .WillRepeatedly(testing::InvokeWithoutArgs([&time]() {
+            return time;
+        }));
+    EXPECT_CALL(*m_pio_mock, sample(power_idx))
+        .WillRepeatedly(testing::InvokeWithoutArgs([&power]() {
+            return power;
+        }));
+    EXPECT_CALL(*m_pio_mock, sample(energy_idx))
+        .WillRepeatedly(Return(1.0));
+    std::vector<geopm_request_s> req {geopm_request_s{0, 0, "POWER"},
+                                      geopm_request_s{0, 0, "ENERGY"}};
+    auto coll = StatsCollectorImp(req, *m_pio_mock);
+    struct geopm_stats_collector_s *coll_ptr = reinterpret_cast<geopm_stats_collector_s *>(&coll);
+    EXPECT_EQ(0, geopm_stats_collector_enable_quantile(coll_ptr, 0));
+    EXPECT_EQ(GEOPM_ERROR_INVALID, geopm_stats_collector_enable_quantile(coll_ptr, 2));
+    for (int step = 1; step <= 100; ++step) {
+        time = step;
+        power = step;
+        coll.update();
+    }
+    std::string report = coll.report_yaml();
+    auto power_pos = report.find("  POWER:\n");
+    auto energy_pos = report.find("  ENERGY:\n");
+    ASSERT_NE(std::string::npos, power_pos);
+    ASSERT_NE(std::string::npos, energy_pos);
+    auto p50_pos = report.find("    p50: ");
+    ASSERT_NE(std::string::npos, p50_pos);
+    EXPECT_LT(power_pos, p50_pos);
+    EXPECT_GT(energy_pos, p50_pos);
+    EXPECT_NE(std::string::npos, report.find("    p90: "));
+    EXPECT_NE(std::string::npos, report.find("    p99: "));
+    EXPECT_EQ(std::string::npos, report.find("p50:", energy_pos));
+
+    auto report_struct = coll.report_struct();
+    ASSERT_EQ(2ULL, report_struct.metric_quantile.size());
+    EXPECT_NEAR(50.0, report_struct.metric_quantile[0][GEOPM_METRIC_QUANTILE_P50], 0.5);
+    EXPECT_NEAR(90.0, report_struct.metric_quantile[0][GEOPM_METRIC_QUANTILE_P90], 0.9);
+    EXPECT_NEAR(99.0, report_struct.metric_quantile[0][GEOPM_METRIC_QUANTILE_P99], 1.0);
+    EXPECT_TRUE(std::isnan(report_struct.metric_quantile[1][GEOPM_METRIC_QUANTILE_P50]));
+
+    std::vector<geopm_metric_quantile_s> quantile_c(2);
+    EXPECT_EQ(GEOPM_ERROR_INVALID,
+              geopm_stats_collector_report_quantile(coll_ptr, 1, quantile_c.data()));
+    ASSERT_EQ(0, geopm_stats_collector_report_quantile(coll_ptr, 2, quantile_c.data()));
+    for (size_t quant_idx = 0; quant_idx != GEOPM_NUM_METRIC_QUANTILE; ++quant_idx) {
+        EXPECT_EQ(report_struct.metric_quantile[0][quant_idx], quantile_c[0].quantile[quant_idx]);
+        EXPECT_TRUE(std::isnan(quantile_c[1].quantile[quant_idx]));
+    }
+}
+
 TEST_F(StatsCollectorTest, c_strings)
 {
     MockStatsCollector mock_coll;
@@ -200,7 +278,8 @@ TEST_F(StatsCollectorTest, c_strings)
     std::string too_big_str(too_big.data());
     geopm::StatsCollector::report_s too_big_report {
         too_big_str, too_big_str, {0.0, 0.0, 0.0, 0.0},
-        {too_big_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}
+        {too_big_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}},
+        {{0.0, 0.0, 0.0}}
     };
     EXPECT_CALL(mock_coll, report_struct()).WillOnce(Return(too_big_report));
     struct geopm_report_s report_c;
@@ -209,7 +288,8 @@ TEST_F(StatsCollectorTest, c_strings)
     std::string max_str(too_big.data() + 1);
     geopm::StatsCollector::report_s max_report {
         max_str, max_str, {0.0, 0.0, 0.0, 0.0},
-        {max_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}
+        {max_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}},
+        {{0.0, 0.0, 0.0}}
     };
     EXPECT_CALL(mock_coll, report_struct()).WillOnce(Return(max_report));
     EXPECT_EQ(0, geopm_stats_collector_report((geopm_stats_collector_s *)(&mock_coll), 1, &report_c));
@@ -219,7 +299,8 @@ TEST_F(StatsCollectorTest, c_strings)
 
     geopm::StatsCollector::report_s mixed_report {
         max_str, too_big_str, {0.0, 0.0, 0.0, 0.0},
-        {max_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}
+        {max_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}},
+        {{0.0, 0.0, 0.0}}
     };
     EXPECT_CALL(mock_coll, report_struct()).WillOnce(Return(mixed_report));
     EXPECT_EQ(-1, geopm_stats_collector_report((geopm_stats_collector_s *)(&mock_coll), 1, &report_c));
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <unistd.h>
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "TimeTSC.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm_time.h"
+#include "MockCpuid.hpp"
+
+using geopm::TimeTSC;
+using testing::Return;
+
+class TimeTSCTest : public ::testing::Test
+{
+    protected:
+        void SetUp(void);
+        void TearDown(void);
+        MockCpuid m_cpuid;
+        const std::string m_clocksource_path = "TimeTSCTest_clocksource";
+        const double M_CALIBRATE_DURATION = 0.01;
+};
+
+void TimeTSCTest::SetUp(void)
+{
+    geopm::write_file(m_clocksource_path, "tsc\n");
+}
+
+void TimeTSCTest::TearDown(void)
+{
+    unlink(m_clocksource_path.c_str());
+}
+
+TEST_F(TimeTSCTest, not_invariant)
+{
+    EXPECT_CALL(m_cpuid, is_tsc_invariant())
+        .WillRepeatedly(Return(false));
+    TimeTSC time_tsc(m_cpuid, m_clocksource_path, M_CALIBRATE_DURATION);
+    EXPECT_FALSE(time_tsc.is_enabled());
+    EXPECT_TRUE(std::isnan(time_tsc.frequency()));
+}
+
+TEST_F(TimeTSCTest, clocksource_not_tsc)
+{
+    EXPECT_CALL(m_cpuid, is_tsc_invariant())
+        .WillRepeatedly(Return(true));
+    geopm::write_file(m_clocksource_path, "hpet\n");
+    TimeTSC time_tsc(m_cpuid, m_clocksource_path, M_CALIBRATE_DURATION);
+    EXPECT_FALSE(time_tsc.is_enabled());
+    TimeTSC time_missing(m_cpuid, "TimeTSCTest_missing", M_CALIBRATE_DURATION);
+    EXPECT_FALSE(time_missing.is_enabled());
+}
+
+TEST_F(TimeTSCTest, convert)
+{
+    if (geopm_time_tsc() == 0) {
+        GTEST_SKIP() << "No time stamp counter on this architecture";
+    }
+    EXPECT_CALL(m_cpuid, is_tsc_invariant())
+        .WillRepeatedly(Return(true));
+    TimeTSC time_tsc(m_cpuid, m_clocksource_path, M_CALIBRATE_DURATION);
+    ASSERT_TRUE(time_tsc.is_enabled());
+    double freq = time_tsc.frequency();
+    EXPECT_LT(0.0, freq);
+
+    struct geopm_time_s expect;
+    geopm_time(&expect);
+    uint64_t tsc = geopm_time_tsc();
+    struct geopm_time_s actual = time_tsc.time(tsc);
+    EXPECT_NEAR(0.0, geopm_time_diff(&expect, &actual), 1E-3);
+    EXPECT_LE(0, actual.t.tv_nsec);
+    EXPECT_GT(1000000000, actual.t.tv_nsec);
+
+    // Counter values before the calibration
+    struct geopm_time_s before = time_tsc.time(tsc - (uint64_t)(0.5 * freq));
+    EXPECT_NEAR(-0.5, geopm_time_diff(&actual, &before), 1E-3);
+    EXPECT_LE(0, before.t.tv_nsec);
+    EXPECT_GT(1000000000, before.t.tv_nsec);
+}
+
+TEST_F(TimeTSCTest, time_fast)
+{
+    // Uses the counter if it is available on the test system,
+    // otherwise geopm_time()
+    struct geopm_time_s expect;
+    struct geopm_time_s actual;
+    geopm_time(&expect);
+    EXPECT_EQ(0, geopm_time_fast(&actual));
+    EXPECT_NEAR(0.0, geopm_time_diff(&expect, &actual), 1E-3);
+    EXPECT_LE(0.0, geopm_time_fast_since(&actual));
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "WorkerPool.hpp"
+
+#include <atomic>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "geopm_test.hpp"
+#include "geopm/Exception.hpp"
+
+using geopm::WorkerPool;
+
+TEST(WorkerPoolTest, run_all_tasks)
+{
+    WorkerPool pool(3);
+    EXPECT_EQ(3, pool.num_thread());
+    for (int num_task : {0, 1, 2, 7, 64}) {
+        std::vector<std::atomic<int> > count(num_task);
+        for (int repeat = 0; repeat < 10; ++repeat) {
+            pool.run(num_task, [&count](int task_idx) {
+                ++count[task_idx];
+            });
+        }
+        for (const auto &it : count) {
+            EXPECT_EQ(10, it.load());
+        }
+    }
+}
+
+TEST(WorkerPoolTest, no_thread)
+{
+    WorkerPool pool(0);
+    EXPECT_EQ(0, pool.num_thread());
+    int sum = 0;
+    pool.run(4, [&sum](int task_idx) {
+        sum += task_idx;
+    });
+    EXPECT_EQ(6, sum);
+}
+
+TEST(WorkerPoolTest, task_throws)
+{
+    WorkerPool pool(2);
+    std::atomic<int> count(0);
+    GEOPM_EXPECT_THROW_MESSAGE(
+        pool.run(8, [&count](int task_idx) {
+            ++count;
+            if (task_idx == 3) {
+                throw geopm::Exception("task failed", GEOPM_ERROR_RUNTIME,
+                                       __FILE__, __LINE__);
+            }
+        }),
+        GEOPM_ERROR_RUNTIME, "task failed");
+    // All tasks are run even when one of them fails
+    EXPECT_EQ(8, count.load());
+    // Pool is usable after an error
+    count = 0;
+    pool.run(8, [&count](int task_idx) {
+        ++count;
+    });
+    EXPECT_EQ(8, count.load());
+}
+
+TEST(WorkerPoolTest, invalid_num_thread)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(WorkerPool(-1), GEOPM_ERROR_INVALID,
+                               "number of threads must be non-negative");
+}
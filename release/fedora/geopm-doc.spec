@@ -108,6 +108,8 @@ cd docs
 %doc %{_mandir}/man1/geopmadmin.1.gz
 %doc %{_mandir}/man1/geopmagent.1.gz
 %doc %{_mandir}/man1/geopmctl.1.gz
+%doc %{_mandir}/man1/geopmreport.1.gz
+%doc %{_mandir}/man1/geopmtrace.1.gz
 %doc %{_mandir}/man7/geopm_agent_ffnet.7.gz
 %doc %{_mandir}/man7/geopm_agent_frequency_map.7.gz
 %doc %{_mandir}/man7/geopm_agent_monitor.7.gz